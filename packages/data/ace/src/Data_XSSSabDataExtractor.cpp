@@ -78,6 +78,45 @@ SabElasticMode XSSSabDataExtractor::getElasticScatteringMode() const
   return convertUnsignedToSabElasticMode( d_nxs[4] );
 }
 
+// Return the number of outgoing energies for every inelastic energy
+unsigned XSSSabDataExtractor::getNumberOfInelasticOutgoingEnergies() const
+{
+  return d_nxs[3];
+}
+
+// Return the number of inelastic scattering angle cosines
+/*! \details Every outgoing energy in the ITXE block is followed by 
+ * nxs[2]+1 equiprobable scattering angle cosines.
+ */
+unsigned 
+XSSSabDataExtractor::getNumberOfInelasticScatteringAngleCosines() const
+{
+  return d_nxs[2] + 1;
+}
+
+// Return the number of elastic scattering angle cosines
+/*! \details Every elastic energy in the ITCE block has nxs[5]+1 equiprobable
+ * scattering angle cosines in the ITCA block. If no elastic angular 
+ * distribution data is present, 0 will be returned.
+ */
+unsigned XSSSabDataExtractor::getNumberOfElasticScatteringAngleCosines() const
+{
+  if( hasElasticScatteringAngularDistributionData() )
+    return d_nxs[5] + 1;
+  else
+    return 0u;
+}
+
+// Return if the inelastic outgoing energies are skewed
+/*! \details When nxs[6] == 1 the outgoing energies in the ITXE block are
+ * skewed (the first two and the last two energies are less likely than the
+ * others). Otherwise the outgoing energies are equally likely.
+ */
+bool XSSSabDataExtractor::hasSkewedInelasticOutgoingEnergies() const
+{
+  return d_nxs[6] == 1;
+}
+
 // Extract the ITIE block from the XSS array
 Teuchos::ArrayView<const double> XSSSabDataExtractor::extractITIEBlock() const
 {
@@ -76,6 +76,18 @@ public:
   //! Return the elastic scattering mode
   SabElasticMode getElasticScatteringMode() const;
 
+  //! Return the number of outgoing energies for every inelastic energy
+  unsigned getNumberOfInelasticOutgoingEnergies() const;
+
+  //! Return the number of inelastic scattering angle cosines
+  unsigned getNumberOfInelasticScatteringAngleCosines() const;
+
+  //! Return the number of elastic scattering angle cosines
+  unsigned getNumberOfElasticScatteringAngleCosines() const;
+
+  //! Return if the inelastic outgoing energies are skewed
+  bool hasSkewedInelasticOutgoingEnergies() const;
+
   //! Extract the ITIE block from the XSS array
   Teuchos::ArrayView<const double> extractITIEBlock() const;
 
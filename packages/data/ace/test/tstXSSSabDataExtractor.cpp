@@ -81,6 +81,48 @@ TEUCHOS_UNIT_TEST( XSSSabDataExtractor,
 		 Data::INCOHERENT_ELASTIC_MODE );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of inelastic
+// outgoing energies
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfInelasticOutgoingEnergies_inelastic_only )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_inelastic_only->getNumberOfInelasticOutgoingEnergies(),
+	  80 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of inelastic
+// scattering angle cosines
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfInelasticScatteringAngleCosines_inelastic_only )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_inelastic_only->getNumberOfInelasticScatteringAngleCosines(),
+	  20 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of elastic
+// scattering angle cosines
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfElasticScatteringAngleCosines_inelastic_only )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_inelastic_only->getNumberOfElasticScatteringAngleCosines(),
+	  0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return if the inelastic outgoing
+// energies are skewed
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   hasSkewedInelasticOutgoingEnergies_inelastic_only )
+{
+  TEST_ASSERT( xss_data_extractor_inelastic_only->hasSkewedInelasticOutgoingEnergies() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the XSSSabDataExtractor can extract the ITIE block from the
 // XSS array
@@ -223,6 +265,48 @@ TEUCHOS_UNIT_TEST( XSSSabDataExtractor,
 		Data::COHERENT_ELASTIC_MODE );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of inelastic
+// outgoing energies
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfInelasticOutgoingEnergies_no_elastic_dist )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_no_elastic_dist->getNumberOfInelasticOutgoingEnergies(),
+	  80 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of inelastic
+// scattering angle cosines
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfInelasticScatteringAngleCosines_no_elastic_dist )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_no_elastic_dist->getNumberOfInelasticScatteringAngleCosines(),
+	  20 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of elastic
+// scattering angle cosines
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfElasticScatteringAngleCosines_no_elastic_dist )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_no_elastic_dist->getNumberOfElasticScatteringAngleCosines(),
+	  0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return if the inelastic outgoing
+// energies are skewed
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   hasSkewedInelasticOutgoingEnergies_no_elastic_dist )
+{
+  TEST_ASSERT( xss_data_extractor_no_elastic_dist->hasSkewedInelasticOutgoingEnergies() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the XSSSabDataExtractor can extract the ITIE block from the
 // XSS array
@@ -368,6 +452,48 @@ TEUCHOS_UNIT_TEST( XSSSabDataExtractor, getElasticScatteringMode_full )
 		       Data::INCOHERENT_ELASTIC_MODE );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of inelastic
+// outgoing energies
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfInelasticOutgoingEnergies_full )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_full->getNumberOfInelasticOutgoingEnergies(),
+	  80 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of inelastic
+// scattering angle cosines
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfInelasticScatteringAngleCosines_full )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_full->getNumberOfInelasticScatteringAngleCosines(),
+	  20 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of elastic
+// scattering angle cosines
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   getNumberOfElasticScatteringAngleCosines_full )
+{
+  TEST_EQUALITY_CONST( 
+	  xss_data_extractor_full->getNumberOfElasticScatteringAngleCosines(),
+	  20 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return if the inelastic outgoing
+// energies are skewed
+TEUCHOS_UNIT_TEST( XSSSabDataExtractor, 
+		   hasSkewedInelasticOutgoingEnergies_full )
+{
+  TEST_ASSERT( xss_data_extractor_full->hasSkewedInelasticOutgoingEnergies() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the XSSSabDataExtractor can extract the ITIE block from the
 // XSS array
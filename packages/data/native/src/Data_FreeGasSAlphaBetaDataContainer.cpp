@@ -0,0 +1,282 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_FreeGasSAlphaBetaDataContainer.cpp
+//! \author Luke Kersting
+//! \brief  The native free gas S(alpha,beta) data container class def.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <typeinfo>
+
+// Boost Includes
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+
+// FRENSIE Includes
+#include "Data_FreeGasSAlphaBetaDataContainer.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace Data{
+
+// Constructor (from saved archive)
+FreeGasSAlphaBetaDataContainer::FreeGasSAlphaBetaDataContainer( 
+		    const std::string& archive_name,
+		    const Utility::ArchivableObject::ArchiveType archive_type )
+{
+  // Import the data in the archive - no way to use initializer list :(
+  this->importData( archive_name, archive_type );
+}
+
+// Return the atomic weight ratio
+double FreeGasSAlphaBetaDataContainer::getAtomicWeightRatio() const
+{
+  return d_atomic_weight_ratio;
+}
+
+// Return the temperature (MeV)
+double FreeGasSAlphaBetaDataContainer::getTemperature() const
+{
+  return d_temperature;
+}
+
+// Return the incoming energy grid
+const std::vector<double>& 
+FreeGasSAlphaBetaDataContainer::getIncomingEnergyGrid() const
+{
+  return d_incoming_energy_grid;
+}
+
+// Return the beta grid for an incoming energy index
+const std::vector<double>& FreeGasSAlphaBetaDataContainer::getBetaGrid( 
+                                          const unsigned energy_index ) const
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+
+  return d_beta_grids.find( energy_index )->second;
+}
+
+// Return the beta CDF for an incoming energy index
+const std::vector<double>& FreeGasSAlphaBetaDataContainer::getBetaCDF( 
+                                          const unsigned energy_index ) const
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+
+  return d_beta_cdfs.find( energy_index )->second;
+}
+
+// Return the alpha grid offsets for an incoming energy index
+const std::vector<unsigned>& 
+FreeGasSAlphaBetaDataContainer::getAlphaGridOffsets( 
+                                          const unsigned energy_index ) const
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+
+  return d_alpha_grid_offsets.find( energy_index )->second;
+}
+
+// Return the (flattened) alpha grids for an incoming energy index
+const std::vector<double>& FreeGasSAlphaBetaDataContainer::getAlphaGrids( 
+                                          const unsigned energy_index ) const
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+
+  return d_alpha_grids.find( energy_index )->second;
+}
+
+// Return the (flattened) S(alpha,beta) values for an incoming energy index
+const std::vector<double>& 
+FreeGasSAlphaBetaDataContainer::getSAlphaBetaValues( 
+                                          const unsigned energy_index ) const
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+
+  return d_sab_values.find( energy_index )->second;
+}
+
+// Return the (flattened) alpha CDFs for an incoming energy index
+const std::vector<double>& FreeGasSAlphaBetaDataContainer::getAlphaCDFs( 
+                                          const unsigned energy_index ) const
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+
+  return d_alpha_cdfs.find( energy_index )->second;
+}
+
+// Set the atomic weight ratio
+void FreeGasSAlphaBetaDataContainer::setAtomicWeightRatio( 
+                                           const double atomic_weight_ratio )
+{
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+
+  d_atomic_weight_ratio = atomic_weight_ratio;
+}
+
+// Set the temperature (MeV)
+void FreeGasSAlphaBetaDataContainer::setTemperature( 
+                                                   const double temperature )
+{
+  // Make sure the temperature is valid
+  testPrecondition( temperature > 0.0 );
+
+  d_temperature = temperature;
+}
+
+// Set the incoming energy grid
+void FreeGasSAlphaBetaDataContainer::setIncomingEnergyGrid( 
+                                      const std::vector<double>& energy_grid )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 0 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+                                                      energy_grid.end() ) );
+  testPrecondition( energy_grid.front() > 0.0 );
+
+  d_incoming_energy_grid = energy_grid;
+}
+
+// Set the beta grid for an incoming energy index
+void FreeGasSAlphaBetaDataContainer::setBetaGrid( 
+                                        const unsigned energy_index,
+                                        const std::vector<double>& beta_grid )
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+  // Make sure the beta grid is valid
+  testPrecondition( beta_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( beta_grid.begin(),
+                                                      beta_grid.end() ) );
+
+  d_beta_grids[energy_index] = beta_grid;
+}
+
+// Set the beta CDF for an incoming energy index
+void FreeGasSAlphaBetaDataContainer::setBetaCDF( 
+                                         const unsigned energy_index,
+                                         const std::vector<double>& beta_cdf )
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+  // Make sure the beta cdf is valid
+  testPrecondition( beta_cdf.size() == 
+                    d_beta_grids.find( energy_index )->second.size() );
+  testPrecondition( Utility::Sort::isSortedAscending( beta_cdf.begin(),
+                                                      beta_cdf.end() ) );
+  testPrecondition( std::find_if( beta_cdf.begin(),
+                                  beta_cdf.end(),
+                                  isValueLessThanZero ) == beta_cdf.end() );
+  testPrecondition( std::find_if( beta_cdf.begin(),
+                                  beta_cdf.end(),
+                                  isValueGreaterThanOne ) == beta_cdf.end() );
+
+  d_beta_cdfs[energy_index] = beta_cdf;
+}
+
+// Set the alpha grid offsets for an incoming energy index
+/*! \details There must be one more offset than there are beta grid points.
+ * The last offset is the size of the flattened alpha grids.
+ */
+void FreeGasSAlphaBetaDataContainer::setAlphaGridOffsets( 
+                             const unsigned energy_index,
+                             const std::vector<unsigned>& alpha_grid_offsets )
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+  // Make sure the offsets are valid
+  testPrecondition( alpha_grid_offsets.size() == 
+                    d_beta_grids.find( energy_index )->second.size() + 1 );
+  testPrecondition( alpha_grid_offsets.front() == 0u );
+  testPrecondition( Utility::Sort::isSortedAscending( 
+                                                alpha_grid_offsets.begin(),
+                                                alpha_grid_offsets.end() ) );
+
+  d_alpha_grid_offsets[energy_index] = alpha_grid_offsets;
+}
+
+// Set the (flattened) alpha grids for an incoming energy index
+void FreeGasSAlphaBetaDataContainer::setAlphaGrids( 
+                                      const unsigned energy_index,
+                                      const std::vector<double>& alpha_grids )
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+  // Make sure the alpha grids are valid
+  testPrecondition( alpha_grids.size() == 
+                    d_alpha_grid_offsets.find( energy_index )->second.back() );
+  testPrecondition( std::find_if( alpha_grids.begin(),
+                                  alpha_grids.end(),
+                                  isValueLessThanZero ) == alpha_grids.end() );
+
+  d_alpha_grids[energy_index] = alpha_grids;
+}
+
+// Set the (flattened) S(alpha,beta) values for an incoming energy index
+void FreeGasSAlphaBetaDataContainer::setSAlphaBetaValues( 
+                                       const unsigned energy_index,
+                                       const std::vector<double>& sab_values )
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+  // Make sure the values are valid
+  testPrecondition( sab_values.size() == 
+                    d_alpha_grids.find( energy_index )->second.size() );
+  testPrecondition( std::find_if( sab_values.begin(),
+                                  sab_values.end(),
+                                  isValueLessThanZero ) == sab_values.end() );
+
+  d_sab_values[energy_index] = sab_values;
+}
+
+// Set the (flattened) alpha CDFs for an incoming energy index
+void FreeGasSAlphaBetaDataContainer::setAlphaCDFs( 
+                                       const unsigned energy_index,
+                                       const std::vector<double>& alpha_cdfs )
+{
+  // Make sure the energy index is valid
+  testPrecondition( energy_index < d_incoming_energy_grid.size() );
+  // Make sure the cdfs are valid
+  testPrecondition( alpha_cdfs.size() == 
+                    d_alpha_grids.find( energy_index )->second.size() );
+  testPrecondition( std::find_if( alpha_cdfs.begin(),
+                                  alpha_cdfs.end(),
+                                  isValueLessThanZero ) == alpha_cdfs.end() );
+  testPrecondition( std::find_if( alpha_cdfs.begin(),
+                                  alpha_cdfs.end(),
+                                  isValueGreaterThanOne ) == alpha_cdfs.end() );
+
+  d_alpha_cdfs[energy_index] = alpha_cdfs;
+}
+
+// Test if a value is less than zero
+bool FreeGasSAlphaBetaDataContainer::isValueLessThanZero( const double value )
+{
+  return value < 0.0;
+}
+
+// Test if a value is greater than one
+bool FreeGasSAlphaBetaDataContainer::isValueGreaterThanOne( 
+                                                           const double value )
+{
+  return value > 1.0;
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_FreeGasSAlphaBetaDataContainer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_FreeGasSAlphaBetaDataContainer.hpp
+//! \author Luke Kersting
+//! \brief  The native free gas S(alpha,beta) data container class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_FREE_GAS_S_ALPHA_BETA_DATA_CONTAINER_HPP
+#define DATA_FREE_GAS_S_ALPHA_BETA_DATA_CONTAINER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <map>
+#include <string>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+
+// FRENSIE Includes
+#include "Utility_StandardArchivableObject.hpp"
+#include "Utility_StandardSerializableObject.hpp"
+
+namespace Data{
+
+/*! The free gas S(alpha,beta) data container
+ * \details The tables are stored for every incoming energy on the incoming
+ * energy grid. The alpha grids (and the S(alpha,beta) values and the alpha
+ * CDFs) of every beta grid point are stored back-to-back in a single array.
+ * The alpha grid of beta grid point j is stored in the range 
+ * [alpha_grid_offsets[j], alpha_grid_offsets[j+1]). The beta CDF and the
+ * alpha CDFs allow a thermal neutron scattering distribution to sample
+ * beta and alpha directly (without rejection). Linear-linear interpolation 
+ * should be used for all data.
+ */
+class FreeGasSAlphaBetaDataContainer : public Utility::StandardArchivableObject<FreeGasSAlphaBetaDataContainer,false>, public Utility::StandardSerializableObject<FreeGasSAlphaBetaDataContainer,false>
+{
+
+public:
+
+  //! Constructor (from saved archive)
+  FreeGasSAlphaBetaDataContainer( 
+		  const std::string& archive_name,
+                  const Utility::ArchivableObject::ArchiveType archive_type =
+		  Utility::ArchivableObject::BINARY_ARCHIVE );
+
+  //! Destructor
+  virtual ~FreeGasSAlphaBetaDataContainer()
+  { /* ... */ }
+
+  //! Return the atomic weight ratio
+  double getAtomicWeightRatio() const;
+
+  //! Return the temperature (MeV)
+  double getTemperature() const;
+
+  //! Return the incoming energy grid
+  const std::vector<double>& getIncomingEnergyGrid() const;
+
+  //! Return the beta grid for an incoming energy index
+  const std::vector<double>& getBetaGrid( const unsigned energy_index ) const;
+
+  //! Return the beta CDF for an incoming energy index
+  const std::vector<double>& getBetaCDF( const unsigned energy_index ) const;
+
+  //! Return the alpha grid offsets for an incoming energy index
+  const std::vector<unsigned>& 
+  getAlphaGridOffsets( const unsigned energy_index ) const;
+
+  //! Return the (flattened) alpha grids for an incoming energy index
+  const std::vector<double>& getAlphaGrids( const unsigned energy_index ) const;
+
+  //! Return the (flattened) S(alpha,beta) values for an incoming energy index
+  const std::vector<double>& 
+  getSAlphaBetaValues( const unsigned energy_index ) const;
+
+  //! Return the (flattened) alpha CDFs for an incoming energy index
+  const std::vector<double>& getAlphaCDFs( const unsigned energy_index ) const;
+
+protected:
+
+  //! Default constructor
+  FreeGasSAlphaBetaDataContainer()
+  { /* ... */ }
+
+  //! Set the atomic weight ratio
+  void setAtomicWeightRatio( const double atomic_weight_ratio );
+
+  //! Set the temperature (MeV)
+  void setTemperature( const double temperature );
+
+  //! Set the incoming energy grid
+  void setIncomingEnergyGrid( const std::vector<double>& energy_grid );
+
+  //! Set the beta grid for an incoming energy index
+  void setBetaGrid( const unsigned energy_index,
+                    const std::vector<double>& beta_grid );
+
+  //! Set the beta CDF for an incoming energy index
+  void setBetaCDF( const unsigned energy_index,
+                   const std::vector<double>& beta_cdf );
+
+  //! Set the alpha grid offsets for an incoming energy index
+  void setAlphaGridOffsets( const unsigned energy_index,
+                            const std::vector<unsigned>& alpha_grid_offsets );
+
+  //! Set the (flattened) alpha grids for an incoming energy index
+  void setAlphaGrids( const unsigned energy_index,
+                      const std::vector<double>& alpha_grids );
+
+  //! Set the (flattened) S(alpha,beta) values for an incoming energy index
+  void setSAlphaBetaValues( const unsigned energy_index,
+                            const std::vector<double>& sab_values );
+
+  //! Set the (flattened) alpha CDFs for an incoming energy index
+  void setAlphaCDFs( const unsigned energy_index,
+                     const std::vector<double>& alpha_cdfs );
+
+private:
+
+  // Test if a value is less than zero
+  static bool isValueLessThanZero( const double value );
+
+  // Test if a value is greater than one
+  static bool isValueGreaterThanOne( const double value );
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+  
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The atomic weight ratio
+  double d_atomic_weight_ratio;
+
+  // The temperature (MeV)
+  double d_temperature;
+
+  // The incoming energy grid (MeV)
+  std::vector<double> d_incoming_energy_grid;
+
+  // The beta grids
+  std::map<unsigned,std::vector<double> > d_beta_grids;
+
+  // The beta CDFs
+  std::map<unsigned,std::vector<double> > d_beta_cdfs;
+
+  // The alpha grid offsets
+  std::map<unsigned,std::vector<unsigned> > d_alpha_grid_offsets;
+
+  // The flattened alpha grids
+  std::map<unsigned,std::vector<double> > d_alpha_grids;
+
+  // The flattened S(alpha,beta) values
+  std::map<unsigned,std::vector<double> > d_sab_values;
+
+  // The flattened alpha CDFs
+  std::map<unsigned,std::vector<double> > d_alpha_cdfs;
+};
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Data_FreeGasSAlphaBetaDataContainer_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end DATA_FREE_GAS_S_ALPHA_BETA_DATA_CONTAINER_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_FreeGasSAlphaBetaDataContainer.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_FreeGasSAlphaBetaDataContainer_def.hpp
+//! \author Luke Kersting
+//! \brief  The native free gas S(alpha,beta) data container template defs.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_FREE_GAS_S_ALPHA_BETA_DATA_CONTAINER_DEF_HPP
+#define DATA_FREE_GAS_S_ALPHA_BETA_DATA_CONTAINER_DEF_HPP
+
+// Boost Includes
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/nvp.hpp>
+
+namespace Data{
+
+// Save the data to an archive
+template<typename Archive>
+void FreeGasSAlphaBetaDataContainer::save( Archive& ar, 
+                                           const unsigned version) const
+{
+  ar & boost::serialization::make_nvp( "atomic_weight_ratio",
+                                       d_atomic_weight_ratio );
+  ar & boost::serialization::make_nvp( "temperature", d_temperature );
+  ar & boost::serialization::make_nvp( "incoming_energy_grid",
+                                       d_incoming_energy_grid );
+  ar & boost::serialization::make_nvp( "beta_grids", d_beta_grids );
+  ar & boost::serialization::make_nvp( "beta_cdfs", d_beta_cdfs );
+  ar & boost::serialization::make_nvp( "alpha_grid_offsets",
+                                       d_alpha_grid_offsets );
+  ar & boost::serialization::make_nvp( "alpha_grids", d_alpha_grids );
+  ar & boost::serialization::make_nvp( "sab_values", d_sab_values );
+  ar & boost::serialization::make_nvp( "alpha_cdfs", d_alpha_cdfs );
+}
+  
+// Load the data from an archive
+template<typename Archive>
+void FreeGasSAlphaBetaDataContainer::load( Archive& ar, 
+                                           const unsigned version )
+{
+  ar & boost::serialization::make_nvp( "atomic_weight_ratio",
+                                       d_atomic_weight_ratio );
+  ar & boost::serialization::make_nvp( "temperature", d_temperature );
+  ar & boost::serialization::make_nvp( "incoming_energy_grid",
+                                       d_incoming_energy_grid );
+  ar & boost::serialization::make_nvp( "beta_grids", d_beta_grids );
+  ar & boost::serialization::make_nvp( "beta_cdfs", d_beta_cdfs );
+  ar & boost::serialization::make_nvp( "alpha_grid_offsets",
+                                       d_alpha_grid_offsets );
+  ar & boost::serialization::make_nvp( "alpha_grids", d_alpha_grids );
+  ar & boost::serialization::make_nvp( "sab_values", d_sab_values );
+  ar & boost::serialization::make_nvp( "alpha_cdfs", d_alpha_cdfs );
+}
+
+} // end Data namespace
+
+#endif // end DATA_FREE_GAS_S_ALPHA_BETA_DATA_CONTAINER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_FreeGasSAlphaBetaDataContainer_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,30 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_FreeGasSAlphaBetaVolatileDataContainer.cpp
+//! \author Luke Kersting
+//! \brief  The native free gas S(alpha,beta) volatile data container
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Data_FreeGasSAlphaBetaVolatileDataContainer.hpp"
+
+namespace Data{
+
+// Default constructor
+FreeGasSAlphaBetaVolatileDataContainer::FreeGasSAlphaBetaVolatileDataContainer()
+  : FreeGasSAlphaBetaDataContainer()
+{ /* ... */ }
+
+// Constructor (from saved archive)
+FreeGasSAlphaBetaVolatileDataContainer::FreeGasSAlphaBetaVolatileDataContainer(
+		    const std::string& archive_name,
+		    const Utility::ArchivableObject::ArchiveType archive_type )
+  : FreeGasSAlphaBetaDataContainer( archive_name, archive_type )
+{ /* ... */ }
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_FreeGasSAlphaBetaVolatileDataContainer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,55 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_FreeGasSAlphaBetaVolatileDataContainer.hpp
+//! \author Luke Kersting
+//! \brief  The native free gas S(alpha,beta) volatile data container class
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_FREE_GAS_S_ALPHA_BETA_VOLATILE_DATA_CONTAINER_HPP
+#define DATA_FREE_GAS_S_ALPHA_BETA_VOLATILE_DATA_CONTAINER_HPP
+
+// FRENSIE Includes
+#include "Data_FreeGasSAlphaBetaDataContainer.hpp"
+
+namespace Data{
+
+//! The free gas S(alpha,beta) volatile data container
+class FreeGasSAlphaBetaVolatileDataContainer : public FreeGasSAlphaBetaDataContainer
+{
+
+public:
+
+  //! Default constructor
+  FreeGasSAlphaBetaVolatileDataContainer();
+
+  //! Constructor (from saved archive)
+  FreeGasSAlphaBetaVolatileDataContainer(
+		   const std::string& archive_name,
+		   const Utility::ArchivableObject::ArchiveType archive_type );
+
+  // Add the setter member functions to the public interface
+  using FreeGasSAlphaBetaDataContainer::setAtomicWeightRatio;
+  using FreeGasSAlphaBetaDataContainer::setTemperature;
+  using FreeGasSAlphaBetaDataContainer::setIncomingEnergyGrid;
+  using FreeGasSAlphaBetaDataContainer::setBetaGrid;
+  using FreeGasSAlphaBetaDataContainer::setBetaCDF;
+  using FreeGasSAlphaBetaDataContainer::setAlphaGridOffsets;
+  using FreeGasSAlphaBetaDataContainer::setAlphaGrids;
+  using FreeGasSAlphaBetaDataContainer::setSAlphaBetaValues;
+  using FreeGasSAlphaBetaDataContainer::setAlphaCDFs;
+
+  // Add the export member function to the public interface
+  using FreeGasSAlphaBetaDataContainer::exportData;
+
+  // Add the packDataInString member function to the public interface
+  using FreeGasSAlphaBetaDataContainer::packDataInString;
+};
+
+} // end Data namespace
+
+#endif // end DATA_FREE_GAS_S_ALPHA_BETA_VOLATILE_DATA_CONTAINER_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_FreeGasSAlphaBetaVolatileDataContainer.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,214 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFreeGasSAlphaBetaDataContainer.cpp
+//! \author Luke Kersting
+//! \brief  Free gas S(alpha,beta) data container class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_VerboseObject.hpp>
+
+// FRENSIE Includes
+#include "Data_FreeGasSAlphaBetaVolatileDataContainer.hpp"
+#include "Data_FreeGasSAlphaBetaDataContainer.hpp"
+#include "Utility_UnitTestHarnessExtensions.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+Data::FreeGasSAlphaBetaVolatileDataContainer sab_data_container;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the atomic weight ratio can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setAtomicWeightRatio )
+{
+  sab_data_container.setAtomicWeightRatio( 0.999167 );
+
+  TEST_EQUALITY_CONST( sab_data_container.getAtomicWeightRatio(), 0.999167 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the temperature can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setTemperature )
+{
+  sab_data_container.setTemperature( 2.5301e-8 );
+
+  TEST_EQUALITY_CONST( sab_data_container.getTemperature(), 2.5301e-8 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the incoming energy grid can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setIncomingEnergyGrid )
+{
+  std::vector<double> energy_grid( 2 );
+  energy_grid[0] = 1e-11;
+  energy_grid[1] = 2.5e-8;
+
+  sab_data_container.setIncomingEnergyGrid( energy_grid );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getIncomingEnergyGrid(),
+                       energy_grid );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the beta grid can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setBetaGrid )
+{
+  std::vector<double> beta_grid( 3 );
+  beta_grid[0] = -1.0;
+  beta_grid[1] = 0.0;
+  beta_grid[2] = 1.0;
+
+  sab_data_container.setBetaGrid( 0, beta_grid );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getBetaGrid( 0 ), beta_grid );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the beta CDF can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setBetaCDF )
+{
+  std::vector<double> beta_cdf( 3 );
+  beta_cdf[0] = 0.0;
+  beta_cdf[1] = 0.6;
+  beta_cdf[2] = 1.0;
+
+  sab_data_container.setBetaCDF( 0, beta_cdf );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getBetaCDF( 0 ), beta_cdf );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the alpha grid offsets can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setAlphaGridOffsets )
+{
+  std::vector<unsigned> offsets( 4 );
+  offsets[0] = 0u;
+  offsets[1] = 2u;
+  offsets[2] = 5u;
+  offsets[3] = 7u;
+
+  sab_data_container.setAlphaGridOffsets( 0, offsets );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getAlphaGridOffsets( 0 ), offsets );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the alpha grids can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setAlphaGrids )
+{
+  std::vector<double> alpha_grids( 7 );
+  alpha_grids[0] = 1.0;
+  alpha_grids[1] = 2.0;
+  alpha_grids[2] = 1e-6;
+  alpha_grids[3] = 1.0;
+  alpha_grids[4] = 4.0;
+  alpha_grids[5] = 1.0;
+  alpha_grids[6] = 3.0;
+
+  sab_data_container.setAlphaGrids( 0, alpha_grids );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getAlphaGrids( 0 ), alpha_grids );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the S(alpha,beta) values can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setSAlphaBetaValues )
+{
+  std::vector<double> sab_values( 7 );
+  sab_values[0] = 0.1;
+  sab_values[1] = 0.2;
+  sab_values[2] = 10.0;
+  sab_values[3] = 1.0;
+  sab_values[4] = 0.1;
+  sab_values[5] = 0.3;
+  sab_values[6] = 0.1;
+
+  sab_data_container.setSAlphaBetaValues( 0, sab_values );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getSAlphaBetaValues( 0 ),
+                       sab_values );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the alpha CDFs can be set
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, setAlphaCDFs )
+{
+  std::vector<double> alpha_cdfs( 7 );
+  alpha_cdfs[0] = 0.0;
+  alpha_cdfs[1] = 1.0;
+  alpha_cdfs[2] = 0.0;
+  alpha_cdfs[3] = 0.8;
+  alpha_cdfs[4] = 1.0;
+  alpha_cdfs[5] = 0.0;
+  alpha_cdfs[6] = 1.0;
+
+  sab_data_container.setAlphaCDFs( 0, alpha_cdfs );
+
+  TEST_COMPARE_ARRAYS( sab_data_container.getAlphaCDFs( 0 ), alpha_cdfs );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the data can be exported and imported
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, export_importData_binary )
+{
+  const std::string test_binary_file_name( "test_fgsab_data_container.bin" );
+
+  sab_data_container.exportData( test_binary_file_name,
+                                 Utility::ArchivableObject::BINARY_ARCHIVE );
+
+  const Data::FreeGasSAlphaBetaDataContainer
+    sab_data_container_copy( test_binary_file_name,
+                             Utility::ArchivableObject::BINARY_ARCHIVE );
+
+  TEST_EQUALITY_CONST( sab_data_container_copy.getAtomicWeightRatio(),
+                       0.999167 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getTemperature(), 2.5301e-8 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getIncomingEnergyGrid().size(),
+                       2 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getBetaGrid( 0 ).size(), 3 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getBetaCDF( 0 ).size(), 3 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getAlphaGridOffsets( 0 ).size(),
+                       4 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getAlphaGrids( 0 ).size(), 7 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getSAlphaBetaValues( 0 ).size(),
+                       7 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getAlphaCDFs( 0 ).size(), 7 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the data can be exported and imported
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataContainer, export_importData_xml )
+{
+  const std::string test_xml_file_name( "test_fgsab_data_container.xml" );
+
+  sab_data_container.exportData( test_xml_file_name,
+                                 Utility::ArchivableObject::XML_ARCHIVE );
+
+  const Data::FreeGasSAlphaBetaDataContainer
+    sab_data_container_copy( test_xml_file_name,
+                             Utility::ArchivableObject::XML_ARCHIVE );
+
+  TEST_EQUALITY_CONST( sab_data_container_copy.getAtomicWeightRatio(),
+                       0.999167 );
+  TEST_EQUALITY_CONST( sab_data_container_copy.getTemperature(), 2.5301e-8 );
+  TEST_COMPARE_ARRAYS( sab_data_container_copy.getBetaGrid( 0 ),
+                       sab_data_container.getBetaGrid( 0 ) );
+  TEST_COMPARE_ARRAYS( sab_data_container_copy.getAlphaGridOffsets( 0 ),
+                       sab_data_container.getAlphaGridOffsets( 0 ) );
+  TEST_COMPARE_ARRAYS( sab_data_container_copy.getAlphaCDFs( 0 ),
+                       sab_data_container.getAlphaCDFs( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFreeGasSAlphaBetaDataContainer.cpp
+//---------------------------------------------------------------------------//
@@ -226,9 +226,12 @@ double FreeGasElasticSAlphaBetaFunction::operator()( const double alpha,
       }
       catch( Utility::IntegratorException& integration_exception )
       {
-	std::cerr << "Warning: difficulty computing S("
-		  << alpha << "," << beta << "," << E
-		  << ") using approximate form." << std::endl;
+	#pragma omp critical( sab_approximate_form_warning_message )
+	{
+	  std::cerr << "Warning: difficulty computing S("
+		    << alpha << "," << beta << "," << E
+		    << ") using approximate form." << std::endl;
+	}
 	
 	// Approximate S(alpha,beta) function
 	value = d_average_zero_temp_elastic_cross_section/
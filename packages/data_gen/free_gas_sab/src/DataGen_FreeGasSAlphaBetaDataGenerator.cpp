@@ -0,0 +1,377 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   DataGen_FreeGasSAlphaBetaDataGenerator.cpp
+//! \author Luke Kersting
+//! \brief  The free gas S(alpha,beta) data generator class def.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <limits>
+
+// Boost Includes
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+
+// FRENSIE Includes
+#include "DataGen_FreeGasSAlphaBetaDataGenerator.hpp"
+#include "Utility_GridGenerator.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+#include "Utility_KinematicHelpers.hpp"
+#include "Utility_ComparePolicy.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace DataGen{
+
+// Initialize static member data
+const double FreeGasSAlphaBetaDataGenerator::s_min_alpha_fraction = 1e-8;
+
+// Constructor
+FreeGasSAlphaBetaDataGenerator::FreeGasSAlphaBetaDataGenerator(
+	  const Teuchos::RCP<Utility::OneDDistribution>& 
+	  zero_temp_elastic_cross_section,
+          const Teuchos::RCP<MonteCarlo::NuclearScatteringAngularDistribution>&
+	  cm_scattering_distribution,
+	  const double A,
+	  const double kT,
+          const double beta_max,
+          const double convergence_tol,
+          const double absolute_diff_tol,
+          const double distance_tol )
+  : d_sab_function( zero_temp_elastic_cross_section,
+                    cm_scattering_distribution,
+                    A,
+                    kT ),
+    d_A( A ),
+    d_kT( kT ),
+    d_beta_max( beta_max ),
+    d_convergence_tol( convergence_tol ),
+    d_absolute_diff_tol( absolute_diff_tol ),
+    d_distance_tol( distance_tol )
+{
+  // Make sure the max beta is valid
+  testPrecondition( beta_max > 0.0 );
+  // Make sure the tolerances are valid
+  testPrecondition( convergence_tol > 0.0 );
+  testPrecondition( convergence_tol <= 1.0 );
+  testPrecondition( absolute_diff_tol >= 0.0 );
+  testPrecondition( distance_tol >= 0.0 );
+}
+
+// Populate the free gas S(alpha,beta) data container
+/*! \details For every incoming energy the beta grid is refined until the
+ * S(alpha,beta) function integrated over alpha can be interpolated 
+ * (lin-lin) to within the convergence tolerance. The alpha grid of every beta
+ * grid point is refined in the same way using the S(alpha,beta) function. 
+ * The alpha grids of all beta grid points that are added on a refinement 
+ * pass are generated in parallel.
+ */
+void FreeGasSAlphaBetaDataGenerator::populateDataContainer( 
+                  const std::vector<double>& incoming_energy_grid,
+                  Data::FreeGasSAlphaBetaVolatileDataContainer& data_container,
+                  const bool verbose ) const
+{
+  data_container.setAtomicWeightRatio( d_A );
+  data_container.setTemperature( d_kT );
+  data_container.setIncomingEnergyGrid( incoming_energy_grid );
+
+  for( unsigned i = 0; i < incoming_energy_grid.size(); ++i )
+  {
+    if( verbose )
+    {
+      std::cout << "Generating S(alpha,beta) table at E = " 
+                << incoming_energy_grid[i] << " MeV...";
+      std::cout.flush();
+    }
+
+    std::vector<BetaTable> beta_tables;
+
+    this->generateBetaTables( incoming_energy_grid[i], beta_tables );
+
+    std::vector<double> beta_grid( beta_tables.size() );
+    std::vector<double> marginal_values( beta_tables.size() );
+    std::vector<unsigned> alpha_grid_offsets( beta_tables.size()+1 );
+
+    alpha_grid_offsets[0] = 0u;
+
+    for( unsigned j = 0; j < beta_tables.size(); ++j )
+    {
+      beta_grid[j] = beta_tables[j].beta;
+      marginal_values[j] = beta_tables[j].marginal_value;
+
+      alpha_grid_offsets[j+1] = 
+        alpha_grid_offsets[j] + beta_tables[j].alpha_grid.size();
+    }
+
+    std::vector<double> beta_cdf;
+
+    this->calculateCDF( beta_grid, marginal_values, beta_cdf );
+
+    // Flatten the alpha tables
+    std::vector<double> alpha_grids, sab_values, alpha_cdfs;
+
+    alpha_grids.reserve( alpha_grid_offsets.back() );
+    sab_values.reserve( alpha_grid_offsets.back() );
+    alpha_cdfs.reserve( alpha_grid_offsets.back() );
+
+    for( unsigned j = 0; j < beta_tables.size(); ++j )
+    {
+      std::vector<double> alpha_cdf;
+      
+      this->calculateCDF( beta_tables[j].alpha_grid,
+                          beta_tables[j].sab_values,
+                          alpha_cdf );
+
+      alpha_grids.insert( alpha_grids.end(),
+                          beta_tables[j].alpha_grid.begin(),
+                          beta_tables[j].alpha_grid.end() );
+
+      sab_values.insert( sab_values.end(),
+                         beta_tables[j].sab_values.begin(),
+                         beta_tables[j].sab_values.end() );
+
+      alpha_cdfs.insert( alpha_cdfs.end(), alpha_cdf.begin(), alpha_cdf.end() );
+    }
+
+    data_container.setBetaGrid( i, beta_grid );
+    data_container.setBetaCDF( i, beta_cdf );
+    data_container.setAlphaGridOffsets( i, alpha_grid_offsets );
+    data_container.setAlphaGrids( i, alpha_grids );
+    data_container.setSAlphaBetaValues( i, sab_values );
+    data_container.setAlphaCDFs( i, alpha_cdfs );
+
+    if( verbose )
+    {
+      std::cout << "done (" << beta_grid.size() << " beta points, "
+                << alpha_grids.size() << " alpha points)" << std::endl;
+    }
+  }
+}
+
+// Generate the beta tables for an incoming energy
+/*! \details The beta grid always contains the min beta (no outgoing energy),
+ * zero (no energy transfer) and the max beta. The midpoint of every 
+ * unconverged interval is evaluated on each refinement pass. These 
+ * evaluations are independent, so they are distributed over the requested
+ * number of threads.
+ */
+void FreeGasSAlphaBetaDataGenerator::generateBetaTables( 
+                                  const double energy,
+                                  std::vector<BetaTable>& beta_tables ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  double beta_min = Utility::calculateBetaMin( energy, d_kT );
+
+  // Set up the initial beta grid
+  beta_tables.clear();
+  beta_tables.resize( 3 );
+
+  beta_tables[0].beta = beta_min;
+  beta_tables[1].beta = 0.0;
+  beta_tables[2].beta = d_beta_max;
+
+  #pragma omp parallel for num_threads( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
+  for( int j = 0; j < (int)beta_tables.size(); ++j )
+    this->generateBetaTable( energy, beta_tables[j] );
+
+  std::vector<bool> interval_converged( beta_tables.size()-1, false );
+
+  while( true )
+  {
+    // Find the midpoints of the unconverged intervals
+    std::vector<BetaTable> mid_beta_tables;
+    std::vector<unsigned> mid_beta_intervals;
+    
+    for( unsigned j = 0; j < interval_converged.size(); ++j )
+    {
+      if( !interval_converged[j] )
+      {
+        mid_beta_tables.push_back( BetaTable() );
+        mid_beta_tables.back().beta = 
+          0.5*(beta_tables[j].beta + beta_tables[j+1].beta);
+        
+        mid_beta_intervals.push_back( j );
+      }
+    }
+
+    if( mid_beta_tables.size() == 0 )
+      break;
+
+    // Generate the midpoint tables in parallel
+    #pragma omp parallel for schedule( dynamic ) num_threads( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
+    for( int k = 0; k < (int)mid_beta_tables.size(); ++k )
+      this->generateBetaTable( energy, mid_beta_tables[k] );
+
+    // Merge the midpoint tables that are required into the beta tables
+    std::vector<BetaTable> refined_beta_tables;
+    std::vector<bool> refined_interval_converged;
+
+    refined_beta_tables.reserve( beta_tables.size()+mid_beta_tables.size() );
+    refined_interval_converged.reserve( refined_beta_tables.capacity() );
+
+    unsigned k = 0;
+
+    for( unsigned j = 0; j < interval_converged.size(); ++j )
+    {
+      refined_beta_tables.push_back( beta_tables[j] );
+
+      if( k < mid_beta_intervals.size() && mid_beta_intervals[k] == j )
+      {
+        if( this->isBetaIntervalConverged( beta_tables[j],
+                                           mid_beta_tables[k],
+                                           beta_tables[j+1] ) )
+        {
+          refined_interval_converged.push_back( true );
+        }
+        else
+        {
+          refined_beta_tables.push_back( mid_beta_tables[k] );
+          refined_interval_converged.push_back( false );
+          refined_interval_converged.push_back( false );
+        }
+
+        ++k;
+      }
+      else
+        refined_interval_converged.push_back( true );
+    }
+
+    refined_beta_tables.push_back( beta_tables.back() );
+
+    beta_tables.swap( refined_beta_tables );
+    interval_converged.swap( refined_interval_converged );
+  }
+}
+
+// Generate the alpha grid (and S(alpha,beta) values) for a beta value
+void FreeGasSAlphaBetaDataGenerator::generateBetaTable( 
+                                                const double energy,
+                                                BetaTable& beta_table ) const
+{
+  double alpha_min = 
+    Utility::calculateAlphaMin( energy, beta_table.beta, d_A, d_kT );
+  double alpha_max = 
+    Utility::calculateAlphaMax( energy, beta_table.beta, d_A, d_kT );
+
+  // S(alpha,beta) has an integrable singularity at alpha = 0
+  if( alpha_min <= 0.0 )
+    alpha_min = s_min_alpha_fraction*alpha_max;
+
+  beta_table.alpha_grid.clear();
+  beta_table.sab_values.clear();
+
+  // The alpha range collapses to a point at the min beta
+  if( Utility::Policy::relError( alpha_min, alpha_max ) <= d_distance_tol )
+  {
+    beta_table.alpha_grid.resize( 2, alpha_min );
+    beta_table.alpha_grid[1] = alpha_max;
+    beta_table.sab_values.resize( 2, 0.0 );
+  }
+  else
+  {
+    boost::function<double (double alpha)> sab_function_wrapper = 
+      boost::bind<double>( boost::cref( d_sab_function ), 
+                           _1, 
+                           beta_table.beta, 
+                           energy );
+
+    std::vector<double> initial_alpha_grid( 2 );
+    initial_alpha_grid[0] = alpha_min;
+    initial_alpha_grid[1] = alpha_max;
+
+    Utility::GridGenerator<Utility::LinLin> 
+      alpha_grid_generator( d_convergence_tol,
+                            d_absolute_diff_tol,
+                            d_distance_tol );
+
+    alpha_grid_generator.generateAndEvaluate( beta_table.alpha_grid,
+                                              beta_table.sab_values,
+                                              initial_alpha_grid,
+                                              sab_function_wrapper );
+  }
+
+  std::vector<double> alpha_cdf;
+
+  beta_table.marginal_value = this->calculateCDF( beta_table.alpha_grid,
+                                                  beta_table.sab_values,
+                                                  alpha_cdf );
+}
+
+// Calculate the CDF of lin-lin tabulated data (returns the integral)
+/*! \details If the integral of the data is zero the CDF will be linear
+ * in the grid.
+ */
+double FreeGasSAlphaBetaDataGenerator::calculateCDF( 
+                                           const std::vector<double>& grid,
+                                           const std::vector<double>& values,
+                                           std::vector<double>& cdf )
+{
+  // Make sure the data is valid
+  testPrecondition( grid.size() > 1 );
+  testPrecondition( grid.size() == values.size() );
+
+  cdf.resize( grid.size() );
+  cdf[0] = 0.0;
+
+  for( unsigned i = 1; i < grid.size(); ++i )
+  {
+    cdf[i] = cdf[i-1] + 
+      0.5*(grid[i] - grid[i-1])*(values[i] + values[i-1]);
+  }
+
+  double integral = cdf.back();
+
+  if( integral > 0.0 )
+  {
+    for( unsigned i = 1; i < cdf.size(); ++i )
+      cdf[i] /= integral;
+  }
+  else
+  {
+    for( unsigned i = 1; i < cdf.size(); ++i )
+      cdf[i] = ((double)i)/(cdf.size()-1);
+  }
+
+  // Make sure round-off does not push the last value above one
+  cdf.back() = 1.0;
+
+  return integral;
+}
+
+// Check if the midpoint beta table shows that an interval is converged
+bool FreeGasSAlphaBetaDataGenerator::isBetaIntervalConverged( 
+                                      const BetaTable& lower_beta_table,
+                                      const BetaTable& mid_beta_table,
+                                      const BetaTable& upper_beta_table ) const
+{
+  double estimated_mid_value = 0.5*(lower_beta_table.marginal_value + 
+                                    upper_beta_table.marginal_value);
+
+  double relative_error = 
+    Utility::Policy::relError( mid_beta_table.marginal_value,
+                               estimated_mid_value );
+
+  double abs_diff = 
+    fabs( mid_beta_table.marginal_value - estimated_mid_value );
+
+  double distance = upper_beta_table.beta - lower_beta_table.beta;
+
+  if( relative_error <= d_convergence_tol )
+    return true;
+  else if( abs_diff <= d_absolute_diff_tol )
+    return true;
+  else if( distance <= d_distance_tol*fabs( upper_beta_table.beta ) )
+    return true;
+  else
+    return false;
+}
+
+} // end DataGen namespace
+
+//---------------------------------------------------------------------------//
+// end DataGen_FreeGasSAlphaBetaDataGenerator.cpp
+//---------------------------------------------------------------------------//
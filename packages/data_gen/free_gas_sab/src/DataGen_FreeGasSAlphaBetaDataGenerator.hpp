@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   DataGen_FreeGasSAlphaBetaDataGenerator.hpp
+//! \author Luke Kersting
+//! \brief  The free gas S(alpha,beta) data generator class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_GEN_FREE_GAS_S_ALPHA_BETA_DATA_GENERATOR_HPP
+#define DATA_GEN_FREE_GAS_S_ALPHA_BETA_DATA_GENERATOR_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+
+// FRENSIE Includes
+#include "DataGen_FreeGasElasticSAlphaBetaFunction.hpp"
+#include "Data_FreeGasSAlphaBetaVolatileDataContainer.hpp"
+#include "MonteCarlo_NuclearScatteringAngularDistribution.hpp"
+#include "Utility_OneDDistribution.hpp"
+
+namespace DataGen{
+
+//! The free gas S(alpha,beta) data generator
+class FreeGasSAlphaBetaDataGenerator
+{
+
+public:
+
+  //! Constructor
+  FreeGasSAlphaBetaDataGenerator(
+	  const Teuchos::RCP<Utility::OneDDistribution>& 
+	  zero_temp_elastic_cross_section,
+          const Teuchos::RCP<MonteCarlo::NuclearScatteringAngularDistribution>&
+	  cm_scattering_distribution,
+	  const double A,
+	  const double kT,
+          const double beta_max = 20.0,
+          const double convergence_tol = 0.001,
+          const double absolute_diff_tol = 1e-12,
+          const double distance_tol = 1e-14 );
+
+  //! Destructor
+  ~FreeGasSAlphaBetaDataGenerator()
+  { /* ... */ }
+
+  //! Populate the free gas S(alpha,beta) data container
+  void populateDataContainer( 
+                  const std::vector<double>& incoming_energy_grid,
+                  Data::FreeGasSAlphaBetaVolatileDataContainer& data_container,
+                  const bool verbose = false ) const;
+
+protected:
+
+  //! The tabulated S(alpha,beta) data at a single beta value
+  struct BetaTable
+  {
+    //! The beta value
+    double beta;
+
+    //! The alpha grid
+    std::vector<double> alpha_grid;
+
+    //! The S(alpha,beta) values on the alpha grid
+    std::vector<double> sab_values;
+
+    //! The S(alpha,beta) values integrated over alpha
+    double marginal_value;
+  };
+
+  //! Generate the beta tables for an incoming energy
+  void generateBetaTables( const double energy,
+                           std::vector<BetaTable>& beta_tables ) const;
+
+  //! Generate the alpha grid (and S(alpha,beta) values) for a beta value
+  void generateBetaTable( const double energy, BetaTable& beta_table ) const;
+
+  //! Calculate the CDF of lin-lin tabulated data (returns the integral)
+  static double calculateCDF( const std::vector<double>& grid,
+                              const std::vector<double>& values,
+                              std::vector<double>& cdf );
+
+private:
+
+  // Check if the midpoint beta table shows that an interval is converged
+  bool isBetaIntervalConverged( const BetaTable& lower_beta_table,
+                                const BetaTable& mid_beta_table,
+                                const BetaTable& upper_beta_table ) const;
+
+  // The fraction of the max alpha used when the min alpha is zero
+  static const double s_min_alpha_fraction;
+
+  // The S(alpha,beta) function
+  FreeGasElasticSAlphaBetaFunction d_sab_function;
+
+  // The atomic weight ratio
+  double d_A;
+
+  // The temperature (MeV)
+  double d_kT;
+
+  // The max beta value
+  double d_beta_max;
+
+  // The convergence tolerance
+  double d_convergence_tol;
+
+  // The absolute difference tolerance
+  double d_absolute_diff_tol;
+
+  // The distance tolerance
+  double d_distance_tol;
+};
+
+} // end DataGen namespace
+
+#endif // end DATA_GEN_FREE_GAS_S_ALPHA_BETA_DATA_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end DataGen_FreeGasSAlphaBetaDataGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFreeGasSAlphaBetaDataGenerator.cpp
+//! \author Luke Kersting
+//! \brief  Free gas S(alpha,beta) data generator unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_VerboseObject.hpp>
+#include <Teuchos_RCP.hpp>
+
+// FRENSIE Includes
+#include "DataGen_FreeGasSAlphaBetaDataGenerator.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_KinematicHelpers.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+Teuchos::RCP<DataGen::FreeGasSAlphaBetaDataGenerator> sab_generator;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the data container can be populated
+TEUCHOS_UNIT_TEST( FreeGasSAlphaBetaDataGenerator, populateDataContainer )
+{
+  std::vector<double> energy_grid( 1, 2.5e-8 );
+
+  Data::FreeGasSAlphaBetaVolatileDataContainer data_container;
+
+  sab_generator->populateDataContainer( energy_grid, data_container );
+
+  TEST_EQUALITY_CONST( data_container.getAtomicWeightRatio(), 0.999167 );
+  TEST_EQUALITY_CONST( data_container.getTemperature(), 2.53010e-8 );
+  TEST_COMPARE_ARRAYS( data_container.getIncomingEnergyGrid(), energy_grid );
+
+  const std::vector<double>& beta_grid = data_container.getBetaGrid( 0 );
+
+  TEST_FLOATING_EQUALITY( beta_grid.front(), 
+                          Utility::calculateBetaMin( 2.5e-8, 2.53010e-8 ),
+                          1e-15 );
+  TEST_EQUALITY_CONST( beta_grid.back(), 20.0 );
+  TEST_ASSERT( beta_grid.size() > 3 );
+
+  const std::vector<double>& beta_cdf = data_container.getBetaCDF( 0 );
+
+  TEST_EQUALITY( beta_cdf.size(), beta_grid.size() );
+  TEST_EQUALITY_CONST( beta_cdf.front(), 0.0 );
+  TEST_EQUALITY_CONST( beta_cdf.back(), 1.0 );
+
+  const std::vector<unsigned>& offsets = 
+    data_container.getAlphaGridOffsets( 0 );
+
+  TEST_EQUALITY( offsets.size(), beta_grid.size()+1 );
+  TEST_EQUALITY( offsets.back(), data_container.getAlphaGrids( 0 ).size() );
+  TEST_EQUALITY( offsets.back(), 
+                 data_container.getSAlphaBetaValues( 0 ).size() );
+  TEST_EQUALITY( offsets.back(), data_container.getAlphaCDFs( 0 ).size() );
+
+  const std::vector<double>& alpha_grids = data_container.getAlphaGrids( 0 );
+  const std::vector<double>& alpha_cdfs = data_container.getAlphaCDFs( 0 );
+
+  // Check the alpha grid limits of the last beta grid point
+  unsigned last_beta = beta_grid.size()-1;
+  
+  TEST_FLOATING_EQUALITY( alpha_grids[offsets[last_beta]],
+                          Utility::calculateAlphaMin( 2.5e-8, 
+                                                      20.0,
+                                                      0.999167,
+                                                      2.53010e-8 ),
+                          1e-12 );
+  TEST_FLOATING_EQUALITY( alpha_grids[offsets[last_beta+1]-1],
+                          Utility::calculateAlphaMax( 2.5e-8, 
+                                                      20.0,
+                                                      0.999167,
+                                                      2.53010e-8 ),
+                          1e-12 );
+
+  // Every alpha CDF must start at zero and end at one
+  for( unsigned j = 0; j < beta_grid.size(); ++j )
+  {
+    TEST_EQUALITY_CONST( alpha_cdfs[offsets[j]], 0.0 );
+    TEST_EQUALITY_CONST( alpha_cdfs[offsets[j+1]-1], 1.0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  int threads = 1;
+  
+  Teuchos::CommandLineProcessor& clp = Teuchos::UnitTestRepository::getCLP();
+
+  clp.setOption( "threads",
+                 &threads,
+                 "Number of threads to use" );
+
+  const Teuchos::RCP<Teuchos::FancyOStream> out = 
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = 
+    clp.parse(argc,argv);
+
+  if ( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL ) {
+    *out << "\nEnd Result: TEST FAILED" << std::endl;
+    return parse_return;
+  }
+
+  // Set up the global OpenMP session
+  if( Utility::GlobalOpenMPSession::isOpenMPUsed() )
+    Utility::GlobalOpenMPSession::setNumberOfThreads( threads );
+
+  // Initialize the zero temperature cross section
+  Teuchos::RCP<Utility::OneDDistribution> cross_section(
+			  new Utility::UniformDistribution( 0.0, 20.0, 1.0 ) );
+
+  // Initialize the scattering probability distribution
+  Teuchos::RCP<Utility::TabularOneDDistribution> isotropic_distribution(
+			  new Utility::UniformDistribution( -1.0, 1.0, 0.5 ) );
+
+  // Initialize the scattering distribution
+  MonteCarlo::NuclearScatteringAngularDistribution::AngularDistribution
+    distribution( 2 );
+
+  distribution[0].first = 0.0;
+  distribution[0].second = isotropic_distribution;
+  
+  distribution[1].first = 20.0;
+  distribution[1].second = isotropic_distribution;
+
+  Teuchos::RCP<MonteCarlo::NuclearScatteringAngularDistribution> 
+    scattering_distribution( 
+			 new MonteCarlo::NuclearScatteringAngularDistribution(
+							      distribution ) );
+
+  // Initialize the S(alpha,beta) data generator
+  sab_generator.reset( new DataGen::FreeGasSAlphaBetaDataGenerator(
+						    cross_section, 
+						    scattering_distribution,
+						    0.999167,
+						    2.53010e-8,
+                                                    20.0,
+                                                    0.01 ) );
+
+  // Run the unit tests
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  const bool success = Teuchos::UnitTestRepository::runUnitTests( *out );
+
+  if (success)
+    *out << "\nEnd Result: TEST PASSED" << std::endl;
+  else
+    *out << "\nEnd Result: TEST FAILED" << std::endl;
+
+  clp.printFinalTimerSummary(out.ptr());
+
+  return (success ? 0 : 1);  
+}
+
+//---------------------------------------------------------------------------//
+// end tstFreeGasSAlphaBetaDataGenerator.cpp
+//---------------------------------------------------------------------------//
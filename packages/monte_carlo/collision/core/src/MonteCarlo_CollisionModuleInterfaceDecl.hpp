@@ -123,6 +123,35 @@ public:
                                               ParticleBank& bank,
                                               const bool analogue ) 
   { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); }
+
+  //! Get the hard macroscopic cross section of a material
+  static inline double getMacroscopicHardCrossSection(
+						 const ElectronState& particle )
+  { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); return 0;}
+
+  //! Get the soft stopping power of a material
+  static inline double getSoftStoppingPower( const ElectronState& particle )
+  { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); return 0;}
+
+  //! Get the soft macroscopic transport cross section of a material
+  static inline double getMacroscopicSoftTransportCrossSection(
+						 const ElectronState& particle )
+  { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); return 0;}
+
+  //! Collide with the material in a cell using only the hard reactions
+  static inline void collideHardWithCellMaterial( ElectronState& particle,
+                                                  ParticleBank& bank )
+  { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); }
+
+  //! Emit the thick-target bremsstrahlung photons of an electron in a cell
+  static inline void emitThickTargetBremsstrahlungInCellMaterial( 
+                                                const ElectronState& particle,
+                                                ParticleBank& bank )
+  { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); }
+
+  //! Reset the particle dependent data before a new particle is transported
+  static inline void startNewParticle()
+  { (void)UndefinedCollisionHandler<CollisionHandler>::notDefined(); }
 };
 
 //! Set the collision handler instance
@@ -39,6 +39,34 @@ AnalogElasticElectronScatteringDistribution::AnalogElasticElectronScatteringDist
   // Make sure the lower cutoff angle is valid
   testPrecondition( lower_cutoff_angle >= 0.0 );
   testPrecondition( lower_cutoff_angle <= 2.0 );
+
+  // Tabulate the cutoff cdf (and max cdf) values at every energy bin - the
+  // correlated cdf at an intermediate energy is the linear interpolation of 
+  // these values
+  d_cutoff_cdfs.resize( d_elastic_scattering_distribution.size() );
+  d_max_cdfs.resize( d_elastic_scattering_distribution.size() );
+
+  for( unsigned i = 0; i < d_elastic_scattering_distribution.size(); ++i )
+  {
+    if ( d_angle_is_used_as_independent_variable )
+    {
+      d_cutoff_cdfs[i] = 
+        d_elastic_scattering_distribution[i].second->evaluateCDF( 
+                                                        d_lower_cutoff_angle );
+
+      d_max_cdfs[i] = 1.0;
+    }
+    else
+    {
+      d_cutoff_cdfs[i] = 
+        d_elastic_scattering_distribution[i].second->evaluateCDF( 
+                                                1.0L - d_lower_cutoff_angle );
+
+      d_max_cdfs[i] = 
+        d_elastic_scattering_distribution[i].second->evaluateCDF( 
+                                                             1.0L - 1.0e-6 );
+    }
+  }
 }
 
 // Evaluate the distribution
@@ -190,30 +218,44 @@ double AnalogElasticElectronScatteringDistribution::evaluateCDF(
 }
 
 // Evaluate the cross section ratio for the cutoff angle
+/*! \details The cutoff cdf values are tabulated at every incoming energy bin
+ * so only a single energy grid search is required.
+ */
 double AnalogElasticElectronScatteringDistribution::evaluateCutoffCrossSectionRatio( 
         const double incoming_energy ) const
 {
+  unsigned lower_bin_index, upper_bin_index;
+  double interpolation_fraction;
+
+  this->findLowerAndUpperBinIndex( incoming_energy,
+                                   lower_bin_index,
+                                   upper_bin_index,
+                                   interpolation_fraction );
+
+  // Get the cdf
+  double cutoff_cdf = 
+    this->interpolateBinValue( d_cutoff_cdfs,
+                               lower_bin_index,
+                               upper_bin_index,
+                               interpolation_fraction );
+
   double cross_section_ratio = 0.0;
 
   if ( d_angle_is_used_as_independent_variable )
-  {  
-    // Get the cdf
-    double cutoff_cdf = evaluateCDF( incoming_energy, d_lower_cutoff_angle );
     cross_section_ratio = 1.0 - cutoff_cdf;
-  }
   else
   {
     // Get the max cdf value
-    double max_cdf = evaluateCDF( incoming_energy, 1.0e-6 );
-
-    // Get the cdf
-    double cutoff_cdf = evaluateCDF( incoming_energy, d_lower_cutoff_angle );
+    double max_cdf = 
+      this->interpolateBinValue( d_max_cdfs,
+                                 lower_bin_index,
+                                 upper_bin_index,
+                                 interpolation_fraction );
 
     // Make sure the cdf values are valid
     testPostcondition( max_cdf >= cutoff_cdf );
     testPostcondition( cutoff_cdf >= 0.0 );
 
-
     if ( max_cdf > 0.0 )
      cross_section_ratio = cutoff_cdf/max_cdf;
   }
@@ -322,49 +364,113 @@ void AnalogElasticElectronScatteringDistribution::sampleAndRecordTrialsImpl(
   // Increment the number of trials
   ++trials;
 
+  unsigned lower_bin_index, upper_bin_index;
+  double interpolation_fraction;
+
+  this->findLowerAndUpperBinIndex( incoming_energy,
+                                   lower_bin_index,
+                                   upper_bin_index,
+                                   interpolation_fraction );
+
+  // Get the tabulated cdf value at the lower cutoff angle
+  double cutoff_cdf = 
+    this->interpolateBinValue( d_cutoff_cdfs,
+                               lower_bin_index,
+                               upper_bin_index,
+                               interpolation_fraction );
+
   double scaled_random_number;
 
   if ( d_angle_is_used_as_independent_variable )
   {  
-    // evaluate the cdf value at the lower cutoff angle
-    double lower_cutoff_cdf = 
-            evaluateCDF( incoming_energy, d_lower_cutoff_angle );
-
     // scale the random number to only sample above the lower cutoff angle
-    scaled_random_number = ( 1.0L - lower_cutoff_cdf )*
+    scaled_random_number = ( 1.0L - cutoff_cdf )*
         Utility::RandomNumberGenerator::getRandomNumber<double>() +
-        lower_cutoff_cdf;
-
-  double scattering_angle = 
-        sampleTwoDDistributionCorrelatedWithRandomNumber( 
-            incoming_energy,
-            d_elastic_scattering_distribution,
-            scaled_random_number );
-
-  scattering_angle_cosine = 1.0L - scattering_angle;
+        cutoff_cdf;
   }
   else
   {
-    // evaluate the cdf value at the upper cutoff angle cosine
-    double upper_cutoff_cdf = 
-            evaluateCDF( incoming_energy, d_lower_cutoff_angle );
-
     // scale the random number to only sample below the upper cutoff angle cosine
-    scaled_random_number = upper_cutoff_cdf*
+    scaled_random_number = cutoff_cdf*
         Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  double sampled_value;
 
-    scattering_angle_cosine = 
-        sampleTwoDDistributionCorrelatedWithRandomNumber( 
-            incoming_energy,
-            d_elastic_scattering_distribution,
-            scaled_random_number );
+  if( lower_bin_index != upper_bin_index )
+  {
+    sampled_value = correlatedSampleWithRandomNumber( 
+                d_elastic_scattering_distribution[upper_bin_index].second,
+                d_elastic_scattering_distribution[lower_bin_index].second,
+                interpolation_fraction,
+                scaled_random_number );
   }
+  else
+  {
+    sampled_value = 
+      d_elastic_scattering_distribution[lower_bin_index].second->sampleWithRandomNumber( 
+                                                      scaled_random_number );
+  }
+
+  if ( d_angle_is_used_as_independent_variable )
+    scattering_angle_cosine = 1.0L - sampled_value;
+  else
+    scattering_angle_cosine = sampled_value;
 
   // Make sure the scattering angle cosine is valid
   testPostcondition( scattering_angle_cosine >= -1.0 );
   testPostcondition( scattering_angle_cosine <= 1.0 );
 }
 
+// Find the lower and upper incoming energy bin indices
+/*! \details The same bin search as the MonteCarlo::TwoDDistribution helpers
+ * is done (energies outside of the grid use the first or last bin).
+ */
+void AnalogElasticElectronScatteringDistribution::findLowerAndUpperBinIndex( 
+                                          const double incoming_energy,
+                                          unsigned& lower_bin_index,
+                                          unsigned& upper_bin_index,
+                                          double& interpolation_fraction ) const
+{
+  if( incoming_energy < d_elastic_scattering_distribution.front().first )
+  {
+    lower_bin_index = 0u;
+    upper_bin_index = lower_bin_index;
+    interpolation_fraction = 0.0;
+  }
+  else if( incoming_energy >= d_elastic_scattering_distribution.back().first )
+  {
+    lower_bin_index = d_elastic_scattering_distribution.size() - 1u;
+    upper_bin_index = lower_bin_index;
+    interpolation_fraction = 0.0;
+  }
+  else
+  {
+    lower_bin_index = Utility::Search::binaryLowerBoundIndex<Utility::FIRST>( 
+                                  d_elastic_scattering_distribution.begin(),
+                                  d_elastic_scattering_distribution.end(),
+                                  incoming_energy );
+    upper_bin_index = lower_bin_index + 1u;
+
+    // Calculate the interpolation fraction
+    interpolation_fraction = 
+      (incoming_energy - d_elastic_scattering_distribution[lower_bin_index].first)/
+      (d_elastic_scattering_distribution[upper_bin_index].first - 
+       d_elastic_scattering_distribution[lower_bin_index].first);
+  }
+}
+
+// Interpolate a tabulated energy bin value
+double AnalogElasticElectronScatteringDistribution::interpolateBinValue( 
+                                     const Teuchos::Array<double>& bin_values,
+                                     const unsigned lower_bin_index,
+                                     const unsigned upper_bin_index,
+                                     const double interpolation_fraction )
+{
+  return bin_values[lower_bin_index] + interpolation_fraction*
+    (bin_values[upper_bin_index] - bin_values[lower_bin_index]);
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
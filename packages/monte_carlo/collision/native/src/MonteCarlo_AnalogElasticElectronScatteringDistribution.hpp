@@ -109,6 +109,18 @@ public:
 
 private:
 
+  // Find the lower and upper incoming energy bin indices
+  void findLowerAndUpperBinIndex( const double incoming_energy,
+                                  unsigned& lower_bin_index,
+                                  unsigned& upper_bin_index,
+                                  double& interpolation_fraction ) const;
+
+  // Interpolate a tabulated energy bin value
+  static double interpolateBinValue( const Teuchos::Array<double>& bin_values,
+                                     const unsigned lower_bin_index,
+                                     const unsigned upper_bin_index,
+                                     const double interpolation_fraction );
+
   // The scattering angle above which the analog distribution is used
   double d_lower_cutoff_angle;
 
@@ -117,6 +129,13 @@ private:
 
   // elastic scattering distribution without forward screening data
   ElasticDistribution d_elastic_scattering_distribution;
+
+  // The cdf value at the lower cutoff angle at each incoming energy bin
+  Teuchos::Array<double> d_cutoff_cdfs;
+
+  // The max cdf value at each incoming energy bin (only used when the angle
+  // cosine is the independent variable)
+  Teuchos::Array<double> d_max_cdfs;
 };
 
 } // end MonteCarlo namespace
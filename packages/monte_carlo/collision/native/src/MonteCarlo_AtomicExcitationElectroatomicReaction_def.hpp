@@ -100,6 +100,15 @@ ElectroatomicReactionType AtomicExcitationElectroatomicReaction<InterpPolicy,pro
   return ATOMIC_EXCITATION_ELECTROATOMIC_REACTION;
 }
 
+// Return the mean energy lost in a single reaction at the given energy
+/*! \details The atomic excitation energy loss is deterministic.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double AtomicExcitationElectroatomicReaction<InterpPolicy,processed_cross_section>::getMeanEnergyLoss( const double energy ) const
+{
+  return d_energy_loss_distribution->evaluateEnergyLoss( energy );
+}
+
 // Simulate the reaction
 template<typename InterpPolicy, bool processed_cross_section>
 void AtomicExcitationElectroatomicReaction<InterpPolicy,processed_cross_section>::react(
@@ -28,6 +28,13 @@ AtomicExcitationElectronScatteringDistribution::AtomicExcitationElectronScatteri
   testPrecondition( !d_energy_loss_distribution.is_null() );
 }
 
+// Evaluate the energy loss at the given incoming energy
+double AtomicExcitationElectronScatteringDistribution::evaluateEnergyLoss(
+                                         const double incoming_energy ) const
+{
+  return d_energy_loss_distribution->evaluate( incoming_energy );
+}
+
 // Sample an outgoing energy and direction from the distribution
 void AtomicExcitationElectronScatteringDistribution::sample( 
              const double incoming_energy,
@@ -38,7 +45,7 @@ void AtomicExcitationElectronScatteringDistribution::sample(
   scattering_angle_cosine = 1.0;
 
   // Get enery loss
-  double energy_loss = d_energy_loss_distribution->evaluate( incoming_energy );
+  double energy_loss = this->evaluateEnergyLoss( incoming_energy );
 
   // Calculate outgoing energy
   outgoing_energy = incoming_energy - energy_loss;
@@ -52,6 +52,9 @@ public:
   { /*...*/}
 
 
+  //! Evaluate the energy loss at the given incoming energy
+  double evaluateEnergyLoss( const double incoming_energy ) const;
+
   //! Sample an outgoing energy and direction from the distribution
   void sample( const double incoming_energy,
                double& outgoing_energy,
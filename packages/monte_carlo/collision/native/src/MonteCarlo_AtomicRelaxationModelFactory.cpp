@@ -8,9 +8,8 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
-#include "MonteCarlo_DetailedSubshellRelaxationModel.hpp"
 #include "MonteCarlo_VoidAtomicRelaxationModel.hpp"
-#include "MonteCarlo_DetailedAtomicRelaxationModel.hpp"
+#include "MonteCarlo_FlattenedAtomicRelaxationModel.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -22,8 +21,8 @@ AtomicRelaxationModelFactory::default_void_model(
 
 // Create the atomic relaxation model
 /*! \details If the use of atomic relaxation data is desired and that data
- * is available for the atom of interest, a detailed atomic relaxation model
- * will be created for the atom. Otherwise a "void" model, which essentially
+ * is available for the atom of interest, a (flattened) detailed atomic 
+ * relaxation model will be created for the atom. Otherwise a "void" model, which essentially
  * ignores relaxation, will be created.
  */
 void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
@@ -59,18 +58,29 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
       Teuchos::ArrayView<const double> xprob_block =
 	raw_photoatom_data.extractXPROBBlock();
       
-      Teuchos::Array<Teuchos::RCP<const SubshellRelaxationModel> >
-	subshell_relaxation_models;
+      Teuchos::Array<SubshellType> vacancy_subshells;
+      Teuchos::Array<Teuchos::Array<SubshellType> > primary_transitions,
+	secondary_transitions;
+      Teuchos::Array<Teuchos::Array<double> > relaxation_energies,
+	transition_cdfs;
       
-      AtomicRelaxationModelFactory::createSubshellRelaxationModels( 
-						  subshells,
-						  subshell_transitions,
-						  relo_block,
-						  xprob_block,
-						  subshell_relaxation_models );
-
-      atomic_relaxation_model.reset( new DetailedAtomicRelaxationModel(
-						subshell_relaxation_models ) );
+      AtomicRelaxationModelFactory::extractSubshellRelaxationData( 
+						       subshells,
+						       subshell_transitions,
+						       relo_block,
+						       xprob_block,
+						       vacancy_subshells,
+						       primary_transitions,
+						       secondary_transitions,
+						       relaxation_energies,
+						       transition_cdfs );
+
+      atomic_relaxation_model.reset( new FlattenedAtomicRelaxationModel(
+						       vacancy_subshells,
+						       primary_transitions,
+						       secondary_transitions,
+						       relaxation_energies,
+						       transition_cdfs ) );
     }
     // No atomic relaxation date is available
     else
@@ -89,8 +99,8 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 
 // Create the atomic relaxation model
 /*! \details If the use of atomic relaxation data is desired and that data
- * is available for the atom of interest, a detailed atomic relaxation model
- * will be created for the atom. Otherwise a "void" model, which essentially
+ * is available for the atom of interest, a (flattened) detailed atomic 
+ * relaxation model will be created for the atom. Otherwise a "void" model, which essentially
  * ignores relaxation, will be created.
  */
 void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
@@ -108,8 +118,11 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
       std::set<unsigned>::const_iterator subshell_it = 
 	endf_designators.begin();
 
-      Teuchos::Array<Teuchos::RCP<const SubshellRelaxationModel> >
-	subshell_relaxation_models;
+      Teuchos::Array<SubshellType> vacancy_subshells;
+      Teuchos::Array<Teuchos::Array<SubshellType> > primary_transitions,
+	secondary_transitions;
+      Teuchos::Array<Teuchos::Array<double> > relaxation_energies,
+	transition_pdfs;
 
       while( subshell_it != endf_designators.end() )
       {
@@ -117,43 +130,41 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 	{
 	  const std::vector<std::pair<unsigned,unsigned> >& transitions = 
 	    raw_photoatom_data.getSubshellRelaxationVacancies( *subshell_it );
+
+	  vacancy_subshells.push_back( convertENDFDesignatorToSubshellEnum( *subshell_it ) );
 	  
-	  Teuchos::Array<SubshellType> primary_transitions(transitions.size()),
-	    secondary_transitions( transitions.size() );
+	  primary_transitions.push_back( 
+		            Teuchos::Array<SubshellType>( transitions.size() ) );
+	  secondary_transitions.push_back(
+			    Teuchos::Array<SubshellType>( transitions.size() ) );
 
 	  for( unsigned i = 0; i < transitions.size(); ++i )
 	  {
-	    primary_transitions[i] = convertENDFDesignatorToSubshellEnum(
+	    primary_transitions.back()[i] = convertENDFDesignatorToSubshellEnum(
 							transitions[i].first );
-	    secondary_transitions[i] = convertENDFDesignatorToSubshellEnum(
+	    secondary_transitions.back()[i] = convertENDFDesignatorToSubshellEnum(
 						       transitions[i].second );
 	  }
 
-	  const std::vector<double>& relaxation_energies = 
-	    raw_photoatom_data.getSubshellRelaxationParticleEnergies(
-							        *subshell_it );
-
-	  const std::vector<double>& transition_pdf = 
-	    raw_photoatom_data.getSubshellRelaxationProbabilities( 
-								*subshell_it );
-
-	  Teuchos::RCP<const SubshellRelaxationModel> subshell_model(
-	          new DetailedSubshellRelaxationModel(
-	                   convertENDFDesignatorToSubshellEnum( *subshell_it ),
-			   primary_transitions,
-			   secondary_transitions,
-			   relaxation_energies,
-			   transition_pdf,
-			   false ) );
-	  
-	  subshell_relaxation_models.push_back( subshell_model );
+	  relaxation_energies.push_back( Teuchos::Array<double>( 
+	       raw_photoatom_data.getSubshellRelaxationParticleEnergies(
+							      *subshell_it ) ) );
+
+	  transition_pdfs.push_back( Teuchos::Array<double>( 
+		  raw_photoatom_data.getSubshellRelaxationProbabilities( 
+							      *subshell_it ) ) );
 	}
 	
 	++subshell_it;
       }
 
-      atomic_relaxation_model.reset( new DetailedAtomicRelaxationModel(
-						subshell_relaxation_models ) );
+      atomic_relaxation_model.reset( new FlattenedAtomicRelaxationModel(
+						       vacancy_subshells,
+						       primary_transitions,
+						       secondary_transitions,
+						       relaxation_energies,
+						       transition_pdfs,
+						       false ) );
     }
     // No atomic relaxation data is available
     else
@@ -173,8 +184,8 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 
 // Create the atomic relaxation model
 /*! \details If the use of atomic relaxation data is desired and that data
- * is available for the atom of interest, a detailed atomic relaxation model
- * will be created for the atom. Otherwise a "void" model, which essentially
+ * is available for the atom of interest, a (flattened) detailed atomic 
+ * relaxation model will be created for the atom. Otherwise a "void" model, which essentially
  * ignores relaxation, will be created.
  */
 void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
@@ -192,8 +203,11 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
       std::set<unsigned>::const_iterator subshell_it = 
 	endf_designators.begin();
 
-      Teuchos::Array<Teuchos::RCP<const SubshellRelaxationModel> >
-	subshell_relaxation_models;
+      Teuchos::Array<SubshellType> vacancy_subshells;
+      Teuchos::Array<Teuchos::Array<SubshellType> > primary_transitions,
+	secondary_transitions;
+      Teuchos::Array<Teuchos::Array<double> > relaxation_energies,
+	transition_pdfs;
 
       while( subshell_it != endf_designators.end() )
       {
@@ -201,43 +215,41 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 	{
 	  const std::vector<std::pair<unsigned,unsigned> >& transitions = 
 	    raw_photoatom_data.getSubshellRelaxationVacancies( *subshell_it );
+
+	  vacancy_subshells.push_back( convertEADLDesignatorToSubshellEnum( *subshell_it ) );
 	  
-	  Teuchos::Array<SubshellType> primary_transitions(transitions.size()),
-	    secondary_transitions( transitions.size() );
+	  primary_transitions.push_back( 
+		            Teuchos::Array<SubshellType>( transitions.size() ) );
+	  secondary_transitions.push_back(
+			    Teuchos::Array<SubshellType>( transitions.size() ) );
 
 	  for( unsigned i = 0; i < transitions.size(); ++i )
 	  {
-	    primary_transitions[i] = convertEADLDesignatorToSubshellEnum(
+	    primary_transitions.back()[i] = convertEADLDesignatorToSubshellEnum(
 							transitions[i].first );
-	    secondary_transitions[i] = convertEADLDesignatorToSubshellEnum(
+	    secondary_transitions.back()[i] = convertEADLDesignatorToSubshellEnum(
 						       transitions[i].second );
 	  }
 
-	  const std::vector<double>& relaxation_energies = 
-	    raw_photoatom_data.getSubshellRelaxationParticleEnergies(
-							        *subshell_it );
-
-	  const std::vector<double>& transition_pdf = 
-	    raw_photoatom_data.getSubshellRelaxationProbabilities( 
-								*subshell_it );
-
-	  Teuchos::RCP<const SubshellRelaxationModel> subshell_model(
-	          new DetailedSubshellRelaxationModel(
-	                   convertEADLDesignatorToSubshellEnum( *subshell_it ),
-			   primary_transitions,
-			   secondary_transitions,
-			   relaxation_energies,
-			   transition_pdf,
-			   false ) );
-	  
-	  subshell_relaxation_models.push_back( subshell_model );
+	  relaxation_energies.push_back( Teuchos::Array<double>( 
+	       raw_photoatom_data.getSubshellRelaxationParticleEnergies(
+							      *subshell_it ) ) );
+
+	  transition_pdfs.push_back( Teuchos::Array<double>( 
+		  raw_photoatom_data.getSubshellRelaxationProbabilities( 
+							      *subshell_it ) ) );
 	}
 	
 	++subshell_it;
       }
 
-      atomic_relaxation_model.reset( new DetailedAtomicRelaxationModel(
-						subshell_relaxation_models ) );
+      atomic_relaxation_model.reset( new FlattenedAtomicRelaxationModel(
+						       vacancy_subshells,
+						       primary_transitions,
+						       secondary_transitions,
+						       relaxation_energies,
+						       transition_pdfs,
+						       false ) );
     }
     // No atomic relaxation data is available
     else
@@ -256,8 +268,8 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 
 // Create and cache the atomic relaxation model
 /*! \details If the use of atomic relaxation data is desired and that data
- * is available for the atom of interest, a detailed atomic relaxation model
- * will be created for the atom. Otherwise a "void" model, which essentially
+ * is available for the atom of interest, a (flattened) detailed atomic 
+ * relaxation model will be created for the atom. Otherwise a "void" model, which essentially
  * ignores relaxation, will be created. To save memory, a relaxation model
  * can be cached. Calling this function multiple times with the same atomic
  * data (same atomic number) will return a pointer to the previously created
@@ -293,8 +305,8 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
 
 // Create and cache the atomic relaxation model
 /*! \details If the use of atomic relaxation data is desired and that data
- * is available for the atom of interest, a detailed atomic relaxation model
- * will be created for the atom. Otherwise a "void" model, which essentially
+ * is available for the atom of interest, a (flattened) detailed atomic 
+ * relaxation model will be created for the atom. Otherwise a "void" model, which essentially
  * ignores relaxation, will be created. To save memory, a relaxation model
  * can be cached. Calling this function multiple times with the same atomic
  * data (same atomic number) will return a pointer to the previously created
@@ -331,8 +343,8 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
 
 // Create and cache the atomic relaxation model
 /*! \details If the use of atomic relaxation data is desired and that data
- * is available for the atom of interest, a detailed atomic relaxation model
- * will be created for the atom. Otherwise a "void" model, which essentially
+ * is available for the atom of interest, a (flattened) detailed atomic 
+ * relaxation model will be created for the atom. Otherwise a "void" model, which essentially
  * ignores relaxation, will be created. To save memory, a relaxation model
  * can be cached. Calling this function multiple times with the same atomic
  * data (same atomic number) will return a pointer to the previously created
@@ -366,14 +378,17 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
   }
 }
 
-// Create the subshell relaxation models
-void AtomicRelaxationModelFactory::createSubshellRelaxationModels(
-		  const Teuchos::Array<SubshellType>& subshell_designators,
-		  const Teuchos::ArrayView<const double>& subshell_transitions,
-		  const Teuchos::ArrayView<const double>& relo_block,
-		  const Teuchos::ArrayView<const double>& xprob_block,
-		  Teuchos::Array<Teuchos::RCP<const SubshellRelaxationModel> >&
-		  subshell_relaxation_models )
+// Extract the subshell relaxation data (using ACE data)
+void AtomicRelaxationModelFactory::extractSubshellRelaxationData(
+	 const Teuchos::Array<SubshellType>& subshell_designators,
+	 const Teuchos::ArrayView<const double>& subshell_transitions,
+	 const Teuchos::ArrayView<const double>& relo_block,
+	 const Teuchos::ArrayView<const double>& xprob_block,
+	 Teuchos::Array<SubshellType>& vacancy_subshells,
+	 Teuchos::Array<Teuchos::Array<SubshellType> >& primary_transitions,
+	 Teuchos::Array<Teuchos::Array<SubshellType> >& secondary_transitions,
+	 Teuchos::Array<Teuchos::Array<double> >& relaxation_energies,
+	 Teuchos::Array<Teuchos::Array<double> >& transition_cdfs )
 {
   // Make sure the arrays are valid
   testPrecondition( subshell_designators.size() > 0 );
@@ -383,7 +398,11 @@ void AtomicRelaxationModelFactory::createSubshellRelaxationModels(
 		    relo_block.size() );
   testPrecondition( xprob_block.size() > 0 );
 
-  subshell_relaxation_models.clear();
+  vacancy_subshells.clear();
+  primary_transitions.clear();
+  secondary_transitions.clear();
+  relaxation_energies.clear();
+  transition_cdfs.clear();
 		    
   for( unsigned i = 0; i < subshell_transitions.size(); ++i )
   {
@@ -391,47 +410,38 @@ void AtomicRelaxationModelFactory::createSubshellRelaxationModels(
     
     unsigned subshell_data_start = (unsigned)relo_block[i];
     
-    // Only create a model if there is at least one transition path
+    // Only extract the data if there is at least one transition path
     if( transitions > 0 )
     {
+      vacancy_subshells.push_back( subshell_designators[i] );
+      
       // Extract the primary transition shells, secondary transition shells,
       // outgoing particle energies and transition CDF
-      Teuchos::Array<SubshellType> 
-	primary_transition_subshells( transitions );
+      primary_transitions.push_back( 
+			       Teuchos::Array<SubshellType>( transitions ) );
       
-      Teuchos::Array<SubshellType>
-	secondary_transition_subshells( transitions );
+      secondary_transitions.push_back( 
+			       Teuchos::Array<SubshellType>( transitions ) );
       
-      Teuchos::Array<double>
-	outgoing_particle_energies( transitions );
+      relaxation_energies.push_back( Teuchos::Array<double>( transitions ) );
       
-      Teuchos::Array<double> transition_cdf( transitions );
+      transition_cdfs.push_back( Teuchos::Array<double>( transitions ) );
       
       for( unsigned j = 0; j < transitions; ++j )
       {
-	primary_transition_subshells[j] = 
+	primary_transitions.back()[j] = 
 	  convertENDFDesignatorToSubshellEnum(
 					xprob_block[subshell_data_start+j*4] );
 	
-	secondary_transition_subshells[j] = 
+	secondary_transitions.back()[j] = 
 	  convertENDFDesignatorToSubshellEnum(
 				      xprob_block[subshell_data_start+j*4+1] );
 
-	outgoing_particle_energies[j] = 
+	relaxation_energies.back()[j] = 
 	  xprob_block[subshell_data_start+j*4+2];
 
-	transition_cdf[j] = xprob_block[subshell_data_start+j*4+3];
+	transition_cdfs.back()[j] = xprob_block[subshell_data_start+j*4+3];
       }
-
-      Teuchos::RCP<SubshellRelaxationModel> subshell_model(
-				        new DetailedSubshellRelaxationModel(
-						subshell_designators[i],
-						primary_transition_subshells,
-						secondary_transition_subshells,
-						outgoing_particle_energies,
-						transition_cdf ) );
-
-      subshell_relaxation_models.push_back( subshell_model );
     }
   }
 }
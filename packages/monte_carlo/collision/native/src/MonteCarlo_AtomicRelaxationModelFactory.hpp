@@ -14,10 +14,11 @@
 
 // Trilinos Includes
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
-#include "MonteCarlo_SubshellRelaxationModel.hpp"
+#include "MonteCarlo_SubshellType.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_EvaluatedElectronDataContainer.hpp"
@@ -83,14 +84,17 @@ public:
 
 private:
 
-  //! Create the subshell relaxation models
-  static void createSubshellRelaxationModels(
-		  const Teuchos::Array<SubshellType>& subshell_designators,
-		  const Teuchos::ArrayView<const double>& subshell_transitions,
-		  const Teuchos::ArrayView<const double>& relo_block,
-		  const Teuchos::ArrayView<const double>& xprob_block,
-		  Teuchos::Array<Teuchos::RCP<const SubshellRelaxationModel> >&
-		  subshell_relaxation_models );
+  //! Extract the subshell relaxation data (using ACE data)
+  static void extractSubshellRelaxationData(
+	 const Teuchos::Array<SubshellType>& subshell_designators,
+	 const Teuchos::ArrayView<const double>& subshell_transitions,
+	 const Teuchos::ArrayView<const double>& relo_block,
+	 const Teuchos::ArrayView<const double>& xprob_block,
+	 Teuchos::Array<SubshellType>& vacancy_subshells,
+	 Teuchos::Array<Teuchos::Array<SubshellType> >& primary_transitions,
+	 Teuchos::Array<Teuchos::Array<SubshellType> >& secondary_transitions,
+	 Teuchos::Array<Teuchos::Array<double> >& relaxation_energies,
+	 Teuchos::Array<Teuchos::Array<double> >& transition_cdfs );
   
   // The default void atomic relaxation model
   static const Teuchos::RCP<AtomicRelaxationModel> default_void_model;
@@ -56,6 +56,9 @@ public:
   //! Return the reaction type
   ElectroatomicReactionType getReactionType() const;
 
+  //! Return the mean energy loss (MeV) at the given energy
+  double getMeanEnergyLoss( const double energy ) const;
+
   //! Simulate the reaction
   void react( ElectronState& electron, 
 	      ParticleBank& bank,
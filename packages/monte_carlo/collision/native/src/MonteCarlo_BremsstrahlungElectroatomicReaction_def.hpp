@@ -101,6 +101,19 @@ ElectroatomicReactionType BremsstrahlungElectroatomicReaction<InterpPolicy,proce
   return BREMSSTRAHLUNG_ELECTROATOMIC_REACTION;
 }
 
+// Return the mean energy loss (MeV) at the given energy
+/*! \details The mean energy lost by the electron is the mean energy of the
+ * emitted bremsstrahlung photon.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double BremsstrahlungElectroatomicReaction<InterpPolicy,processed_cross_section>::getMeanEnergyLoss( const double energy ) const
+{
+  if( energy >= this->getThresholdEnergy() )
+    return d_bremsstrahlung_distribution->evaluateMeanPhotonEnergy( energy );
+  else
+    return 0.0;
+}
+
 // Simulate the reaction
 template<typename InterpPolicy, bool processed_cross_section>
 void BremsstrahlungElectroatomicReaction<InterpPolicy,processed_cross_section>::react( 
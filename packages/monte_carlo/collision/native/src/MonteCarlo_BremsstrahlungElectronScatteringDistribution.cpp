@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <limits>
+#include <algorithm>
 
 // Trilinos Includes
 #include <Teuchos_Array.hpp>
@@ -146,6 +147,35 @@ double BremsstrahlungElectronScatteringDistribution::evaluatePDF(
                          d_bremsstrahlung_scattering_distribution );
 }
 
+// Evaluate the mean photon energy for a given incoming energy
+/*! \details The mean is calculated deterministically by averaging the photon
+ * energies at the midpoints of equal probability bins (the random number
+ * generator may not be available when this is called).
+ */
+double BremsstrahlungElectronScatteringDistribution::evaluateMeanPhotonEnergy(
+                                          const double incoming_energy ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  const unsigned number_of_bins = 100u;
+
+  double mean_photon_energy = 0.0;
+
+  for( unsigned i = 0u; i < number_of_bins; ++i )
+  {
+    mean_photon_energy += sampleTwoDDistributionCorrelatedWithRandomNumber(
+                                     incoming_energy,
+                                     d_bremsstrahlung_scattering_distribution,
+                                     (i + 0.5)/number_of_bins );
+  }
+
+  mean_photon_energy /= number_of_bins;
+
+  // The photon energy can never exceed the incoming electron energy
+  return std::min( mean_photon_energy, incoming_energy );
+}
+
 // Sample the photon energy and direction from the distribution
 void BremsstrahlungElectronScatteringDistribution::sample( 
              const double incoming_energy,
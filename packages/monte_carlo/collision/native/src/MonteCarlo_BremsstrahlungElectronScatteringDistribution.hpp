@@ -73,6 +73,9 @@ public:
   double evaluatePDF( const double incoming_energy, 
                       const double photon_energy ) const;
 
+  //! Evaluate the mean photon energy for a given incoming energy
+  double evaluateMeanPhotonEnergy( const double incoming_energy ) const;
+
   //! Sample an outgoing energy and direction from the distribution
   void sample( const double incoming_energy,
                double& photon_energy,
@@ -11,6 +11,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_CollisionHandler.hpp"
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
 
@@ -195,7 +196,7 @@ double CollisionHandler::getMacroscopicTotalCrossSection(
   Teuchos::RCP<NeutronMaterial>& material = 
     CollisionHandler::master_neutron_map.find( particle.getCell() )->second;
   
-  return material->getMacroscopicTotalCrossSection( particle.getEnergy() );
+  return material->getMacroscopicTotalCrossSection( particle );
 }
 
 // Get the total macroscopic cross section of a material
@@ -236,8 +237,8 @@ double CollisionHandler::getMacroscopicReactionCrossSection(
   
   if( it != CollisionHandler::master_neutron_map.end() )
   {
-    return it->second->getMacroscopicReactionCrossSection(particle.getEnergy(),
-							  reaction );
+    return it->second->getMacroscopicReactionCrossSection( particle, 
+							   reaction );
   }
   else
     return 0.0;
@@ -253,8 +254,8 @@ double CollisionHandler::getMacroscopicReactionCrossSection(
 
   if( it != CollisionHandler::master_photon_map.end() )
   {
-    return it->second->getMacroscopicReactionCrossSection(particle.getEnergy(),
-							  reaction );
+    return it->second->getMacroscopicReactionCrossSection( particle, 
+							   reaction );
   }
   else
     return 0.0;
@@ -348,6 +349,86 @@ void CollisionHandler::collideWithCellMaterial( ElectronState& particle,
     material->collideSurvivalBias( particle, bank );   
 }
 
+// Get the hard macroscopic cross section of a material
+double CollisionHandler::getMacroscopicHardCrossSection(
+						  const ElectronState& particle )
+{
+  // Make sure the cell is not void
+  testPrecondition( !CollisionHandler::isCellVoid( particle.getCell(),
+						   ELECTRON ) );
+
+  const Teuchos::RCP<ElectronMaterial>& material = 
+      CollisionHandler::master_electron_map.find( particle.getCell() )->second;
+    
+  return material->getMacroscopicHardCrossSection( particle.getEnergy() );
+}
+
+// Get the soft stopping power of a material
+double CollisionHandler::getSoftStoppingPower( const ElectronState& particle )
+{
+  // Make sure the cell is not void
+  testPrecondition( !CollisionHandler::isCellVoid( particle.getCell(),
+						   ELECTRON ) );
+
+  const Teuchos::RCP<ElectronMaterial>& material = 
+      CollisionHandler::master_electron_map.find( particle.getCell() )->second;
+    
+  return material->getSoftStoppingPower( particle.getEnergy() );
+}
+
+// Get the soft macroscopic transport cross section of a material
+double CollisionHandler::getMacroscopicSoftTransportCrossSection(
+						  const ElectronState& particle )
+{
+  // Make sure the cell is not void
+  testPrecondition( !CollisionHandler::isCellVoid( particle.getCell(),
+						   ELECTRON ) );
+
+  const Teuchos::RCP<ElectronMaterial>& material = 
+      CollisionHandler::master_electron_map.find( particle.getCell() )->second;
+    
+  return material->getMacroscopicSoftTransportCrossSection( 
+                                                        particle.getEnergy() );
+}
+
+// Collide with the material in a cell using only the hard reactions
+void CollisionHandler::collideHardWithCellMaterial( ElectronState& particle,
+                                                    ParticleBank& bank )
+{
+  // Make sure the cell is not void
+  testPrecondition( !CollisionHandler::isCellVoid( particle.getCell(),
+						   ELECTRON ) );
+  
+  const Teuchos::RCP<ElectronMaterial>& material = 
+    CollisionHandler::master_electron_map.find( particle.getCell() )->second;
+  
+  material->collideHard( particle, bank );
+}
+
+// Emit the thick-target bremsstrahlung photons of an electron in a cell
+void CollisionHandler::emitThickTargetBremsstrahlungInCellMaterial( 
+                                                const ElectronState& particle,
+                                                ParticleBank& bank )
+{
+  // Make sure the cell is not void
+  testPrecondition( !CollisionHandler::isCellVoid( particle.getCell(),
+						   ELECTRON ) );
+  
+  const Teuchos::RCP<ElectronMaterial>& material = 
+    CollisionHandler::master_electron_map.find( particle.getCell() )->second;
+  
+  material->emitThickTargetBremsstrahlung( particle, bank );
+}
+
+// Reset the particle dependent data before a new particle is transported
+/*! \details The unresolved resonance band selections made by the previous
+ * particle on the calling thread will not be reused.
+ */
+void CollisionHandler::startNewParticle()
+{
+  UnresolvedResonanceProbabilityTable::startNewParticle();
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -134,6 +134,28 @@ public:
 				       ParticleBank& bank,
 				       const bool analogue );
 
+  //! Get the hard macroscopic cross section of a material
+  static double getMacroscopicHardCrossSection( const ElectronState& particle );
+
+  //! Get the soft stopping power of a material
+  static double getSoftStoppingPower( const ElectronState& particle );
+
+  //! Get the soft macroscopic transport cross section of a material
+  static double getMacroscopicSoftTransportCrossSection( 
+                                                const ElectronState& particle );
+
+  //! Collide with the material in a cell using only the hard reactions
+  static void collideHardWithCellMaterial( ElectronState& particle,
+                                           ParticleBank& bank );
+
+  //! Emit the thick-target bremsstrahlung photons of an electron in a cell
+  static void emitThickTargetBremsstrahlungInCellMaterial( 
+                                                const ElectronState& particle,
+                                                ParticleBank& bank );
+
+  //! Reset the particle dependent data before a new particle is transported
+  static void startNewParticle();
+
 private:
   
   // The cell id neutron material map
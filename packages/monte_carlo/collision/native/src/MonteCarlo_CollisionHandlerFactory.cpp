@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <sstream>
+
 // Boost Includes
 #include <boost/unordered_set.hpp>
 
@@ -15,6 +18,7 @@
 #include "MonteCarlo_IncoherentModelType.hpp"
 #include "MonteCarlo_BremsstrahlungAngularDistributionType.hpp"
 #include "MonteCarlo_NuclideFactory.hpp"
+#include "MonteCarlo_CrossSectionsXMLProperties.hpp"
 #include "MonteCarlo_PhotoatomFactory.hpp"
 #include "MonteCarlo_ElectroatomFactory.hpp"
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
@@ -108,6 +112,25 @@ void CollisionHandlerFactory::initializeHandler(
 
   this->createCellIdDataMaps( cell_id_mat_id_map, cell_id_density_map );
 
+  // Create the material temperature data maps (neutron modes only)
+  boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>
+    material_id_temperature_map;
+
+  boost::unordered_map<std::string,Teuchos::Array<std::string> >
+    isotope_temperature_table_aliases_map;
+
+  if( SimulationGeneralProperties::getParticleMode() == NEUTRON_MODE ||
+      SimulationGeneralProperties::getParticleMode() == NEUTRON_PHOTON_MODE )
+  {
+    CollisionHandlerFactory::createMaterialIdTemperatureDataMaps(
+				       material_reps,
+				       alias_map_list,
+				       cross_sections_table_info,
+				       cross_sections_xml_directory,
+				       material_id_temperature_map,
+				       isotope_temperature_table_aliases_map );
+  }
+
   // Initialize an atomic relaxation model factory
   Teuchos::RCP<AtomicRelaxationModelFactory> atomic_relaxation_model_factory(
 					    new AtomicRelaxationModelFactory );
@@ -121,6 +144,8 @@ void CollisionHandlerFactory::initializeHandler(
 				  cross_sections_xml_directory,
 				  material_id_fraction_map,
 				  material_id_component_map,
+				  material_id_temperature_map,
+				  isotope_temperature_table_aliases_map,
 				  aliases,
 				  cell_id_mat_id_map,
 				  cell_id_density_map,
@@ -145,6 +170,24 @@ void CollisionHandlerFactory::initializeHandler(
 		     SimulationPhotonProperties::isDetailedPairProductionModeOn(),
 		     SimulationPhotonProperties::isAtomicRelaxationModeOn(),
 		     SimulationPhotonProperties::isPhotonuclearInteractionModeOn() );
+
+    // The electron materials are needed for thick-target bremsstrahlung
+    if( SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() )
+    {
+      this->createElectronMaterials(
+		     cross_sections_table_info,
+		     cross_sections_xml_directory,
+		     material_id_fraction_map,
+		     material_id_component_map,
+		     aliases,
+		     cell_id_mat_id_map,
+		     cell_id_density_map,
+		     atomic_relaxation_model_factory,
+		     SimulationElectronProperties::getNumberOfElectronHashGridBins(),
+		     SimulationElectronProperties::getBremsstrahlungAngularDistributionFunction(),
+		     false,
+		     SimulationElectronProperties::getElasticCutoffAngle() );
+    }
     break;
   }
   case NEUTRON_PHOTON_MODE:
@@ -156,6 +199,8 @@ void CollisionHandlerFactory::initializeHandler(
 				  cross_sections_xml_directory,
 				  material_id_fraction_map,
 				  material_id_component_map,
+				  material_id_temperature_map,
+				  isotope_temperature_table_aliases_map,
 				  aliases,
 				  cell_id_mat_id_map,
 				  cell_id_density_map,
@@ -234,6 +279,19 @@ void CollisionHandlerFactory::validateMaterialRep(
 		      InvalidMaterialRepresentation,
 		      "Error: a material must have isotope fractions "
 		      "specified!" );
+
+  // Make sure the temperature (optional) is valid
+  if( material_rep.isParameter( "Temperature" ) )
+  {
+    TEST_FOR_EXCEPTION( !material_rep.isType<double>( "Temperature" ),
+			InvalidMaterialRepresentation,
+			"Error: a material temperature must be a double!" );
+
+    TEST_FOR_EXCEPTION( material_rep.get<double>( "Temperature" ) < 0.0,
+			InvalidMaterialRepresentation,
+			"Error: a material temperature must be "
+			"non-negative!" );
+  }
 }
 
 // Create the set of all nuclides/atoms needed to construct materials
@@ -326,6 +384,72 @@ void CollisionHandlerFactory::createMaterialIdDataMaps(
   }
 }
 
+// Create the material id temperature data maps
+/*! \details Only materials with a "Temperature" parameter (in MeV) will be 
+ * added to the material id temperature map. The isotopes of these materials
+ * will be mapped to the aliases of the nuclear tables in the 
+ * cross_sections.xml file (for the same nuclide) that bracket the 
+ * temperature of a material that contains them. Only these tables will be
+ * loaded and used as the base tables for on-the-fly temperature 
+ * interpolation.
+ */
+void CollisionHandlerFactory::createMaterialIdTemperatureDataMaps(
+    const Teuchos::ParameterList& material_reps,
+    const Teuchos::ParameterList& cross_sections_alias_map,
+    const Teuchos::ParameterList& cross_sections_table_info,
+    const std::string& cross_sections_xml_directory,
+    boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>&
+    material_id_temperature_map,
+    boost::unordered_map<std::string,Teuchos::Array<std::string> >&
+    isotope_temperature_table_aliases_map )
+{
+  Teuchos::ParameterList::ConstIterator it = material_reps.begin();
+
+  while( it != material_reps.end() )
+  {
+    const Teuchos::ParameterList& material_rep = 
+      Teuchos::any_cast<Teuchos::ParameterList>( it->second.getAny() );
+
+    if( material_rep.isParameter( "Temperature" ) )
+    {
+      const double temperature = material_rep.get<double>( "Temperature" );
+      
+      material_id_temperature_map[material_rep.get<unsigned>( "Id" )] =
+	temperature;
+
+      const Teuchos::Array<std::string>& material_isotopes = 
+	material_rep.get<Teuchos::Array<std::string> >( "Isotopes" );
+
+      for( unsigned i = 0; i < material_isotopes.size(); ++i )
+      {
+	std::string alias( material_isotopes[i] );
+
+	// The name is a key - use the mapped name
+	if( cross_sections_alias_map.isParameter( material_isotopes[i] ) )
+	{
+	  try{ 
+	    alias = 
+	      cross_sections_alias_map.get<std::string>( material_isotopes[i] );
+	  }
+	  EXCEPTION_CATCH_AND_EXIT( Teuchos::Exceptions::InvalidParameter,
+				    "Error: cross section alias map entry "
+				    << material_isotopes[i] <<
+				    "is invalid! Please fix this entry." );
+	}
+
+	CrossSectionsXMLProperties::extractNuclideBracketingTemperatureTableAliases(
+		 cross_sections_xml_directory,
+		 alias,
+		 cross_sections_table_info,
+		 temperature,
+		 isotope_temperature_table_aliases_map[material_isotopes[i]] );
+      }
+    }
+    
+    ++it;
+  }
+}
+
 // Create the neutron materials
 void CollisionHandlerFactory::createNeutronMaterials( 
    const Teuchos::ParameterList& cross_sections_table_info,
@@ -334,6 +458,10 @@ void CollisionHandlerFactory::createNeutronMaterials(
                             Teuchos::Array<double> >& material_id_fraction_map,
    const boost::unordered_map<ModuleTraits::InternalMaterialHandle,
                       Teuchos::Array<std::string> >& material_id_component_map,
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>&
+   material_id_temperature_map,
+   const boost::unordered_map<std::string,Teuchos::Array<std::string> >&
+   isotope_temperature_table_aliases_map,
    const boost::unordered_set<std::string>& nuclide_aliases,
    const boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
                               std::vector<std::string> >& cell_id_mat_id_map,
@@ -342,10 +470,25 @@ void CollisionHandlerFactory::createNeutronMaterials(
    const bool use_unresolved_resonance_data,
    const bool use_photon_production_data )
 {
+  // Add the base temperature tables to the nuclides of interest
+  boost::unordered_set<std::string> all_nuclide_aliases( nuclide_aliases );
+
+  boost::unordered_map<std::string,Teuchos::Array<std::string> >::const_iterator
+    isotope_table_aliases_it = isotope_temperature_table_aliases_map.begin();
+
+  while( isotope_table_aliases_it != 
+	 isotope_temperature_table_aliases_map.end() )
+  {
+    all_nuclide_aliases.insert( isotope_table_aliases_it->second.begin(),
+				isotope_table_aliases_it->second.end() );
+    
+    ++isotope_table_aliases_it;
+  }
+  
   // Load the nuclides of interest
   NuclideFactory nuclide_factory( cross_sections_xml_directory,
 				  cross_sections_table_info,
-				  nuclide_aliases,
+				  all_nuclide_aliases,
 				  use_unresolved_resonance_data,
 				  use_photon_production_data,
 				  d_os_warn );
@@ -354,6 +497,51 @@ void CollisionHandlerFactory::createNeutronMaterials(
 
   nuclide_factory.createNuclideMap( nuclide_map );
 
+  // Separate the cells with temperature interpolated materials
+  boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+		       std::vector<std::string> > 
+    standard_cell_id_mat_id_map, standard_cell_id_density_map,
+    temperature_cell_id_mat_id_map, temperature_cell_id_density_map;
+
+  boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+		       std::vector<std::string> >::const_iterator
+    cell_id_mat_id_it = cell_id_mat_id_map.begin();
+
+  while( cell_id_mat_id_it != cell_id_mat_id_map.end() )
+  {
+    Geometry::ModuleTraits::InternalCellHandle cell_id = 
+      cell_id_mat_id_it->first;
+    
+    bool temperature_material = false;
+    
+    if( cell_id_mat_id_it->second.size() == 1 )
+    {
+      ModuleTraits::InternalMaterialHandle material_id;
+
+      std::istringstream iss( cell_id_mat_id_it->second.front() );
+    
+      iss >> material_id;
+
+      temperature_material = material_id_temperature_map.find( material_id )
+	!= material_id_temperature_map.end();
+    }
+
+    if( temperature_material )
+    {
+      temperature_cell_id_mat_id_map[cell_id] = cell_id_mat_id_it->second;
+      temperature_cell_id_density_map[cell_id] = 
+	cell_id_density_map.find( cell_id )->second;
+    }
+    else
+    {
+      standard_cell_id_mat_id_map[cell_id] = cell_id_mat_id_it->second;
+      standard_cell_id_density_map[cell_id] = 
+	cell_id_density_map.find( cell_id )->second;
+    }
+    
+    ++cell_id_mat_id_it;
+  }
+
   // Create the material name data maps
   boost::unordered_map<std::string,Teuchos::RCP<NeutronMaterial> >
     material_name_pointer_map;
@@ -366,16 +554,130 @@ void CollisionHandlerFactory::createNeutronMaterials(
 						  material_id_fraction_map,
 						  material_id_component_map,
 						  nuclide_map,
-						  cell_id_mat_id_map,
-						  cell_id_density_map,
+						  standard_cell_id_mat_id_map,
+						  standard_cell_id_density_map,
 						  material_name_pointer_map,
 						  material_name_cell_ids_map );
 
+  if( temperature_cell_id_mat_id_map.size() > 0 )
+  {
+    // Create the nuclide temperature table map
+    NeutronMaterial::NuclideTemperatureTableMap nuclide_temperature_table_map;
+
+    isotope_table_aliases_it = isotope_temperature_table_aliases_map.begin();
+
+    while( isotope_table_aliases_it != 
+	   isotope_temperature_table_aliases_map.end() )
+    {
+      Teuchos::Array<Teuchos::RCP<Nuclide> >& tables = 
+	nuclide_temperature_table_map[isotope_table_aliases_it->first];
+
+      for( unsigned i = 0; i < isotope_table_aliases_it->second.size(); ++i )
+      {
+	tables.push_back( 
+	      nuclide_map.find( isotope_table_aliases_it->second[i] )->second );
+      }
+      
+      ++isotope_table_aliases_it;
+    }
+    
+    CollisionHandlerFactory::createTemperatureInterpolatedNeutronMaterials(
+					      material_id_fraction_map,
+					      material_id_component_map,
+					      material_id_temperature_map,
+					      nuclide_temperature_table_map,
+					      temperature_cell_id_mat_id_map,
+					      temperature_cell_id_density_map,
+					      material_name_pointer_map,
+					      material_name_cell_ids_map );
+  }
+
   // Register materials with the collision handler
   CollisionHandlerFactory::registerMaterials( material_name_pointer_map,
 					      material_name_cell_ids_map );
 }
 
+// Create the temperature interpolated neutron materials
+/*! \details The material names will be created in the same way as in
+ * MonteCarlo::CollisionHandlerFactory::createMaterialNameDataMaps (the
+ * material temperature is a property of the material id).
+ */
+void CollisionHandlerFactory::createTemperatureInterpolatedNeutronMaterials(
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,
+                            Teuchos::Array<double> >& material_id_fraction_map,
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,
+                      Teuchos::Array<std::string> >& material_id_component_map,
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>&
+   material_id_temperature_map,
+   const NeutronMaterial::NuclideTemperatureTableMap& 
+   nuclide_temperature_table_map,
+   const boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+                              std::vector<std::string> >& cell_id_mat_id_map,
+   const boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+                               std::vector<std::string> >& cell_id_density_map,
+   boost::unordered_map<std::string,Teuchos::RCP<NeutronMaterial> >&
+   material_name_pointer_map,
+   boost::unordered_map<std::string,
+                  Teuchos::Array<Geometry::ModuleTraits::InternalCellHandle> >&
+   material_name_cell_ids_map )
+{
+  // Make sure the cell data maps have the same size
+  testPrecondition( cell_id_mat_id_map.size() == cell_id_density_map.size() );
+
+  boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+                       std::vector<std::string> >::const_iterator 
+    cell_id_mat_id_it = cell_id_mat_id_map.begin();
+
+  while( cell_id_mat_id_it != cell_id_mat_id_map.end() )
+  {
+    Geometry::ModuleTraits::InternalCellHandle cell_id = 
+      cell_id_mat_id_it->first;
+    
+    const std::vector<std::string>& cell_densities = 
+      cell_id_density_map.find( cell_id )->second;
+    
+    TEST_FOR_EXCEPTION( cell_densities.size() > 1,
+			InvalidMaterialRepresentation,
+			"Error: " << cell_densities.size() << 
+			" densities set to cell " << cell_id << "!" );
+
+    std::istringstream iss( cell_id_mat_id_it->second[0] );
+
+    ModuleTraits::InternalMaterialHandle material_id;
+
+    iss >> material_id;
+
+    std::istringstream density_iss( cell_densities[0] );
+
+    double density;
+
+    density_iss >> density;
+
+    std::string material_name( cell_id_mat_id_it->second[0] );
+    material_name += "_";
+    material_name += cell_densities[0];
+
+    if( material_name_pointer_map.find( material_name ) == 
+	material_name_pointer_map.end() )
+    {
+      Teuchos::RCP<NeutronMaterial>& new_material = 
+	material_name_pointer_map[material_name];
+
+      new_material.reset( new NeutronMaterial( 
+		     material_id,
+		     density,
+		     material_id_temperature_map.find( material_id )->second,
+		     nuclide_temperature_table_map,
+		     material_id_fraction_map.find( material_id )->second,
+		     material_id_component_map.find( material_id )->second ) );
+    }
+
+    material_name_cell_ids_map[material_name].push_back( cell_id );
+
+    ++cell_id_mat_id_it;
+  }
+}
+
 // Create the photon materials
 void CollisionHandlerFactory::createPhotonMaterials(
    const Teuchos::ParameterList& cross_sections_table_info,
@@ -496,6 +798,23 @@ void CollisionHandlerFactory::createElectronMaterials(
 						  material_name_pointer_map,
 						  material_name_cell_ids_map );
 
+  // Tabulate the thick-target bremsstrahlung photon yields
+  if( SimulationGeneralProperties::getParticleMode() == PHOTON_MODE &&
+      SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() )
+  {
+    boost::unordered_map<std::string,Teuchos::RCP<ElectronMaterial> >::
+      iterator material = material_name_pointer_map.begin();
+
+    while( material != material_name_pointer_map.end() )
+    {
+      material->second->tabulateThickTargetBremsstrahlungYield(
+		      SimulationElectronProperties::getMinElectronEnergy(),
+		      SimulationElectronProperties::getMaxElectronEnergy() );
+
+      ++material;
+    }
+  }
+
   // Register materials with the collision handler
   CollisionHandlerFactory::registerMaterials( material_name_pointer_map,
                                               material_name_cell_ids_map );
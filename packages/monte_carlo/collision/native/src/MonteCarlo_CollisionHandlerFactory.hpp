@@ -77,6 +77,17 @@ protected:
     boost::unordered_map<ModuleTraits::InternalMaterialHandle,
                     Teuchos::Array<std::string> >& material_id_component_map );
 
+  //! Create the material id temperature data maps
+  static void createMaterialIdTemperatureDataMaps(
+    const Teuchos::ParameterList& material_reps,
+    const Teuchos::ParameterList& cross_sections_alias_map,
+    const Teuchos::ParameterList& cross_sections_table_info,
+    const std::string& cross_sections_xml_directory,
+    boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>&
+    material_id_temperature_map,
+    boost::unordered_map<std::string,Teuchos::Array<std::string> >&
+    isotope_temperature_table_aliases_map );
+
   //! Create the neutron materials
   void createNeutronMaterials( 
    const Teuchos::ParameterList& cross_sections_table_info,
@@ -85,6 +96,10 @@ protected:
                             Teuchos::Array<double> >& material_id_fraction_map,
    const boost::unordered_map<ModuleTraits::InternalMaterialHandle,
                       Teuchos::Array<std::string> >& material_id_component_map,
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>&
+   material_id_temperature_map,
+   const boost::unordered_map<std::string,Teuchos::Array<std::string> >&
+   isotope_temperature_table_aliases_map,
    const boost::unordered_set<std::string>& nuclide_aliases,
    const boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
                               std::vector<std::string> >& cell_id_mat_id_map,
@@ -165,6 +180,26 @@ protected:
 
 private:
 
+  // Create the temperature interpolated neutron materials
+  static void createTemperatureInterpolatedNeutronMaterials(
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,
+                            Teuchos::Array<double> >& material_id_fraction_map,
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,
+                      Teuchos::Array<std::string> >& material_id_component_map,
+   const boost::unordered_map<ModuleTraits::InternalMaterialHandle,double>&
+   material_id_temperature_map,
+   const NeutronMaterial::NuclideTemperatureTableMap& 
+   nuclide_temperature_table_map,
+   const boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+                              std::vector<std::string> >& cell_id_mat_id_map,
+   const boost::unordered_map<Geometry::ModuleTraits::InternalCellHandle,
+                               std::vector<std::string> >& cell_id_density_map,
+   boost::unordered_map<std::string,Teuchos::RCP<NeutronMaterial> >&
+   material_name_pointer_map,
+   boost::unordered_map<std::string,
+                  Teuchos::Array<Geometry::ModuleTraits::InternalCellHandle> >&
+   material_name_cell_ids_map );
+
   // Copy constructor
   CollisionHandlerFactory( const CollisionHandlerFactory& copy );
 
@@ -91,6 +91,28 @@ public:
   static void collideWithCellMaterial( ElectronState& particle,
 				       ParticleBank& bank,
 				       const bool analogue );
+
+  //! Get the hard macroscopic cross section of a material
+  static double getMacroscopicHardCrossSection( const ElectronState& particle );
+
+  //! Get the soft stopping power of a material
+  static double getSoftStoppingPower( const ElectronState& particle );
+
+  //! Get the soft macroscopic transport cross section of a material
+  static double getMacroscopicSoftTransportCrossSection( 
+                                                const ElectronState& particle );
+
+  //! Collide with the material in a cell using only the hard reactions
+  static void collideHardWithCellMaterial( ElectronState& particle,
+                                           ParticleBank& bank );
+
+  //! Emit the thick-target bremsstrahlung photons of an electron in a cell
+  static void emitThickTargetBremsstrahlungInCellMaterial( 
+                                                const ElectronState& particle,
+                                                ParticleBank& bank );
+
+  //! Reset the particle dependent data before a new particle is transported
+  static void startNewParticle();
 };
 
 
@@ -222,6 +244,53 @@ CollisionModuleInterface<CollisionHandler>::collideWithCellMaterial(
                                              analogue );
 }
 
+// Get the hard macroscopic cross section of a material
+inline double 
+CollisionModuleInterface<CollisionHandler>::getMacroscopicHardCrossSection(
+					        const ElectronState& particle )
+{
+  return CollisionHandler::getMacroscopicHardCrossSection( particle );
+}
+
+// Get the soft stopping power of a material
+inline double 
+CollisionModuleInterface<CollisionHandler>::getSoftStoppingPower(
+					        const ElectronState& particle )
+{
+  return CollisionHandler::getSoftStoppingPower( particle );
+}
+
+// Get the soft macroscopic transport cross section of a material
+inline double CollisionModuleInterface<CollisionHandler>::getMacroscopicSoftTransportCrossSection(
+					        const ElectronState& particle )
+{
+  return CollisionHandler::getMacroscopicSoftTransportCrossSection( particle );
+}
+
+// Collide with the material in a cell using only the hard reactions
+inline void 
+CollisionModuleInterface<CollisionHandler>::collideHardWithCellMaterial( 
+						       ElectronState& particle,
+						       ParticleBank& bank )
+{
+  CollisionHandler::collideHardWithCellMaterial( particle, bank );
+}
+
+// Emit the thick-target bremsstrahlung photons of an electron in a cell
+inline void CollisionModuleInterface<CollisionHandler>::emitThickTargetBremsstrahlungInCellMaterial( 
+						 const ElectronState& particle,
+						 ParticleBank& bank )
+{
+  CollisionHandler::emitThickTargetBremsstrahlungInCellMaterial( particle, 
+                                                                 bank );
+}
+
+// Reset the particle dependent data before a new particle is transported
+inline void CollisionModuleInterface<CollisionHandler>::startNewParticle()
+{
+  CollisionHandler::startNewParticle();
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_COLLISION_MODULE_INTERFACE_NATIVE_HPP
@@ -6,9 +6,14 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <limits>
+
 // FRENSIE Includes
 #include "MonteCarlo_CompleteDopplerBroadenedPhotonEnergyDistribution.hpp"
+#include "MonteCarlo_PhotonKinematicsHelpers.hpp"
 #include "Utility_DiscreteDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -44,6 +49,138 @@ void CompleteDopplerBroadenedPhotonEnergyDistribution::sampleENDFInteractionSubs
   shell_of_interaction = d_endf_subshell_order[shell_index];
 }
 
+// Sample an outgoing energy from the accessible subshells (no rejection)
+/*! \details A subshell is accessible if the incoming energy is above its
+ * binding energy and the maximum electron momentum projection is inside of
+ * its Compton profile grid. The interaction subshell is sampled directly 
+ * from the occupancies of the accessible subshells, which removes the 
+ * rejection of inaccessible subshells (the dominant source of rejection
+ * at low energies in high Z atoms). The electron momentum projection is then
+ * sampled from the tabulated Compton profile cdf of the subshell (inverse 
+ * cdf sampling restricted to the allowed range). Only the rare momentum 
+ * projections that are not energetically possible will be resampled. If 
+ * there are no accessible subshells or a valid energy cannot be sampled,
+ * false will be returned. 
+ */
+bool CompleteDopplerBroadenedPhotonEnergyDistribution::sampleFromAccessibleSubshells( 
+		    const double incoming_energy,
+		    const double scattering_angle_cosine,
+		    const Teuchos::Array<double>& subshell_occupancies,
+		    const Teuchos::Array<double>& subshell_binding_energies,
+		    const Teuchos::Array<unsigned>& compton_profile_indices,
+		    const ElectronMomentumDistArray& electron_momentum_dists,
+		    const bool half_profiles,
+		    double& outgoing_energy,
+		    unsigned& shell_index,
+		    unsigned& trials )
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+  // Make sure the subshell data is valid
+  testPrecondition( subshell_binding_energies.size() == 
+		    subshell_occupancies.size() );
+  testPrecondition( compton_profile_indices.size() == 
+		    subshell_occupancies.size() );
+
+  // Calculate the total occupancy of the accessible subshells
+  double accessible_occupancy = 0.0;
+
+  for( unsigned i = 0; i < subshell_occupancies.size(); ++i )
+  {
+    if( incoming_energy > subshell_binding_energies[i] )
+    {
+      const double pz_max = calculateMaxElectronMomentumProjection(
+						 incoming_energy,
+						 subshell_binding_energies[i],
+						 scattering_angle_cosine );
+
+      if( pz_max >= electron_momentum_dists[compton_profile_indices[i]]->getLowerBoundOfIndepVar() )
+	accessible_occupancy += subshell_occupancies[i];
+    }
+  }
+
+  if( accessible_occupancy <= 0.0 )
+  {
+    ++trials;
+    
+    return false;
+  }
+
+  // Sample an accessible subshell
+  const double scaled_random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    accessible_occupancy;
+
+  double partial_occupancy = 0.0;
+  double pz_max = 0.0;
+
+  shell_index = subshell_occupancies.size();
+
+  for( unsigned i = 0; i < subshell_occupancies.size(); ++i )
+  {
+    if( incoming_energy > subshell_binding_energies[i] )
+    {
+      const double subshell_pz_max = calculateMaxElectronMomentumProjection(
+						 incoming_energy,
+						 subshell_binding_energies[i],
+						 scattering_angle_cosine );
+
+      if( subshell_pz_max >= electron_momentum_dists[compton_profile_indices[i]]->getLowerBoundOfIndepVar() )
+      {
+	partial_occupancy += subshell_occupancies[i];
+
+	// Roundoff can cause the last accessible subshell to be missed
+	shell_index = i;
+	pz_max = subshell_pz_max;
+
+	if( scaled_random_number < partial_occupancy )
+	  break;
+      }
+    }
+  }
+  
+  // Get the Compton profile for the sampled subshell
+  const Utility::TabularOneDDistribution& compton_profile = 
+    *electron_momentum_dists[compton_profile_indices[shell_index]];
+
+  if( pz_max > compton_profile.getUpperBoundOfIndepVar() )
+    pz_max = compton_profile.getUpperBoundOfIndepVar();
+
+  // Sample an energetically possible electron momentum projection
+  for( unsigned iterations = 0u; iterations < 1000u; ++iterations )
+  {
+    ++trials;
+    
+    double pz = compton_profile.sampleInSubrange( pz_max );
+
+    if( half_profiles )
+    {
+      if( Utility::RandomNumberGenerator::getRandomNumber<double>() <= 0.5 )
+	pz *= -1.0;
+    }
+
+    bool energetically_possible;
+
+    outgoing_energy = calculateDopplerBroadenedEnergy(pz,
+						      incoming_energy,
+						      scattering_angle_cosine,
+						      energetically_possible );
+
+    if( energetically_possible && outgoing_energy >= 0.0 )
+    {
+      if( outgoing_energy == 0.0 )
+	outgoing_energy = std::numeric_limits<double>::min();
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
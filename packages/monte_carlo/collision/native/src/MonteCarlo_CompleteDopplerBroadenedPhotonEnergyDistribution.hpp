@@ -62,6 +62,22 @@ protected:
   void sampleENDFInteractionSubshell( SubshellType& shell_of_interaction,
 				      unsigned& shell_index ) const;
 
+  // Return the ENDF subshell at the desired index
+  SubshellType getENDFSubshell( const unsigned shell_index ) const;
+
+  // Sample an outgoing energy from the accessible subshells (no rejection)
+  static bool sampleFromAccessibleSubshells( 
+		    const double incoming_energy,
+		    const double scattering_angle_cosine,
+		    const Teuchos::Array<double>& subshell_occupancies,
+		    const Teuchos::Array<double>& subshell_binding_energies,
+		    const Teuchos::Array<unsigned>& compton_profile_indices,
+		    const ElectronMomentumDistArray& electron_momentum_dists,
+		    const bool half_profiles,
+		    double& outgoing_energy,
+		    unsigned& shell_index,
+		    unsigned& trials );
+
 private:
 
   // The ENDF subshell interaction probabilities
@@ -72,6 +88,17 @@ private:
   Teuchos::Array<SubshellType> d_endf_subshell_order;
 };
 
+// Return the ENDF subshell at the desired index
+inline SubshellType 
+CompleteDopplerBroadenedPhotonEnergyDistribution::getENDFSubshell(
+					       const unsigned shell_index ) const
+{
+  // Make sure the shell index is valid
+  testPrecondition( shell_index < d_endf_subshell_order.size() );
+  
+  return d_endf_subshell_order[shell_index];
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_COMPLETE_DOPPLER_BROADENED_PHOTON_ENERGY_DISTRIBUTION_HPP
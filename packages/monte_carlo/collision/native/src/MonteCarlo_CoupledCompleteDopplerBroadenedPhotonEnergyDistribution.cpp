@@ -18,20 +18,27 @@ namespace MonteCarlo{
 /*! \details The Compton profile grids must be in me*c units (not atomic 
  * units). The Compton profiles must be in inverse me*c units (not inverse 
  * atomic units). Only half profiles should be provided (grid ranges from 0.0 
- * to 1.0).
+ * to 1.0). When inverse cdf sampling is used the interaction subshell will
+ * be sampled directly from the accessible subshells instead of with the
+ * rejection loop (see 
+ * MonteCarlo::CompleteDopplerBroadenedPhotonEnergyDistribution::sampleFromAccessibleSubshells).
  */
 CoupledCompleteDopplerBroadenedPhotonEnergyDistribution::CoupledCompleteDopplerBroadenedPhotonEnergyDistribution(
        const Teuchos::Array<double>& subshell_binding_energies,
        const Teuchos::Array<double>& subshell_occupancies,
        const Teuchos::Array<SubshellType>& subshell_order,
        const Teuchos::RCP<ComptonProfileSubshellConverter>& subshell_converter,
-       const ElectronMomentumDistArray& electron_momentum_dist_array )
+       const ElectronMomentumDistArray& electron_momentum_dist_array,
+       const bool use_inverse_cdf_sampling )
   : CompleteDopplerBroadenedPhotonEnergyDistribution( subshell_occupancies,
 						      subshell_order ),
     d_subshell_converter( subshell_converter ),
     d_subshell_binding_energies( subshell_binding_energies ),
     d_half_profiles( true ),
-    d_electron_momentum_distribution( electron_momentum_dist_array )
+    d_electron_momentum_distribution( electron_momentum_dist_array ),
+    d_subshell_occupancies( subshell_occupancies ),
+    d_subshell_compton_profile_indices( subshell_order.size() ),
+    d_inverse_cdf_sampling( use_inverse_cdf_sampling )
 {
   // Make sure the shell interaction data is valid
   testPrecondition( subshell_occupancies.size() > 0 );
@@ -51,6 +58,13 @@ CoupledCompleteDopplerBroadenedPhotonEnergyDistribution::CoupledCompleteDopplerB
     d_half_profiles = false;
   else
     d_half_profiles = true;
+
+  // Cache the Compton profile index of each subshell
+  for( unsigned i = 0; i < subshell_order.size(); ++i )
+  {
+    d_subshell_compton_profile_indices[i] = 
+      d_subshell_converter->convertSubshellToIndex( subshell_order[i] );
+  }
 }
 
 // Evaluate the distribution
@@ -143,10 +157,75 @@ void CoupledCompleteDopplerBroadenedPhotonEnergyDistribution::sampleAndRecordTri
   testPrecondition( scattering_angle_cosine >= -1.0 );
   testPrecondition( scattering_angle_cosine <= 1.0 );
 
-  const double compton_line_energy = calculateComptonLineEnergy( 
-						     incoming_energy,
-						     scattering_angle_cosine );
+  // Record if a valid Doppler broadening energy is calculated
+  bool valid_doppler_broadening;
+
+  if( d_inverse_cdf_sampling )
+  {
+    unsigned shell_index;
+    
+    valid_doppler_broadening = this->sampleFromAccessibleSubshells(
+					  incoming_energy,
+					  scattering_angle_cosine,
+					  d_subshell_occupancies,
+					  d_subshell_binding_energies,
+					  d_subshell_compton_profile_indices,
+					  d_electron_momentum_distribution,
+					  d_half_profiles,
+					  outgoing_energy,
+					  shell_index,
+					  trials );
+
+    if( valid_doppler_broadening )
+      shell_of_interaction = this->getENDFSubshell( shell_index );
+    else
+    {
+      // No subshell is accessible - sample the subshell from all subshells
+      this->sampleENDFInteractionSubshell( shell_of_interaction,
+					   shell_index );
+    }
+  }
+  else
+  {
+    valid_doppler_broadening = this->sampleAndRecordTrialsRejection(
+						       incoming_energy,
+						       scattering_angle_cosine,
+						       outgoing_energy,
+						       shell_of_interaction,
+						       trials );
+  }
+
+  if( !valid_doppler_broadening )
+  {
+    // Should the interaction shell be reset?
+    // shell_of_interaction = UNKNOWN_SUBSHELL;
+    
+    // reset the outgoing energy
+    outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+						  scattering_angle_cosine );
+  }
+
+  // Make sure the outgoing energy is valid
+  testPostcondition( outgoing_energy <= incoming_energy );
+  testPostcondition( outgoing_energy > 0.0 );
+  // Make sure the interaction subshell is valid
+  testPostcondition( shell_of_interaction != UNKNOWN_SUBSHELL );
+  testPostcondition( shell_of_interaction != INVALID_SUBSHELL );
+}
 
+// Sample an outgoing energy using the rejection loop
+/*! \details This is the original sampling procedure. A subshell is sampled
+ * from all subshells and rejected if it is not accessible. It is kept as a 
+ * verification path for the inverse cdf sampling procedure. If a valid
+ * energy cannot be sampled in 1000 iterations, false will be returned.
+ */
+bool CoupledCompleteDopplerBroadenedPhotonEnergyDistribution::sampleAndRecordTrialsRejection( 
+				     const double incoming_energy,
+				     const double scattering_angle_cosine,
+				     double& outgoing_energy,
+				     SubshellType& shell_of_interaction,
+				     unsigned& trials ) const
+{
   // Record if a valid Doppler broadening energy is calculated
   bool valid_doppler_broadening = false;
 
@@ -228,21 +307,7 @@ void CoupledCompleteDopplerBroadenedPhotonEnergyDistribution::sampleAndRecordTri
   // Increment the number of trials
   trials += iterations;
 
-  if( !valid_doppler_broadening )
-  {
-    // Should the interaction shell be reset?
-    // shell_of_interaction = UNKNOWN_SUBSHELL;
-    
-    // reset the outgoing energy
-    outgoing_energy = compton_line_energy;
-  }
-
-  // Make sure the outgoing energy is valid
-  testPostcondition( outgoing_energy <= incoming_energy );
-  testPostcondition( outgoing_energy > 0.0 );
-  // Make sure the interaction subshell is valid
-  testPostcondition( shell_of_interaction != UNKNOWN_SUBSHELL );
-  testPostcondition( shell_of_interaction != INVALID_SUBSHELL );
+  return valid_doppler_broadening;
 }
 
 } // end MonteCarlo namespace
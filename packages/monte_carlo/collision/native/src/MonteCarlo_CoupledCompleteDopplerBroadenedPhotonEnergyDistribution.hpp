@@ -27,7 +27,8 @@ public:
        const Teuchos::Array<double>& subshell_occupancies,
        const Teuchos::Array<SubshellType>& subshell_order,
        const Teuchos::RCP<ComptonProfileSubshellConverter>& subshell_converter,
-       const ElectronMomentumDistArray& electron_momentum_dist_array );
+       const ElectronMomentumDistArray& electron_momentum_dist_array,
+       const bool use_inverse_cdf_sampling = false );
 
   //! Destructor
   virtual ~CoupledCompleteDopplerBroadenedPhotonEnergyDistribution()
@@ -68,6 +69,9 @@ public:
 					  const SubshellType subshell,
 					  const double precision ) const;
 
+  //! Check if inverse cdf sampling is used
+  bool isInverseCDFSamplingUsed() const;
+
   //! Sample an outgoing energy from the distribution
   void sample( const double incoming_energy,
 	       const double scattering_angle_cosine,
@@ -83,6 +87,13 @@ public:
 
 private:
 
+  // Sample an outgoing energy using the rejection loop
+  bool sampleAndRecordTrialsRejection( const double incoming_energy,
+				       const double scattering_angle_cosine,
+				       double& outgoing_energy,
+				       SubshellType& shell_of_interaction,
+				       unsigned& trials ) const;
+
   // The Compton profile subshell converter
   Teuchos::RCP<ComptonProfileSubshellConverter> d_subshell_converter;
 
@@ -94,8 +105,24 @@ private:
 
   // The electron momentum dist array
   ElectronMomentumDistArray d_electron_momentum_distribution;
+
+  // The subshell occupancies
+  Teuchos::Array<double> d_subshell_occupancies;
+
+  // The Compton profile index of each subshell
+  Teuchos::Array<unsigned> d_subshell_compton_profile_indices;
+
+  // Records if inverse cdf sampling is used (instead of the rejection loop)
+  bool d_inverse_cdf_sampling;
 };
 
+// Check if inverse cdf sampling is used
+inline bool 
+CoupledCompleteDopplerBroadenedPhotonEnergyDistribution::isInverseCDFSamplingUsed() const
+{
+  return d_inverse_cdf_sampling;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_COUPLED_COMPLETE_DOPPLER_BROADENED_PHOTON_ENERGY_DISTRIBUTION_HPP
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_CrossSectionsXMLProperties.hpp"
 #include "Utility_PhysicalConstants.hpp"
@@ -330,6 +333,242 @@ void CrossSectionsXMLProperties::extractInfoFromNuclideTableInfoParameterList(
 			   " is invalid! Please fix this entry." );
 }
 
+// Extract the S(alpha,beta) table info from the nuclide table info list
+/*! \details The S(alpha,beta) table of a bound nuclide is optional. If the
+ * nuclide table entry does not have an S(alpha,beta) file path false will be
+ * returned and the other arguments will not be modified.
+ */
+bool 
+CrossSectionsXMLProperties::extractSAlphaBetaInfoFromNuclideTableInfoParameterList(
+			const std::string& cross_sections_xml_directory,
+			const std::string& nuclide_alias,
+			const Teuchos::ParameterList& cross_section_table_info,
+			std::string& data_file_path,
+			std::string& data_file_type,
+			std::string& data_file_table_name,
+			int& data_file_start_line )
+{
+  Teuchos::ParameterList nuclide_table_info;
+  
+  try{
+    nuclide_table_info = cross_section_table_info.sublist( nuclide_alias );
+  }
+  EXCEPTION_CATCH_AND_EXIT( std::exception,
+			    "There is no data present in the "
+			    "cross_sections.xml file at "
+			    << cross_sections_xml_directory <<
+			    " for nuclide " << nuclide_alias << "!" );
+
+  if( !nuclide_table_info.isParameter( 
+		    CrossSectionsXMLProperties::s_alpha_beta_file_path_prop ) )
+    return false;
+
+  data_file_path = cross_sections_xml_directory + "/";
+
+  try{
+    data_file_path += nuclide_table_info.get<std::string>( 
+		     CrossSectionsXMLProperties::s_alpha_beta_file_path_prop );
+  }
+  EXCEPTION_CATCH_RETHROW( Teuchos::Exceptions::InvalidParameter,
+			   "Error: cross section table entry "
+			   << nuclide_alias <<
+			   " is invalid! Please fix this entry." );
+  
+  try{ 
+    data_file_type = nuclide_table_info.get<std::string>( 
+		     CrossSectionsXMLProperties::s_alpha_beta_file_type_prop );
+  }
+  EXCEPTION_CATCH_RETHROW( Teuchos::Exceptions::InvalidParameter,
+			   "Error: cross section table entry "
+			   << nuclide_alias <<
+			   " is invalid! Please fix this entry." );
+
+  try{
+    data_file_table_name = nuclide_table_info.get<std::string>( 
+		    CrossSectionsXMLProperties::s_alpha_beta_table_name_prop );
+  }
+  EXCEPTION_CATCH_RETHROW( Teuchos::Exceptions::InvalidParameter,
+			   "Error: cross section table entry "
+			   << nuclide_alias <<
+			   " is invalid! Please fix this entry." );
+
+  try{
+    data_file_start_line = nuclide_table_info.get<int>( 
+	       CrossSectionsXMLProperties::s_alpha_beta_file_start_line_prop );
+  }
+  EXCEPTION_CATCH_RETHROW( Teuchos::Exceptions::InvalidParameter,
+			   "Error: cross section table entry "
+			   << nuclide_alias <<
+			   " is invalid! Please fix this entry." );
+
+  return true;
+}
+
+// Extract the aliases of every nuclear table of the nuclide
+/*! \details Every table entry with nuclear data that has the same atomic
+ * number, atomic mass number and isomer number as the requested nuclide
+ * entry will be added (the requested alias will be included). These tables
+ * are typically evaluated at different temperatures and can be used as the
+ * base tables for on-the-fly temperature interpolation.
+ */
+void CrossSectionsXMLProperties::extractNuclideTemperatureTableAliases(
+			const std::string& cross_sections_xml_directory,
+			const std::string& nuclide_alias,
+			const Teuchos::ParameterList& cross_section_table_info,
+			Teuchos::Array<std::string>& table_aliases )
+{
+  table_aliases.clear();
+  
+  std::string data_file_path, data_file_type, data_file_table_name;
+  int data_file_start_line;
+  int atomic_number, atomic_mass_number, isomer_number;
+  double atomic_weight_ratio, temperature;
+
+  CrossSectionsXMLProperties::extractInfoFromNuclideTableInfoParameterList(
+						  cross_sections_xml_directory,
+						  nuclide_alias,
+						  cross_section_table_info,
+						  data_file_path,
+						  data_file_type,
+						  data_file_table_name,
+						  data_file_start_line,
+						  atomic_number,
+						  atomic_mass_number,
+						  isomer_number,
+						  atomic_weight_ratio,
+						  temperature );
+
+  Teuchos::ParameterList::ConstIterator it = 
+    cross_section_table_info.begin();
+
+  while( it != cross_section_table_info.end() )
+  {
+    if( it->second.isList() )
+    {
+      const Teuchos::ParameterList& table_info = 
+	Teuchos::any_cast<Teuchos::ParameterList>( it->second.getAny() );
+
+      if( table_info.isParameter( 
+			  CrossSectionsXMLProperties::nuclear_file_path_prop ) &&
+	  table_info.isType<int>( 
+			      CrossSectionsXMLProperties::atomic_number_prop ) &&
+	  table_info.isType<int>( 
+			 CrossSectionsXMLProperties::atomic_mass_number_prop ) &&
+	  table_info.isType<int>( 
+			      CrossSectionsXMLProperties::isomer_number_prop ) )
+      {
+	if( table_info.get<int>( 
+		    CrossSectionsXMLProperties::atomic_number_prop ) == 
+	    atomic_number &&
+	    table_info.get<int>( 
+		    CrossSectionsXMLProperties::atomic_mass_number_prop ) == 
+	    atomic_mass_number &&
+	    table_info.get<int>( 
+		    CrossSectionsXMLProperties::isomer_number_prop ) ==
+	    isomer_number )
+	{
+	  table_aliases.push_back( cross_section_table_info.name( it ) );
+	}
+      }
+    }
+
+    ++it;
+  }
+
+  // Make sure the requested nuclide table was found
+  testPostcondition( table_aliases.size() > 0 );
+}
+
+// Extract the aliases of the nuclear tables that bracket a temperature
+/*! \details Of the nuclear tables of the nuclide (see 
+ * extractNuclideTemperatureTableAliases) only the table with the highest 
+ * temperature not above the requested temperature and the table with the
+ * lowest temperature not below the requested temperature will be added. If
+ * the temperature is outside of the range covered by the tables only the
+ * closest table will be added. When several tables have the same 
+ * temperature the requested nuclide table will be preferred. The aliases 
+ * are appended to the array (aliases that are already present will not be
+ * added again) so that the tables needed by several temperatures can be 
+ * collected. The temperature must be in MeV.
+ */
+void CrossSectionsXMLProperties::extractNuclideBracketingTemperatureTableAliases(
+			const std::string& cross_sections_xml_directory,
+			const std::string& nuclide_alias,
+			const Teuchos::ParameterList& cross_section_table_info,
+			const double temperature,
+			Teuchos::Array<std::string>& table_aliases )
+{
+  // Make sure the temperature is valid
+  testPrecondition( temperature >= 0.0 );
+  
+  Teuchos::Array<std::string> nuclide_table_aliases;
+
+  CrossSectionsXMLProperties::extractNuclideTemperatureTableAliases(
+						  cross_sections_xml_directory,
+						  nuclide_alias,
+						  cross_section_table_info,
+						  nuclide_table_aliases );
+
+  std::string lower_table_alias, upper_table_alias;
+  double lower_table_temperature, upper_table_temperature;
+
+  for( unsigned i = 0; i < nuclide_table_aliases.size(); ++i )
+  {
+    const Teuchos::ParameterList& table_info = 
+      cross_section_table_info.sublist( nuclide_table_aliases[i] );
+
+    double table_temperature;
+
+    try{
+      table_temperature = table_info.get<double>( 
+				CrossSectionsXMLProperties::temperature_prop );
+    }
+    EXCEPTION_CATCH_RETHROW( Teuchos::Exceptions::InvalidParameter,
+			     "Error: cross section table entry "
+			     << nuclide_table_aliases[i] <<
+			     " is invalid! Please fix this entry." );
+
+    const bool requested_table = nuclide_table_aliases[i] == nuclide_alias;
+
+    if( table_temperature <= temperature )
+    {
+      if( lower_table_alias.empty() ||
+	  table_temperature > lower_table_temperature ||
+	  (table_temperature == lower_table_temperature && requested_table) )
+      {
+	lower_table_alias = nuclide_table_aliases[i];
+	lower_table_temperature = table_temperature;
+      }
+    }
+
+    if( table_temperature >= temperature )
+    {
+      if( upper_table_alias.empty() ||
+	  table_temperature < upper_table_temperature ||
+	  (table_temperature == upper_table_temperature && requested_table) )
+      {
+	upper_table_alias = nuclide_table_aliases[i];
+	upper_table_temperature = table_temperature;
+      }
+    }
+  }
+
+  if( !lower_table_alias.empty() &&
+      std::find( table_aliases.begin(), 
+		 table_aliases.end(), 
+		 lower_table_alias ) == table_aliases.end() )
+    table_aliases.push_back( lower_table_alias );
+
+  if( !upper_table_alias.empty() &&
+      std::find( table_aliases.begin(), 
+		 table_aliases.end(), 
+		 upper_table_alias ) == table_aliases.end() )
+    table_aliases.push_back( upper_table_alias );
+  
+  // Make sure at least one table was found
+  testPostcondition( table_aliases.size() > 0 );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -14,6 +14,7 @@
 
 // Trilinos Includes
 #include <Teuchos_ParameterList.hpp>
+#include <Teuchos_Array.hpp>
 #include <Teuchos_RCP.hpp>
 
 namespace MonteCarlo{
@@ -88,6 +89,31 @@ public:
 			int& isomer_number,
 			double& atomic_weight_ratio,
 			double& temperature );
+
+  //! Extract the S(alpha,beta) table info from the nuclide table info list
+  static bool extractSAlphaBetaInfoFromNuclideTableInfoParameterList(
+			const std::string& cross_sections_xml_directory,
+			const std::string& nuclide_alias,
+			const Teuchos::ParameterList& cross_section_table_info,
+			std::string& data_file_path,
+			std::string& data_file_type,
+			std::string& data_file_table_name,
+			int& data_file_start_line );
+
+  //! Extract the aliases of every nuclear table of the nuclide
+  static void extractNuclideTemperatureTableAliases(
+			const std::string& cross_sections_xml_directory,
+			const std::string& nuclide_alias,
+			const Teuchos::ParameterList& cross_section_table_info,
+			Teuchos::Array<std::string>& table_aliases );
+
+  //! Extract the aliases of the nuclear tables that bracket a temperature
+  static void extractNuclideBracketingTemperatureTableAliases(
+			const std::string& cross_sections_xml_directory,
+			const std::string& nuclide_alias,
+			const Teuchos::ParameterList& cross_section_table_info,
+			const double temperature,
+			Teuchos::Array<std::string>& table_aliases );
 };
 
 } // end MonteCarlo namespace
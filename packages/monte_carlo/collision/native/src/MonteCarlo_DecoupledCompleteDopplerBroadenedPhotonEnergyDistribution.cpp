@@ -19,21 +19,27 @@ namespace MonteCarlo{
 /*! \details The Compton profile grids must be in me*c units (not atomic 
  * units). The Compton profiles must be in inverse me*c units (not inverse 
  * atomic units). Only half profiles should be provided (grid ranges from 0.0 
- * to 1.0).
+ * to 1.0). When inverse cdf sampling is used the interaction subshell will
+ * be sampled directly from the accessible subshells instead of with the
+ * rejection loop (see 
+ * MonteCarlo::CompleteDopplerBroadenedPhotonEnergyDistribution::sampleFromAccessibleSubshells).
  */
 DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution::DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution(
 	       const Teuchos::Array<double>& endf_subshell_occupancies,
 	       const Teuchos::Array<SubshellType>& endf_subshell_order,
 	       const Teuchos::Array<double>& old_subshell_binding_energies,
 	       const Teuchos::Array<double>& old_subshell_occupancies,
-	       const ElectronMomentumDistArray& electron_momentum_dist_array )
+	       const ElectronMomentumDistArray& electron_momentum_dist_array,
+	       const bool use_inverse_cdf_sampling )
   : CompleteDopplerBroadenedPhotonEnergyDistribution(endf_subshell_occupancies,
 						     endf_subshell_order ),
     d_old_subshell_occupancy_distribution(),
     d_old_subshell_binding_energy( old_subshell_binding_energies ),
     d_old_subshell_occupancies( old_subshell_occupancies ),
     d_half_profiles( true ),
-    d_electron_momentum_distribution( electron_momentum_dist_array )
+    d_electron_momentum_distribution( electron_momentum_dist_array ),
+    d_old_subshell_compton_profile_indices( old_subshell_occupancies.size() ),
+    d_inverse_cdf_sampling( use_inverse_cdf_sampling )
 {
   // Make sure the shell interaction data is valid
   testPrecondition( endf_subshell_occupancies.size() > 0 );
@@ -63,6 +69,10 @@ DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution::DecoupledCompleteDopp
     d_half_profiles = false;
   else
     d_half_profiles = true;
+
+  // Each old subshell has its own Compton profile
+  for( unsigned i = 0; i < d_old_subshell_compton_profile_indices.size(); ++i )
+    d_old_subshell_compton_profile_indices[i] = i;
 }
 
 // Evaluate the distribution
@@ -195,6 +205,67 @@ void DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution::sampleAndRecordT
   testPrecondition( scattering_angle_cosine >= -1.0 );
   testPrecondition( scattering_angle_cosine <= 1.0 );
 
+  // Record if a valid Doppler broadening energy is calculated
+  bool valid_doppler_broadening;
+
+  if( d_inverse_cdf_sampling )
+  {
+    unsigned compton_shell_index;
+    
+    valid_doppler_broadening = this->sampleFromAccessibleSubshells(
+				      incoming_energy,
+				      scattering_angle_cosine,
+				      d_old_subshell_occupancies,
+				      d_old_subshell_binding_energy,
+				      d_old_subshell_compton_profile_indices,
+				      d_electron_momentum_distribution,
+				      d_half_profiles,
+				      outgoing_energy,
+				      compton_shell_index,
+				      trials );
+  }
+  else
+  {
+    valid_doppler_broadening = this->sampleAndRecordTrialsRejection(
+						       incoming_energy,
+						       scattering_angle_cosine,
+						       outgoing_energy,
+						       trials );
+  }
+
+  // reset the outgoing energy to the Compton line energy
+  if( !valid_doppler_broadening ) 
+  {   
+    outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+						  scattering_angle_cosine );
+  }
+
+  // The ENDF subshell is not sampled in this procedure
+  unsigned shell_index;
+  
+  this->sampleENDFInteractionSubshell( shell_of_interaction,
+				       shell_index );
+
+  // Make sure the outgoing energy is valid
+  testPostcondition( outgoing_energy <= incoming_energy );
+  testPostcondition( outgoing_energy > 0.0 );
+  // Make sure that the sampled subshell is valid
+  testPostcondition( shell_of_interaction != UNKNOWN_SUBSHELL );
+  testPostcondition( shell_of_interaction != INVALID_SUBSHELL );
+}
+
+// Sample an outgoing energy using the rejection loop
+/*! \details This is the original sampling procedure. A subshell is sampled
+ * from all subshells and rejected if it is not accessible. It is kept as a 
+ * verification path for the inverse cdf sampling procedure. If a valid
+ * energy cannot be sampled in 1000 iterations, false will be returned.
+ */
+bool DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution::sampleAndRecordTrialsRejection( 
+				     const double incoming_energy,
+				     const double scattering_angle_cosine,
+				     double& outgoing_energy,
+				     unsigned& trials ) const
+{
   // Record if a valid Doppler broadening energy is calculated
   bool valid_doppler_broadening = false;
 
@@ -307,25 +378,7 @@ void DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution::sampleAndRecordT
   // Increment the number of trials
   trials += iterations;
 
-  // reset the outgoing energy to the Compton line energy
-  if( !valid_doppler_broadening ) 
-  {   
-    outgoing_energy = calculateComptonLineEnergy( incoming_energy,
-						  scattering_angle_cosine );
-  }
-
-  // The ENDF subshell is not sampled in this procedure
-  unsigned shell_index;
-  
-  this->sampleENDFInteractionSubshell( shell_of_interaction,
-				       shell_index );
-
-  // Make sure the outgoing energy is valid
-  testPostcondition( outgoing_energy <= incoming_energy );
-  testPostcondition( outgoing_energy > 0.0 );
-  // Make sure that the sampled subshell is valid
-  testPostcondition( shell_of_interaction != UNKNOWN_SUBSHELL );
-  testPostcondition( shell_of_interaction != INVALID_SUBSHELL );
+  return valid_doppler_broadening;
 }
 
 // Sample the old subshell that is interacted with
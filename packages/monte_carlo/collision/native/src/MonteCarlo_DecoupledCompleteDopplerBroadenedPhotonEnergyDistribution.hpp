@@ -31,7 +31,8 @@ public:
 	       const Teuchos::Array<SubshellType>& endf_subshell_order,
 	       const Teuchos::Array<double>& old_subshell_binding_energies,
 	       const Teuchos::Array<double>& old_subshell_occupancies,
-	       const ElectronMomentumDistArray& electron_momentum_dist_array );
+	       const ElectronMomentumDistArray& electron_momentum_dist_array,
+	       const bool use_inverse_cdf_sampling = false );
 
   //! Destructor
   virtual ~DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution()
@@ -72,6 +73,9 @@ public:
 					  const SubshellType subshell,
 					  const double precision ) const;
 
+  //! Check if inverse cdf sampling is used
+  bool isInverseCDFSamplingUsed() const;
+
   //! Sample an outgoing energy from the distribution
   void sample( const double incoming_energy,
 	       const double scattering_angle_cosine,
@@ -87,6 +91,12 @@ public:
 
 private:
 
+  // Sample an outgoing energy using the rejection loop
+  bool sampleAndRecordTrialsRejection( const double incoming_energy,
+				       const double scattering_angle_cosine,
+				       double& outgoing_energy,
+				       unsigned& trials ) const;
+
   // Sample the old subshell that is interacted with
   void sampleOldInteractionSubshell( 
 				   unsigned& old_shell_of_interaction,
@@ -107,8 +117,21 @@ private:
 
   // The electron momentum dist array
   ElectronMomentumDistArray d_electron_momentum_distribution;
+
+  // The Compton profile index of each old subshell
+  Teuchos::Array<unsigned> d_old_subshell_compton_profile_indices;
+
+  // Records if inverse cdf sampling is used (instead of the rejection loop)
+  bool d_inverse_cdf_sampling;
 };
 
+// Check if inverse cdf sampling is used
+inline bool 
+DecoupledCompleteDopplerBroadenedPhotonEnergyDistribution::isInverseCDFSamplingUsed() const
+{
+  return d_inverse_cdf_sampling;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_DECOUPLED_COMPLETE_DOPPLER_BROADENED_PHOTON_ENERGY_DISTRIBUTION_HPP
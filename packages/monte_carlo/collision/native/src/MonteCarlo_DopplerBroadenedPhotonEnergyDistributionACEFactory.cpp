@@ -13,6 +13,7 @@
 #include "MonteCarlo_ComptonProfileSubshellConverterFactory.hpp"
 #include "MonteCarlo_ComptonProfileHelpers.hpp"
 #include "MonteCarlo_SubshellType.hpp"
+#include "MonteCarlo_SimulationPhotonProperties.hpp"
 #include "Utility_TabularDistribution.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -56,7 +57,8 @@ void DopplerBroadenedPhotonEnergyDistributionACEFactory::createCoupledCompleteDi
 			   raw_photoatom_data.extractSubshellOccupancies(),
 			   subshell_order,
 			   converter,
-			   compton_profiles ) );
+			   compton_profiles,
+			   SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() ) );
 }
 
 // Create a coupled complete Doppler broadened photon energy dist
@@ -106,7 +108,8 @@ void DopplerBroadenedPhotonEnergyDistributionACEFactory::createDecoupledComplete
 			   subshell_order,
 			   raw_photoatom_data.extractLBEPSBlock(),
 			   raw_photoatom_data.extractLNEPSBlock(),
-			   compton_profiles ) );
+			   compton_profiles,
+			   SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() ) );
 }
 
 // Create a decoupled complete Doppler broadened photon energy dist
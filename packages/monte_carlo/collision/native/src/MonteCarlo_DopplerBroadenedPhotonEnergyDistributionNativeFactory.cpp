@@ -13,6 +13,7 @@
 #include "MonteCarlo_ComptonProfileHelpers.hpp"
 #include "MonteCarlo_SubshellType.hpp"
 #include "MonteCarlo_VoidComptonProfileSubshellConverter.hpp"
+#include "MonteCarlo_SimulationPhotonProperties.hpp"
 #include "Utility_TabularDistribution.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -72,7 +73,8 @@ void DopplerBroadenedPhotonEnergyDistributionNativeFactory::createCoupledComplet
 						subshell_occupancies,
 						subshell_order,
 						converter,
-						compton_profiles ) );
+						compton_profiles,
+			   SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() ) );
 }
 
 // Create a coupled complete Doppler broadened photon energy dist
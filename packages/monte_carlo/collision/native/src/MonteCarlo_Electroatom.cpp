@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_Electroatom.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
@@ -21,6 +24,13 @@ Electroatom::getScatteringReactionTypes()
   return ElectroatomCore::scattering_reaction_types;
 }
 
+// Return the reactions that are grouped into a condensed history step
+const boost::unordered_set<ElectroatomicReactionType>& 
+Electroatom::getSoftReactionTypes()
+{
+  return ElectroatomCore::soft_reaction_types;
+}
+
 //! Constructor (from a core)
 Electroatom::Electroatom( const std::string& name,
                           const unsigned atomic_number,
@@ -134,6 +144,126 @@ double Electroatom::getReactionCrossSection(
   }
 }
 
+// Return the hard (not grouped) cross section at the desired energy
+/*! \details The hard cross section is the total cross section minus the
+ * cross sections of the soft reactions (see 
+ * MonteCarlo::Electroatom::getSoftReactionTypes).
+ */
+double Electroatom::getHardCrossSection( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  double hard_cross_section = this->getTotalCrossSection( energy );
+
+  ConstReactionMap::const_iterator electroatomic_reaction = 
+    d_core.getScatteringReactions().begin();
+
+  while( electroatomic_reaction != d_core.getScatteringReactions().end() )
+  {
+    if( ElectroatomCore::soft_reaction_types.count( 
+                                          electroatomic_reaction->first ) )
+    {
+      hard_cross_section -= 
+        electroatomic_reaction->second->getCrossSection( energy );
+    }
+
+    ++electroatomic_reaction;
+  }
+
+  // Roundoff can cause a small negative value when all reactions are soft
+  return std::max( hard_cross_section, 0.0 );
+}
+
+// Return the soft stopping cross section (MeV-b) at the desired energy
+/*! \details The soft stopping cross section is the sum over the soft 
+ * reactions of the reaction cross section multiplied by the mean energy lost
+ * in a single reaction.
+ */
+double Electroatom::getSoftStoppingCrossSection( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  double stopping_cross_section = 0.0;
+
+  ConstReactionMap::const_iterator electroatomic_reaction = 
+    d_core.getScatteringReactions().begin();
+
+  while( electroatomic_reaction != d_core.getScatteringReactions().end() )
+  {
+    if( ElectroatomCore::soft_reaction_types.count( 
+                                          electroatomic_reaction->first ) )
+    {
+      stopping_cross_section += 
+        electroatomic_reaction->second->getCrossSection( energy )*
+        electroatomic_reaction->second->getMeanEnergyLoss( energy );
+    }
+
+    ++electroatomic_reaction;
+  }
+
+  return stopping_cross_section;
+}
+
+// Return the soft transport cross section (b) at the desired energy
+/*! \details The soft transport cross section is the sum over the soft
+ * reactions of the reaction cross section multiplied by the mean angular
+ * deflection (1-mu) of a single reaction.
+ */
+double Electroatom::getSoftTransportCrossSection( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  double transport_cross_section = 0.0;
+
+  ConstReactionMap::const_iterator electroatomic_reaction = 
+    d_core.getScatteringReactions().begin();
+
+  while( electroatomic_reaction != d_core.getScatteringReactions().end() )
+  {
+    if( ElectroatomCore::soft_reaction_types.count( 
+                                          electroatomic_reaction->first ) )
+    {
+      transport_cross_section += 
+        electroatomic_reaction->second->getCrossSection( energy )*
+        electroatomic_reaction->second->getMeanAngularDeflection( energy );
+    }
+
+    ++electroatomic_reaction;
+  }
+
+  return transport_cross_section;
+}
+
+// Return the radiative stopping cross section (MeV-b) at the desired energy
+/*! \details The radiative stopping cross section is the bremsstrahlung
+ * cross section multiplied by the mean energy of the emitted photon.
+ */
+double Electroatom::getRadiativeStoppingCrossSection( 
+                                                    const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  ConstReactionMap::const_iterator bremsstrahlung_reaction = 
+    d_core.getScatteringReactions().find( 
+                                     BREMSSTRAHLUNG_ELECTROATOMIC_REACTION );
+
+  if( bremsstrahlung_reaction != d_core.getScatteringReactions().end() )
+  {
+    return bremsstrahlung_reaction->second->getCrossSection( energy )*
+      bremsstrahlung_reaction->second->getMeanEnergyLoss( energy );
+  }
+  else
+    return 0.0;
+}
+
 // Collide with a electron
 void Electroatom::collideAnalogue( ElectronState& electron, 
                                    ParticleBank& bank ) const
@@ -175,30 +305,14 @@ void Electroatom::collideSurvivalBias( ElectronState& electron,
     this->getAbsorptionCrossSection( electron.getEnergy() );
 
   double survival_prob = scattering_cross_section/total_cross_section;
- 
-  sampleScatteringReaction(
-	 	     Utility::RandomNumberGenerator::getRandomNumber<double>()*
-		     scattering_cross_section,
-		     electron,
-		     bank );
 
-  if( survival_prob < 1.0 )
+  if( survival_prob > 0.0 )
   {
-    // Multiply the electron's weight by the survival probabilty
-    if( survival_prob > 0.0 )
+    if( survival_prob < 1.0 )
     {
-
       // Create a copy of the electron for sampling the absorption reaction
       ElectronState electron_copy( electron, false, false );
-    
-      electron.multiplyWeight( survival_prob );
-
-      sampleScatteringReaction(
-	 	     Utility::RandomNumberGenerator::getRandomNumber<double>()*
-		     scattering_cross_section,
-		     electron,
-		     bank );
- 
+      
       electron_copy.multiplyWeight( 1.0 - survival_prob );
 
       sampleAbsorptionReaction(
@@ -206,9 +320,74 @@ void Electroatom::collideSurvivalBias( ElectronState& electron,
                       (total_cross_section - scattering_cross_section),
                       electron_copy,
                       bank );
+    
+      // Multiply the electron's weight by the survival probabilty
+      electron.multiplyWeight( survival_prob );
     }
-    else
-      electron.setAsGone();
+
+    sampleScatteringReaction(
+	 	     Utility::RandomNumberGenerator::getRandomNumber<double>()*
+		     scattering_cross_section,
+		     electron,
+		     bank );
+  }
+  else
+    electron.setAsGone();
+}
+
+// Collide with a electron using only the hard reactions
+/*! \details This method is used by the condensed history electron transport
+ * mode. The effect of the soft reactions must be accounted for separately
+ * (continuous energy loss and multiple scattering).
+ */
+void Electroatom::collideHard( ElectronState& electron, 
+                               ParticleBank& bank ) const
+{
+  double hard_cross_section = 
+    this->getHardCrossSection( electron.getEnergy() );
+
+  double scaled_random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      hard_cross_section;
+
+  double absorption_cross_section = 
+    this->getAbsorptionCrossSection( electron.getEnergy() );
+
+  // Check if absorption occurs 
+  if( scaled_random_number < absorption_cross_section )
+  {
+    sampleAbsorptionReaction( scaled_random_number, electron, bank );
+
+    // Set the electron as gone regardless of the reaction that occurred
+    electron.setAsGone();
+  }
+  else
+  {
+    sampleHardScatteringReaction( 
+                               scaled_random_number - absorption_cross_section,
+                               electron, 
+                               bank );
+  }
+}
+
+// Collide with a electron using only the bremsstrahlung reaction
+/*! \details If the atom does not have a bremsstrahlung reaction the
+ * electron will not be changed.
+ */
+void Electroatom::collideBremsstrahlung( ElectronState& electron, 
+                                         ParticleBank& bank ) const
+{
+  ConstReactionMap::const_iterator bremsstrahlung_reaction = 
+    d_core.getScatteringReactions().find( 
+                                     BREMSSTRAHLUNG_ELECTROATOMIC_REACTION );
+
+  if( bremsstrahlung_reaction != d_core.getScatteringReactions().end() )
+  {
+    SubshellType shell_of_interaction;
+
+    bremsstrahlung_reaction->second->react( electron, 
+                                            bank, 
+                                            shell_of_interaction );
   }
 }
 
@@ -313,6 +492,58 @@ std::cout << " reaction type = \t"<<electroatomic_reaction->second->getReactionT
                                                bank );
 }
 
+// Sample a hard scattering reaction
+void Electroatom::sampleHardScatteringReaction( 
+                                            const double scaled_random_number,
+                                            ElectronState& electron,
+                                            ParticleBank& bank ) const
+{
+  double partial_cross_section = 0.0;
+
+  ConstReactionMap::const_iterator electroatomic_reaction = 
+    d_core.getScatteringReactions().begin();
+
+  ConstReactionMap::const_iterator last_hard_reaction = 
+    d_core.getScatteringReactions().end();
+  
+  while( electroatomic_reaction != d_core.getScatteringReactions().end() )
+  {
+    if( !ElectroatomCore::soft_reaction_types.count( 
+                                          electroatomic_reaction->first ) )
+    {
+      last_hard_reaction = electroatomic_reaction;
+      
+      partial_cross_section +=
+        electroatomic_reaction->second->getCrossSection( electron.getEnergy() );
+
+      if( scaled_random_number < partial_cross_section )
+        break;
+    }
+
+    ++electroatomic_reaction;
+  }
+
+  // Roundoff can cause a small difference between the calculated hard cross
+  // section and the sum of the stored hard cross sections. This test ensures
+  // that a valid reaction is always sampled.
+  if( electroatomic_reaction == d_core.getScatteringReactions().end() )
+    electroatomic_reaction = last_hard_reaction;
+
+  // There may not be any hard scattering reactions
+  if( electroatomic_reaction == d_core.getScatteringReactions().end() )
+    return;
+
+  // Undergo reaction selected
+  SubshellType subshell_vacancy;
+
+  electroatomic_reaction->second->react( electron, bank, subshell_vacancy );
+
+  // Relax the atom
+  d_core.getAtomicRelaxationModel().relaxAtom( subshell_vacancy,
+                                               electron,
+                                               bank );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -48,6 +48,10 @@ public:
   //! Return the reactions that are treated as scattering
   static const boost::unordered_set<ElectroatomicReactionType>& 
   getScatteringReactionTypes();
+
+  //! Return the reactions that are grouped into a condensed history step
+  static const boost::unordered_set<ElectroatomicReactionType>& 
+  getSoftReactionTypes();
 					
   //! Constructor 
   template<typename InterpPolicy>
@@ -107,6 +111,18 @@ public:
 			        const double energy,
 			        const ElectroatomicReactionType reaction ) const;
 
+  //! Return the hard (not grouped) cross section at the desired energy
+  double getHardCrossSection( const double energy ) const;
+
+  //! Return the soft stopping cross section (MeV-b) at the desired energy
+  double getSoftStoppingCrossSection( const double energy ) const;
+
+  //! Return the soft transport cross section (b) at the desired energy
+  double getSoftTransportCrossSection( const double energy ) const;
+
+  //! Return the radiative stopping cross section (MeV-b) at the desired energy
+  double getRadiativeStoppingCrossSection( const double energy ) const;
+
   //! Collide with a electron
   virtual void collideAnalogue( ElectronState& electron, 
 				                ParticleBank& bank ) const;
@@ -115,6 +131,13 @@ public:
   virtual void collideSurvivalBias( ElectronState& electron, 
 				                    ParticleBank& bank ) const;
 
+  //! Collide with a electron using only the hard reactions
+  void collideHard( ElectronState& electron, ParticleBank& bank ) const;
+
+  //! Collide with a electron using only the bremsstrahlung reaction
+  void collideBremsstrahlung( ElectronState& electron, 
+                              ParticleBank& bank ) const;
+
   //! Return the core
   const ElectroatomCore& getCore() const;
 
@@ -130,6 +153,11 @@ private:
                                  ElectronState& electron,
                                  ParticleBank& bank ) const;
 
+  // Sample a hard scattering reaction
+  void sampleHardScatteringReaction( const double scaled_random_number,
+                                     ElectronState& electron,
+                                     ParticleBank& bank ) const;
+
   // The atom name
   std::string d_name;
 
@@ -17,6 +17,10 @@ const boost::unordered_set<ElectroatomicReactionType>
 ElectroatomCore::scattering_reaction_types = 
   ElectroatomCore::setDefaultScatteringReactionTypes();
 
+const boost::unordered_set<ElectroatomicReactionType> 
+ElectroatomCore::soft_reaction_types = 
+  ElectroatomCore::setDefaultSoftReactionTypes();
+
 // Set the default scattering reaction types
 boost::unordered_set<ElectroatomicReactionType>
 ElectroatomCore::setDefaultScatteringReactionTypes()
@@ -116,6 +120,25 @@ ElectroatomCore::setDefaultScatteringReactionTypes()
   return tmp_scattering_reaction_types;
 }
 
+// Set the default soft reaction types
+/*! \details The soft reactions are the reactions that will be grouped into
+ * a condensed history step: the atomic excitation reaction (continuous
+ * energy loss) and the screened Rutherford elastic reaction, which only
+ * describes scattering below the elastic cutoff angle (multiple
+ * scattering angular deflection).
+ */
+boost::unordered_set<ElectroatomicReactionType>
+ElectroatomCore::setDefaultSoftReactionTypes()
+{
+  boost::unordered_set<ElectroatomicReactionType> tmp_soft_reaction_types;
+  tmp_soft_reaction_types.insert(
+			          SCREENED_RUTHERFORD_ELASTIC_ELECTROATOMIC_REACTION );
+  tmp_soft_reaction_types.insert(
+				  ATOMIC_EXCITATION_ELECTROATOMIC_REACTION );
+
+  return tmp_soft_reaction_types;
+}
+
 // Default constructor
 ElectroatomCore::ElectroatomCore()
   : d_total_reaction(),
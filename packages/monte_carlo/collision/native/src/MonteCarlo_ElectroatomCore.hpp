@@ -59,6 +59,10 @@ public:
   static const boost::unordered_set<ElectroatomicReactionType> 
   void_reaction_types;
 
+  // Reactions that are grouped into a condensed history step (soft)
+  static const boost::unordered_set<ElectroatomicReactionType> 
+  soft_reaction_types;
+
   //! Default constructor
   ElectroatomCore();
 
@@ -115,6 +119,10 @@ private:
   static boost::unordered_set<ElectroatomicReactionType>
   setDefaultScatteringReactionTypes();
 
+  // Set the default soft reaction types
+  static boost::unordered_set<ElectroatomicReactionType>
+  setDefaultSoftReactionTypes();
+
   // Create the total absorption reaction
   template<typename InterpPolicy>
   static void createTotalAbsorptionReaction(
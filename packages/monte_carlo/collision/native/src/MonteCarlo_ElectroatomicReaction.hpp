@@ -9,11 +9,15 @@
 #ifndef MONTE_CARLO_ELECTROATOMIC_REACTION_HPP
 #define MONTE_CARLO_ELECTROATOMIC_REACTION_HPP
 
+// Trilinos Includes
+#include <Teuchos_ArrayView.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_ElectronState.hpp"
 #include "MonteCarlo_ParticleBank.hpp"
 #include "MonteCarlo_SubshellType.hpp"
 #include "MonteCarlo_ElectroatomicReactionType.hpp"
+#include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
 
@@ -34,6 +38,11 @@ public:
   //! Return the cross section at the given energy
   virtual double getCrossSection( const double energy ) const = 0;
 
+  //! Return the cross sections at the given energies
+  virtual void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
   //! Return the threshold energy
   virtual double getThresholdEnergy() const = 0;
 
@@ -46,12 +55,56 @@ public:
   //! Return reaction type
   virtual ElectroatomicReactionType getReactionType() const = 0;
 
+  //! Return the mean energy lost in a single reaction at the given energy
+  virtual double getMeanEnergyLoss( const double energy ) const;
+
+  //! Return the mean angular deflection (1-mu) of a single reaction
+  virtual double getMeanAngularDeflection( const double energy ) const;
+
   //! Simulate the reaction
   virtual void react( ElectronState& electron, 
                       ParticleBank& bank,
                       SubshellType& shell_of_interaction ) const = 0;
 };
 
+// Return the cross sections at the given energies
+/*! \details By default the cross sections will be evaluated one at a time.
+ */
+inline void ElectroatomicReaction::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == cross_sections.size() );
+  
+  for( unsigned i = 0; i < energies.size(); ++i )
+    cross_sections[i] = this->getCrossSection( energies[i] );
+}
+
+// Return the mean energy lost in a single reaction at the given energy
+/*! \details The mean energy loss is only required by the condensed history
+ * electron transport mode for reactions that are grouped into a step (soft
+ * reactions). By default a reaction will not contribute to the continuous 
+ * energy loss.
+ */
+inline double ElectroatomicReaction::getMeanEnergyLoss( 
+                                                   const double energy ) const
+{
+  return 0.0;
+}
+
+// Return the mean angular deflection (1-mu) of a single reaction
+/*! \details The mean angular deflection is only required by the condensed
+ * history electron transport mode for reactions that are grouped into a step
+ * (soft reactions). By default a reaction will not contribute to the
+ * multiple scattering angular deflection.
+ */
+inline double ElectroatomicReaction::getMeanAngularDeflection( 
+                                                   const double energy ) const
+{
+  return 0.0;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_ELECTROATOMIC_REACTION_HPP
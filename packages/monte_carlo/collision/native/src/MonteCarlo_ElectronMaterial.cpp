@@ -8,11 +8,14 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <cmath>
 
 // FRENSIE Includes
 #include "MonteCarlo_ElectronMaterial.hpp"
 #include "MonteCarlo_MaterialHelpers.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_ContractException.hpp"
@@ -28,7 +31,11 @@ ElectronMaterial::ElectronMaterial(
 			   const Teuchos::Array<std::string>& electroatom_names )
   : d_id( id ),
     d_number_density( density ),
-    d_atoms( electroatom_fractions.size() )
+    d_atoms( electroatom_fractions.size() ),
+    d_electron_density( 0.0 ),
+    d_mean_excitation_energy( 0.0 ),
+    d_ttb_energy_grid(),
+    d_ttb_yield()
 {
   // Make sure the id is valid
   testPrecondition( id != ModuleTraits::invalid_internal_material_handle );
@@ -87,6 +94,24 @@ ElectronMaterial::ElectronMaterial(
   scaleAtomFractionsByNumberDensity<Utility::FIRST>( d_number_density,
                                                      d_atoms.begin(),
                                                      d_atoms.end() );
+
+  // Calculate the electron density and the mean excitation energy
+  double log_mean_excitation_energy = 0.0;
+  
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    const double atom_electron_density = 
+      d_atoms[i].first*d_atoms[i].second->getAtomicNumber();
+
+    d_electron_density += atom_electron_density;
+
+    log_mean_excitation_energy += atom_electron_density*
+      std::log( ElectronMaterial::estimateMeanExcitationEnergy(
+                                 d_atoms[i].second->getAtomicNumber() ) );
+  }
+
+  d_mean_excitation_energy = 
+    std::exp( log_mean_excitation_energy/d_electron_density );
 }
 
 // Return the material id
@@ -185,6 +210,226 @@ double ElectronMaterial::getMacroscopicReactionCrossSection(
   return cross_section;
 }
 
+// Return the macroscopic hard cross section (1/cm)
+double ElectronMaterial::getMacroscopicHardCrossSection( 
+                                                    const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+  
+  double cross_section = 0.0;
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    cross_section +=
+      d_atoms[i].first*d_atoms[i].second->getHardCrossSection( energy );
+  }
+
+  return cross_section;
+}
+
+// Return the soft stopping power (MeV/cm)
+double ElectronMaterial::getSoftStoppingPower( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+  
+  double stopping_power = 0.0;
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    stopping_power +=
+      d_atoms[i].first*d_atoms[i].second->getSoftStoppingCrossSection( energy );
+  }
+
+  return stopping_power;
+}
+
+// Return the macroscopic soft transport cross section (1/cm)
+double ElectronMaterial::getMacroscopicSoftTransportCrossSection( 
+                                                    const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+  
+  double cross_section = 0.0;
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    cross_section += d_atoms[i].first*
+      d_atoms[i].second->getSoftTransportCrossSection( energy );
+  }
+
+  return cross_section;
+}
+
+// Return the collisional stopping power (MeV/cm)
+/*! \details The Bethe formula for electrons is used (without the density
+ * effect correction). The mean excitation energy of the material is estimated
+ * from the mean excitation energies of the elements that make up the 
+ * material (see MonteCarlo::ElectronMaterial::getMeanExcitationEnergy). At
+ * energies near the mean excitation energy the formula is not valid and the 
+ * stopping power will be clamped to zero.
+ */
+double ElectronMaterial::getCollisionalStoppingPower( 
+                                                    const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  const double tau = 
+    energy/Utility::PhysicalConstants::electron_rest_mass_energy;
+
+  const double beta_squared = tau*(tau + 2.0)/((tau + 1.0)*(tau + 1.0));
+
+  const double scaled_excitation_energy = d_mean_excitation_energy/
+    Utility::PhysicalConstants::electron_rest_mass_energy;
+
+  const double f_minus = 1.0 - beta_squared + 
+    (tau*tau/8.0 - (2.0*tau + 1.0)*std::log( 2.0 ))/((tau + 1.0)*(tau + 1.0));
+
+  const double stopping_number = 
+    std::log( tau*tau*(tau + 2.0)/
+              (2.0*scaled_excitation_energy*scaled_excitation_energy) ) +
+    f_minus;
+
+  if( stopping_number <= 0.0 )
+    return 0.0;
+
+  // 2*pi*r_e^2 (b)
+  const double prefactor = 2e24*Utility::PhysicalConstants::pi*
+    Utility::PhysicalConstants::classical_electron_radius*
+    Utility::PhysicalConstants::classical_electron_radius;
+
+  return prefactor*Utility::PhysicalConstants::electron_rest_mass_energy*
+    d_electron_density*stopping_number/beta_squared;
+}
+
+// Return the radiative stopping power (MeV/cm)
+double ElectronMaterial::getRadiativeStoppingPower( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+  
+  double stopping_power = 0.0;
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    stopping_power += d_atoms[i].first*
+      d_atoms[i].second->getRadiativeStoppingCrossSection( energy );
+  }
+
+  return stopping_power;
+}
+
+// Return the mean excitation energy (MeV)
+/*! \details The mean excitation energy of the material is calculated from
+ * the electron density weighted log of the mean excitation energies of the
+ * elements (Bragg additivity rule).
+ */
+double ElectronMaterial::getMeanExcitationEnergy() const
+{
+  return d_mean_excitation_energy;
+}
+
+// Tabulate the thick-target bremsstrahlung photon yield
+/*! \details The thick-target bremsstrahlung photon yield is the mean number 
+ * of bremsstrahlung photons that an electron with the given initial energy 
+ * will emit while slowing down to the min energy in a continuous manner. It 
+ * is calculated by integrating the ratio of the macroscopic bremsstrahlung
+ * cross section and the total (collisional + radiative) stopping power on
+ * a logarithmic energy grid (trapezoidal rule). The random number generator
+ * is not used so this can be called before the random number streams have
+ * been created.
+ */
+void ElectronMaterial::tabulateThickTargetBremsstrahlungYield(
+                                                const double min_energy,
+                                                const double max_energy,
+                                                const unsigned grid_points )
+{
+  // Make sure the energies are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( max_energy > min_energy );
+  // Make sure the number of grid points is valid
+  testPrecondition( grid_points > 1u );
+
+  d_ttb_energy_grid.resize( grid_points );
+  d_ttb_yield.resize( grid_points );
+
+  const double log_spacing = 
+    std::log( max_energy/min_energy )/(grid_points - 1u);
+
+  double previous_integrand = 0.0;
+
+  for( unsigned i = 0u; i < grid_points; ++i )
+  {
+    if( i < grid_points - 1u )
+      d_ttb_energy_grid[i] = min_energy*std::exp( i*log_spacing );
+    else
+      d_ttb_energy_grid[i] = max_energy;
+
+    const double energy = d_ttb_energy_grid[i];
+    
+    const double total_stopping_power = 
+      this->getCollisionalStoppingPower( energy ) + 
+      this->getRadiativeStoppingPower( energy );
+
+    double integrand = 0.0;
+
+    if( total_stopping_power > 0.0 )
+    {
+      integrand = this->getMacroscopicReactionCrossSection( 
+                                     energy,
+                                     BREMSSTRAHLUNG_ELECTROATOMIC_REACTION )/
+        total_stopping_power;
+    }
+
+    if( i == 0u )
+      d_ttb_yield[i] = 0.0;
+    else
+    {
+      d_ttb_yield[i] = d_ttb_yield[i-1] + 0.5*(integrand + previous_integrand)*
+        (d_ttb_energy_grid[i] - d_ttb_energy_grid[i-1]);
+    }
+
+    previous_integrand = integrand;
+  }
+}
+
+// Return the thick-target bremsstrahlung photon yield
+/*! \details If the yield has not been tabulated, zero will be returned.
+ * Energies above the tabulated energy grid will be given the yield at the
+ * max tabulated energy.
+ */
+double ElectronMaterial::getThickTargetBremsstrahlungYield( 
+                                                    const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !ST::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  if( d_ttb_energy_grid.size() == 0u || energy <= d_ttb_energy_grid.front() )
+    return 0.0;
+  else if( energy >= d_ttb_energy_grid.back() )
+    return d_ttb_yield.back();
+  else
+  {
+    unsigned lower_index = Utility::Search::binaryLowerBoundIndex(
+                                                    d_ttb_energy_grid.begin(),
+                                                    d_ttb_energy_grid.end(),
+                                                    energy );
+
+    return d_ttb_yield[lower_index] + 
+      (d_ttb_yield[lower_index+1] - d_ttb_yield[lower_index])*
+      (energy - d_ttb_energy_grid[lower_index])/
+      (d_ttb_energy_grid[lower_index+1] - d_ttb_energy_grid[lower_index]);
+  }
+}
 
 // Collide with a electron
 void ElectronMaterial::collideAnalogue( ElectronState& electron, 
@@ -213,6 +458,114 @@ void ElectronMaterial::collideSurvivalBias( ElectronState& electron,
   d_atoms[atom_index].second->collideSurvivalBias( electron, bank );
 }
 
+// Collide with a electron using only the hard reactions
+void ElectronMaterial::collideHard( ElectronState& electron, 
+                                    ParticleBank& bank ) const
+{
+  unsigned atom_index = sampleHardCollisionAtom( electron.getEnergy() );
+
+  d_atoms[atom_index].second->collideHard( electron, bank );
+}
+
+// Emit the thick-target bremsstrahlung photons of a electron
+/*! \details The electron is assumed to deposit its energy locally (it will
+ * not be modified - the caller is responsible for killing it). The number of
+ * emitted photons is sampled from the thick-target bremsstrahlung yield
+ * (the integer part is always emitted and one extra photon is emitted with
+ * a probability equal to the fractional part). The electron energy at 
+ * emission is sampled from the yield distribution and the photon is then
+ * sampled from the bremsstrahlung reaction of an atom in the material.
+ */
+void ElectronMaterial::emitThickTargetBremsstrahlung( 
+                                                const ElectronState& electron,
+                                                ParticleBank& bank ) const
+{
+  const double yield = 
+    this->getThickTargetBremsstrahlungYield( electron.getEnergy() );
+
+  if( yield <= 0.0 )
+    return;
+
+  unsigned number_of_photons = (unsigned)yield;
+
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>() < 
+      yield - number_of_photons )
+    ++number_of_photons;
+
+  for( unsigned i = 0u; i < number_of_photons; ++i )
+  {
+    const double emission_energy = 
+      this->sampleThickTargetBremsstrahlungEnergy( yield );
+
+    if( this->getMacroscopicReactionCrossSection( 
+                     emission_energy,
+                     BREMSSTRAHLUNG_ELECTROATOMIC_REACTION ) <= 0.0 )
+      continue;
+
+    ElectronState emitting_electron( electron, false, false );
+
+    emitting_electron.setEnergy( emission_energy );
+
+    unsigned atom_index = 
+      this->sampleBremsstrahlungCollisionAtom( emission_energy );
+
+    d_atoms[atom_index].second->collideBremsstrahlung( emitting_electron, 
+                                                       bank );
+  }
+}
+
+// Estimate the mean excitation energy (MeV) of an element
+/*! \details The empirical fit of Sternheimer is used 
+ * (I = 9.76Z + 58.8Z^-0.19 eV). The measured value is used for hydrogen.
+ */
+double ElectronMaterial::estimateMeanExcitationEnergy( 
+                                                const unsigned atomic_number )
+{
+  // Make sure the atomic number is valid
+  testPrecondition( atomic_number > 0u );
+
+  if( atomic_number == 1u )
+    return 19.2e-6;
+  else
+  {
+    return (9.76*atomic_number + 58.8*std::pow( atomic_number, -0.19 ))*1e-6;
+  }
+}
+
+// Sample the thick-target bremsstrahlung emission energy
+double ElectronMaterial::sampleThickTargetBremsstrahlungEnergy( 
+                                                    const double yield ) const
+{
+  // Make sure the yield is valid
+  testPrecondition( yield > 0.0 );
+  testPrecondition( yield <= d_ttb_yield.back() );
+
+  const double scaled_random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*yield;
+
+  unsigned lower_index = Utility::Search::binaryLowerBoundIndex(
+                                                    d_ttb_yield.begin(),
+                                                    d_ttb_yield.end(),
+                                                    scaled_random_number );
+
+  // Make sure the bin does not have zero width
+  while( lower_index < d_ttb_yield.size() - 2u &&
+         d_ttb_yield[lower_index+1] == d_ttb_yield[lower_index] )
+    ++lower_index;
+
+  const double yield_bin_width = 
+    d_ttb_yield[lower_index+1] - d_ttb_yield[lower_index];
+
+  if( yield_bin_width > 0.0 )
+  {
+    return d_ttb_energy_grid[lower_index] + 
+      (d_ttb_energy_grid[lower_index+1] - d_ttb_energy_grid[lower_index])*
+      (scaled_random_number - d_ttb_yield[lower_index])/yield_bin_width;
+  }
+  else
+    return d_ttb_energy_grid[lower_index+1];
+}
+
 // Get the atomic weight from an atom pointer
 double ElectronMaterial::getAtomicWeight(
 	     const Utility::Pair<double,Teuchos::RCP<const Electroatom> >& pair )
@@ -251,6 +604,73 @@ unsigned ElectronMaterial::sampleCollisionAtom( const double energy ) const
   return collision_atom_index;
 }
 
+// Sample the atom that is collided with (hard reactions only)
+unsigned ElectronMaterial::sampleHardCollisionAtom( const double energy ) const
+{
+  double scaled_random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    this->getMacroscopicHardCrossSection( energy );
+
+  double partial_hard_cs = 0.0;
+
+  unsigned collision_atom_index = std::numeric_limits<unsigned>::max();
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    partial_hard_cs +=
+      d_atoms[i].first*d_atoms[i].second->getHardCrossSection( energy );
+
+    if( scaled_random_number < partial_hard_cs )
+    {
+      collision_atom_index = i;
+
+      break;
+    }
+  }
+
+  // Make sure a collision index was found
+  testPostcondition( collision_atom_index !=
+		     std::numeric_limits<unsigned>::max() );
+
+  return collision_atom_index;
+}
+
+// Sample the atom that is collided with (bremsstrahlung reaction only)
+unsigned ElectronMaterial::sampleBremsstrahlungCollisionAtom( 
+                                                    const double energy ) const
+{
+  double scaled_random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    this->getMacroscopicReactionCrossSection( 
+                                       energy,
+                                       BREMSSTRAHLUNG_ELECTROATOMIC_REACTION );
+
+  double partial_bremsstrahlung_cs = 0.0;
+
+  unsigned collision_atom_index = std::numeric_limits<unsigned>::max();
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    partial_bremsstrahlung_cs += d_atoms[i].first*
+      d_atoms[i].second->getReactionCrossSection( 
+                                       energy,
+                                       BREMSSTRAHLUNG_ELECTROATOMIC_REACTION );
+
+    if( scaled_random_number < partial_bremsstrahlung_cs )
+    {
+      collision_atom_index = i;
+
+      break;
+    }
+  }
+
+  // Make sure a collision index was found
+  testPostcondition( collision_atom_index !=
+		     std::numeric_limits<unsigned>::max() );
+
+  return collision_atom_index;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
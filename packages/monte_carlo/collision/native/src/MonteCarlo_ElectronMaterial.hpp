@@ -69,21 +69,67 @@ public:
 				const double energy,
 				const ElectroatomicReactionType reaction ) const;
 
+  //! Return the macroscopic hard cross section (1/cm)
+  double getMacroscopicHardCrossSection( const double energy ) const;
+
+  //! Return the soft stopping power (MeV/cm)
+  double getSoftStoppingPower( const double energy ) const;
+
+  //! Return the macroscopic soft transport cross section (1/cm)
+  double getMacroscopicSoftTransportCrossSection( const double energy ) const;
+
+  //! Return the collisional stopping power (MeV/cm)
+  double getCollisionalStoppingPower( const double energy ) const;
+
+  //! Return the radiative stopping power (MeV/cm)
+  double getRadiativeStoppingPower( const double energy ) const;
+
+  //! Return the mean excitation energy (MeV)
+  double getMeanExcitationEnergy() const;
+
+  //! Tabulate the thick-target bremsstrahlung photon yield
+  void tabulateThickTargetBremsstrahlungYield( 
+                                        const double min_energy,
+                                        const double max_energy,
+                                        const unsigned grid_points = 200u );
+
+  //! Return the thick-target bremsstrahlung photon yield
+  double getThickTargetBremsstrahlungYield( const double energy ) const;
+
   //! Collide with a electron
   void collideAnalogue( ElectronState& electron, ParticleBank& bank ) const;
 
   //! Collide with a electron and survival bias
   void collideSurvivalBias( ElectronState& electron, ParticleBank& bank ) const;
 
+  //! Collide with a electron using only the hard reactions
+  void collideHard( ElectronState& electron, ParticleBank& bank ) const;
+
+  //! Emit the thick-target bremsstrahlung photons of a electron
+  void emitThickTargetBremsstrahlung( const ElectronState& electron, 
+                                      ParticleBank& bank ) const;
+
 private:
 
   // Get the atomic weight from an atom pointer
   static double getAtomicWeight(
 	    const Utility::Pair<double,Teuchos::RCP<const Electroatom> >& pair );
 
+  // Estimate the mean excitation energy (MeV) of an element
+  static double estimateMeanExcitationEnergy( const unsigned atomic_number );
+
+  // Sample the thick-target bremsstrahlung emission energy
+  double sampleThickTargetBremsstrahlungEnergy( const double yield ) const;
+
   // Sample the atom that is collided with
   unsigned sampleCollisionAtom( const double energy ) const;  
 
+  // Sample the atom that is collided with (hard reactions only)
+  unsigned sampleHardCollisionAtom( const double energy ) const;
+
+  // Sample the atom that is collided with (bremsstrahlung reaction only)
+  unsigned sampleBremsstrahlungCollisionAtom( const double energy ) const;
+
   // The material id
   ModuleTraits::InternalMaterialHandle d_id;
 
@@ -93,6 +139,18 @@ private:
   // The atoms that make up the material
   Teuchos::Array<Utility::Pair<double,Teuchos::RCP<const Electroatom> > > 
   d_atoms;
+
+  // The electron density of the material (electrons/b-cm)
+  double d_electron_density;
+
+  // The mean excitation energy of the material (MeV)
+  double d_mean_excitation_energy;
+
+  // The thick-target bremsstrahlung energy grid (MeV)
+  Teuchos::Array<double> d_ttb_energy_grid;
+
+  // The thick-target bremsstrahlung photon yield
+  Teuchos::Array<double> d_ttb_yield;
 };
 
 } // end MonteCarlo namespace
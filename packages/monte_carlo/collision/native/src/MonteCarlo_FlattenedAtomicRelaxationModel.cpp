@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FlattenedAtomicRelaxationModel.cpp
+//! \author Luke Kersting
+//! \brief  Flattened atomic relaxation model class definition.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_FlattenedAtomicRelaxationModel.hpp"
+#include "MonteCarlo_SimulationElectronProperties.hpp"
+#include "MonteCarlo_SimulationPhotonProperties.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+const unsigned FlattenedAtomicRelaxationModel::max_vacancy_stack_size;
+
+// Constructor
+/*! \details Each vacancy subshell has an array of primary transition
+ * vacancy shells, secondary transition vacancy shells, outgoing particle
+ * energies and transition pdf (or cdf) values associated with it. Duplicate
+ * vacancy subshells will be neglected.
+ */
+FlattenedAtomicRelaxationModel::FlattenedAtomicRelaxationModel(
+     const Teuchos::Array<SubshellType>& vacancy_subshells,
+     const Teuchos::Array<Teuchos::Array<SubshellType> >&
+     primary_transition_vacancy_shells,
+     const Teuchos::Array<Teuchos::Array<SubshellType> >&
+     secondary_transition_vacancy_shells,
+     const Teuchos::Array<Teuchos::Array<double> >& outgoing_particle_energies,
+     const Teuchos::Array<Teuchos::Array<double> >& transition_pdf_or_cdf,
+     const bool interpret_as_cdf )
+  : d_subshell_transition_offsets( Q3_SUBSHELL+2, 0u ),
+    d_transition_cdfs(),
+    d_transitions()
+{
+  // Make sure the arrays are valid
+  testPrecondition( primary_transition_vacancy_shells.size() ==
+		    vacancy_subshells.size() );
+  testPrecondition( secondary_transition_vacancy_shells.size() ==
+		    vacancy_subshells.size() );
+  testPrecondition( outgoing_particle_energies.size() ==
+		    vacancy_subshells.size() );
+  testPrecondition( transition_pdf_or_cdf.size() ==
+		    vacancy_subshells.size() );
+
+  // Find the data index of every subshell (neglect duplicates)
+  Teuchos::Array<int> subshell_data_indices( Q3_SUBSHELL+1, -1 );
+
+  for( unsigned i = 0; i < vacancy_subshells.size(); ++i )
+  {
+    // Make sure the vacancy subshell is valid
+    testPrecondition( vacancy_subshells[i] > UNKNOWN_SUBSHELL );
+    testPrecondition( vacancy_subshells[i] <= Q3_SUBSHELL );
+    // Make sure the subshell arrays are valid
+    testPrecondition( secondary_transition_vacancy_shells[i].size() ==
+		      primary_transition_vacancy_shells[i].size() );
+    testPrecondition( outgoing_particle_energies[i].size() ==
+		      primary_transition_vacancy_shells[i].size() );
+    testPrecondition( transition_pdf_or_cdf[i].size() ==
+		      primary_transition_vacancy_shells[i].size() );
+
+    if( subshell_data_indices[vacancy_subshells[i]] < 0 )
+      subshell_data_indices[vacancy_subshells[i]] = i;
+  }
+
+  // Store the transition data of every subshell contiguously
+  for( unsigned subshell = 0; subshell <= Q3_SUBSHELL; ++subshell )
+  {
+    d_subshell_transition_offsets[subshell] = d_transitions.size();
+
+    if( subshell_data_indices[subshell] < 0 )
+      continue;
+
+    const unsigned data_index = subshell_data_indices[subshell];
+
+    const Teuchos::Array<double>& raw_transition_dist =
+      transition_pdf_or_cdf[data_index];
+
+    const unsigned start_index = d_transitions.size();
+
+    double cdf_value = 0.0;
+
+    for( unsigned j = 0; j < raw_transition_dist.size(); ++j )
+    {
+      if( interpret_as_cdf )
+	cdf_value = raw_transition_dist[j];
+      else
+	cdf_value += raw_transition_dist[j];
+
+      d_transition_cdfs.push_back( cdf_value );
+
+      d_transitions.push_back( Utility::Trip<SubshellType,SubshellType,double>(
+		       primary_transition_vacancy_shells[data_index][j],
+		       secondary_transition_vacancy_shells[data_index][j],
+		       outgoing_particle_energies[data_index][j] ) );
+    }
+
+    // Normalize the subshell transition cdf
+    if( d_transitions.size() > start_index )
+    {
+      const double norm_constant = d_transition_cdfs.back();
+
+      for( unsigned j = start_index; j < d_transition_cdfs.size(); ++j )
+	d_transition_cdfs[j] /= norm_constant;
+
+      d_transition_cdfs.back() = 1.0;
+    }
+  }
+
+  d_subshell_transition_offsets.back() = d_transitions.size();
+}
+
+// Relax the atom
+/*! \details The subshell vacancies created during the cascade are stored
+ * on a fixed size stack. The primary vacancy created by a transition will
+ * always be relaxed before the secondary vacancy (the same order as the
+ * recursive MonteCarlo::DetailedAtomicRelaxationModel). If the stack
+ * overflows, the remaining vacancies will not be relaxed (their energy is
+ * deposited locally).
+ */
+void FlattenedAtomicRelaxationModel::relaxAtom(
+					  const SubshellType vacancy_shell,
+					  const ParticleState& particle,
+					  ParticleBank& bank ) const
+{
+  const double min_photon_energy =
+    SimulationPhotonProperties::getMinPhotonEnergy();
+
+  const double min_electron_energy =
+    SimulationElectronProperties::getMinElectronEnergy();
+
+  SubshellType vacancy_stack[max_vacancy_stack_size];
+
+  unsigned stack_size = 0;
+
+  if( this->hasSubshellRelaxationData( vacancy_shell ) )
+    vacancy_stack[stack_size++] = vacancy_shell;
+
+  while( stack_size > 0 )
+  {
+    const SubshellType vacancy = vacancy_stack[--stack_size];
+
+    const Utility::Trip<SubshellType,SubshellType,double>& transition =
+      d_transitions[this->sampleTransition( vacancy )];
+
+    // A secondary vacancy will only be created with Auger electron emission
+    if( transition.second == INVALID_SUBSHELL ||
+	transition.second == UNKNOWN_SUBSHELL )
+    {
+      // Make sure the photon energy is valid
+      testInvariant( transition.third > 0.0 );
+
+      // Only generate the photon if it is above the cutoff energy
+      if( transition.third >= min_photon_energy )
+      {
+	PhotonState fluorescence_photon( particle, true, true );
+
+	fluorescence_photon.setEnergy( transition.third );
+
+	double angle_cosine, azimuthal_angle;
+
+	this->sampleEmissionDirection( angle_cosine, azimuthal_angle );
+
+	fluorescence_photon.rotateDirection( angle_cosine, azimuthal_angle );
+
+	bank.push( fluorescence_photon );
+      }
+    }
+    else
+    {
+      // Make sure the electron energy is valid - 0.0 can appear in the table
+      testInvariant( transition.third >= 0.0 );
+
+      // Only generate the electron if it is above the cutoff energy
+      if( transition.third >= min_electron_energy )
+      {
+	ElectronState auger_electron( particle, true, true );
+
+	auger_electron.setEnergy( transition.third );
+
+	double angle_cosine, azimuthal_angle;
+
+	this->sampleEmissionDirection( angle_cosine, azimuthal_angle );
+
+	auger_electron.rotateDirection( angle_cosine, azimuthal_angle );
+
+	bank.push( auger_electron );
+      }
+
+      // Push the secondary vacancy first so that it is relaxed last
+      if( this->hasSubshellRelaxationData( transition.second ) &&
+	  stack_size < max_vacancy_stack_size )
+	vacancy_stack[stack_size++] = transition.second;
+    }
+
+    if( this->hasSubshellRelaxationData( transition.first ) &&
+	stack_size < max_vacancy_stack_size )
+      vacancy_stack[stack_size++] = transition.first;
+  }
+}
+
+// Return the number of transitions that can fill a subshell vacancy
+unsigned FlattenedAtomicRelaxationModel::getNumberOfSubshellTransitions(
+				          const SubshellType subshell ) const
+{
+  if( this->hasSubshellRelaxationData( subshell ) )
+  {
+    return d_subshell_transition_offsets[subshell+1] -
+      d_subshell_transition_offsets[subshell];
+  }
+  else
+    return 0u;
+}
+
+// Sample a transition in the subshell transition range
+unsigned FlattenedAtomicRelaxationModel::sampleTransition(
+				  const SubshellType vacancy_subshell ) const
+{
+  // Make sure the subshell has data
+  testPrecondition( this->hasSubshellRelaxationData( vacancy_subshell ) );
+
+  const unsigned start_index =
+    d_subshell_transition_offsets[vacancy_subshell];
+
+  const unsigned end_index =
+    d_subshell_transition_offsets[vacancy_subshell+1];
+
+  double random_number = Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  return start_index + Utility::Search::binaryUpperBoundIndex(
+				      d_transition_cdfs.begin() + start_index,
+				      d_transition_cdfs.begin() + end_index,
+				      random_number );
+}
+
+// Sample emission direction
+void FlattenedAtomicRelaxationModel::sampleEmissionDirection(
+						      double& angle_cosine,
+						      double& azimuthal_angle )
+{
+  // Sample an isotropic outgoing angle cosine for the relaxation particle
+  angle_cosine = -1.0 +
+    2.0*Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  // Sample the azimuthal angle
+  azimuthal_angle = 2.0*Utility::PhysicalConstants::pi*
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  // Make sure the scattering angle cosine is valid
+  testPostcondition( angle_cosine >= -1.0 );
+  testPostcondition( angle_cosine <= 1.0 );
+  // Make sure the azimuthal angle is valid
+  testPostcondition( azimuthal_angle >= 0.0 );
+  testPostcondition( azimuthal_angle <= 2*Utility::PhysicalConstants::pi );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FlattenedAtomicRelaxationModel.cpp
+//---------------------------------------------------------------------------//
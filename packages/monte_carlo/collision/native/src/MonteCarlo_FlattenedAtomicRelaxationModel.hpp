@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FlattenedAtomicRelaxationModel.hpp
+//! \author Luke Kersting
+//! \brief  Flattened atomic relaxation model class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FLATTENED_ATOMIC_RELAXATION_MODEL_HPP
+#define MONTE_CARLO_FLATTENED_ATOMIC_RELAXATION_MODEL_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_AtomicRelaxationModel.hpp"
+#include "Utility_Tuple.hpp"
+
+namespace MonteCarlo{
+
+/*! The flattened atomic relaxation model
+ * \details This model accounts for all possible transitions to fill an
+ * initial vacancy and will follow all subsequent vacancies until the atom
+ * has relaxed back to its ground state (identical physics to the
+ * MonteCarlo::DetailedAtomicRelaxationModel). The transition data for every
+ * subshell is stored in a single contiguous array that is indexed by the
+ * subshell type and the cascade is followed with a fixed size vacancy stack
+ * instead of recursion. Relaxation particles with energies below the
+ * particle cutoff energies are never constructed - their energy is
+ * deposited locally.
+ */
+class FlattenedAtomicRelaxationModel : public AtomicRelaxationModel
+{
+
+public:
+
+  //! Constructor
+  FlattenedAtomicRelaxationModel(
+     const Teuchos::Array<SubshellType>& vacancy_subshells,
+     const Teuchos::Array<Teuchos::Array<SubshellType> >&
+     primary_transition_vacancy_shells,
+     const Teuchos::Array<Teuchos::Array<SubshellType> >&
+     secondary_transition_vacancy_shells,
+     const Teuchos::Array<Teuchos::Array<double> >& outgoing_particle_energies,
+     const Teuchos::Array<Teuchos::Array<double> >& transition_pdf_or_cdf,
+     const bool interpret_as_cdf = true );
+
+  //! Destructor
+  ~FlattenedAtomicRelaxationModel()
+  { /* ... */ }
+
+  //! Relax the atom
+  void relaxAtom( const SubshellType vacancy_shell,
+		  const ParticleState& particle,
+		  ParticleBank& bank ) const;
+
+  //! Check if a subshell has relaxation data
+  bool hasSubshellRelaxationData( const SubshellType subshell ) const;
+
+  //! Return the number of transitions that can fill a subshell vacancy
+  unsigned getNumberOfSubshellTransitions( const SubshellType subshell ) const;
+
+  //! The maximum number of vacancies that can be waiting for relaxation
+  static const unsigned max_vacancy_stack_size = 128;
+
+private:
+
+  // Sample a transition in the subshell transition range
+  unsigned sampleTransition( const SubshellType vacancy_subshell ) const;
+
+  // Sample emission direction
+  static void sampleEmissionDirection( double& angle_cosine,
+				       double& azimuthal_angle );
+
+  // The transition data offsets (indexed by subshell type)
+  Teuchos::Array<unsigned> d_subshell_transition_offsets;
+
+  // The transition cdf values of every subshell
+  Teuchos::Array<double> d_transition_cdfs;
+
+  // The transition vacancy shells and outgoing particle energies of every
+  // subshell (first = primary, second = secondary, third = energy)
+  Teuchos::Array<Utility::Trip<SubshellType,SubshellType,double> >
+  d_transitions;
+};
+
+// Check if a subshell has relaxation data
+inline bool FlattenedAtomicRelaxationModel::hasSubshellRelaxationData(
+				         const SubshellType subshell ) const
+{
+  if( subshell > UNKNOWN_SUBSHELL && subshell <= Q3_SUBSHELL )
+  {
+    return d_subshell_transition_offsets[subshell] !=
+      d_subshell_transition_offsets[subshell+1];
+  }
+  else
+    return false;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FLATTENED_ATOMIC_RELAXATION_MODEL_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FlattenedAtomicRelaxationModel.hpp
+//---------------------------------------------------------------------------//
@@ -8,11 +8,14 @@
 
 // Std Lib Includes
 #include <limits>
+#include <stdexcept>
+#include <cmath>
 
 // FRENSIE Includes
 #include "MonteCarlo_NeutronMaterial.hpp"
 #include "MonteCarlo_MaterialHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -42,6 +45,160 @@ NeutronMaterial::NeutronMaterial(
     d_nuclides[i].second = nuclide_name_map.find( nuclide_names[i] )->second;
   }
 
+  // Convert the fractions to nuclide number densities
+  this->calculateNuclideNumberDensities( density );
+}
+
+// Constructor (on-the-fly temperature interpolation)
+/*! \details Only a few base tables of each nuclide (evaluated at different
+ * temperatures) need to be loaded. Each nuclide in the material is replaced 
+ * by the pair of base tables that bracket the material temperature. The 
+ * nuclide fraction is split between the two tables using interpolation 
+ * in the square root of the temperature (the Doppler width scales with 
+ * sqrt(T)). The macroscopic cross sections are therefore the 
+ * temperature interpolated cross sections and sampling the collision table 
+ * from the split fractions is equivalent to stochastically interpolating 
+ * between the bracketing tables. The temperature must be in MeV.
+ */
+NeutronMaterial::NeutronMaterial(
+	    const ModuleTraits::InternalMaterialHandle id,
+	    const double density,
+	    const double temperature,
+	    const NuclideTemperatureTableMap& nuclide_temperature_table_map,
+	    const Teuchos::Array<double>& nuclide_fractions,
+	    const Teuchos::Array<std::string>& nuclide_names )
+  : d_id( id ),
+    d_number_density( density ),
+    d_nuclides()
+{
+  // Make sure the temperature is valid
+  testPrecondition( temperature >= 0.0 );
+  // Make sure the fraction values are valid (all positive or all negative)
+  testPrecondition( areFractionValuesValid( nuclide_fractions.begin(),
+					    nuclide_fractions.end() ) );
+  testPrecondition( nuclide_fractions.size() == nuclide_names.size() );
+
+  d_nuclides.reserve( 2*nuclide_fractions.size() );
+
+  // Split each nuclide between the tables that bracket the temperature
+  for( unsigned i = 0u; i < nuclide_fractions.size(); ++i )
+  {
+    NuclideTemperatureTableMap::const_iterator tables = 
+      nuclide_temperature_table_map.find( nuclide_names[i] );
+
+    TEST_FOR_EXCEPTION( tables == nuclide_temperature_table_map.end(),
+			std::runtime_error,
+			"Error: there are no temperature tables for nuclide "
+			<< nuclide_names[i] << " (material " << id << ")!" );
+
+    unsigned lower_table_index, upper_table_index;
+    double upper_table_fraction;
+
+    NeutronMaterial::findBracketingTemperatureTables( temperature,
+						      tables->second,
+						      lower_table_index,
+						      upper_table_index,
+						      upper_table_fraction );
+    
+    TEST_FOR_EXCEPTION( upper_table_fraction < 0.0 || 
+			upper_table_fraction > 1.0,
+			std::runtime_error,
+			"Error: temperature " << temperature << " MeV of "
+			"material " << id << " is outside of the temperature "
+			"range covered by the tables of nuclide "
+			<< nuclide_names[i] << "!" );
+
+    if( upper_table_fraction < 1.0 )
+    {
+      d_nuclides.push_back( Utility::Pair<double,Teuchos::RCP<Nuclide> >( 
+			       nuclide_fractions[i]*(1.0 - upper_table_fraction),
+			       tables->second[lower_table_index] ) );
+    }
+
+    if( upper_table_fraction > 0.0 )
+    {
+      d_nuclides.push_back( Utility::Pair<double,Teuchos::RCP<Nuclide> >( 
+				       nuclide_fractions[i]*upper_table_fraction,
+				       tables->second[upper_table_index] ) );
+    }
+  }
+
+  // Convert the fractions to nuclide number densities
+  this->calculateNuclideNumberDensities( density );
+}
+
+// Find the tables that bracket the temperature
+/*! \details The tables do not need to be sorted. If the temperature is
+ * outside of the range covered by the tables the upper table fraction will
+ * be outside of [0,1].
+ */
+void NeutronMaterial::findBracketingTemperatureTables( 
+		       const double temperature,
+		       const Teuchos::Array<Teuchos::RCP<Nuclide> >& tables,
+		       unsigned& lower_table_index,
+		       unsigned& upper_table_index,
+		       double& upper_table_fraction )
+{
+  // Make sure there is at least one table
+  testPrecondition( tables.size() > 0 );
+
+  lower_table_index = std::numeric_limits<unsigned>::max();
+  upper_table_index = std::numeric_limits<unsigned>::max();
+  
+  for( unsigned i = 0u; i < tables.size(); ++i )
+  {
+    const double table_temperature = tables[i]->getTemperature();
+    
+    if( table_temperature <= temperature )
+    {
+      if( lower_table_index == std::numeric_limits<unsigned>::max() ||
+	  table_temperature > tables[lower_table_index]->getTemperature() )
+	lower_table_index = i;
+    }
+    
+    if( table_temperature >= temperature )
+    {
+      if( upper_table_index == std::numeric_limits<unsigned>::max() ||
+	  table_temperature < tables[upper_table_index]->getTemperature() )
+	upper_table_index = i;
+    }
+  }
+
+  // Below the lowest table temperature
+  if( lower_table_index == std::numeric_limits<unsigned>::max() )
+  {
+    lower_table_index = upper_table_index;
+    upper_table_fraction = -1.0;
+  }
+  // Above the highest table temperature
+  else if( upper_table_index == std::numeric_limits<unsigned>::max() )
+  {
+    upper_table_index = lower_table_index;
+    upper_table_fraction = 2.0;
+  }
+  // The temperature of a table
+  else if( lower_table_index == upper_table_index ||
+	   tables[lower_table_index]->getTemperature() ==
+	   tables[upper_table_index]->getTemperature() )
+  {
+    upper_table_index = lower_table_index;
+    upper_table_fraction = 0.0;
+  }
+  else
+  {
+    const double sqrt_lower_temp = 
+      std::sqrt( tables[lower_table_index]->getTemperature() );
+    const double sqrt_upper_temp = 
+      std::sqrt( tables[upper_table_index]->getTemperature() );
+    
+    upper_table_fraction = (std::sqrt( temperature ) - sqrt_lower_temp)/
+      (sqrt_upper_temp - sqrt_lower_temp);
+  }
+}
+
+// Convert the nuclide fractions to nuclide number densities
+void NeutronMaterial::calculateNuclideNumberDensities( const double density )
+{
   // Convert weight fractions to atom fractions
   if( d_nuclides.front().first < 0.0 )
   {
@@ -80,6 +237,15 @@ NeutronMaterial::NeutronMaterial(
 						     d_nuclides.end() );
 }
 
+// Return the number of nuclide tables used by the material
+/*! \details When on-the-fly temperature interpolation is used each nuclide
+ * can be represented by up to two tables.
+ */
+unsigned NeutronMaterial::getNumberOfNuclideTables() const
+{
+  return d_nuclides.size();
+}
+
 // Return the material id
 ModuleTraits::InternalMaterialHandle NeutronMaterial::getId() const
 {
@@ -149,11 +315,45 @@ double NeutronMaterial::getMacroscopicReactionCrossSection(
   return cross_section;
 }
 
+// Return the macroscopic total cross section (1/cm) seen by a neutron
+/*! \details The unresolved resonance probability tables of the nuclides 
+ * will be used if the neutron is in the unresolved resonance range.
+ */
+double NeutronMaterial::getMacroscopicTotalCrossSection( 
+					     const NeutronState& neutron ) const
+{
+  double cross_section = 0.0;
+  
+  for( unsigned i = 0u; i < d_nuclides.size(); ++i )
+  {
+    cross_section += 
+      d_nuclides[i].first*d_nuclides[i].second->getTotalCrossSection(neutron);
+  }
+
+  return cross_section;
+}
+
+// Return the macroscopic reaction cross section (1/cm) seen by a neutron
+double NeutronMaterial::getMacroscopicReactionCrossSection( 
+				     const NeutronState& neutron,
+				     const NuclearReactionType reaction ) const
+{
+  double cross_section = 0.0;
+  
+  for( unsigned i = 0u; i < d_nuclides.size(); ++i )
+  {
+    cross_section += d_nuclides[i].first*
+      d_nuclides[i].second->getReactionCrossSection( neutron, reaction );
+  }
+
+  return cross_section;
+}
+
 // Collide with a neutron
 void NeutronMaterial::collideAnalogue( NeutronState& neutron, 
 				       ParticleBank& bank ) const
 {
-  unsigned nuclide_index = sampleCollisionNuclide( neutron.getEnergy() );
+  unsigned nuclide_index = sampleCollisionNuclide( neutron );
 
   d_nuclides[nuclide_index].second->collideAnalogue( neutron, bank );
 }
@@ -171,17 +371,18 @@ void NeutronMaterial::collideAnalogue( NeutronState& neutron,
 void NeutronMaterial::collideSurvivalBias( NeutronState& neutron, 
 					   ParticleBank& bank ) const
 {
-  unsigned nuclide_index = sampleCollisionNuclide( neutron.getEnergy() );
+  unsigned nuclide_index = sampleCollisionNuclide( neutron );
 
   d_nuclides[nuclide_index].second->collideSurvivalBias( neutron, bank );
 }
 
 // Sample the nuclide that is collided with
-unsigned NeutronMaterial::sampleCollisionNuclide( const double energy ) const
+unsigned NeutronMaterial::sampleCollisionNuclide( 
+					     const NeutronState& neutron ) const
 {
   double scaled_random_number = 
     Utility::RandomNumberGenerator::getRandomNumber<double>()*
-    this->getMacroscopicTotalCrossSection( energy );
+    this->getMacroscopicTotalCrossSection( neutron );
 
   double partial_total_cs = 0.0;
 
@@ -190,7 +391,7 @@ unsigned NeutronMaterial::sampleCollisionNuclide( const double energy ) const
   for( unsigned i = 0u; i < d_nuclides.size(); ++i )
   {
     partial_total_cs += 
-      d_nuclides[i].first*d_nuclides[i].second->getTotalCrossSection( energy );
+      d_nuclides[i].first*d_nuclides[i].second->getTotalCrossSection(neutron);
     
     if( scaled_random_number < partial_total_cs )
     {
@@ -30,6 +30,11 @@ class NeutronMaterial
 
 public:
 
+  //! Typedef for the nuclide temperature table map
+  typedef boost::unordered_map<std::string,
+                               Teuchos::Array<Teuchos::RCP<Nuclide> > >
+  NuclideTemperatureTableMap;
+
   //! Constructor
   NeutronMaterial( 
 		const ModuleTraits::InternalMaterialHandle id,
@@ -39,6 +44,15 @@ public:
 		const Teuchos::Array<double>& nuclide_fractions,
 		const Teuchos::Array<std::string>& nuclide_names );
 
+  //! Constructor (on-the-fly temperature interpolation)
+  NeutronMaterial( 
+	    const ModuleTraits::InternalMaterialHandle id,
+	    const double density,
+	    const double temperature,
+	    const NuclideTemperatureTableMap& nuclide_temperature_table_map,
+	    const Teuchos::Array<double>& nuclide_fractions,
+	    const Teuchos::Array<std::string>& nuclide_names );
+
   //! Destructor
   ~NeutronMaterial()
   { /* ... */ }
@@ -49,6 +63,9 @@ public:
   //! Return the material number density (atom/b-cm)
   double getNumberDensity() const;
 
+  //! Return the number of nuclide tables used by the material
+  unsigned getNumberOfNuclideTables() const;
+
   //! Return the macroscopic total cross section (1/cm)
   double getMacroscopicTotalCrossSection( const double energy ) const;
 
@@ -63,6 +80,14 @@ public:
 				     const double energy,
 				     const NuclearReactionType reaction) const;
 
+  //! Return the macroscopic total cross section (1/cm) seen by a neutron
+  double getMacroscopicTotalCrossSection( const NeutronState& neutron ) const;
+
+  //! Return the macroscopic reaction cross section (1/cm) seen by a neutron
+  double getMacroscopicReactionCrossSection( 
+				     const NeutronState& neutron,
+				     const NuclearReactionType reaction) const;
+
   //! Collide with a neutron
   void collideAnalogue( NeutronState& neutron, ParticleBank& bank ) const;
 
@@ -71,12 +96,23 @@ public:
 
 private:
 
+  // Find the tables that bracket the temperature
+  static void findBracketingTemperatureTables( 
+		      const double temperature,
+		      const Teuchos::Array<Teuchos::RCP<Nuclide> >& tables,
+		      unsigned& lower_table_index,
+		      unsigned& upper_table_index,
+		      double& upper_table_fraction );
+
+  // Convert the nuclide fractions to nuclide number densities
+  void calculateNuclideNumberDensities( const double density );
+
   // Get the atomic weight ratio from a nuclide pointer
   static double getNuclideAWR( 
 		    const Utility::Pair<double,Teuchos::RCP<Nuclide> >& pair );
 
   // Sample the nuclide that is collided with
-  unsigned sampleCollisionNuclide( const double energy ) const;
+  unsigned sampleCollisionNuclide( const NeutronState& neutron ) const;
 
   // The material id
   ModuleTraits::InternalMaterialHandle d_id;
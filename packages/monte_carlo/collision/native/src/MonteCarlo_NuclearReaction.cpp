@@ -8,6 +8,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_NuclearReaction.hpp"
+#include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_SearchAlgorithms.hpp"
 #include "Utility_InterpolationPolicy.hpp"
@@ -16,6 +17,11 @@
 namespace MonteCarlo{
 
 // Constructor
+/*! \details If the compact cross section storage mode has been turned on 
+ * (see MonteCarlo::SimulationNeutronProperties) the cross section values 
+ * will be stored in single precision. The incoming energy grid, which is 
+ * shared by all reactions of a nuclide, is always stored in double precision.
+ */
 NuclearReaction::NuclearReaction( 
 		   const NuclearReactionType reaction_type,
 		   const double temperature,
@@ -28,7 +34,8 @@ NuclearReaction::NuclearReaction(
     d_q_value( q_value ),
     d_threshold_energy_index( threshold_energy_index ),
     d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section )
+    d_cross_section(),
+    d_compact_cross_section()
 {
   // Make sure the Q value is valid
   testPrecondition( !ST::isnaninf( q_value ) );
@@ -43,6 +50,18 @@ NuclearReaction::NuclearReaction(
   testPrecondition( incoming_energy_grid.size() > 0 );
   // Make sure the cross section is valid
   testPrecondition( cross_section.size() > 0 );
+
+  if( SimulationNeutronProperties::isCompactCrossSectionStorageModeOn() )
+  {
+    Teuchos::ArrayRCP<float> compact_cross_section( cross_section.size() );
+
+    for( unsigned i = 0; i < cross_section.size(); ++i )
+      compact_cross_section[i] = static_cast<float>( cross_section[i] );
+
+    d_compact_cross_section = compact_cross_section;
+  }
+  else
+    d_cross_section = cross_section;
 }
 
 // Return the reaction type
@@ -58,11 +77,30 @@ double NuclearReaction::getQValue() const
 }
 
 // Return the cross section value at a given energy
+/*! \details The storage is selected once per call so that the lookup itself
+ * does not need to check which cross section array has been set.
+ */
 double NuclearReaction::getCrossSection( const double energy ) const
+{
+  if( d_compact_cross_section.is_null() )
+    return this->getCrossSection( energy, d_cross_section );
+  else
+    return this->getCrossSection( energy, d_compact_cross_section );
+}
+
+// Return the cross section at a given energy using the stored values
+template<typename ValueType>
+double NuclearReaction::getCrossSection( 
+	        const double energy,
+	        const Teuchos::ArrayRCP<const ValueType>& cross_section ) const
 {
   if( energy >= this->getThresholdEnergy() &&
-      energy < d_incoming_energy_grid[d_incoming_energy_grid.size()-1] )
+      energy <= d_incoming_energy_grid[d_incoming_energy_grid.size()-1] )
   {
+    // The last grid point has no upper bin
+    if( energy == d_incoming_energy_grid[d_incoming_energy_grid.size()-1] )
+      return cross_section[cross_section.size()-1];
+    
     unsigned energy_index = 
       Utility::Search::binaryLowerBoundIndex( d_incoming_energy_grid.begin(),
 					      d_incoming_energy_grid.end(),
@@ -71,18 +109,14 @@ double NuclearReaction::getCrossSection( const double energy ) const
     unsigned cs_index = energy_index - d_threshold_energy_index;
     
     return Utility::LinLin::interpolate( 
-					d_incoming_energy_grid[energy_index],
-					d_incoming_energy_grid[energy_index+1],
-					energy,
-					d_cross_section[cs_index],
-					d_cross_section[cs_index+1] );
+				      d_incoming_energy_grid[energy_index],
+				      d_incoming_energy_grid[energy_index+1],
+				      energy,
+				      cross_section[cs_index],
+				      cross_section[cs_index+1] );
   }
-  else if( energy < this->getThresholdEnergy() )
+  else // energy < threshold energy or energy > max energy
     return 0.0;
-  else if( energy == d_incoming_energy_grid[d_incoming_energy_grid.size()-1] )
-    return d_cross_section[d_cross_section.size()-1];
-  else // energy > this->getThresholdEnergy()
-    return 0.0;    
 }
 
 } // end MonteCarlo namespace
@@ -55,6 +55,9 @@ public:
 
   //! Return the cross section at a given energy
   double getCrossSection( const double energy ) const;
+
+  //! Check if the cross section values are stored in single precision
+  bool hasCompactCrossSection() const;
   
   //! Return the number of neutrons emitted from the rxn at the given energy
   virtual unsigned getNumberOfEmittedNeutrons( const double energy ) const = 0;
@@ -73,6 +76,12 @@ protected:
   
 private:
 
+  // Return the cross section at a given energy using the stored values
+  template<typename ValueType>
+  double getCrossSection( 
+	       const double energy,
+	       const Teuchos::ArrayRCP<const ValueType>& cross_section ) const;
+
   // The nuclear reaction type
   NuclearReactionType d_reaction_type;
 
@@ -90,6 +99,9 @@ private:
 
   // The cross section values evaluated on the incoming energy grid
   Teuchos::ArrayRCP<const double> d_cross_section;
+
+  // The single precision cross section values (compact storage mode only)
+  Teuchos::ArrayRCP<const float> d_compact_cross_section;
 };
 
 // Return the temperature (in MeV) at which the reaction occurs
@@ -104,6 +116,12 @@ inline double NuclearReaction::getThresholdEnergy() const
   return d_incoming_energy_grid[d_threshold_energy_index];
 }
 
+// Check if the cross section values are stored in single precision
+inline bool NuclearReaction::hasCompactCrossSection() const
+{
+  return !d_compact_cross_section.is_null();
+}
+
 // Return the average number of neutron emitted from the rxn
 /*! \details If the neutron multiplicity for the reaction is not an integer
  * at the desired energy, this function should be overridden in the derived
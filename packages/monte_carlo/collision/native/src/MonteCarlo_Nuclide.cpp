@@ -18,6 +18,7 @@
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
 
@@ -158,6 +159,26 @@ Nuclide::Nuclide( const std::string& name,
     ++reaction_type_pointer;
   }
 
+  // Store the fission reactions so that the smooth fission cross section
+  // can be evaluated without searching the reaction maps
+  const ConstReactionMap* reaction_maps[3] = {&d_scattering_reactions,
+					      &d_absorption_reactions,
+					      &d_miscellaneous_reactions};
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    ConstReactionMap::const_iterator nuclear_reaction = 
+      reaction_maps[i]->begin();
+
+    while( nuclear_reaction != reaction_maps[i]->end() )
+    {
+      if( isFissionReaction( nuclear_reaction->first ) )
+	d_fission_reactions.push_back( nuclear_reaction->second );
+
+      ++nuclear_reaction;
+    }
+  }
+
   // Calculate the total absorption cross section
   calculateTotalAbsorptionReaction( energy_grid );
   
@@ -208,9 +229,27 @@ double Nuclide::getTemperature() const
 }
 
 // Return the total cross section at the desired energy
+/*! \details Below the maximum S(alpha,beta) energy the free gas elastic
+ * cross section is replaced by the S(alpha,beta) cross sections.
+ */
 double Nuclide::getTotalCrossSection( const double energy ) const
 {
-  return d_total_reaction->getCrossSection( energy );
+  if( this->useSAlphaBeta( energy ) )
+  {
+    double total_cross_section = 
+      d_total_reaction->getCrossSection( energy ) +
+      d_s_alpha_beta->getTotalCrossSection( energy );
+
+    if( !d_free_gas_elastic_reaction.is_null() )
+    {
+      total_cross_section -= 
+	d_free_gas_elastic_reaction->getCrossSection( energy );
+    }
+
+    return total_cross_section;
+  }
+  else
+    return d_total_reaction->getCrossSection( energy );
 }
 
 // Return the total absorption cross section at the desired energy
@@ -228,7 +267,7 @@ double Nuclide::getSurvivalProbability( const double energy ) const
   
   double survival_prob = 1.0 - 
     d_total_absorption_reaction->getCrossSection( energy )/
-    d_total_reaction->getCrossSection( energy );
+    this->getTotalCrossSection( energy );
 
   // Make sure the survival probability is valid
   testPostcondition( survival_prob >= 0.0 );
@@ -245,10 +284,14 @@ double Nuclide::getReactionCrossSection(
   switch( reaction )
   {
   case N__TOTAL_REACTION:
-    return d_total_reaction->getCrossSection( energy );
+    return this->getTotalCrossSection( energy );
   case N__TOTAL_ABSORPTION_REACTION:
     return d_total_absorption_reaction->getCrossSection( energy );
   default:
+    // Use the S(alpha,beta) data instead of the free gas elastic reaction
+    if( reaction == N__N_ELASTIC_REACTION && this->useSAlphaBeta( energy ) )
+      return d_s_alpha_beta->getTotalCrossSection( energy );
+    
     ConstReactionMap::const_iterator nuclear_reaction = 
       d_scattering_reactions.find( reaction );
     
@@ -269,24 +312,111 @@ double Nuclide::getReactionCrossSection(
   }
 }
   
+// Return the total cross section seen by a neutron
+/*! \details In the unresolved resonance range the elastic, fission and
+ * capture cross sections are sampled from the probability table. The other
+ * reactions always use their smooth cross sections. Outside of the 
+ * unresolved resonance range this is identical to the energy only lookup.
+ */
+double Nuclide::getTotalCrossSection( const NeutronState& neutron ) const
+{
+  if( this->useUnresolvedResonanceData( neutron.getEnergy() ) )
+  {
+    UnresolvedResonanceFactors factors;
+
+    this->calculateUnresolvedResonanceFactors( neutron, factors );
+
+    return this->getTotalCrossSection( neutron.getEnergy(), factors );
+  }
+  else
+    return this->getTotalCrossSection( neutron.getEnergy() );
+}
+
+// Return the total absorption cross section seen by a neutron
+double Nuclide::getAbsorptionCrossSection( const NeutronState& neutron ) const
+{
+  if( this->useUnresolvedResonanceData( neutron.getEnergy() ) )
+  {
+    UnresolvedResonanceFactors factors;
+
+    this->calculateUnresolvedResonanceFactors( neutron, factors );
+
+    return this->getAbsorptionCrossSection( neutron.getEnergy(), factors );
+  }
+  else
+    return this->getAbsorptionCrossSection( neutron.getEnergy() );
+}
+
+// Return the cross section for a specific reaction seen by a neutron
+double Nuclide::getReactionCrossSection( 
+				     const NeutronState& neutron,
+				     const NuclearReactionType reaction ) const
+{
+  if( this->useUnresolvedResonanceData( neutron.getEnergy() ) )
+  {
+    UnresolvedResonanceFactors factors;
+
+    this->calculateUnresolvedResonanceFactors( neutron, factors );
+      
+    switch( reaction )
+    {
+    case N__TOTAL_REACTION:
+      return this->getTotalCrossSection( neutron.getEnergy(), factors );
+    case N__TOTAL_ABSORPTION_REACTION:
+      return this->getAbsorptionCrossSection( neutron.getEnergy(), factors );
+    default:
+      return this->getReactionCrossSection( neutron.getEnergy(), reaction )*
+	Nuclide::getUnresolvedResonanceFactor( reaction, factors );
+    }
+  }
+  else
+    return this->getReactionCrossSection( neutron.getEnergy(), reaction );
+}
+
 // Collide with a neutron
+/*! \details In the unresolved resonance range the reaction cross sections
+ * seen by the neutron are used to sample the reaction.
+ */
 void Nuclide::collideAnalogue( NeutronState& neutron, 
 			       ParticleBank& bank ) const
 {
-  double total_cross_section = 
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
+  UnresolvedResonanceFactors factors;
+  
+  const UnresolvedResonanceFactors* factors_ptr = NULL;
+  
+  double total_cross_section, absorption_cross_section;
+  
+  if( this->useUnresolvedResonanceData( neutron.getEnergy() ) )
+  {
+    this->calculateUnresolvedResonanceFactors( neutron, factors );
+
+    factors_ptr = &factors;
+
+    total_cross_section = 
+      this->getTotalCrossSection( neutron.getEnergy(), factors );
+
+    absorption_cross_section = 
+      this->getAbsorptionCrossSection( neutron.getEnergy(), factors );
+  }
+  else
+  {
+    total_cross_section = this->getTotalCrossSection( neutron.getEnergy() );
+
+    absorption_cross_section = 
+      d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+  }
 
   double scaled_random_number = 
     Utility::RandomNumberGenerator::getRandomNumber<double>()*
     total_cross_section;
 
-  double absorption_cross_section = 
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
-
   // Check if absorption occurs
   if( scaled_random_number < absorption_cross_section )
   {
-    sampleAbsorptionReaction( scaled_random_number, neutron, bank );
+    sampleAbsorptionReaction( scaled_random_number, 
+			      neutron, 
+			      bank, 
+			      factors_ptr );
 
     // Set the neutron as gone regardless of the reaction that occurred.
     neutron.setAsGone(); 
@@ -295,7 +425,8 @@ void Nuclide::collideAnalogue( NeutronState& neutron,
   {
     sampleScatteringReaction( scaled_random_number - absorption_cross_section, 
 			      neutron, 
-			      bank );
+			      bank,
+			      factors_ptr );
   }
 }
 
@@ -303,14 +434,34 @@ void Nuclide::collideAnalogue( NeutronState& neutron,
 void Nuclide::collideSurvivalBias( NeutronState& neutron, 
 				   ParticleBank& bank) const
 {
-  double random_number = 
-    Utility::RandomNumberGenerator::getRandomNumber<double>();
+  UnresolvedResonanceFactors factors;
+  
+  const UnresolvedResonanceFactors* factors_ptr = NULL;
+  
+  double total_cross_section, scattering_cross_section;
   
-  double total_cross_section = 
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
+  if( this->useUnresolvedResonanceData( neutron.getEnergy() ) )
+  {
+    this->calculateUnresolvedResonanceFactors( neutron, factors );
+
+    factors_ptr = &factors;
 
-  double scattering_cross_section = total_cross_section - 
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+    total_cross_section = 
+      this->getTotalCrossSection( neutron.getEnergy(), factors );
+
+    scattering_cross_section = total_cross_section -
+      this->getAbsorptionCrossSection( neutron.getEnergy(), factors );
+  }
+  else
+  {
+    total_cross_section = this->getTotalCrossSection( neutron.getEnergy() );
+
+    scattering_cross_section = total_cross_section - 
+      d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+  }
+  
+  double random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
 
   double survival_prob = scattering_cross_section/total_cross_section;
   
@@ -321,12 +472,164 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
 
     sampleScatteringReaction( random_number*scattering_cross_section,
 			      neutron,
-			      bank );
+			      bank,
+			      factors_ptr );
   }
   else
     neutron.setAsGone();
 }
 
+// Set the S(alpha,beta) data of the bound nuclide
+/*! \details Below the maximum S(alpha,beta) energy the S(alpha,beta) 
+ * reactions will replace the free gas elastic reaction.
+ */
+void Nuclide::setSAlphaBeta( const Teuchos::RCP<const SAlphaBeta>& s_alpha_beta )
+{
+  // Make sure the S(alpha,beta) data is valid
+  testPrecondition( !s_alpha_beta.is_null() );
+
+  d_s_alpha_beta = s_alpha_beta;
+
+  ConstReactionMap::const_iterator elastic_reaction = 
+    d_scattering_reactions.find( N__N_ELASTIC_REACTION );
+
+  if( elastic_reaction != d_scattering_reactions.end() )
+    d_free_gas_elastic_reaction = elastic_reaction->second;
+}
+
+// Check if the nuclide has S(alpha,beta) data
+bool Nuclide::hasSAlphaBeta() const
+{
+  return !d_s_alpha_beta.is_null();
+}
+
+// Set the unresolved resonance probability table
+void Nuclide::setUnresolvedResonanceProbabilityTable(
+	       const Teuchos::RCP<const UnresolvedResonanceProbabilityTable>&
+	       unresolved_resonance_table )
+{
+  // Make sure the table is valid
+  testPrecondition( !unresolved_resonance_table.is_null() );
+
+  d_unresolved_resonance_table = unresolved_resonance_table;
+}
+
+// Check if the nuclide has unresolved resonance data
+bool Nuclide::hasUnresolvedResonanceData() const
+{
+  return !d_unresolved_resonance_table.is_null();
+}
+
+// Calculate the unresolved resonance factors seen by a neutron
+/*! \details The smooth fission cross section is the sum of all fission 
+ * reaction cross sections. If a smooth cross section is zero its factor 
+ * will be one (the band value cannot be distributed over the reactions).
+ * The smooth cross sections will only be evaluated if the probability table
+ * has not already cached the cross sections seen by the neutron (e.g. when
+ * the material total cross section and the collision nuclide are evaluated
+ * at the same collision site).
+ */
+void Nuclide::calculateUnresolvedResonanceFactors(
+			          const NeutronState& neutron,
+				  UnresolvedResonanceFactors& factors ) const
+{
+  // Make sure the unresolved resonance data can be used
+  testPrecondition( this->useUnresolvedResonanceData( neutron.getEnergy() ) );
+
+  double elastic_cross_section, fission_cross_section, capture_cross_section;
+
+  if( !d_unresolved_resonance_table->getCachedCrossSections( 
+						     neutron,
+						     factors.smooth_elastic,
+						     factors.smooth_fission,
+						     factors.smooth_capture,
+						     elastic_cross_section,
+						     fission_cross_section,
+						     capture_cross_section ) )
+  {
+    const double energy = neutron.getEnergy();
+  
+    factors.smooth_elastic = 
+      this->getReactionCrossSection( energy, N__N_ELASTIC_REACTION );
+    
+    factors.smooth_capture = 
+      this->getReactionCrossSection( energy, N__GAMMA_REACTION );
+    
+    factors.smooth_fission = 0.0;
+
+    for( unsigned i = 0; i < d_fission_reactions.size(); ++i )
+    {
+      factors.smooth_fission += 
+	d_fission_reactions[i]->getCrossSection( energy );
+    }
+    
+    d_unresolved_resonance_table->sampleCrossSections( neutron,
+						       factors.smooth_elastic,
+						       factors.smooth_fission,
+						       factors.smooth_capture,
+						       elastic_cross_section,
+						       fission_cross_section,
+						       capture_cross_section );
+  }
+
+  factors.elastic = (factors.smooth_elastic > 0.0 ?
+		     elastic_cross_section/factors.smooth_elastic : 1.0);
+
+  factors.fission = (factors.smooth_fission > 0.0 ?
+		     fission_cross_section/factors.smooth_fission : 1.0);
+
+  factors.capture = (factors.smooth_capture > 0.0 ?
+		     capture_cross_section/factors.smooth_capture : 1.0);
+}
+
+// Return the total cross section with the unresolved resonance factors
+double Nuclide::getTotalCrossSection( 
+			  const double energy,
+			  const UnresolvedResonanceFactors& factors ) const
+{
+  return this->getTotalCrossSection( energy ) +
+    (factors.elastic - 1.0)*factors.smooth_elastic +
+    (factors.fission - 1.0)*factors.smooth_fission +
+    (factors.capture - 1.0)*factors.smooth_capture;
+}
+
+// Return the absorption cross section with the unresolved resonance factors
+double Nuclide::getAbsorptionCrossSection( 
+			  const double energy,
+			  const UnresolvedResonanceFactors& factors ) const
+{
+  double cross_section = 0.0;
+
+  ConstReactionMap::const_iterator nuclear_reaction = 
+    d_absorption_reactions.begin();
+  
+  while( nuclear_reaction != d_absorption_reactions.end() )
+  {
+    cross_section += nuclear_reaction->second->getCrossSection( energy )*
+      Nuclide::getUnresolvedResonanceFactor( nuclear_reaction->first, 
+					     factors );
+    
+    ++nuclear_reaction;
+  }
+
+  return cross_section;
+}
+
+// Return the unresolved resonance factor of a reaction
+double Nuclide::getUnresolvedResonanceFactor(
+				    const NuclearReactionType reaction,
+				    const UnresolvedResonanceFactors& factors )
+{
+  if( reaction == N__N_ELASTIC_REACTION )
+    return factors.elastic;
+  else if( reaction == N__GAMMA_REACTION )
+    return factors.capture;
+  else if( isFissionReaction( reaction ) )
+    return factors.fission;
+  else
+    return 1.0;
+}
+
 // Calculate the total absorption cross section
 void Nuclide::calculateTotalAbsorptionReaction( 
 				 const Teuchos::ArrayRCP<double>& energy_grid )
@@ -404,11 +707,29 @@ void Nuclide::calculateTotalReaction(
 // Sample a scattering reaction
 // NOTE: The scaled random number must be a random number multiplied by the
 //       total scattering cross section then subtracted by the absorption xs.
-void Nuclide::sampleScatteringReaction( const double scaled_random_number,
-					NeutronState& neutron,
-					ParticleBank& bank ) const
+void Nuclide::sampleScatteringReaction( 
+			         const double scaled_random_number,
+				 NeutronState& neutron,
+				 ParticleBank& bank,
+				 const UnresolvedResonanceFactors* factors ) const
 {
   double partial_cross_section = 0.0;
+
+  const bool use_s_alpha_beta = this->useSAlphaBeta( neutron.getEnergy() );
+
+  // The S(alpha,beta) reactions replace the free gas elastic reaction
+  if( use_s_alpha_beta )
+  {
+    partial_cross_section += 
+      d_s_alpha_beta->getTotalCrossSection( neutron.getEnergy() );
+
+    if( scaled_random_number < partial_cross_section )
+    {
+      d_s_alpha_beta->scatterNeutron( neutron );
+
+      return;
+    }
+  }
     
   ConstReactionMap::const_iterator nuclear_reaction, nuclear_reaction_end;
     
@@ -417,9 +738,25 @@ void Nuclide::sampleScatteringReaction( const double scaled_random_number,
     
   while( nuclear_reaction != nuclear_reaction_end )
   {
-    partial_cross_section += 
+    if( use_s_alpha_beta && 
+	nuclear_reaction->first == N__N_ELASTIC_REACTION )
+    {
+      ++nuclear_reaction;
+      
+      continue;
+    }
+    
+    double cross_section = 
       nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
 
+    if( factors )
+    {
+      cross_section *= Nuclide::getUnresolvedResonanceFactor( 
+					     nuclear_reaction->first, *factors );
+    }
+
+    partial_cross_section += cross_section;
+
     if( scaled_random_number < partial_cross_section )
       break;
       
@@ -436,9 +773,11 @@ void Nuclide::sampleScatteringReaction( const double scaled_random_number,
 // Sample an absorption reaction
 // NOTE: The scaled random number must be a random number multiplied by the
 //       total absorption cross section
-void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
-					NeutronState& neutron,
-					ParticleBank& bank ) const
+void Nuclide::sampleAbsorptionReaction( 
+			         const double scaled_random_number,
+				 NeutronState& neutron,
+				 ParticleBank& bank,
+				 const UnresolvedResonanceFactors* factors ) const
 {
   double partial_cross_section = 0.0;
     
@@ -449,8 +788,16 @@ void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
   
   while( nuclear_reaction != nuclear_reaction_end )
   {
-    partial_cross_section += 
+    double cross_section = 
       nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+
+    if( factors )
+    {
+      cross_section *= Nuclide::getUnresolvedResonanceFactor( 
+					     nuclear_reaction->first, *factors );
+    }
+
+    partial_cross_section += cross_section;
     
     if( scaled_random_number < partial_cross_section )
       break;
@@ -16,13 +16,17 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_NuclearReaction.hpp"
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
 
 namespace MonteCarlo{
 
 /*! The nuclide class
- * \details This is the base class for all nuclides. No unresolved 
- * resonance data is stored in this base class.
+ * \details This is the base class for all nuclides. Unresolved resonance
+ * probability tables are only used by the cross section lookups that take
+ * a neutron - the energy only lookups always return the smooth (infinitely
+ * dilute) cross sections.
  */
 class Nuclide
 {
@@ -103,14 +107,75 @@ public:
   double getReactionCrossSection( const double energy,
 				  const NuclearReactionType reaction ) const;
 
+  //! Return the total cross section seen by a neutron
+  double getTotalCrossSection( const NeutronState& neutron ) const;
+
+  //! Return the total absorption cross section seen by a neutron
+  double getAbsorptionCrossSection( const NeutronState& neutron ) const;
+
+  //! Return the cross section for a specific reaction seen by a neutron
+  double getReactionCrossSection( const NeutronState& neutron,
+				  const NuclearReactionType reaction ) const;
+
   //! Collide with a neutron
   void collideAnalogue( NeutronState& neutron, ParticleBank& bank ) const;
 
   //! Collide with a neutron and survival bias
   void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const;
 
+  //! Set the S(alpha,beta) data of the bound nuclide
+  void setSAlphaBeta( const Teuchos::RCP<const SAlphaBeta>& s_alpha_beta );
+
+  //! Check if the nuclide has S(alpha,beta) data
+  bool hasSAlphaBeta() const;
+
+  //! Set the unresolved resonance probability table
+  void setUnresolvedResonanceProbabilityTable(
+	       const Teuchos::RCP<const UnresolvedResonanceProbabilityTable>&
+	       unresolved_resonance_table );
+
+  //! Check if the nuclide has unresolved resonance data
+  bool hasUnresolvedResonanceData() const;
+
 private:
 
+  // The unresolved resonance factors (band cross section/smooth cross section)
+  struct UnresolvedResonanceFactors
+  {
+    double elastic;
+    double fission;
+    double capture;
+    double smooth_elastic;
+    double smooth_fission;
+    double smooth_capture;
+  };
+
+  // Check if the unresolved resonance data should be used at the energy
+  bool useUnresolvedResonanceData( const double energy ) const;
+
+  // Calculate the unresolved resonance factors seen by a neutron
+  void calculateUnresolvedResonanceFactors(
+				   const NeutronState& neutron,
+				   UnresolvedResonanceFactors& factors ) const;
+
+  // Return the total cross section with the unresolved resonance factors
+  double getTotalCrossSection( 
+			   const double energy,
+			   const UnresolvedResonanceFactors& factors ) const;
+
+  // Return the absorption cross section with the unresolved resonance factors
+  double getAbsorptionCrossSection( 
+			   const double energy,
+			   const UnresolvedResonanceFactors& factors ) const;
+
+  // Return the unresolved resonance factor of a reaction
+  static double getUnresolvedResonanceFactor(
+				  const NuclearReactionType reaction,
+				  const UnresolvedResonanceFactors& factors );
+
+  // Check if the S(alpha,beta) data should be used at the energy
+  bool useSAlphaBeta( const double energy ) const;
+
   // Set the default absorption reaction types
   static boost::unordered_set<NuclearReactionType> 
   setDefaultAbsorptionReactionTypes();
@@ -123,14 +188,18 @@ private:
   void calculateTotalReaction( const Teuchos::ArrayRCP<double>& energy_grid );
 
   // Sample an absorption reaction
-  void sampleAbsorptionReaction( const double scaled_random_number,
-				 NeutronState& neutron, 
-				 ParticleBank& bank ) const;
+  void sampleAbsorptionReaction( 
+		       const double scaled_random_number,
+		       NeutronState& neutron, 
+		       ParticleBank& bank,
+		       const UnresolvedResonanceFactors* factors = NULL ) const;
 
   // Sample a scattering reaction
-  void sampleScatteringReaction( const double scaled_random_number,
-				 NeutronState& neutron,
-				 ParticleBank& bank ) const;
+  void sampleScatteringReaction(
+		       const double scaled_random_number,
+		       NeutronState& neutron,
+		       ParticleBank& bank,
+		       const UnresolvedResonanceFactors* factors = NULL ) const;
 
   // Reactions that should be treated as absorption
   static boost::unordered_set<NuclearReactionType> absorption_reaction_types;
@@ -170,8 +239,34 @@ private:
 
   // Miscellaneous reactions
   ConstReactionMap d_miscellaneous_reactions;
+
+  // The fission reactions (used by the unresolved resonance data)
+  Teuchos::Array<Teuchos::RCP<const NuclearReaction> > d_fission_reactions;
+
+  // The S(alpha,beta) data (null if the nuclide is not bound)
+  Teuchos::RCP<const SAlphaBeta> d_s_alpha_beta;
+
+  // The free gas elastic reaction (replaced by the S(alpha,beta) data)
+  Teuchos::RCP<const NuclearReaction> d_free_gas_elastic_reaction;
+
+  // The unresolved resonance probability table (null if not used)
+  Teuchos::RCP<const UnresolvedResonanceProbabilityTable>
+  d_unresolved_resonance_table;
 };
 
+// Check if the S(alpha,beta) data should be used at the energy
+inline bool Nuclide::useSAlphaBeta( const double energy ) const
+{
+  return !d_s_alpha_beta.is_null() && d_s_alpha_beta->isEnergyInRange( energy );
+}
+
+// Check if the unresolved resonance data should be used at the energy
+inline bool Nuclide::useUnresolvedResonanceData( const double energy ) const
+{
+  return !d_unresolved_resonance_table.is_null() && 
+    d_unresolved_resonance_table->isEnergyInRange( energy );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_NUCLIDE_HPP
@@ -6,9 +6,14 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <stdexcept>
+
 // FRENSIE Includes
 #include "MonteCarlo_NuclideACEFactory.hpp"
 #include "MonteCarlo_NuclearReactionACEFactory.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
 
@@ -28,6 +33,41 @@ void NuclideACEFactory::createNuclide(
   Teuchos::ArrayRCP<double> energy_grid;
   energy_grid.deepCopy( raw_nuclide_data.extractEnergyGrid() );
 
+  NuclideACEFactory::createNuclide( raw_nuclide_data,
+				    nuclide_alias,
+				    atomic_number,
+				    atomic_mass_number,
+				    isomer_number,
+				    atomic_weight_ratio,
+				    temperature,
+				    energy_grid,
+				    nuclide,
+				    use_unresolved_resonance_data,
+				    use_photon_production_data );
+}
+
+// Create a nuclide that uses an existing (shared) energy grid
+/*! \details The energy grid must have the same values as the energy grid
+ * in the raw nuclide data. Nuclides with identical energy grids (e.g. the 
+ * same table loaded with different aliases) can share the grid storage.
+ */
+void NuclideACEFactory::createNuclide( 
+			 const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+			 const std::string& nuclide_alias,
+			 const unsigned atomic_number,
+			 const unsigned atomic_mass_number,
+			 const unsigned isomer_number,
+			 const double atomic_weight_ratio,
+			 const double temperature,
+			 const Teuchos::ArrayRCP<double>& energy_grid,
+			 Teuchos::RCP<Nuclide>& nuclide,
+			 const bool use_unresolved_resonance_data,
+			 const bool use_photon_production_data )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() == 
+		    raw_nuclide_data.extractEnergyGrid().size() );
+  
   // Create the nuclear reaction factory
   NuclearReactionACEFactory reaction_factory( nuclide_alias,
 					      atomic_weight_ratio,
@@ -46,14 +86,6 @@ void NuclideACEFactory::createNuclide(
   
   reaction_factory.createAbsorptionReactions( standard_absorption_reactions );
 
-  if( use_unresolved_resonance_data )
-  {
-    std::cerr << std::endl
-	      << "Warning: Unresolved resonance data has been requested. "
-	      << "This feature is not currently supported!"
-	      << std::endl;
-  }
-
   if( use_photon_production_data )
   {
     std::cerr << std::endl
@@ -71,6 +103,98 @@ void NuclideACEFactory::createNuclide(
 			      energy_grid,
 			      standard_scattering_reactions,
 			      standard_absorption_reactions ) );
+
+  if( use_unresolved_resonance_data && 
+      raw_nuclide_data.hasUnresolvedResonanceData() )
+  {
+    Teuchos::RCP<const UnresolvedResonanceProbabilityTable> 
+      unresolved_resonance_table;
+
+    NuclideACEFactory::createUnresolvedResonanceProbabilityTable(
+						  raw_nuclide_data,
+						  unresolved_resonance_table );
+
+    nuclide->setUnresolvedResonanceProbabilityTable( 
+						  unresolved_resonance_table );
+  }
+}
+
+// Create the unresolved resonance probability table
+/*! \details The UNR block contains the number of incoming energies (N), the
+ * number of bands (M), the interpolation parameter (2 = lin-lin, 
+ * 5 = log-log), the inelastic competition flag, the other absorption flag,
+ * the factors flag, the N incoming energies and then for every incoming
+ * energy the band cdf, total, elastic, fission, capture and heating
+ * values (M values each). The inelastic competition and other absorption 
+ * flags are not needed - the cross sections of all reactions other than 
+ * elastic, fission and capture are always taken from the smooth data.
+ */
+void NuclideACEFactory::createUnresolvedResonanceProbabilityTable(
+	  const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+	  Teuchos::RCP<const UnresolvedResonanceProbabilityTable>& 
+	  unresolved_resonance_table )
+{
+  // Make sure the nuclide has unresolved resonance data
+  testPrecondition( raw_nuclide_data.hasUnresolvedResonanceData() );
+  
+  Teuchos::ArrayView<const double> unr_block = 
+    raw_nuclide_data.extractUNRBlock();
+
+  const unsigned number_of_energies = (unsigned)unr_block[0];
+  const unsigned number_of_bands = (unsigned)unr_block[1];
+  const int interpolation = (int)unr_block[2];
+  const bool bands_are_factors = (unr_block[5] > 0.0);
+
+  TEST_FOR_EXCEPTION( interpolation != 2 && interpolation != 5,
+		      std::runtime_error,
+		      "Error: the unresolved resonance interpolation parameter "
+		      << interpolation << " is not supported!" );
+
+  TEST_FOR_EXCEPTION( unr_block.size() != 
+		      6 + number_of_energies*(1 + 6*number_of_bands),
+		      std::runtime_error,
+		      "Error: the UNR block has an unexpected size!" );
+
+  Teuchos::ArrayView<const double> energy_grid = 
+    unr_block( 6, number_of_energies );
+
+  Teuchos::Array<double> band_cdfs, elastic_bands, fission_bands, 
+    capture_bands;
+
+  for( unsigned i = 0; i < number_of_energies; ++i )
+  {
+    const unsigned table_start = 
+      6 + number_of_energies + i*6*number_of_bands;
+
+    Teuchos::ArrayView<const double> table = 
+      unr_block( table_start, 6*number_of_bands );
+
+    band_cdfs.insert( band_cdfs.end(), 
+		      table.begin(),
+		      table.begin() + number_of_bands );
+
+    elastic_bands.insert( elastic_bands.end(),
+			  table.begin() + 2*number_of_bands,
+			  table.begin() + 3*number_of_bands );
+
+    fission_bands.insert( fission_bands.end(),
+			  table.begin() + 3*number_of_bands,
+			  table.begin() + 4*number_of_bands );
+
+    capture_bands.insert( capture_bands.end(),
+			  table.begin() + 4*number_of_bands,
+			  table.begin() + 5*number_of_bands );
+  }
+
+  unresolved_resonance_table.reset( new UnresolvedResonanceProbabilityTable(
+						       energy_grid,
+						       band_cdfs(),
+						       elastic_bands(),
+						       fission_bands(),
+						       capture_bands(),
+						       number_of_bands,
+						       interpolation == 5,
+						       bands_are_factors ) );
 }
 
 } // end MonteCarlo namespace
@@ -37,6 +37,26 @@ public:
 			 const bool use_unresolved_resonance_data,
 			 const bool use_photon_production_data );
 
+  //! Create a nuclide that uses an existing (shared) energy grid
+  static void createNuclide(
+			 const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+			 const std::string& nuclide_alias,
+			 const unsigned atomic_number,
+			 const unsigned atomic_mass_number,
+			 const unsigned isomer_number,
+			 const double atomic_weight_ratio,
+			 const double temperature,
+			 const Teuchos::ArrayRCP<double>& energy_grid,
+			 Teuchos::RCP<Nuclide>& nuclide,
+			 const bool use_unresolved_resonance_data,
+			 const bool use_photon_production_data );
+
+  //! Create the unresolved resonance probability table
+  static void createUnresolvedResonanceProbabilityTable(
+	  const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+	  Teuchos::RCP<const UnresolvedResonanceProbabilityTable>& 
+	  unresolved_resonance_table );
+
 private:
 
   // Constructor
@@ -6,6 +6,13 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <utility>
+
+// Boost Includes
+#include <boost/functional/hash.hpp>
+
 // Trilinos Includes
 #include <Teuchos_ParameterList.hpp>
 
@@ -13,9 +20,11 @@
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_NuclideACEFactory.hpp"
 #include "MonteCarlo_NuclearReactionACEFactory.hpp"
+#include "MonteCarlo_SAlphaBetaACEFactory.hpp"
 #include "MonteCarlo_CrossSectionsXMLProperties.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
+#include "Data_XSSSabDataExtractor.hpp"
 #include "Utility_ContractException.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
@@ -40,6 +49,9 @@ NuclideFactory::NuclideFactory(
   
   std::string nuclide_file_path, nuclide_file_type, nuclide_table_name;
   int nuclide_file_start_line;
+  std::string s_alpha_beta_file_path, s_alpha_beta_file_type;
+  std::string s_alpha_beta_table_name;
+  int s_alpha_beta_file_start_line;
   int atomic_number, atomic_mass_number, isomer_number;
   double atomic_weight_ratio, temperature;
 
@@ -81,6 +93,33 @@ NuclideFactory::NuclideFactory(
 		       " is not supported!" );
     }
 
+    // Attach the S(alpha,beta) data of a bound nuclide
+    if( CrossSectionsXMLProperties::extractSAlphaBetaInfoFromNuclideTableInfoParameterList(
+						  cross_sections_xml_directory,
+						  *nuclide_name,
+						  cross_section_table_info,
+						  s_alpha_beta_file_path,
+						  s_alpha_beta_file_type,
+						  s_alpha_beta_table_name,
+						  s_alpha_beta_file_start_line ) )
+    {
+      if( s_alpha_beta_file_type == CrossSectionsXMLProperties::ace_file )
+      {
+	addSAlphaBetaFromACETable( *nuclide_name,
+				   s_alpha_beta_file_path,
+				   s_alpha_beta_table_name,
+				   s_alpha_beta_file_start_line,
+				   atomic_weight_ratio );
+      }
+      else
+      {
+	THROW_EXCEPTION( std::logic_error,
+			 "Error: S(alpha,beta) table type " 
+			 << s_alpha_beta_file_type <<
+			 " is not supported!" );
+      }
+    }
+
     ++nuclide_name;
   }
 
@@ -138,20 +177,132 @@ void NuclideFactory::createNuclideFromACETable(
   Teuchos::RCP<Nuclide>& nuclide = d_nuclide_name_map[nuclide_alias];
   
   // Create the new nuclide
-  NuclideACEFactory::createNuclide( xss_data_extractor,
-				    nuclear_table_name,
-				    atomic_number,
-				    atomic_mass_number,
-				    isomer_number,
-				    atomic_weight_ratio,
-				    temperature,
-				    nuclide,
-				    use_unresolved_resonance_data,
-				    use_photon_production_data );
+  NuclideACEFactory::createNuclide( 
+		   xss_data_extractor,
+		   nuclear_table_name,
+		   atomic_number,
+		   atomic_mass_number,
+		   isomer_number,
+		   atomic_weight_ratio,
+		   temperature,
+		   this->getSharedEnergyGrid( 
+				      xss_data_extractor.extractEnergyGrid() ),
+		   nuclide,
+		   use_unresolved_resonance_data,
+		   use_photon_production_data );
   
   *d_os_message << "done." << std::endl;
 }
 
+// Attach the S(alpha,beta) data in an ACE table to a nuclide
+/*! \details Nuclides that use the same S(alpha,beta) table (e.g. the same 
+ * bound nuclide loaded with different aliases) will share the data.
+ */
+void NuclideFactory::addSAlphaBetaFromACETable( 
+				   const std::string& nuclide_alias,
+				   const std::string& ace_file_path,
+				   const std::string& s_alpha_beta_table_name,
+				   const int s_alpha_beta_file_start_line,
+				   const double atomic_weight_ratio )
+{
+  // Make sure the nuclide has been created
+  testPrecondition( d_nuclide_name_map.count( nuclide_alias ) );
+  
+  Teuchos::RCP<const SAlphaBeta>& s_alpha_beta = 
+    d_s_alpha_beta_map[s_alpha_beta_table_name];
+
+  if( s_alpha_beta.is_null() )
+  {
+    *d_os_message << "Loading ACE S(alpha,beta) table " 
+		  << s_alpha_beta_table_name << " (" << nuclide_alias 
+		  << ") ... ";
+
+    // The ACE table reader
+    Data::ACEFileHandler ace_file_handler( ace_file_path,
+					   s_alpha_beta_table_name,
+					   s_alpha_beta_file_start_line,
+					   true );
+
+    // The XSS S(alpha,beta) data extractor
+    Data::XSSSabDataExtractor xss_data_extractor( 
+					 ace_file_handler.getTableNXSArray(),
+					 ace_file_handler.getTableJXSArray(),
+				         ace_file_handler.getTableXSSArray() );
+
+    Teuchos::RCP<SAlphaBeta> new_s_alpha_beta;
+
+    SAlphaBetaACEFactory::createSAlphaBeta( xss_data_extractor,
+					    s_alpha_beta_table_name,
+					    atomic_weight_ratio,
+					    new_s_alpha_beta );
+
+    s_alpha_beta = new_s_alpha_beta;
+
+    *d_os_message << "done." << std::endl;
+  }
+  
+  d_nuclide_name_map[nuclide_alias]->setSAlphaBeta( s_alpha_beta );
+}
+
+// Return a shared energy grid with the requested values
+/*! \details All reactions of a nuclide already share the nuclide energy
+ * grid. Nuclides with identical energy grids (e.g. the same table loaded 
+ * with different aliases or tables processed on a common grid) will also 
+ * share the grid storage. The cached grids are keyed on their size, end
+ * points and values so that a full comparison is only done with the
+ * grids that are likely to be identical.
+ */
+Teuchos::ArrayRCP<double> NuclideFactory::getSharedEnergyGrid( 
+			  const Teuchos::ArrayView<const double>& energy_grid )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 0 );
+  
+  const std::size_t grid_key = 
+    NuclideFactory::calculateEnergyGridKey( energy_grid );
+
+  typedef boost::unordered_multimap<std::size_t,Teuchos::ArrayRCP<double> >
+    EnergyGridMap;
+  
+  std::pair<EnergyGridMap::const_iterator,EnergyGridMap::const_iterator>
+    candidates = d_energy_grids.equal_range( grid_key );
+
+  while( candidates.first != candidates.second )
+  {
+    const Teuchos::ArrayRCP<double>& cached_grid = candidates.first->second;
+    
+    if( cached_grid.size() == energy_grid.size() &&
+	std::equal( energy_grid.begin(), 
+		    energy_grid.end(), 
+		    cached_grid.begin() ) )
+      return cached_grid;
+
+    ++candidates.first;
+  }
+
+  // Create a new grid
+  Teuchos::ArrayRCP<double> new_grid;
+  new_grid.deepCopy( energy_grid );
+
+  d_energy_grids.insert( std::make_pair( grid_key, new_grid ) );
+
+  return new_grid;
+}
+
+// Calculate the energy grid cache key
+std::size_t NuclideFactory::calculateEnergyGridKey(
+			  const Teuchos::ArrayView<const double>& energy_grid )
+{
+  std::size_t grid_key = 0;
+
+  boost::hash_combine( grid_key, energy_grid.size() );
+  boost::hash_combine( grid_key, energy_grid[0] );
+  boost::hash_combine( grid_key, energy_grid[energy_grid.size()-1] );
+  boost::hash_range( grid_key, energy_grid.begin(), energy_grid.end() );
+
+  return grid_key;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
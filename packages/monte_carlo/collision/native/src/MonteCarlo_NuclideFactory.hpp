@@ -65,9 +65,32 @@ private:
 			      const bool use_unresolved_resonance_data,
 			      const bool use_photon_production_data );
 
+  // Attach the S(alpha,beta) data in an ACE table to a nuclide
+  void addSAlphaBetaFromACETable( const std::string& nuclide_alias,
+				  const std::string& ace_file_path,
+				  const std::string& s_alpha_beta_table_name,
+				  const int s_alpha_beta_file_start_line,
+				  const double atomic_weight_ratio );
+
+  // Return a shared energy grid with the requested values
+  Teuchos::ArrayRCP<double> getSharedEnergyGrid( 
+			 const Teuchos::ArrayView<const double>& energy_grid );
+
+  // Calculate the energy grid cache key
+  static std::size_t calculateEnergyGridKey(
+			 const Teuchos::ArrayView<const double>& energy_grid );
+
   // The nuclide id map
   boost::unordered_map<std::string,Teuchos::RCP<Nuclide> > d_nuclide_name_map;
 
+  // The S(alpha,beta) data that has been loaded
+  boost::unordered_map<std::string,Teuchos::RCP<const SAlphaBeta> > 
+  d_s_alpha_beta_map;
+
+  // The energy grids used by the nuclides that have been created
+  boost::unordered_multimap<std::size_t,Teuchos::ArrayRCP<double> > 
+  d_energy_grids;
+
   // The message output stream
   std::ostream* d_os_message;
 };
@@ -58,6 +58,52 @@ double Photoatom::getAtomicWeight() const
   return d_atomic_weight;
 }
 
+// Return the total cross section at the desired energies
+/*! \details The energy grid bins of all energies are found together and 
+ * every reaction is then evaluated at all energies before moving on to the
+ * next reaction. This is more efficient than evaluating the total cross
+ * section at one energy at a time when many particles must be processed.
+ */
+void Photoatom::getTotalCrossSections( 
+		     const Teuchos::ArrayView<const double>& energies,
+		     const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == cross_sections.size() );
+
+  Teuchos::Array<unsigned> energy_grid_bins( energies.size() );
+
+  d_core.getGridSearcher().findLowerBinIndices( energies, 
+						energy_grid_bins() );
+
+  Teuchos::Array<double> reaction_cross_sections( energies.size() );
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+    cross_sections[i] = this->getNuclearTotalCrossSection( energies[i] );
+
+  const ConstReactionMap* reaction_maps[2] = 
+    {&d_core.getScatteringReactions(), &d_core.getAbsorptionReactions()};
+
+  for( unsigned m = 0; m < 2; ++m )
+  {
+    ConstReactionMap::const_iterator photoatomic_reaction = 
+      reaction_maps[m]->begin();
+
+    while( photoatomic_reaction != reaction_maps[m]->end() )
+    {
+      photoatomic_reaction->second->getCrossSections( 
+						  energies,
+						  energy_grid_bins(),
+						  reaction_cross_sections() );
+      
+      for( unsigned i = 0; i < energies.size(); ++i )
+	cross_sections[i] += reaction_cross_sections[i];
+      
+      ++photoatomic_reaction;
+    }
+  }
+}
+
 // Return the total cross section from atomic interactions 
 double Photoatom::getAtomicTotalCrossSection( const double energy ) const
 {
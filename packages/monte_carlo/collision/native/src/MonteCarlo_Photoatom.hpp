@@ -18,6 +18,7 @@
 
 // Trilinos Includes
 #include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
 #include <Teuchos_ScalarTraits.hpp>
 
 // FRENSIE Includes
@@ -99,6 +100,11 @@ public:
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
+  //! Return the total cross section at the desired energies
+  void getTotalCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<double>& cross_sections ) const;
+
   //! Return the total cross section from atomic interactions 
   double getAtomicTotalCrossSection( const double energy ) const;
 
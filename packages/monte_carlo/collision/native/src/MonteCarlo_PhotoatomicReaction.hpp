@@ -9,11 +9,15 @@
 #ifndef MONTE_CARLO_PHOTOATOMIC_REACTION_HPP
 #define MONTE_CARLO_PHOTOATOMIC_REACTION_HPP
 
+// Trilinos Includes
+#include <Teuchos_ArrayView.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ParticleBank.hpp"
 #include "MonteCarlo_SubshellType.hpp"
 #include "MonteCarlo_PhotoatomicReactionType.hpp"
+#include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
 
@@ -44,6 +48,17 @@ public:
   virtual double getCrossSection( const double energy,
 				  const unsigned bin_index ) const = 0;
 
+  //! Return the cross sections at the given energies
+  virtual void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
+  //! Return the cross sections at the given energies (efficient)
+  virtual void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<const unsigned>& bin_indices,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
   //! Return the threshold energy
   virtual double getThresholdEnergy() const = 0;
 
@@ -77,6 +92,36 @@ inline bool PhotoatomicReaction::isEnergyGridShared(
   return this->getEnergyGridHead() == other_reaction.getEnergyGridHead();
 }
 
+// Return the cross sections at the given energies
+/*! \details By default the cross sections will be evaluated one at a time.
+ */
+inline void PhotoatomicReaction::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == cross_sections.size() );
+  
+  for( unsigned i = 0; i < energies.size(); ++i )
+    cross_sections[i] = this->getCrossSection( energies[i] );
+}
+
+// Return the cross sections at the given energies (efficient)
+/*! \details By default the cross sections will be evaluated one at a time.
+ */
+inline void PhotoatomicReaction::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<const unsigned>& bin_indices,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == bin_indices.size() );
+  testPrecondition( energies.size() == cross_sections.size() );
+  
+  for( unsigned i = 0; i < energies.size(); ++i )
+    cross_sections[i] = this->getCrossSection( energies[i], bin_indices[i] );
+}
+
 // Simulate the reaction and track the number of sampling trials
 inline void PhotoatomicReaction::react( PhotonState& photon, 
 					ParticleBank& bank,
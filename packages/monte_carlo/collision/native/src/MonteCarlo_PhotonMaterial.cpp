@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotonMaterial.hpp"
@@ -120,6 +121,28 @@ double PhotonMaterial::getMacroscopicTotalCrossSection(
   return cross_section;
 }
 
+// Return the macroscopic total cross sections (1/cm)
+void PhotonMaterial::getMacroscopicTotalCrossSections( 
+		     const Teuchos::ArrayView<const double>& energies,
+		     const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == cross_sections.size() );
+
+  std::fill( cross_sections.begin(), cross_sections.end(), 0.0 );
+
+  Teuchos::Array<double> atom_cross_sections( energies.size() );
+
+  for( unsigned i = 0u; i < d_atoms.size(); ++i )
+  {
+    d_atoms[i].second->getTotalCrossSections( energies, 
+					      atom_cross_sections() );
+
+    for( unsigned j = 0u; j < energies.size(); ++j )
+      cross_sections[j] += d_atoms[i].first*atom_cross_sections[j];
+  }
+}
+
 // Return the macroscopic absorption cross section (1/cm)
 double PhotonMaterial::getMacroscopicAbsorptionCrossSection( 
 						    const double energy ) const
@@ -15,6 +15,7 @@
 // Trilinos Includes
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_Array.hpp"
+#include "Teuchos_ArrayView.hpp"
 
 // FRENSIE Includes
 #include "MonteCarlo_ModuleTraits.hpp"
@@ -58,6 +59,11 @@ public:
   //! Return the macroscopic total cross section (1/cm)
   double getMacroscopicTotalCrossSection( const double energy ) const;
 
+  //! Return the macroscopic total cross sections (1/cm)
+  void getMacroscopicTotalCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<double>& cross_sections ) const;
+
   //! Return the macroscopic absorption cross section (1/cm)
   double getMacroscopicAbsorptionCrossSection( const double energy ) const;
 
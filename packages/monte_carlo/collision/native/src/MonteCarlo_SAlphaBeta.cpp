@@ -0,0 +1,209 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBeta.cpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor (inelastic only)
+SAlphaBeta::SAlphaBeta( 
+	      const std::string& table_name,
+	      const Teuchos::ArrayView<const double>& inelastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& inelastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	      inelastic_distribution )
+  : d_table_name( table_name ),
+    d_inelastic_energy_grid( inelastic_energy_grid ),
+    d_inelastic_cross_section( inelastic_cross_section ),
+    d_inelastic_distribution( inelastic_distribution )
+{
+  // Make sure the inelastic data is valid
+  testPrecondition( inelastic_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( 
+					       inelastic_energy_grid.begin(),
+					       inelastic_energy_grid.end() ) );
+  testPrecondition( inelastic_cross_section.size() == 
+		    inelastic_energy_grid.size() );
+  testPrecondition( !inelastic_distribution.is_null() );
+}
+
+// Constructor (inelastic and incoherent elastic)
+SAlphaBeta::SAlphaBeta( 
+	      const std::string& table_name,
+	      const Teuchos::ArrayView<const double>& inelastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& inelastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	      inelastic_distribution,
+	      const Teuchos::ArrayView<const double>& elastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& elastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaIncoherentElasticScatteringDistribution>&
+	      incoherent_elastic_distribution )
+  : d_table_name( table_name ),
+    d_inelastic_energy_grid( inelastic_energy_grid ),
+    d_inelastic_cross_section( inelastic_cross_section ),
+    d_inelastic_distribution( inelastic_distribution ),
+    d_elastic_energy_grid( elastic_energy_grid ),
+    d_elastic_cross_section( elastic_cross_section ),
+    d_incoherent_elastic_distribution( incoherent_elastic_distribution )
+{
+  // Make sure the inelastic data is valid
+  testPrecondition( inelastic_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( 
+					       inelastic_energy_grid.begin(),
+					       inelastic_energy_grid.end() ) );
+  testPrecondition( inelastic_cross_section.size() == 
+		    inelastic_energy_grid.size() );
+  testPrecondition( !inelastic_distribution.is_null() );
+  // Make sure the elastic data is valid
+  testPrecondition( elastic_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( 
+					       elastic_energy_grid.begin(),
+					       elastic_energy_grid.end() ) );
+  testPrecondition( elastic_cross_section.size() == 
+		    elastic_energy_grid.size() );
+  testPrecondition( !incoherent_elastic_distribution.is_null() );
+}
+
+// Constructor (inelastic and coherent elastic)
+SAlphaBeta::SAlphaBeta( 
+	      const std::string& table_name,
+	      const Teuchos::ArrayView<const double>& inelastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& inelastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	      inelastic_distribution,
+	      const Teuchos::RCP<const SAlphaBetaCoherentElasticScatteringDistribution>&
+	      coherent_elastic_distribution )
+  : d_table_name( table_name ),
+    d_inelastic_energy_grid( inelastic_energy_grid ),
+    d_inelastic_cross_section( inelastic_cross_section ),
+    d_inelastic_distribution( inelastic_distribution ),
+    d_coherent_elastic_distribution( coherent_elastic_distribution )
+{
+  // Make sure the inelastic data is valid
+  testPrecondition( inelastic_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( 
+					       inelastic_energy_grid.begin(),
+					       inelastic_energy_grid.end() ) );
+  testPrecondition( inelastic_cross_section.size() == 
+		    inelastic_energy_grid.size() );
+  testPrecondition( !inelastic_distribution.is_null() );
+  // Make sure the elastic data is valid
+  testPrecondition( !coherent_elastic_distribution.is_null() );
+}
+
+// Return the table name
+const std::string& SAlphaBeta::getTableName() const
+{
+  return d_table_name;
+}
+
+// Return the maximum energy where S(alpha,beta) data is used
+double SAlphaBeta::getMaxEnergy() const
+{
+  return d_inelastic_energy_grid.back();
+}
+
+// Return the inelastic cross section at the desired energy
+double SAlphaBeta::getInelasticCrossSection( const double energy ) const
+{
+  return SAlphaBeta::evaluateTabulatedCrossSection( d_inelastic_energy_grid,
+						    d_inelastic_cross_section,
+						    energy );
+}
+
+// Return the elastic cross section at the desired energy
+double SAlphaBeta::getElasticCrossSection( const double energy ) const
+{
+  if( !d_incoherent_elastic_distribution.is_null() )
+  {
+    return SAlphaBeta::evaluateTabulatedCrossSection( d_elastic_energy_grid,
+						      d_elastic_cross_section,
+						      energy );
+  }
+  else if( !d_coherent_elastic_distribution.is_null() )
+    return d_coherent_elastic_distribution->evaluateCrossSection( energy );
+  else
+    return 0.0;
+}
+
+// Return the total cross section at the desired energy
+double SAlphaBeta::getTotalCrossSection( const double energy ) const
+{
+  return this->getInelasticCrossSection( energy ) +
+    this->getElasticCrossSection( energy );
+}
+
+// Scatter the neutron
+void SAlphaBeta::scatterNeutron( NeutronState& neutron ) const
+{
+  // Make sure the neutron energy is in the S(alpha,beta) range
+  testPrecondition( this->isEnergyInRange( neutron.getEnergy() ) );
+
+  neutron.incrementCollisionNumber();
+  
+  const double inelastic_cross_section = 
+    this->getInelasticCrossSection( neutron.getEnergy() );
+
+  const double elastic_cross_section = 
+    this->getElasticCrossSection( neutron.getEnergy() );
+
+  const double scaled_random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    (inelastic_cross_section + elastic_cross_section);
+
+  if( scaled_random_number < elastic_cross_section )
+  {
+    if( !d_incoherent_elastic_distribution.is_null() )
+      d_incoherent_elastic_distribution->scatterParticle( neutron, neutron, 0.0 );
+    else
+      d_coherent_elastic_distribution->scatterParticle( neutron, neutron, 0.0 );
+  }
+  else
+    d_inelastic_distribution->scatterParticle( neutron, neutron, 0.0 );
+}
+
+// Evaluate a tabulated cross section
+/*! \details Lin-lin interpolation is used. The cross section below the
+ * first energy grid point is treated as constant and the cross section above
+ * the last energy grid point is zero.
+ */
+double SAlphaBeta::evaluateTabulatedCrossSection( 
+				 const Teuchos::Array<double>& energy_grid,
+				 const Teuchos::Array<double>& cross_section,
+				 const double energy )
+{
+  if( energy <= energy_grid.front() )
+    return cross_section.front();
+  else if( energy < energy_grid.back() )
+  {
+    const unsigned lower_bin_index = Utility::Search::binaryLowerBoundIndex(
+							   energy_grid.begin(),
+							   energy_grid.end(),
+							   energy );
+    
+    return cross_section[lower_bin_index] + 
+      (cross_section[lower_bin_index+1] - cross_section[lower_bin_index])*
+      (energy - energy_grid[lower_bin_index])/
+      (energy_grid[lower_bin_index+1] - energy_grid[lower_bin_index]);
+  }
+  else if( energy == energy_grid.back() )
+    return cross_section.back();
+  else
+    return 0.0;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBeta.cpp
+//---------------------------------------------------------------------------//
@@ -2,26 +2,140 @@
 //!
 //! \file   MonteCarlo_SAlphaBeta.hpp
 //! \author Alex Robinson
-//! \brief  The S(alpha,beta) class
+//! \brief  The S(alpha,beta) class declaration
 //!
 //---------------------------------------------------------------------------//
 
-#ifndef MONTE_CARLO_S_ALHPA_BETA_HPP
+#ifndef MONTE_CARLO_S_ALPHA_BETA_HPP
 #define MONTE_CARLO_S_ALPHA_BETA_HPP
 
+// Std Lib Includes
+#include <string>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaInelasticScatteringDistribution.hpp"
+#include "MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.hpp"
+#include "MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+
 namespace MonteCarlo{
 
-//! The S(alpha,beta) class
+/*! The S(alpha,beta) class
+ * \details This class stores the thermal scattering cross sections and
+ * distributions of a bound scatterer (e.g. H in H2O). Below the maximum 
+ * S(alpha,beta) energy these cross sections and distributions replace the
+ * free gas elastic scattering cross section and distribution of the 
+ * nuclide that the bound scatterer is associated with. Elastic scattering
+ * can be absent, incoherent (e.g. H in polyethylene) or coherent (e.g. 
+ * graphite).
+ */
 class SAlphaBeta
 {
 
+public:
+
+  //! Constructor (inelastic only)
+  SAlphaBeta( const std::string& table_name,
+	      const Teuchos::ArrayView<const double>& inelastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& inelastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	      inelastic_distribution );
+
+  //! Constructor (inelastic and incoherent elastic)
+  SAlphaBeta( const std::string& table_name,
+	      const Teuchos::ArrayView<const double>& inelastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& inelastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	      inelastic_distribution,
+	      const Teuchos::ArrayView<const double>& elastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& elastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaIncoherentElasticScatteringDistribution>&
+	      incoherent_elastic_distribution );
+
+  //! Constructor (inelastic and coherent elastic)
+  SAlphaBeta( const std::string& table_name,
+	      const Teuchos::ArrayView<const double>& inelastic_energy_grid,
+	      const Teuchos::ArrayView<const double>& inelastic_cross_section,
+	      const Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	      inelastic_distribution,
+	      const Teuchos::RCP<const SAlphaBetaCoherentElasticScatteringDistribution>&
+	      coherent_elastic_distribution );
+
+  //! Destructor
+  ~SAlphaBeta()
+  { /* ... */ }
+
+  //! Return the table name
+  const std::string& getTableName() const;
+
+  //! Return the maximum energy where S(alpha,beta) data is used
+  double getMaxEnergy() const;
+
+  //! Check if the energy is in the S(alpha,beta) energy range
+  bool isEnergyInRange( const double energy ) const;
+
+  //! Return the inelastic cross section at the desired energy
+  double getInelasticCrossSection( const double energy ) const;
+
+  //! Return the elastic cross section at the desired energy
+  double getElasticCrossSection( const double energy ) const;
 
+  //! Return the total cross section at the desired energy
+  double getTotalCrossSection( const double energy ) const;
 
+  //! Scatter the neutron
+  void scatterNeutron( NeutronState& neutron ) const;
+
+private:
+
+  // Evaluate a tabulated cross section
+  static double evaluateTabulatedCrossSection( 
+				const Teuchos::Array<double>& energy_grid,
+				const Teuchos::Array<double>& cross_section,
+				const double energy );
+
+  // The table name
+  std::string d_table_name;
+
+  // The inelastic energy grid
+  Teuchos::Array<double> d_inelastic_energy_grid;
+
+  // The inelastic cross section
+  Teuchos::Array<double> d_inelastic_cross_section;
+
+  // The inelastic scattering distribution
+  Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>
+  d_inelastic_distribution;
+
+  // The incoherent elastic energy grid
+  Teuchos::Array<double> d_elastic_energy_grid;
+
+  // The incoherent elastic cross section
+  Teuchos::Array<double> d_elastic_cross_section;
+
+  // The incoherent elastic scattering distribution
+  Teuchos::RCP<const SAlphaBetaIncoherentElasticScatteringDistribution>
+  d_incoherent_elastic_distribution;
+
+  // The coherent elastic scattering distribution
+  Teuchos::RCP<const SAlphaBetaCoherentElasticScatteringDistribution>
+  d_coherent_elastic_distribution;
 };
 
+// Check if the energy is in the S(alpha,beta) energy range
+inline bool SAlphaBeta::isEnergyInRange( const double energy ) const
+{
+  return energy < d_inelastic_energy_grid.back();
+}
+
 } // end MonteCarlo namespace
 
-#endif // end MONTE_CARLO_S_ALHPA_BETA_HPP
+#endif // end MONTE_CARLO_S_ALPHA_BETA_HPP
 
 //---------------------------------------------------------------------------//
 // end MonteCarlo_SAlphaBeta.hpp
@@ -0,0 +1,217 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaACEFactory.cpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) ace factory class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaACEFactory.hpp"
+#include "Utility_ContractException.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+// Create a S(alpha,beta) object
+void SAlphaBetaACEFactory::createSAlphaBeta( 
+			 const Data::XSSSabDataExtractor& raw_sab_data,
+			 const std::string& table_name,
+			 const double atomic_weight_ratio,
+			 Teuchos::RCP<SAlphaBeta>& s_alpha_beta )
+{
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+
+  Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution> 
+    inelastic_distribution;
+
+  SAlphaBetaACEFactory::createInelasticScatteringDistribution( 
+						      raw_sab_data,
+						      table_name,
+						      atomic_weight_ratio,
+						      inelastic_distribution );
+
+  if( !raw_sab_data.hasElasticScatteringCrossSectionData() )
+  {
+    s_alpha_beta.reset( new SAlphaBeta( 
+			        table_name,
+				raw_sab_data.extractInelasticEnergyGrid(),
+				raw_sab_data.extractInelasticCrossSection(),
+				inelastic_distribution ) );
+  }
+  else if( raw_sab_data.getElasticScatteringMode() == 
+	   Data::COHERENT_ELASTIC_MODE )
+  {
+    Teuchos::RCP<const SAlphaBetaCoherentElasticScatteringDistribution>
+      coherent_elastic_distribution;
+
+    SAlphaBetaACEFactory::createCoherentElasticScatteringDistribution(
+					       raw_sab_data,
+					       atomic_weight_ratio,
+					       coherent_elastic_distribution );
+
+    s_alpha_beta.reset( new SAlphaBeta( 
+			        table_name,
+				raw_sab_data.extractInelasticEnergyGrid(),
+				raw_sab_data.extractInelasticCrossSection(),
+				inelastic_distribution,
+				coherent_elastic_distribution ) );
+  }
+  else
+  {
+    TEST_FOR_EXCEPTION( 
+		  !raw_sab_data.hasElasticScatteringAngularDistributionData(),
+		  std::runtime_error,
+		  "Error: S(alpha,beta) table " << table_name << 
+		  " has incoherent elastic cross section data but no "
+		  "incoherent elastic angular distribution data!" );
+    
+    Teuchos::RCP<const SAlphaBetaIncoherentElasticScatteringDistribution>
+      incoherent_elastic_distribution;
+
+    SAlphaBetaACEFactory::createIncoherentElasticScatteringDistribution(
+					     raw_sab_data,
+					     table_name,
+					     atomic_weight_ratio,
+					     incoherent_elastic_distribution );
+
+    s_alpha_beta.reset( new SAlphaBeta( 
+			        table_name,
+				raw_sab_data.extractInelasticEnergyGrid(),
+				raw_sab_data.extractInelasticCrossSection(),
+				inelastic_distribution,
+				raw_sab_data.extractElasticEnergyGrid(),
+				raw_sab_data.extractElasticCrossSection(),
+				incoherent_elastic_distribution ) );
+  }
+}
+
+// Create the inelastic scattering distribution
+/*! \details The ITXE block stores, for every incoming energy, every discrete
+ * outgoing energy followed by its equiprobable scattering angle cosines. 
+ * The outgoing energies and the cosines are separated into two contiguous
+ * tables so that they can be accessed with direct index lookups.
+ */
+void SAlphaBetaACEFactory::createInelasticScatteringDistribution(
+	 const Data::XSSSabDataExtractor& raw_sab_data,
+	 const std::string& table_name,
+	 const double atomic_weight_ratio,
+	 Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	 inelastic_distribution )
+{
+  Teuchos::ArrayView<const double> incoming_energy_grid = 
+    raw_sab_data.extractInelasticEnergyGrid();
+
+  Teuchos::ArrayView<const double> itxe_block = 
+    raw_sab_data.extractITXEBlock();
+
+  const unsigned number_of_outgoing_energies = 
+    raw_sab_data.getNumberOfInelasticOutgoingEnergies();
+
+  const unsigned number_of_cosines = 
+    raw_sab_data.getNumberOfInelasticScatteringAngleCosines();
+
+  const unsigned outgoing_energy_stride = number_of_cosines + 1u;
+
+  TEST_FOR_EXCEPTION( itxe_block.size() != 
+		      incoming_energy_grid.size()*number_of_outgoing_energies*
+		      outgoing_energy_stride,
+		      std::runtime_error,
+		      "Error: the ITXE block of S(alpha,beta) table " <<
+		      table_name << " does not use discrete outgoing "
+		      "energies with equiprobable cosines!" );
+
+  Teuchos::Array<double> outgoing_energies( 
+		      incoming_energy_grid.size()*number_of_outgoing_energies );
+
+  Teuchos::Array<double> scattering_angle_cosines( 
+			      outgoing_energies.size()*number_of_cosines );
+
+  for( unsigned i = 0; i < outgoing_energies.size(); ++i )
+  {
+    outgoing_energies[i] = itxe_block[i*outgoing_energy_stride];
+
+    for( unsigned k = 0; k < number_of_cosines; ++k )
+    {
+      scattering_angle_cosines[i*number_of_cosines+k] = 
+	itxe_block[i*outgoing_energy_stride+k+1];
+    }
+  }
+
+  inelastic_distribution.reset( 
+		  new SAlphaBetaInelasticScatteringDistribution(
+			 atomic_weight_ratio,
+			 incoming_energy_grid,
+			 outgoing_energies(),
+			 scattering_angle_cosines(),
+			 number_of_outgoing_energies,
+			 number_of_cosines,
+			 raw_sab_data.hasSkewedInelasticOutgoingEnergies() ) );
+}
+
+// Create the incoherent elastic scattering distribution
+void SAlphaBetaACEFactory::createIncoherentElasticScatteringDistribution(
+	 const Data::XSSSabDataExtractor& raw_sab_data,
+	 const std::string& table_name,
+	 const double atomic_weight_ratio,
+	 Teuchos::RCP<const SAlphaBetaIncoherentElasticScatteringDistribution>&
+	 incoherent_elastic_distribution )
+{
+  // Make sure the elastic data is valid
+  testPrecondition( raw_sab_data.hasElasticScatteringAngularDistributionData() );
+  
+  Teuchos::ArrayView<const double> incoming_energy_grid = 
+    raw_sab_data.extractElasticEnergyGrid();
+
+  Teuchos::ArrayView<const double> itca_block = 
+    raw_sab_data.extractITCABlock();
+
+  const unsigned number_of_cosines = 
+    raw_sab_data.getNumberOfElasticScatteringAngleCosines();
+
+  TEST_FOR_EXCEPTION( itca_block.size() != 
+		      incoming_energy_grid.size()*number_of_cosines,
+		      std::runtime_error,
+		      "Error: the ITCA block of S(alpha,beta) table " <<
+		      table_name << " does not have the expected size!" );
+
+  incoherent_elastic_distribution.reset( 
+		  new SAlphaBetaIncoherentElasticScatteringDistribution(
+						       atomic_weight_ratio,
+						       incoming_energy_grid,
+						       itca_block,
+						       number_of_cosines ) );
+}
+
+// Create the coherent elastic scattering distribution
+/*! \details The ITCE block of a coherent elastic table stores the Bragg 
+ * edges and the cumulative structure factors instead of an energy grid and 
+ * cross section.
+ */
+void SAlphaBetaACEFactory::createCoherentElasticScatteringDistribution(
+	 const Data::XSSSabDataExtractor& raw_sab_data,
+	 const double atomic_weight_ratio,
+	 Teuchos::RCP<const SAlphaBetaCoherentElasticScatteringDistribution>&
+	 coherent_elastic_distribution )
+{
+  // Make sure the elastic data is valid
+  testPrecondition( raw_sab_data.hasElasticScatteringCrossSectionData() );
+  testPrecondition( raw_sab_data.getElasticScatteringMode() == 
+		    Data::COHERENT_ELASTIC_MODE );
+  
+  coherent_elastic_distribution.reset( 
+		  new SAlphaBetaCoherentElasticScatteringDistribution(
+			       atomic_weight_ratio,
+			       raw_sab_data.extractElasticEnergyGrid(),
+			       raw_sab_data.extractElasticCrossSection() ) );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaACEFactory.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaACEFactory.hpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) ace factory class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_S_ALPHA_BETA_ACE_FACTORY_HPP
+#define MONTE_CARLO_S_ALPHA_BETA_ACE_FACTORY_HPP
+
+// Std Lib Includes
+#include <string>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "Data_XSSSabDataExtractor.hpp"
+
+namespace MonteCarlo{
+
+//! The S(alpha,beta) factory class that uses ACE data
+class SAlphaBetaACEFactory
+{
+
+public:
+
+  //! Create a S(alpha,beta) object
+  static void createSAlphaBeta( 
+			 const Data::XSSSabDataExtractor& raw_sab_data,
+			 const std::string& table_name,
+			 const double atomic_weight_ratio,
+			 Teuchos::RCP<SAlphaBeta>& s_alpha_beta );
+
+  //! Create the inelastic scattering distribution
+  static void createInelasticScatteringDistribution(
+	 const Data::XSSSabDataExtractor& raw_sab_data,
+	 const std::string& table_name,
+	 const double atomic_weight_ratio,
+	 Teuchos::RCP<const SAlphaBetaInelasticScatteringDistribution>&
+	 inelastic_distribution );
+
+  //! Create the incoherent elastic scattering distribution
+  static void createIncoherentElasticScatteringDistribution(
+	 const Data::XSSSabDataExtractor& raw_sab_data,
+	 const std::string& table_name,
+	 const double atomic_weight_ratio,
+	 Teuchos::RCP<const SAlphaBetaIncoherentElasticScatteringDistribution>&
+	 incoherent_elastic_distribution );
+
+  //! Create the coherent elastic scattering distribution
+  static void createCoherentElasticScatteringDistribution(
+	 const Data::XSSSabDataExtractor& raw_sab_data,
+	 const double atomic_weight_ratio,
+	 Teuchos::RCP<const SAlphaBetaCoherentElasticScatteringDistribution>&
+	 coherent_elastic_distribution );
+
+private:
+
+  // Constructor
+  SAlphaBetaACEFactory();
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_S_ALPHA_BETA_ACE_FACTORY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaACEFactory.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.cpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) coherent elastic scattering dist. class def.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_DirectionHelpers.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+SAlphaBetaCoherentElasticScatteringDistribution::SAlphaBetaCoherentElasticScatteringDistribution(
+	   const double atomic_weight_ratio,
+	   const Teuchos::ArrayView<const double>& bragg_edges,
+	   const Teuchos::ArrayView<const double>& cumulative_structure_factors )
+  : NuclearScatteringDistribution<NeutronState,NeutronState>(
+						       atomic_weight_ratio ),
+    d_bragg_edges( bragg_edges ),
+    d_cumulative_structure_factors( cumulative_structure_factors )
+{
+  // Make sure the Bragg edges are valid
+  testPrecondition( bragg_edges.size() > 0 );
+  testPrecondition( bragg_edges.front() > 0.0 );
+  testPrecondition( Utility::Sort::isSortedAscending( bragg_edges.begin(),
+						      bragg_edges.end() ) );
+  // Make sure the structure factors are valid
+  testPrecondition( cumulative_structure_factors.size() == 
+		    bragg_edges.size() );
+  testPrecondition( Utility::Sort::isSortedAscending( 
+				       cumulative_structure_factors.begin(),
+				       cumulative_structure_factors.end() ) );
+}
+
+// Randomly scatter the particle
+/*! \details The S(alpha,beta) tables are only valid at the temperature
+ * that they were processed at - the temperature argument is ignored.
+ */
+void SAlphaBetaCoherentElasticScatteringDistribution::scatterParticle(
+				         const NeutronState& incoming_particle,
+					 NeutronState& outgoing_particle,
+					 const double temperature ) const
+{
+  double outgoing_direction[3];
+
+  Utility::rotateDirectionThroughPolarAndAzimuthalAngle(
+		      this->sampleAngleCosine( incoming_particle.getEnergy() ),
+		      this->sampleAzimuthalAngle(),
+		      incoming_particle.getDirection(),
+		      outgoing_direction );
+
+  outgoing_particle.setEnergy( incoming_particle.getEnergy() );
+
+  outgoing_particle.setDirection( outgoing_direction );
+}
+
+// Sample a scattering angle cosine
+double SAlphaBetaCoherentElasticScatteringDistribution::sampleAngleCosine(
+					   const double incoming_energy ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy >= d_bragg_edges.front() );
+
+  const unsigned number_of_edges =
+    this->getNumberOfAccessibleBraggEdges( incoming_energy );
+
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    d_cumulative_structure_factors[number_of_edges-1];
+
+  const unsigned edge_index = Utility::Search::binaryUpperBoundIndex(
+			 d_cumulative_structure_factors.begin(),
+			 d_cumulative_structure_factors.begin()+number_of_edges,
+			 scaled_random_number );
+
+  double scattering_angle_cosine = 
+    1.0 - 2.0*d_bragg_edges[edge_index]/incoming_energy;
+
+  // Protect against round-off
+  if( scattering_angle_cosine < -1.0 )
+    scattering_angle_cosine = -1.0;
+
+  return scattering_angle_cosine;
+}
+
+// Evaluate the cross section
+/*! \details The cross section is zero below the first Bragg edge.
+ */
+double SAlphaBetaCoherentElasticScatteringDistribution::evaluateCrossSection(
+					   const double incoming_energy ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  if( incoming_energy < d_bragg_edges.front() )
+    return 0.0;
+  else
+  {
+    return d_cumulative_structure_factors[
+	 this->getNumberOfAccessibleBraggEdges( incoming_energy )-1]/
+      incoming_energy;
+  }
+}
+
+// Return the number of Bragg edges below the incoming energy
+unsigned 
+SAlphaBetaCoherentElasticScatteringDistribution::getNumberOfAccessibleBraggEdges(
+					   const double incoming_energy ) const
+{
+  if( incoming_energy >= d_bragg_edges.back() )
+    return d_bragg_edges.size();
+  else
+  {
+    return Utility::Search::binaryLowerBoundIndex( d_bragg_edges.begin(),
+						   d_bragg_edges.end(),
+						   incoming_energy ) + 1u;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.hpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) coherent elastic scattering dist. class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_S_ALPHA_BETA_COHERENT_ELASTIC_SCATTERING_DISTRIBUTION_HPP
+#define MONTE_CARLO_S_ALPHA_BETA_COHERENT_ELASTIC_SCATTERING_DISTRIBUTION_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclearScatteringDistribution.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+
+namespace MonteCarlo{
+
+/*! The S(alpha,beta) coherent elastic scattering distribution class
+ * \details Coherent elastic scattering can only occur off of the Bragg 
+ * edges that are below the incoming energy. The cumulative structure factors
+ * (the products of the Bragg edge energies and the cross sections) 
+ * are used directly as an unnormalized cdf for selecting the Bragg edge. 
+ * The scattering angle cosine is then 1 - 2*E_i/E. The outgoing energy is
+ * always equal to the incoming energy.
+ */
+class SAlphaBetaCoherentElasticScatteringDistribution : public NuclearScatteringDistribution<NeutronState,NeutronState>
+{
+
+public:
+
+  //! Constructor
+  SAlphaBetaCoherentElasticScatteringDistribution(
+	  const double atomic_weight_ratio,
+	  const Teuchos::ArrayView<const double>& bragg_edges,
+	  const Teuchos::ArrayView<const double>& cumulative_structure_factors );
+
+  //! Destructor
+  ~SAlphaBetaCoherentElasticScatteringDistribution()
+  { /* ... */ }
+
+  //! Randomly scatter the particle
+  void scatterParticle( const NeutronState& incoming_particle,
+			NeutronState& outgoing_particle,
+			const double temperature ) const;
+
+  //! Sample a scattering angle cosine
+  double sampleAngleCosine( const double incoming_energy ) const;
+
+  //! Evaluate the cross section
+  double evaluateCrossSection( const double incoming_energy ) const;
+
+private:
+
+  // Return the number of Bragg edges below the incoming energy
+  unsigned getNumberOfAccessibleBraggEdges( 
+				       const double incoming_energy ) const;
+
+  // The Bragg edges
+  Teuchos::Array<double> d_bragg_edges;
+
+  // The cumulative structure factors
+  Teuchos::Array<double> d_cumulative_structure_factors;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_S_ALPHA_BETA_COHERENT_ELASTIC_SCATTERING_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaHelpers.hpp
+//! \author Luke Kersting
+//! \brief  S(alpha,beta) helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_S_ALPHA_BETA_HELPERS_HPP
+#define MONTE_CARLO_S_ALPHA_BETA_HELPERS_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+//! Find the grid bin of an energy and the interpolation fraction in the bin
+/*! \details Energies below the first grid point or above the last grid point
+ * are treated as being equal to the first or last grid point respectively.
+ */
+inline double calculateSAlphaBetaInterpolationFraction(
+			       const Teuchos::Array<double>& energy_grid,
+			       const double energy,
+			       unsigned& lower_bin_index )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+
+  if( energy <= energy_grid.front() )
+  {
+    lower_bin_index = 0u;
+
+    return 0.0;
+  }
+  else if( energy >= energy_grid.back() )
+  {
+    lower_bin_index = energy_grid.size() - 2;
+
+    return 1.0;
+  }
+  else
+  {
+    lower_bin_index = Utility::Search::binaryLowerBoundIndex(
+							   energy_grid.begin(),
+							   energy_grid.end(),
+							   energy );
+
+    return (energy - energy_grid[lower_bin_index])/
+      (energy_grid[lower_bin_index+1] - energy_grid[lower_bin_index]);
+  }
+}
+
+//! Sample an index from a set of equally likely indices
+inline unsigned sampleSAlphaBetaEquiprobableIndex(
+					    const double random_number,
+					    const unsigned number_of_indices )
+{
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number < 1.0 );
+
+  unsigned index = (unsigned)(random_number*number_of_indices);
+
+  // Protect against round-off
+  if( index >= number_of_indices )
+    index = number_of_indices - 1u;
+
+  return index;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_S_ALPHA_BETA_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaHelpers.hpp
+//---------------------------------------------------------------------------//
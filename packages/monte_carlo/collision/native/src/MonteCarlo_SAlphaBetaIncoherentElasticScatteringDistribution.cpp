@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.cpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) incoherent elastic scattering dist. class def.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.hpp"
+#include "MonteCarlo_SAlphaBetaHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_DirectionHelpers.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The scattering angle cosines must be ordered by incoming energy
+ * (i.e. the first number_of_scattering_angle_cosines values belong to the
+ * first incoming energy).
+ */
+SAlphaBetaIncoherentElasticScatteringDistribution::SAlphaBetaIncoherentElasticScatteringDistribution(
+	   const double atomic_weight_ratio,
+	   const Teuchos::ArrayView<const double>& incoming_energy_grid,
+	   const Teuchos::ArrayView<const double>& scattering_angle_cosines,
+	   const unsigned number_of_scattering_angle_cosines )
+  : NuclearScatteringDistribution<NeutronState,NeutronState>(
+						       atomic_weight_ratio ),
+    d_incoming_energy_grid( incoming_energy_grid ),
+    d_scattering_angle_cosines( scattering_angle_cosines ),
+    d_number_of_scattering_angle_cosines( number_of_scattering_angle_cosines )
+{
+  // Make sure the incoming energy grid is valid
+  testPrecondition( incoming_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+					      incoming_energy_grid.begin(),
+					      incoming_energy_grid.end() ) );
+  // Make sure the table dimensions are valid
+  testPrecondition( number_of_scattering_angle_cosines > 0 );
+  testPrecondition( scattering_angle_cosines.size() ==
+		    incoming_energy_grid.size()*
+		    number_of_scattering_angle_cosines );
+}
+
+// Randomly scatter the particle
+/*! \details The S(alpha,beta) tables are only valid at the temperature
+ * that they were processed at - the temperature argument is ignored.
+ */
+void SAlphaBetaIncoherentElasticScatteringDistribution::scatterParticle(
+				         const NeutronState& incoming_particle,
+					 NeutronState& outgoing_particle,
+					 const double temperature ) const
+{
+  double outgoing_direction[3];
+
+  Utility::rotateDirectionThroughPolarAndAzimuthalAngle(
+		      this->sampleAngleCosine( incoming_particle.getEnergy() ),
+		      this->sampleAzimuthalAngle(),
+		      incoming_particle.getDirection(),
+		      outgoing_direction );
+
+  outgoing_particle.setEnergy( incoming_particle.getEnergy() );
+
+  outgoing_particle.setDirection( outgoing_direction );
+}
+
+// Sample a scattering angle cosine
+double SAlphaBetaIncoherentElasticScatteringDistribution::sampleAngleCosine(
+					   const double incoming_energy ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  unsigned lower_bin_index;
+
+  const double interpolation_fraction =
+    calculateSAlphaBetaInterpolationFraction( d_incoming_energy_grid,
+					      incoming_energy,
+					      lower_bin_index );
+
+  const unsigned lower_cosine_index =
+    lower_bin_index*d_number_of_scattering_angle_cosines +
+    sampleSAlphaBetaEquiprobableIndex(
+		      Utility::RandomNumberGenerator::getRandomNumber<double>(),
+		      d_number_of_scattering_angle_cosines );
+
+  const unsigned upper_cosine_index =
+    lower_cosine_index + d_number_of_scattering_angle_cosines;
+
+  double scattering_angle_cosine =
+    d_scattering_angle_cosines[lower_cosine_index] +
+    interpolation_fraction*(d_scattering_angle_cosines[upper_cosine_index] -
+			    d_scattering_angle_cosines[lower_cosine_index]);
+
+  // Protect against round-off
+  if( scattering_angle_cosine < -1.0 )
+    scattering_angle_cosine = -1.0;
+  else if( scattering_angle_cosine > 1.0 )
+    scattering_angle_cosine = 1.0;
+
+  return scattering_angle_cosine;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
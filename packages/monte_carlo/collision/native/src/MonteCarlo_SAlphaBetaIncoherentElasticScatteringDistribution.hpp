@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.hpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) incoherent elastic scattering dist. class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_S_ALPHA_BETA_INCOHERENT_ELASTIC_SCATTERING_DISTRIBUTION_HPP
+#define MONTE_CARLO_S_ALPHA_BETA_INCOHERENT_ELASTIC_SCATTERING_DISTRIBUTION_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclearScatteringDistribution.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+
+namespace MonteCarlo{
+
+/*! The S(alpha,beta) incoherent elastic scattering distribution class
+ * \details For every incoming energy a table of equiprobable scattering
+ * angle cosines is stored. The cosine index is found with a single direct
+ * lookup and the cosine is interpolated between the tables that bound the
+ * incoming energy. The outgoing energy is always equal to the incoming energy.
+ */
+class SAlphaBetaIncoherentElasticScatteringDistribution : public NuclearScatteringDistribution<NeutronState,NeutronState>
+{
+
+public:
+
+  //! Constructor
+  SAlphaBetaIncoherentElasticScatteringDistribution(
+	   const double atomic_weight_ratio,
+	   const Teuchos::ArrayView<const double>& incoming_energy_grid,
+	   const Teuchos::ArrayView<const double>& scattering_angle_cosines,
+	   const unsigned number_of_scattering_angle_cosines );
+
+  //! Destructor
+  ~SAlphaBetaIncoherentElasticScatteringDistribution()
+  { /* ... */ }
+
+  //! Randomly scatter the particle
+  void scatterParticle( const NeutronState& incoming_particle,
+			NeutronState& outgoing_particle,
+			const double temperature ) const;
+
+  //! Sample a scattering angle cosine
+  double sampleAngleCosine( const double incoming_energy ) const;
+
+private:
+
+  // The incoming energy grid
+  Teuchos::Array<double> d_incoming_energy_grid;
+
+  // The scattering angle cosines (indexed by incoming energy, cosine)
+  Teuchos::Array<double> d_scattering_angle_cosines;
+
+  // The number of scattering angle cosines for every incoming energy
+  unsigned d_number_of_scattering_angle_cosines;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_S_ALPHA_BETA_INCOHERENT_ELASTIC_SCATTERING_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.hpp
+//---------------------------------------------------------------------------//
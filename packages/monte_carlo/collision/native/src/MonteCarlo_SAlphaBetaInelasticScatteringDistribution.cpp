@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaInelasticScatteringDistribution.cpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) inelastic scattering distribution class def.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaInelasticScatteringDistribution.hpp"
+#include "MonteCarlo_SAlphaBetaHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_DirectionHelpers.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The outgoing energies must be ordered by incoming energy (i.e.
+ * the first number_of_outgoing_energies values belong to the first incoming
+ * energy). The scattering angle cosines must be ordered by incoming energy
+ * and then by outgoing energy. When the outgoing energies are skewed, the
+ * first and last outgoing energies have a relative weight of 1, the second
+ * and second to last outgoing energies have a relative weight of 4 and all
+ * other outgoing energies have a relative weight of 10.
+ */
+SAlphaBetaInelasticScatteringDistribution::SAlphaBetaInelasticScatteringDistribution(
+	   const double atomic_weight_ratio,
+	   const Teuchos::ArrayView<const double>& incoming_energy_grid,
+	   const Teuchos::ArrayView<const double>& outgoing_energies,
+	   const Teuchos::ArrayView<const double>& scattering_angle_cosines,
+	   const unsigned number_of_outgoing_energies,
+	   const unsigned number_of_scattering_angle_cosines,
+	   const bool skewed_outgoing_energies )
+  : NuclearScatteringDistribution<NeutronState,NeutronState>(
+						       atomic_weight_ratio ),
+    d_incoming_energy_grid( incoming_energy_grid ),
+    d_outgoing_energies( outgoing_energies ),
+    d_scattering_angle_cosines( scattering_angle_cosines ),
+    d_outgoing_energy_index_table(),
+    d_number_of_outgoing_energies( number_of_outgoing_energies ),
+    d_number_of_scattering_angle_cosines( number_of_scattering_angle_cosines )
+{
+  // Make sure the incoming energy grid is valid
+  testPrecondition( incoming_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+					      incoming_energy_grid.begin(),
+					      incoming_energy_grid.end() ) );
+  // Make sure the table dimensions are valid
+  testPrecondition( number_of_outgoing_energies > 0 );
+  testPrecondition( number_of_scattering_angle_cosines > 0 );
+  testPrecondition( outgoing_energies.size() ==
+		    incoming_energy_grid.size()*number_of_outgoing_energies );
+  testPrecondition( scattering_angle_cosines.size() ==
+		    outgoing_energies.size()*
+		    number_of_scattering_angle_cosines );
+  // Make sure there are enough outgoing energies for the skewed weights
+  testPrecondition( !skewed_outgoing_energies ||
+		    number_of_outgoing_energies >= 4 );
+
+  // Create the outgoing energy index table (one entry per unit weight)
+  if( skewed_outgoing_energies )
+  {
+    for( unsigned j = 0; j < number_of_outgoing_energies; ++j )
+    {
+      unsigned weight;
+
+      if( j == 0 || j == number_of_outgoing_energies - 1 )
+	weight = 1u;
+      else if( j == 1 || j == number_of_outgoing_energies - 2 )
+	weight = 4u;
+      else
+	weight = 10u;
+
+      for( unsigned w = 0; w < weight; ++w )
+	d_outgoing_energy_index_table.push_back( j );
+    }
+  }
+}
+
+// Randomly scatter the particle
+/*! \details The S(alpha,beta) tables are only valid at the temperature
+ * that they were processed at - the temperature argument is ignored.
+ */
+void SAlphaBetaInelasticScatteringDistribution::scatterParticle(
+				         const NeutronState& incoming_particle,
+					 NeutronState& outgoing_particle,
+					 const double temperature ) const
+{
+  double outgoing_energy, scattering_angle_cosine;
+
+  this->sampleOutgoingEnergyAndAngleCosine( incoming_particle.getEnergy(),
+					    outgoing_energy,
+					    scattering_angle_cosine );
+
+  double outgoing_direction[3];
+
+  Utility::rotateDirectionThroughPolarAndAzimuthalAngle(
+					     scattering_angle_cosine,
+					     this->sampleAzimuthalAngle(),
+					     incoming_particle.getDirection(),
+					     outgoing_direction );
+
+  outgoing_particle.setEnergy( outgoing_energy );
+
+  outgoing_particle.setDirection( outgoing_direction );
+}
+
+// Sample an outgoing energy and scattering angle cosine
+/*! \details The same outgoing energy index and scattering angle cosine
+ * index are used with the two tables that bound the incoming energy.
+ */
+void SAlphaBetaInelasticScatteringDistribution::sampleOutgoingEnergyAndAngleCosine(
+				        const double incoming_energy,
+					double& outgoing_energy,
+					double& scattering_angle_cosine ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  unsigned lower_bin_index;
+
+  const double interpolation_fraction =
+    calculateSAlphaBetaInterpolationFraction( d_incoming_energy_grid,
+					      incoming_energy,
+					      lower_bin_index );
+
+  const unsigned outgoing_energy_index = this->sampleOutgoingEnergyIndex();
+
+  const unsigned scattering_angle_cosine_index =
+    sampleSAlphaBetaEquiprobableIndex(
+		      Utility::RandomNumberGenerator::getRandomNumber<double>(),
+		      d_number_of_scattering_angle_cosines );
+
+  const unsigned lower_energy_index =
+    lower_bin_index*d_number_of_outgoing_energies + outgoing_energy_index;
+
+  const unsigned upper_energy_index =
+    lower_energy_index + d_number_of_outgoing_energies;
+
+  outgoing_energy = d_outgoing_energies[lower_energy_index] +
+    interpolation_fraction*(d_outgoing_energies[upper_energy_index] -
+			    d_outgoing_energies[lower_energy_index]);
+
+  const unsigned lower_cosine_index =
+    lower_energy_index*d_number_of_scattering_angle_cosines +
+    scattering_angle_cosine_index;
+
+  const unsigned upper_cosine_index = lower_cosine_index +
+    d_number_of_outgoing_energies*d_number_of_scattering_angle_cosines;
+
+  scattering_angle_cosine = d_scattering_angle_cosines[lower_cosine_index] +
+    interpolation_fraction*(d_scattering_angle_cosines[upper_cosine_index] -
+			    d_scattering_angle_cosines[lower_cosine_index]);
+
+  // Protect against round-off
+  if( scattering_angle_cosine < -1.0 )
+    scattering_angle_cosine = -1.0;
+  else if( scattering_angle_cosine > 1.0 )
+    scattering_angle_cosine = 1.0;
+
+  // Make sure the outgoing energy is valid
+  testPostcondition( outgoing_energy >= 0.0 );
+}
+
+// Sample the outgoing energy index
+unsigned
+SAlphaBetaInelasticScatteringDistribution::sampleOutgoingEnergyIndex() const
+{
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  if( d_outgoing_energy_index_table.size() == 0 )
+  {
+    return sampleSAlphaBetaEquiprobableIndex( random_number,
+					      d_number_of_outgoing_energies );
+  }
+  else
+  {
+    return d_outgoing_energy_index_table[
+		          sampleSAlphaBetaEquiprobableIndex(
+				     random_number,
+				     d_outgoing_energy_index_table.size() )];
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaInelasticScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
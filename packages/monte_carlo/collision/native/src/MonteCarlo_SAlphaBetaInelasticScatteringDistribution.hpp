@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaInelasticScatteringDistribution.hpp
+//! \author Luke Kersting
+//! \brief  The S(alpha,beta) inelastic scattering distribution class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_S_ALPHA_BETA_INELASTIC_SCATTERING_DISTRIBUTION_HPP
+#define MONTE_CARLO_S_ALPHA_BETA_INELASTIC_SCATTERING_DISTRIBUTION_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclearScatteringDistribution.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+
+namespace MonteCarlo{
+
+/*! The S(alpha,beta) inelastic scattering distribution class
+ * \details For every incoming energy a table of discrete outgoing energies
+ * is stored and for every outgoing energy a table of equiprobable scattering
+ * angle cosines is stored. The outgoing energies are either equally likely
+ * or skewed (relative weights of 1, 4, 10, ..., 10, 4, 1). Skewed outgoing
+ * energies are sampled from a prebuilt index table (one entry per unit
+ * weight) so that both the outgoing energy index and the scattering angle
+ * cosine index are found with a single direct lookup - no searching or
+ * rejection is required. The outgoing energy and the scattering angle cosine
+ * are interpolated between the tables that bound the incoming energy.
+ */
+class SAlphaBetaInelasticScatteringDistribution : public NuclearScatteringDistribution<NeutronState,NeutronState>
+{
+
+public:
+
+  //! Constructor
+  SAlphaBetaInelasticScatteringDistribution(
+	   const double atomic_weight_ratio,
+	   const Teuchos::ArrayView<const double>& incoming_energy_grid,
+	   const Teuchos::ArrayView<const double>& outgoing_energies,
+	   const Teuchos::ArrayView<const double>& scattering_angle_cosines,
+	   const unsigned number_of_outgoing_energies,
+	   const unsigned number_of_scattering_angle_cosines,
+	   const bool skewed_outgoing_energies );
+
+  //! Destructor
+  ~SAlphaBetaInelasticScatteringDistribution()
+  { /* ... */ }
+
+  //! Randomly scatter the particle
+  void scatterParticle( const NeutronState& incoming_particle,
+			NeutronState& outgoing_particle,
+			const double temperature ) const;
+
+  //! Sample an outgoing energy and scattering angle cosine
+  void sampleOutgoingEnergyAndAngleCosine(
+				    const double incoming_energy,
+				    double& outgoing_energy,
+				    double& scattering_angle_cosine ) const;
+
+  //! Return the maximum incoming energy
+  double getMaxEnergy() const;
+
+private:
+
+  // Sample the outgoing energy index
+  unsigned sampleOutgoingEnergyIndex() const;
+
+  // The incoming energy grid
+  Teuchos::Array<double> d_incoming_energy_grid;
+
+  // The outgoing energies (indexed by incoming energy, outgoing energy)
+  Teuchos::Array<double> d_outgoing_energies;
+
+  // The scattering angle cosines (indexed by incoming energy, outgoing
+  // energy, cosine)
+  Teuchos::Array<double> d_scattering_angle_cosines;
+
+  // The outgoing energy index table (empty if equally likely)
+  Teuchos::Array<unsigned> d_outgoing_energy_index_table;
+
+  // The number of outgoing energies for every incoming energy
+  unsigned d_number_of_outgoing_energies;
+
+  // The number of scattering angle cosines for every outgoing energy
+  unsigned d_number_of_scattering_angle_cosines;
+};
+
+// Return the maximum incoming energy
+inline double SAlphaBetaInelasticScatteringDistribution::getMaxEnergy() const
+{
+  return d_incoming_energy_grid.back();
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_S_ALPHA_BETA_INELASTIC_SCATTERING_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaInelasticScatteringDistribution.hpp
+//---------------------------------------------------------------------------//
@@ -59,6 +59,9 @@ public:
   //! Return the reaction type
   ElectroatomicReactionType getReactionType() const;
 
+  //! Return the mean angular deflection (1-mu) of a single reaction
+  double getMeanAngularDeflection( const double energy ) const;
+
   //! Simulate the reaction
   void react( ElectronState& electron, 
               ParticleBank& bank,
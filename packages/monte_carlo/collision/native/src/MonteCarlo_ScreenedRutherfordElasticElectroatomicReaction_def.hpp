@@ -114,6 +114,13 @@ ElectroatomicReactionType ScreenedRutherfordElasticElectroatomicReaction<InterpP
   return SCREENED_RUTHERFORD_ELASTIC_ELECTROATOMIC_REACTION;
 }
 
+// Return the mean angular deflection (1-mu) of a single reaction
+template<typename InterpPolicy, bool processed_cross_section>
+double ScreenedRutherfordElasticElectroatomicReaction<InterpPolicy,processed_cross_section>::getMeanAngularDeflection( const double energy ) const
+{
+  return d_scattering_distribution->evaluateMeanAngularDeflection( energy );
+}
+
 // Simulate the reaction
 template<typename InterpPolicy, bool processed_cross_section>
 void ScreenedRutherfordElasticElectroatomicReaction<InterpPolicy,processed_cross_section>::react( 
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <limits>
+#include <iterator>
 
 // Trilinos Includes
 #include <Teuchos_Array.hpp>
@@ -75,6 +76,18 @@ ScreenedRutherfordElasticElectronScatteringDistribution::ScreenedRutherfordElast
   testPrecondition( d_upper_cutoff_angle <= 2.0 );
 
   d_using_endl_tables = true;
+
+  // Tabulate the max (unnormalized) cdf value at every energy bin
+  d_max_unnormalized_cdfs.resize( d_screened_rutherford_parameters.size() );
+
+  for( unsigned i = 0; i < d_screened_rutherford_parameters.size(); ++i )
+  {
+    d_max_unnormalized_cdfs[i] = 
+      d_upper_cutoff_angle*d_screened_rutherford_parameters[i].third/( 
+                      ( d_screened_rutherford_parameters[i].second )*
+                      ( d_upper_cutoff_angle + 
+                        d_screened_rutherford_parameters[i].second ) );
+  }
 }
 
 // Evaluate the distribution at the given energy and scattering angle (units of pi)
@@ -187,16 +200,9 @@ double ScreenedRutherfordElasticElectronScatteringDistribution::evaluateIntegrat
                                         upper_bin_boundary,
                                         interpolation_fraction );
 
-    double lower_value = d_upper_cutoff_angle*lower_bin_boundary->third/( 
-                        ( lower_bin_boundary->second )*
-                        ( d_upper_cutoff_angle + lower_bin_boundary->second ) );
-
-    double upper_value = d_upper_cutoff_angle*upper_bin_boundary->third/( 
-                        ( upper_bin_boundary->second )*
-                        ( d_upper_cutoff_angle + upper_bin_boundary->second ) );
-
-    // Linearly interpolate between the upper and lower values
-    return interpolation_fraction*(upper_value - lower_value) + lower_value;
+    return this->evaluateMaxUnnormalizedCDF( lower_bin_boundary,
+                                             upper_bin_boundary,
+                                             interpolation_fraction );
   }
   else
   {
@@ -231,10 +237,9 @@ double ScreenedRutherfordElasticElectronScatteringDistribution::evaluateCDF(
                                         interpolation_fraction );
 
     double max_unormalized_cdf = 
-      this->evaluateIntegratedPDF( d_upper_cutoff_angle, 
-                                   lower_bin_boundary, 
-                                   upper_bin_boundary,
-                                   interpolation_fraction );
+      this->evaluateMaxUnnormalizedCDF( lower_bin_boundary, 
+                                        upper_bin_boundary,
+                                        interpolation_fraction );
 
     double unormalized_cdf = 
       this->evaluateIntegratedPDF( scattering_angle, 
@@ -254,6 +259,49 @@ double ScreenedRutherfordElasticElectronScatteringDistribution::evaluateCDF(
   }
 }
 
+// Evaluate the mean angular deflection (1-mu)
+/*! \details The distribution of the angular deflection x = 1-mu is 
+ * proportional to 1/(x+eta)^2 on [0,x_c], where eta is the screening constant
+ * and x_c is the upper cutoff angle. The mean is therefore
+ * eta(x_c+eta)/x_c*[ln(1+x_c/eta) - x_c/(x_c+eta)].
+ */
+double ScreenedRutherfordElasticElectronScatteringDistribution::evaluateMeanAngularDeflection( 
+                                         const double incoming_energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  double eta;
+
+  if ( d_using_endl_tables )
+  {
+    ParameterArray::const_iterator lower_bin_boundary, upper_bin_boundary;
+    double interpolation_fraction;
+
+    this->findLowerAndUpperBinBoundary( incoming_energy, 
+                                        lower_bin_boundary, 
+                                        upper_bin_boundary,
+                                        interpolation_fraction );
+
+    eta = interpolation_fraction*
+      ( upper_bin_boundary->second - lower_bin_boundary->second ) +
+      lower_bin_boundary->second;
+  }
+  else
+    eta = this->evaluateMoliereScreeningConstant( incoming_energy );
+
+  double mean_deflection = 
+    eta*( d_upper_cutoff_angle + eta )/d_upper_cutoff_angle*
+    ( log( 1.0 + d_upper_cutoff_angle/eta ) - 
+      d_upper_cutoff_angle/( d_upper_cutoff_angle + eta ) );
+
+  // Make sure the mean deflection is valid
+  testPostcondition( mean_deflection >= 0.0 );
+  testPostcondition( mean_deflection <= d_upper_cutoff_angle );
+
+  return mean_deflection;
+}
+
 // Sample an outgoing energy and direction from the distribution
 void ScreenedRutherfordElasticElectronScatteringDistribution::sample( 
 				     const double incoming_energy,
@@ -380,10 +428,9 @@ void ScreenedRutherfordElasticElectronScatteringDistribution::sampleAndRecordTri
                                         interpolation_fraction );
 
     double max_unormalized_cdf = 
-      this->evaluateIntegratedPDF( d_upper_cutoff_angle, 
-                                   lower_bin_boundary, 
-                                   upper_bin_boundary,
-                                   interpolation_fraction );
+      this->evaluateMaxUnnormalizedCDF( lower_bin_boundary, 
+                                        upper_bin_boundary,
+                                        interpolation_fraction );
 
     double scaled_random_number = random_number*max_unormalized_cdf;
 
@@ -429,12 +476,14 @@ void ScreenedRutherfordElasticElectronScatteringDistribution::findLowerAndUpperB
   {
     lower_bin_boundary = d_screened_rutherford_parameters.begin();
     upper_bin_boundary = lower_bin_boundary;
+    interpolation_fraction = 0.0;
   }
   else if( incoming_energy >= d_screened_rutherford_parameters.back().first )
   {
     lower_bin_boundary = d_screened_rutherford_parameters.end();
     --lower_bin_boundary;
     upper_bin_boundary = lower_bin_boundary;
+    interpolation_fraction = 0.0;
   }
   else
   {
@@ -474,6 +523,29 @@ double ScreenedRutherfordElasticElectronScatteringDistribution::evaluateIntegrat
   return interpolation_fraction*(upper_value - lower_value) + lower_value;
 }
 
+// Evaluate the tabulated max (unnormalized) cdf value
+/*! \details The pdf integrated from 0 to the upper cutoff angle is
+ * tabulated at every energy bin when the distribution is constructed.
+ */
+double ScreenedRutherfordElasticElectronScatteringDistribution::evaluateMaxUnnormalizedCDF( 
+        const ParameterArray::const_iterator& lower_bin_boundary, 
+        const ParameterArray::const_iterator& upper_bin_boundary,
+        const double& interpolation_fraction ) const
+{
+  const unsigned lower_bin_index = 
+    std::distance( d_screened_rutherford_parameters.begin(), 
+                   lower_bin_boundary );
+
+  const unsigned upper_bin_index = 
+    std::distance( d_screened_rutherford_parameters.begin(), 
+                   upper_bin_boundary );
+
+  // Linearly interpolate between the upper and lower values
+  return interpolation_fraction*(d_max_unnormalized_cdfs[upper_bin_index] - 
+                                 d_max_unnormalized_cdfs[lower_bin_index]) +
+    d_max_unnormalized_cdfs[lower_bin_index];
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
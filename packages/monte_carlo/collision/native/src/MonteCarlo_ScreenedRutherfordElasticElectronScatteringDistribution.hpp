@@ -76,6 +76,9 @@ public:
   double evaluateCDF( const double incoming_energy,
                       const double scattering_angle ) const;
 
+  //! Evaluate the mean angular deflection (1-mu)
+  double evaluateMeanAngularDeflection( const double incoming_energy ) const;
+
   //! Sample an outgoing energy and direction from the distribution
   void sample( const double incoming_energy,
                double& outgoing_energy,
@@ -125,6 +128,12 @@ private:
         const ParameterArray::const_iterator& upper_bin_boundary,
         const double& interpolation_fraction ) const;
 
+  // Evaluate the tabulated max (unnormalized) cdf value
+  double evaluateMaxUnnormalizedCDF( 
+        const ParameterArray::const_iterator& lower_bin_boundary, 
+        const ParameterArray::const_iterator& upper_bin_boundary,
+        const double& interpolation_fraction ) const;
+
   // The fine structure constant (fsc) squared
   static double s_fine_structure_const_squared;
 
@@ -154,6 +163,9 @@ private:
 
   // Screened Rutherford energy depended paramters: Moliere's screening constant and normalization constant
   ParameterArray d_screened_rutherford_parameters;
+
+  // The max (unnormalized) cdf value at each energy bin (ENDL tables only)
+  Teuchos::Array<double> d_max_unnormalized_cdfs;
 };
 
 } // end MonteCarlo namespace
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_STANDARD_ELECTROATOMIC_REACTION_DEF_HPP
 #define MONTE_CARLO_STANDARD_ELECTROATOMIC_REACTION_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_StandardElectroatomicReaction.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
@@ -275,6 +278,144 @@ double StandardElectroatomicReaction<InterpPolicy,processed_cross_section>::getC
     return 0.0;
 }
 
+// Return the cross sections at the given energies
+/*! \details The bin indices of all energies are found together using the
+ * grid searcher.
+ */
+template<typename InterpPolicy>
+void StandardElectroatomicReaction<InterpPolicy,true>::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == cross_sections.size() );
+
+  Teuchos::Array<unsigned> bin_indices( energies.size() );
+
+  d_grid_searcher->findLowerBinIndices( energies, bin_indices() );
+
+  this->getCrossSections( energies, bin_indices(), cross_sections );
+}
+
+// Return the cross sections at the given energies
+/*! \details The bin indices of all energies are found together using the
+ * grid searcher.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+void StandardElectroatomicReaction<InterpPolicy,processed_cross_section>::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == cross_sections.size() );
+
+  Teuchos::Array<unsigned> bin_indices( energies.size() );
+
+  d_grid_searcher->findLowerBinIndices( energies, bin_indices() );
+
+  this->getCrossSections( energies, bin_indices(), cross_sections );
+}
+
+// Return the cross sections at the given energies (efficient)
+/*! \details All of the energies are processed before any interpolation is
+ * done. Energies below the threshold are evaluated at the threshold and then
+ * set to zero (no branches) so that the interpolation loop can be 
+ * vectorized.
+ */
+template<typename InterpPolicy>
+void StandardElectroatomicReaction<InterpPolicy,true>::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<const unsigned>& bin_indices,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == bin_indices.size() );
+  testPrecondition( energies.size() == cross_sections.size() );
+
+  // The cross section is zero everywhere if the threshold is the last point
+  if( d_threshold_energy_index+1 >= d_incoming_energy_grid.size() )
+  {
+    std::fill( cross_sections.begin(), cross_sections.end(), 0.0 );
+
+    return;
+  }
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+    cross_sections[i] = InterpPolicy::processIndepVar( energies[i] );
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+  {
+    const bool above_threshold = bin_indices[i] >= d_threshold_energy_index;
+
+    const unsigned bin_index = 
+      above_threshold ? bin_indices[i] : d_threshold_energy_index;
+    
+    const double processed_energy = above_threshold ? cross_sections[i] :
+      d_incoming_energy_grid[d_threshold_energy_index];
+
+    const unsigned cs_index = bin_index - d_threshold_energy_index;
+    
+    const double processed_slope = 
+      (d_cross_section[cs_index+1]-d_cross_section[cs_index])/
+      (d_incoming_energy_grid[bin_index+1]-
+       d_incoming_energy_grid[bin_index]);
+
+    const double cross_section = 
+      InterpPolicy::interpolate( d_incoming_energy_grid[bin_index],
+				 processed_energy,
+				 d_cross_section[cs_index],
+				 processed_slope );
+    
+    cross_sections[i] = above_threshold ? cross_section : 0.0;
+  }
+}
+
+// Return the cross sections at the given energies (efficient)
+/*! \details Energies below the threshold are evaluated at the threshold and
+ * then set to zero (no branches) so that the interpolation loop can be 
+ * vectorized.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+void StandardElectroatomicReaction<InterpPolicy,processed_cross_section>::getCrossSections( 
+		    const Teuchos::ArrayView<const double>& energies,
+		    const Teuchos::ArrayView<const unsigned>& bin_indices,
+		    const Teuchos::ArrayView<double>& cross_sections ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( energies.size() == bin_indices.size() );
+  testPrecondition( energies.size() == cross_sections.size() );
+
+  // The cross section is zero everywhere if the threshold is the last point
+  if( d_threshold_energy_index+1 >= d_incoming_energy_grid.size() )
+  {
+    std::fill( cross_sections.begin(), cross_sections.end(), 0.0 );
+
+    return;
+  }
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+  {
+    const bool above_threshold = bin_indices[i] >= d_threshold_energy_index;
+
+    const unsigned bin_index = 
+      above_threshold ? bin_indices[i] : d_threshold_energy_index;
+    
+    const double energy = above_threshold ? energies[i] :
+      d_incoming_energy_grid[d_threshold_energy_index];
+
+    const unsigned cs_index = bin_index - d_threshold_energy_index;
+
+    const double cross_section = 
+      InterpPolicy::interpolate( d_incoming_energy_grid[bin_index],
+				 d_incoming_energy_grid[bin_index+1],
+				 energy,
+				 d_cross_section[cs_index],
+				 d_cross_section[cs_index+1] );
+    
+    cross_sections[i] = above_threshold ? cross_section : 0.0;
+  }
+}
+
 // Return the threshold energy
 template<typename InterpPolicy>
 double StandardElectroatomicReaction<InterpPolicy,true>::getThresholdEnergy() const
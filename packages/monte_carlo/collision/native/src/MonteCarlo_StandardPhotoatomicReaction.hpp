@@ -11,6 +11,8 @@
 
 // Trilinos Includes
 #include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomicReaction.hpp"
@@ -62,6 +64,17 @@ public:
   double getCrossSection( const double energy,
 			  const unsigned bin_index ) const;
 
+  //! Return the cross sections at the given energies
+  void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
+  //! Return the cross sections at the given energies (efficient)
+  void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<const unsigned>& bin_indices,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
   //! Return the threshold energy
   double getThresholdEnergy() const;
 
@@ -118,6 +131,17 @@ public:
   double getCrossSection( const double energy,
 			  const unsigned bin_index ) const;
 
+  //! Return the cross sections at the given energies
+  void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
+  //! Return the cross sections at the given energies (efficient)
+  void getCrossSections( 
+		   const Teuchos::ArrayView<const double>& energies,
+		   const Teuchos::ArrayView<const unsigned>& bin_indices,
+		   const Teuchos::ArrayView<double>& cross_sections ) const;
+
   //! Return the threshold energy
   double getThresholdEnergy() const;
 
@@ -0,0 +1,401 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_UnresolvedResonanceProbabilityTable.cpp
+//! \author Luke Kersting
+//! \brief  The unresolved resonance probability table class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+Teuchos::Array<unsigned long long> 
+UnresolvedResonanceProbabilityTable::particle_numbers;
+
+// Constructor
+/*! \details The band values must be ordered by incoming energy (i.e. the
+ * first number_of_bands values belong to the first incoming energy). One
+ * band selection cache will be created for every thread that has been
+ * requested from the Utility::GlobalOpenMPSession. Threads without a cache
+ * will sample a new band for every lookup.
+ */
+UnresolvedResonanceProbabilityTable::UnresolvedResonanceProbabilityTable(
+			 const Teuchos::ArrayView<const double>& energy_grid,
+			 const Teuchos::ArrayView<const double>& band_cdfs,
+			 const Teuchos::ArrayView<const double>& elastic_bands,
+			 const Teuchos::ArrayView<const double>& fission_bands,
+			 const Teuchos::ArrayView<const double>& capture_bands,
+			 const unsigned number_of_bands,
+			 const bool use_log_interpolation,
+			 const bool bands_are_factors )
+  : d_energy_grid( energy_grid ),
+    d_band_cdfs( band_cdfs ),
+    d_elastic_bands( elastic_bands ),
+    d_fission_bands( fission_bands ),
+    d_capture_bands( capture_bands ),
+    d_number_of_bands( number_of_bands ),
+    d_use_log_interpolation( use_log_interpolation ),
+    d_bands_are_factors( bands_are_factors ),
+    d_band_caches( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( energy_grid.front() > 0.0 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+						      energy_grid.end() ) );
+  // Make sure the table dimensions are valid
+  testPrecondition( number_of_bands > 0 );
+  testPrecondition( band_cdfs.size() == energy_grid.size()*number_of_bands );
+  testPrecondition( elastic_bands.size() == band_cdfs.size() );
+  testPrecondition( fission_bands.size() == band_cdfs.size() );
+  testPrecondition( capture_bands.size() == band_cdfs.size() );
+
+  for( unsigned i = 0; i < d_band_caches.size(); ++i )
+    d_band_caches[i].valid = false;
+
+  if( particle_numbers.size() < d_band_caches.size() )
+    particle_numbers.resize( d_band_caches.size(), 0ull );
+}
+
+// Start the transport of a new particle on the calling thread
+/*! \details Every band selection cache that was filled by the previous 
+ * particle on the calling thread will be invalidated. Secondary particles
+ * can have the same history, generation and collision numbers as the 
+ * particle that created them so this must be called before every particle
+ * is transported.
+ */
+void UnresolvedResonanceProbabilityTable::startNewParticle()
+{
+  const unsigned thread_id = Utility::GlobalOpenMPSession::getThreadId();
+
+  if( thread_id < particle_numbers.size() )
+    ++particle_numbers[thread_id];
+}
+
+// Return the minimum energy of the unresolved resonance range
+double UnresolvedResonanceProbabilityTable::getMinEnergy() const
+{
+  return d_energy_grid.front();
+}
+
+// Return the maximum energy of the unresolved resonance range
+double UnresolvedResonanceProbabilityTable::getMaxEnergy() const
+{
+  return d_energy_grid.back();
+}
+
+// Return the number of bands in every table
+unsigned UnresolvedResonanceProbabilityTable::getNumberOfBands() const
+{
+  return d_number_of_bands;
+}
+
+// Check if the band values are factors of the smooth cross sections
+bool UnresolvedResonanceProbabilityTable::areBandsFactors() const
+{
+  return d_bands_are_factors;
+}
+
+// Sample the cross sections seen by a neutron
+/*! \details New bands will only be selected when the particle, the neutron
+ * history, generation or collision number or the energy interval differs 
+ * from the cached values. The cached cross sections will be returned when
+ * the energy and the smooth cross sections have not changed either.
+ */
+void UnresolvedResonanceProbabilityTable::sampleCrossSections(
+				     const NeutronState& neutron,
+				     const double smooth_elastic_cross_section,
+				     const double smooth_fission_cross_section,
+				     const double smooth_capture_cross_section,
+				     double& elastic_cross_section,
+				     double& fission_cross_section,
+				     double& capture_cross_section ) const
+{
+  // Make sure the neutron energy is valid
+  testPrecondition( this->isEnergyInRange( neutron.getEnergy() ) );
+
+  const double energy = neutron.getEnergy();
+  
+  const unsigned thread_id = Utility::GlobalOpenMPSession::getThreadId();
+
+  if( thread_id >= d_band_caches.size() )
+  {
+    this->evaluateCrossSections(
+		      energy,
+		      Utility::RandomNumberGenerator::getRandomNumber<double>(),
+		      smooth_elastic_cross_section,
+		      smooth_fission_cross_section,
+		      smooth_capture_cross_section,
+		      elastic_cross_section,
+		      fission_cross_section,
+		      capture_cross_section );
+
+    return;
+  }
+
+  BandCache& cache = d_band_caches[thread_id];
+
+  const bool cache_current = this->isCacheCurrent( cache, thread_id, neutron );
+
+  if( cache_current && 
+      cache.energy == energy &&
+      cache.smooth_elastic_cross_section == smooth_elastic_cross_section &&
+      cache.smooth_fission_cross_section == smooth_fission_cross_section &&
+      cache.smooth_capture_cross_section == smooth_capture_cross_section )
+  {
+    elastic_cross_section = cache.elastic_cross_section;
+    fission_cross_section = cache.fission_cross_section;
+    capture_cross_section = cache.capture_cross_section;
+
+    return;
+  }
+
+  const unsigned energy_interval = 
+    (cache_current && cache.energy == energy ? 
+     cache.energy_interval : this->findEnergyInterval( energy ) );
+
+  if( !cache_current || cache.energy_interval != energy_interval )
+  {
+    const double random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+    
+    cache.valid = true;
+    cache.particle_number = particle_numbers[thread_id];
+    cache.history_number = neutron.getHistoryNumber();
+    cache.generation_number = neutron.getGenerationNumber();
+    cache.collision_number = neutron.getCollisionNumber();
+    cache.energy_interval = energy_interval;
+    cache.lower_band = this->findBand( energy_interval, random_number );
+    cache.upper_band = this->findBand( energy_interval+1, random_number );
+  }
+
+  this->evaluateBands( energy,
+		       energy_interval,
+		       cache.lower_band,
+		       cache.upper_band,
+		       smooth_elastic_cross_section,
+		       smooth_fission_cross_section,
+		       smooth_capture_cross_section,
+		       elastic_cross_section,
+		       fission_cross_section,
+		       capture_cross_section );
+
+  cache.energy = energy;
+  cache.smooth_elastic_cross_section = smooth_elastic_cross_section;
+  cache.smooth_fission_cross_section = smooth_fission_cross_section;
+  cache.smooth_capture_cross_section = smooth_capture_cross_section;
+  cache.elastic_cross_section = elastic_cross_section;
+  cache.fission_cross_section = fission_cross_section;
+  cache.capture_cross_section = capture_cross_section;
+}
+
+// Return the cross sections that have been cached for a neutron
+/*! \details The cross sections will only be returned (along with the smooth
+ * cross sections that they were sampled with) if the last cross sections 
+ * sampled on the calling thread were sampled for the same particle state at
+ * the same energy. False will be returned otherwise.
+ */
+bool UnresolvedResonanceProbabilityTable::getCachedCrossSections(
+				    const NeutronState& neutron,
+				    double& smooth_elastic_cross_section,
+				    double& smooth_fission_cross_section,
+				    double& smooth_capture_cross_section,
+				    double& elastic_cross_section,
+				    double& fission_cross_section,
+				    double& capture_cross_section ) const
+{
+  const unsigned thread_id = Utility::GlobalOpenMPSession::getThreadId();
+
+  if( thread_id >= d_band_caches.size() )
+    return false;
+
+  const BandCache& cache = d_band_caches[thread_id];
+
+  if( this->isCacheCurrent( cache, thread_id, neutron ) && 
+      cache.energy == neutron.getEnergy() )
+  {
+    smooth_elastic_cross_section = cache.smooth_elastic_cross_section;
+    smooth_fission_cross_section = cache.smooth_fission_cross_section;
+    smooth_capture_cross_section = cache.smooth_capture_cross_section;
+    elastic_cross_section = cache.elastic_cross_section;
+    fission_cross_section = cache.fission_cross_section;
+    capture_cross_section = cache.capture_cross_section;
+
+    return true;
+  }
+  else
+    return false;
+}
+
+// Evaluate the cross sections of the band selected by a random number
+/*! \details The same random number is used to select the band in the
+ * lower and upper bounding tables.
+ */
+void UnresolvedResonanceProbabilityTable::evaluateCrossSections(
+				     const double energy,
+				     const double random_number,
+				     const double smooth_elastic_cross_section,
+				     const double smooth_fission_cross_section,
+				     const double smooth_capture_cross_section,
+				     double& elastic_cross_section,
+				     double& fission_cross_section,
+				     double& capture_cross_section ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyInRange( energy ) );
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number < 1.0 );
+
+  const unsigned energy_interval = this->findEnergyInterval( energy );
+
+  this->evaluateBands( energy,
+		       energy_interval,
+		       this->findBand( energy_interval, random_number ),
+		       this->findBand( energy_interval+1, random_number ),
+		       smooth_elastic_cross_section,
+		       smooth_fission_cross_section,
+		       smooth_capture_cross_section,
+		       elastic_cross_section,
+		       fission_cross_section,
+		       capture_cross_section );
+}
+
+// Check if a band selection cache belongs to the neutron
+bool UnresolvedResonanceProbabilityTable::isCacheCurrent( 
+					 const BandCache& cache,
+					 const unsigned thread_id,
+					 const NeutronState& neutron ) const
+{
+  return cache.valid &&
+    cache.particle_number == particle_numbers[thread_id] &&
+    cache.history_number == neutron.getHistoryNumber() &&
+    cache.generation_number == neutron.getGenerationNumber() &&
+    cache.collision_number == neutron.getCollisionNumber();
+}
+
+// Find the energy interval that contains an energy
+/*! \details The last grid point belongs to the last energy interval.
+ */
+unsigned UnresolvedResonanceProbabilityTable::findEnergyInterval(
+					           const double energy ) const
+{
+  if( energy >= d_energy_grid.back() )
+    return d_energy_grid.size() - 2;
+  else
+  {
+    return Utility::Search::binaryLowerBoundIndex( d_energy_grid.begin(),
+						   d_energy_grid.end(),
+						   energy );
+  }
+}
+
+// Find the band that is selected by a random number
+/*! \details The first band with a cdf value not less than the random number
+ * will be selected.
+ */
+unsigned UnresolvedResonanceProbabilityTable::findBand(
+					     const unsigned energy_index,
+					     const double random_number ) const
+{
+  Teuchos::Array<double>::const_iterator start =
+    d_band_cdfs.begin() + energy_index*d_number_of_bands;
+
+  Teuchos::Array<double>::const_iterator end = start + d_number_of_bands;
+
+  if( random_number < *start )
+    return 0u;
+  else if( random_number >= *(end-1) )
+    return d_number_of_bands - 1u;
+  else
+    return Utility::Search::binaryUpperBoundIndex( start, end, random_number );
+}
+
+// Evaluate the cross sections of the selected bands
+void UnresolvedResonanceProbabilityTable::evaluateBands(
+				     const double energy,
+				     const unsigned energy_interval,
+				     const unsigned lower_band,
+				     const unsigned upper_band,
+				     const double smooth_elastic_cross_section,
+				     const double smooth_fission_cross_section,
+				     const double smooth_capture_cross_section,
+				     double& elastic_cross_section,
+				     double& fission_cross_section,
+				     double& capture_cross_section ) const
+{
+  const unsigned lower_index = energy_interval*d_number_of_bands + lower_band;
+
+  const unsigned upper_index = 
+    (energy_interval+1)*d_number_of_bands + upper_band;
+
+  elastic_cross_section = this->interpolate( energy,
+					     energy_interval,
+					     d_elastic_bands[lower_index],
+					     d_elastic_bands[upper_index] );
+
+  fission_cross_section = this->interpolate( energy,
+					     energy_interval,
+					     d_fission_bands[lower_index],
+					     d_fission_bands[upper_index] );
+
+  capture_cross_section = this->interpolate( energy,
+					     energy_interval,
+					     d_capture_bands[lower_index],
+					     d_capture_bands[upper_index] );
+
+  if( d_bands_are_factors )
+  {
+    elastic_cross_section *= smooth_elastic_cross_section;
+    fission_cross_section *= smooth_fission_cross_section;
+    capture_cross_section *= smooth_capture_cross_section;
+  }
+
+  // Make sure the cross sections are valid
+  testPostcondition( elastic_cross_section >= 0.0 );
+  testPostcondition( fission_cross_section >= 0.0 );
+  testPostcondition( capture_cross_section >= 0.0 );
+}
+
+// Interpolate a band value between the bounding tables
+/*! \details Log-log interpolation will fall back to lin-lin interpolation
+ * when one of the band values is not positive.
+ */
+double UnresolvedResonanceProbabilityTable::interpolate(
+					    const double energy,
+					    const unsigned energy_interval,
+					    const double lower_value,
+					    const double upper_value ) const
+{
+  const double lower_energy = d_energy_grid[energy_interval];
+  const double upper_energy = d_energy_grid[energy_interval+1];
+
+  if( d_use_log_interpolation && lower_value > 0.0 && upper_value > 0.0 )
+  {
+    return lower_value*std::exp( std::log( upper_value/lower_value )*
+				 std::log( energy/lower_energy )/
+				 std::log( upper_energy/lower_energy ) );
+  }
+  else
+  {
+    return lower_value + (upper_value - lower_value)*
+      (energy - lower_energy)/(upper_energy - lower_energy);
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_UnresolvedResonanceProbabilityTable.cpp
+//---------------------------------------------------------------------------//
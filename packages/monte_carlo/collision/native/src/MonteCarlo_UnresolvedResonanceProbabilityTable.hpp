@@ -0,0 +1,199 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_UnresolvedResonanceProbabilityTable.hpp
+//! \author Luke Kersting
+//! \brief  The unresolved resonance probability table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_UNRESOLVED_RESONANCE_PROBABILITY_TABLE_HPP
+#define MONTE_CARLO_UNRESOLVED_RESONANCE_PROBABILITY_TABLE_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NeutronState.hpp"
+
+namespace MonteCarlo{
+
+/*! The unresolved resonance probability table class
+ * \details For every incoming energy in the unresolved resonance range a
+ * table of cross section bands is stored (the band cdf and the elastic,
+ * fission and capture values of every band). A single random number is used
+ * to select the band in both tables that bound the incoming energy and the
+ * band values are interpolated between the tables. If the factors flag is
+ * set the band values are multiplied by the smooth cross sections. The
+ * selected bands are cached (one cache entry per thread) and are reused as 
+ * long as the particle, the history, generation and collision number of the
+ * neutron and the energy interval that it is in do not change - every cross
+ * section lookup made on the same track segment will see the same band. The
+ * sampled cross sections are also cached so that repeated lookups at the 
+ * same energy do not have to be evaluated again. The transport code must 
+ * call startNewParticle before a new particle is transported so that 
+ * secondary particles of the same generation never share a band.
+ */
+class UnresolvedResonanceProbabilityTable
+{
+
+public:
+
+  //! Constructor
+  UnresolvedResonanceProbabilityTable(
+			 const Teuchos::ArrayView<const double>& energy_grid,
+			 const Teuchos::ArrayView<const double>& band_cdfs,
+			 const Teuchos::ArrayView<const double>& elastic_bands,
+			 const Teuchos::ArrayView<const double>& fission_bands,
+			 const Teuchos::ArrayView<const double>& capture_bands,
+			 const unsigned number_of_bands,
+			 const bool use_log_interpolation,
+			 const bool bands_are_factors );
+
+  //! Destructor
+  ~UnresolvedResonanceProbabilityTable()
+  { /* ... */ }
+
+  //! Start the transport of a new particle on the calling thread
+  static void startNewParticle();
+
+  //! Check if the energy is in the unresolved resonance range
+  bool isEnergyInRange( const double energy ) const;
+
+  //! Return the minimum energy of the unresolved resonance range
+  double getMinEnergy() const;
+
+  //! Return the maximum energy of the unresolved resonance range
+  double getMaxEnergy() const;
+
+  //! Return the number of bands in every table
+  unsigned getNumberOfBands() const;
+
+  //! Check if the band values are factors of the smooth cross sections
+  bool areBandsFactors() const;
+
+  //! Sample the cross sections seen by a neutron
+  void sampleCrossSections( const NeutronState& neutron,
+			    const double smooth_elastic_cross_section,
+			    const double smooth_fission_cross_section,
+			    const double smooth_capture_cross_section,
+			    double& elastic_cross_section,
+			    double& fission_cross_section,
+			    double& capture_cross_section ) const;
+
+  //! Return the cross sections that have been cached for a neutron
+  bool getCachedCrossSections( const NeutronState& neutron,
+			       double& smooth_elastic_cross_section,
+			       double& smooth_fission_cross_section,
+			       double& smooth_capture_cross_section,
+			       double& elastic_cross_section,
+			       double& fission_cross_section,
+			       double& capture_cross_section ) const;
+
+  //! Evaluate the cross sections of the band selected by a random number
+  void evaluateCrossSections( const double energy,
+			      const double random_number,
+			      const double smooth_elastic_cross_section,
+			      const double smooth_fission_cross_section,
+			      const double smooth_capture_cross_section,
+			      double& elastic_cross_section,
+			      double& fission_cross_section,
+			      double& capture_cross_section ) const;
+
+private:
+
+  // The band selection cache of a thread
+  struct BandCache
+  {
+    bool valid;
+    unsigned long long particle_number;
+    ParticleState::historyNumberType history_number;
+    ParticleState::generationNumberType generation_number;
+    ParticleState::collisionNumberType collision_number;
+    unsigned energy_interval;
+    unsigned lower_band;
+    unsigned upper_band;
+    double energy;
+    double smooth_elastic_cross_section;
+    double smooth_fission_cross_section;
+    double smooth_capture_cross_section;
+    double elastic_cross_section;
+    double fission_cross_section;
+    double capture_cross_section;
+  };
+
+  // Check if a band selection cache belongs to the neutron
+  bool isCacheCurrent( const BandCache& cache,
+		       const unsigned thread_id,
+		       const NeutronState& neutron ) const;
+
+  // Find the energy interval that contains an energy
+  unsigned findEnergyInterval( const double energy ) const;
+
+  // Find the band that is selected by a random number
+  unsigned findBand( const unsigned energy_index,
+		     const double random_number ) const;
+
+  // Evaluate the cross sections of the selected bands
+  void evaluateBands( const double energy,
+		      const unsigned energy_interval,
+		      const unsigned lower_band,
+		      const unsigned upper_band,
+		      const double smooth_elastic_cross_section,
+		      const double smooth_fission_cross_section,
+		      const double smooth_capture_cross_section,
+		      double& elastic_cross_section,
+		      double& fission_cross_section,
+		      double& capture_cross_section ) const;
+
+  // Interpolate a band value between the bounding tables
+  double interpolate( const double energy,
+		      const unsigned energy_interval,
+		      const double lower_value,
+		      const double upper_value ) const;
+
+  // The incoming energy grid
+  Teuchos::Array<double> d_energy_grid;
+
+  // The band cdfs (indexed by incoming energy, band)
+  Teuchos::Array<double> d_band_cdfs;
+
+  // The elastic bands (indexed by incoming energy, band)
+  Teuchos::Array<double> d_elastic_bands;
+
+  // The fission bands (indexed by incoming energy, band)
+  Teuchos::Array<double> d_fission_bands;
+
+  // The capture bands (indexed by incoming energy, band)
+  Teuchos::Array<double> d_capture_bands;
+
+  // The number of bands in every table
+  unsigned d_number_of_bands;
+
+  // Use log-log interpolation between tables (lin-lin otherwise)
+  bool d_use_log_interpolation;
+
+  // The band values are factors of the smooth cross sections
+  bool d_bands_are_factors;
+
+  // The band selection caches (one per thread)
+  mutable Teuchos::Array<BandCache> d_band_caches;
+
+  // The number of particles started on every thread
+  static Teuchos::Array<unsigned long long> particle_numbers;
+};
+
+// Check if the energy is in the unresolved resonance range
+inline bool UnresolvedResonanceProbabilityTable::isEnergyInRange(
+					           const double energy ) const
+{
+  return energy >= d_energy_grid.front() && energy <= d_energy_grid.back();
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_UNRESOLVED_RESONANCE_PROBABILITY_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_UnresolvedResonanceProbabilityTable.hpp
+//---------------------------------------------------------------------------//
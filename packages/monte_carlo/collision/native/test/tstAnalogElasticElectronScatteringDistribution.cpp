@@ -16,6 +16,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_AnalogElasticElectronScatteringDistribution.hpp"
+#include "MonteCarlo_TwoDDistributionHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
@@ -268,6 +269,91 @@ TEUCHOS_UNIT_TEST( AnalogElasticElectronScatteringDistribution,
   TEST_FLOATING_EQUALITY( cdf_value, 1.0, 1e-15 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the tabulated cutoff cdf values match the correlated cdf 
+// evaluated on the fly (at and between the energy grid points)
+TEUCHOS_UNIT_TEST( AnalogElasticElectronScatteringDistribution, 
+                   evaluateCutoffCrossSectionRatio_tabulated )
+{
+  Teuchos::Array<double> energies( 7 );
+  energies[0] = 1.0e-3; // grid point
+  energies[1] = 2.5e-3;
+  energies[2] = 3.7e-1;
+  energies[3] = 5.0e+3;
+  energies[4] = 1.0e+5; // grid point
+  energies[5] = 1.0e-6; // below the grid
+  energies[6] = 2.0e+5; // above the grid
+
+  Teuchos::Array<double> cutoff_angles( 3 );
+  cutoff_angles[0] = angle_cutoff;
+  cutoff_angles[1] = 0.02;
+  cutoff_angles[2] = 1.0;
+
+  for( unsigned j = 0; j < cutoff_angles.size(); ++j )
+  {
+    // Angle cosine is the independent variable
+    test_elastic_distribution.reset(
+		new MonteCarlo::AnalogElasticElectronScatteringDistribution(
+                            elastic_scattering_distribution,
+                            cutoff_angles[j],
+                            false ) );
+
+    for( unsigned i = 0; i < energies.size(); ++i )
+    {
+      double cutoff_cdf = MonteCarlo::evaluateTwoDDistributionCorrelatedCDF(
+                                            energies[i],
+                                            1.0 - cutoff_angles[j],
+                                            elastic_scattering_distribution );
+      double max_cdf = MonteCarlo::evaluateTwoDDistributionCorrelatedCDF(
+                                            energies[i],
+                                            1.0 - 1.0e-6,
+                                            elastic_scattering_distribution );
+
+      TEST_FLOATING_EQUALITY( 
+           test_elastic_distribution->evaluateCutoffCrossSectionRatio( 
+                                                               energies[i] ),
+           cutoff_cdf/max_cdf,
+           1e-12 );
+
+      TEST_FLOATING_EQUALITY( 
+           test_elastic_distribution->evaluateCutoffCrossSectionRatio( 
+                                                               energies[i] ),
+           test_elastic_distribution->evaluateCDF( energies[i], 
+                                                   cutoff_angles[j] )/
+           test_elastic_distribution->evaluateCDF( energies[i], 1.0e-6 ),
+           1e-12 );
+    }
+    
+    // Angle is the independent variable (the ratio is 1 - cutoff cdf)
+    test_elastic_distribution.reset(
+		new MonteCarlo::AnalogElasticElectronScatteringDistribution(
+                            elastic_scattering_distribution,
+                            cutoff_angles[j],
+                            true ) );
+
+    for( unsigned i = 0; i < energies.size(); ++i )
+    {
+      double cutoff_cdf = MonteCarlo::evaluateTwoDDistributionCorrelatedCDF(
+                                            energies[i],
+                                            cutoff_angles[j],
+                                            elastic_scattering_distribution );
+
+      TEST_FLOATING_EQUALITY( 
+           1.0 - test_elastic_distribution->evaluateCutoffCrossSectionRatio( 
+                                                               energies[i] ),
+           cutoff_cdf,
+           1e-12 );
+
+      TEST_FLOATING_EQUALITY( 
+           1.0 - test_elastic_distribution->evaluateCutoffCrossSectionRatio( 
+                                                               energies[i] ),
+           test_elastic_distribution->evaluateCDF( energies[i], 
+                                                   cutoff_angles[j] ),
+           1e-12 );
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the energy can be returned
 TEUCHOS_UNIT_TEST( AnalogElasticElectronScatteringDistribution, 
@@ -320,6 +406,66 @@ TEUCHOS_UNIT_TEST( AnalogElasticElectronScatteringDistribution,
 }
 
 
+//---------------------------------------------------------------------------//
+// Check that the samples match the samples of the correlated distribution
+// scaled with the cutoff cdf evaluated on the fly
+TEUCHOS_UNIT_TEST( AnalogElasticElectronScatteringDistribution, 
+                   sampleAndRecordTrialsImpl_tabulated )
+{
+  Teuchos::Array<double> energies( 4 );
+  energies[0] = 1.0e-3; // grid point
+  energies[1] = 2.5e-3;
+  energies[2] = 5.0e+3;
+  energies[3] = 1.0e+5; // grid point
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 1.0 - 1e-15;
+
+  double cutoff_angle = 0.02;
+
+  test_elastic_distribution.reset(
+		new MonteCarlo::AnalogElasticElectronScatteringDistribution(
+                            elastic_scattering_distribution,
+                            cutoff_angle,
+                            false ) );
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+  {
+    double cutoff_cdf = MonteCarlo::evaluateTwoDDistributionCorrelatedCDF(
+                                            energies[i],
+                                            1.0 - cutoff_angle,
+                                            elastic_scattering_distribution );
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+    
+    for( unsigned j = 0; j < fake_stream.size(); ++j )
+    {
+      double scattering_angle_cosine;
+      unsigned trials = 0;
+
+      test_elastic_distribution->sampleAndRecordTrialsImpl( 
+                                                       energies[i],
+                                                       scattering_angle_cosine,
+                                                       trials );
+
+      double expected_angle_cosine = 
+        MonteCarlo::sampleTwoDDistributionCorrelatedWithRandomNumber(
+                                            energies[i],
+                                            elastic_scattering_distribution,
+                                            cutoff_cdf*fake_stream[j] );
+
+      TEST_FLOATING_EQUALITY( scattering_angle_cosine, 
+                              expected_angle_cosine,
+                              1e-12 );
+      TEST_ASSERT( scattering_angle_cosine <= 1.0 - cutoff_angle + 1e-12 );
+    }
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check sample can be evaluated
 TEUCHOS_UNIT_TEST( AnalogElasticElectronScatteringDistribution, 
@@ -37,6 +37,9 @@ Teuchos::RCP<MonteCarlo::DopplerBroadenedPhotonEnergyDistribution>
 Teuchos::RCP<MonteCarlo::DopplerBroadenedPhotonEnergyDistribution> 
   full_distribution;
 
+Teuchos::RCP<MonteCarlo::DopplerBroadenedPhotonEnergyDistribution> 
+  half_inverse_cdf_distribution;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -95,6 +98,69 @@ TEUCHOS_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
   TEST_EQUALITY_CONST( shell_of_interaction, MonteCarlo::K_SUBSHELL );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled using inverse cdf sampling
+TEUCHOS_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
+		   sample_half_inverse_cdf )
+{
+  double incoming_energy = 20.0, scattering_angle_cosine = 0.0;
+  double outgoing_energy;
+  MonteCarlo::SubshellType shell_of_interaction;
+
+  // Set up the random number stream (all subshells are accessible)
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.005; // select first shell for collision
+  fake_stream[1] = 6.427713151861e-01; // select pz = 0.291894102792
+  fake_stream[2] = 0.25; // select energy loss
+  fake_stream[3] = 0.005; // select first shell for collision
+  
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  half_inverse_cdf_distribution->sample( incoming_energy,
+					 scattering_angle_cosine,
+					 outgoing_energy,
+					 shell_of_interaction );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+  
+  TEST_FLOATING_EQUALITY( outgoing_energy, 0.352804013048420073, 1e-12 );
+  TEST_EQUALITY_CONST( shell_of_interaction, MonteCarlo::K_SUBSHELL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that inverse cdf sampling does not reject inaccessible subshells
+TEUCHOS_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
+		   sampleAndRecordTrials_half_inverse_cdf )
+{
+  // The K subshell is not accessible below 88 keV
+  double incoming_energy = 0.05, scattering_angle_cosine = 0.0;
+  double outgoing_energy;
+  MonteCarlo::SubshellType shell_of_interaction;
+  unsigned trials = 0;
+
+  // Set up the random number stream
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.005; // select first accessible shell for collision
+  fake_stream[1] = 0.5; // select pz
+  fake_stream[2] = 0.75; // keep pz positive
+  
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  half_inverse_cdf_distribution->sampleAndRecordTrials( 
+                                                     incoming_energy,
+						     scattering_angle_cosine,
+						     outgoing_energy,
+						     shell_of_interaction,
+						     trials );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  TEST_EQUALITY_CONST( trials, 1 );
+  TEST_ASSERT( outgoing_energy > 0.0 );
+  TEST_ASSERT( outgoing_energy < incoming_energy );
+  TEST_ASSERT( shell_of_interaction != MonteCarlo::K_SUBSHELL );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
@@ -215,6 +281,15 @@ int main( int argc, char** argv )
 			  converter,
 			  half_compton_profiles ) );
 
+  half_inverse_cdf_distribution.reset(
+      new MonteCarlo::CoupledCompleteDopplerBroadenedPhotonEnergyDistribution( 
+			  xss_data_extractor->extractSubshellBindingEnergies(),
+			  xss_data_extractor->extractSubshellOccupancies(),
+			  subshell_order,
+			  converter,
+			  half_compton_profiles,
+			  true ) );
+
   full_distribution.reset(
       new MonteCarlo::CoupledCompleteDopplerBroadenedPhotonEnergyDistribution( 
 			  xss_data_extractor->extractSubshellBindingEnergies(),
@@ -119,6 +119,79 @@ TEUCHOS_UNIT_TEST( CrossSectionXMLProperties,
   TEST_EQUALITY_CONST( temperature, 2.53010e-08 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the nuclide tables that bracket a temperature can be extracted
+TEUCHOS_UNIT_TEST( CrossSectionXMLProperties,
+		   extractNuclideBracketingTemperatureTableAliases )
+{
+  // Create tables of the nuclide at other temperatures
+  Teuchos::ParameterList table_info( *cross_section_info );
+
+  Teuchos::ParameterList hot_table_info = 
+    table_info.sublist( "H-1_293.6K" );
+
+  hot_table_info.set( MonteCarlo::CrossSectionsXMLProperties::temperature_prop,
+		      5.17050e-08 );
+
+  table_info.set( "H-1_600K", hot_table_info );
+
+  hot_table_info.set( MonteCarlo::CrossSectionsXMLProperties::temperature_prop,
+		      1.03410e-07 );
+
+  table_info.set( "H-1_1200K", hot_table_info );
+
+  Teuchos::Array<std::string> table_aliases;
+
+  // Between two tables
+  MonteCarlo::CrossSectionsXMLProperties::extractNuclideBracketingTemperatureTableAliases(
+						  cross_sections_xml_directory,
+						  "H-1_293.6K",
+						  table_info,
+						  4.0e-08,
+						  table_aliases );
+
+  TEST_EQUALITY_CONST( table_aliases.size(), 2 );
+  TEST_EQUALITY_CONST( table_aliases[0], "H-1_293.6K" );
+  TEST_EQUALITY_CONST( table_aliases[1], "H-1_600K" );
+
+  // The tables that are already present are not added again
+  MonteCarlo::CrossSectionsXMLProperties::extractNuclideBracketingTemperatureTableAliases(
+						  cross_sections_xml_directory,
+						  "H-1_293.6K",
+						  table_info,
+						  8.0e-08,
+						  table_aliases );
+
+  TEST_EQUALITY_CONST( table_aliases.size(), 3 );
+  TEST_EQUALITY_CONST( table_aliases[2], "H-1_1200K" );
+
+  // At the temperature of a table
+  table_aliases.clear();
+
+  MonteCarlo::CrossSectionsXMLProperties::extractNuclideBracketingTemperatureTableAliases(
+						  cross_sections_xml_directory,
+						  "H-1_293.6K",
+						  table_info,
+						  5.17050e-08,
+						  table_aliases );
+
+  TEST_EQUALITY_CONST( table_aliases.size(), 1 );
+  TEST_EQUALITY_CONST( table_aliases[0], "H-1_600K" );
+
+  // Above the highest table temperature
+  table_aliases.clear();
+
+  MonteCarlo::CrossSectionsXMLProperties::extractNuclideBracketingTemperatureTableAliases(
+						  cross_sections_xml_directory,
+						  "H-1_293.6K",
+						  table_info,
+						  2.0e-07,
+						  table_aliases );
+
+  TEST_EQUALITY_CONST( table_aliases.size(), 1 );
+  TEST_EQUALITY_CONST( table_aliases[0], "H-1_1200K" );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
@@ -402,6 +402,99 @@ TEUCHOS_UNIT_TEST( Electroatom, getReactionCrossSection )
   TEST_EQUALITY_CONST( cross_section, 0.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the soft reaction types can be returned
+TEUCHOS_UNIT_TEST( Electroatom, getSoftReactionTypes )
+{
+  const boost::unordered_set<MonteCarlo::ElectroatomicReactionType>&
+    soft_types = MonteCarlo::Electroatom::getSoftReactionTypes();
+
+  TEST_EQUALITY_CONST( soft_types.size(), 2 );
+  TEST_ASSERT( soft_types.count( 
+	       MonteCarlo::SCREENED_RUTHERFORD_ELASTIC_ELECTROATOMIC_REACTION ) );
+  TEST_ASSERT( soft_types.count( 
+	       MonteCarlo::ATOMIC_EXCITATION_ELECTROATOMIC_REACTION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hard cross section can be returned
+TEUCHOS_UNIT_TEST( Electroatom, getHardCrossSection_ace )
+{
+  double cross_section = 
+    ace_electroatom->getHardCrossSection( 2.000000000000E-03 );
+
+  TEST_FLOATING_EQUALITY( cross_section, 9.258661418255E+03, 1e-9 );
+
+  cross_section = 
+    ace_electroatom->getHardCrossSection( 4.000000000000E-04 );
+  
+  TEST_FLOATING_EQUALITY( cross_section, 8.914234996439E+03, 1e-9 );
+  
+  cross_section = 
+    ace_electroatom->getHardCrossSection( 9.000000000000E-05 );
+  
+  TEST_FLOATING_EQUALITY( cross_section, 7.249970966838E+03, 1e-9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the soft stopping cross section can be returned
+TEUCHOS_UNIT_TEST( Electroatom, getSoftStoppingCrossSection_ace )
+{
+  const MonteCarlo::ElectroatomicReaction& excitation_reaction = 
+    *ace_electroatom->getCore().getScatteringReactions().find( 
+                MonteCarlo::ATOMIC_EXCITATION_ELECTROATOMIC_REACTION )->second;
+
+  double stopping_cross_section = 
+    ace_electroatom->getSoftStoppingCrossSection( 2.000000000000E-03 );
+
+  TEST_ASSERT( stopping_cross_section > 0.0 );
+  TEST_FLOATING_EQUALITY( 
+         stopping_cross_section, 
+         excitation_reaction.getCrossSection( 2.000000000000E-03 )*
+         excitation_reaction.getMeanEnergyLoss( 2.000000000000E-03 ),
+         1e-12 );
+
+  stopping_cross_section = 
+    ace_electroatom->getSoftStoppingCrossSection( 9.000000000000E-05 );
+
+  TEST_ASSERT( stopping_cross_section > 0.0 );
+  TEST_FLOATING_EQUALITY( 
+         stopping_cross_section, 
+         excitation_reaction.getCrossSection( 9.000000000000E-05 )*
+         excitation_reaction.getMeanEnergyLoss( 9.000000000000E-05 ),
+         1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the soft transport cross section can be returned
+TEUCHOS_UNIT_TEST( Electroatom, getSoftTransportCrossSection_ace )
+{
+  // Atomic excitation does not deflect the electron
+  double cross_section = 
+    ace_electroatom->getSoftTransportCrossSection( 2.000000000000E-03 );
+
+  TEST_EQUALITY_CONST( cross_section, 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a hard collision with the atom can be modeled
+TEUCHOS_UNIT_TEST( Electroatom, collideHard )
+{
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 2.000000000000E-03 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+  electron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Only bremsstrahlung can be sampled
+  ace_electroatom->collideHard( electron, bank );
+  
+  TEST_ASSERT( !electron.isGone() );
+  TEST_EQUALITY_CONST( electron.getWeight(), 1.0 );
+  TEST_EQUALITY_CONST( electron.getCollisionNumber(), 1 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an analogue collision with the atom can be modeled
 TEUCHOS_UNIT_TEST( Electroatom, collideAnalogue )
@@ -194,6 +194,97 @@ TEUCHOS_UNIT_TEST( ElectronMaterial, getMacroscopicReactionCrossSection )
                           1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the mean excitation energy can be returned
+TEUCHOS_UNIT_TEST( ElectronMaterial, getMeanExcitationEnergy )
+{
+  TEST_FLOATING_EQUALITY( material->getMeanExcitationEnergy(),
+                          8.257738039121631e-04,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the collisional stopping power can be returned
+TEUCHOS_UNIT_TEST( ElectronMaterial, getCollisionalStoppingPower )
+{
+  double stopping_power = material->getCollisionalStoppingPower( 1.0 );
+
+  TEST_FLOATING_EQUALITY( stopping_power, 1.0058386536086676, 1e-9 );
+
+  // The Bethe formula is not valid near the mean excitation energy
+  stopping_power = material->getCollisionalStoppingPower( 1e-4 );
+
+  TEST_EQUALITY_CONST( stopping_power, 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the radiative stopping power can be returned
+TEUCHOS_UNIT_TEST( ElectronMaterial, getRadiativeStoppingPower )
+{
+  double stopping_power = material->getRadiativeStoppingPower( 1.0 );
+
+  TEST_ASSERT( stopping_power > 0.0 );
+  TEST_ASSERT( stopping_power < 
+               material->getMacroscopicReactionCrossSection( 
+                    1.0, MonteCarlo::BREMSSTRAHLUNG_ELECTROATOMIC_REACTION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the thick-target bremsstrahlung yield can be tabulated
+TEUCHOS_UNIT_TEST( ElectronMaterial, tabulateThickTargetBremsstrahlungYield )
+{
+  TEST_EQUALITY_CONST( material->getThickTargetBremsstrahlungYield( 1.0 ),
+                       0.0 );
+
+  material->tabulateThickTargetBremsstrahlungYield( 1e-2, 10.0 );
+
+  TEST_EQUALITY_CONST( material->getThickTargetBremsstrahlungYield( 1e-2 ),
+                       0.0 );
+  TEST_ASSERT( material->getThickTargetBremsstrahlungYield( 1.0 ) > 0.0 );
+  TEST_ASSERT( material->getThickTargetBremsstrahlungYield( 10.0 ) >
+               material->getThickTargetBremsstrahlungYield( 1.0 ) );
+  TEST_EQUALITY( material->getThickTargetBremsstrahlungYield( 20.0 ),
+                 material->getThickTargetBremsstrahlungYield( 10.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that thick-target bremsstrahlung photons can be emitted
+TEUCHOS_UNIT_TEST( ElectronMaterial, emitThickTargetBremsstrahlung )
+{
+  material->tabulateThickTargetBremsstrahlungYield( 1e-2, 10.0 );
+  
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1e-2 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+  electron.setCell( 4 );
+
+  // No photons are emitted at the min tabulated energy
+  material->emitThickTargetBremsstrahlung( electron, bank );
+
+  TEST_EQUALITY_CONST( bank.size(), 0 );
+
+  electron.setEnergy( 10.0 );
+
+  unsigned min_number_of_photons = (unsigned)
+    material->getThickTargetBremsstrahlungYield( 10.0 );
+
+  material->emitThickTargetBremsstrahlung( electron, bank );
+
+  // The electron is never modified
+  TEST_EQUALITY_CONST( electron.getEnergy(), 10.0 );
+  TEST_ASSERT( bank.size() >= min_number_of_photons );
+
+  while( bank.size() > 0 )
+  {
+    TEST_EQUALITY_CONST( bank.top().getParticleType(), MonteCarlo::PHOTON );
+    TEST_ASSERT( bank.top().getEnergy() <= 10.0 );
+
+    bank.pop();
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a electron can collide with the material
 TEUCHOS_UNIT_TEST( ElectronMaterial, collideAnalogue )
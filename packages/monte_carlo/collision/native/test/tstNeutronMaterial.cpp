@@ -17,6 +17,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_NeutronMaterial.hpp"
+#include "MonteCarlo_CrossSectionsXMLProperties.hpp"
 
 //---------------------------------------------------------------------------//
 // Testing Variables.
@@ -25,6 +26,9 @@ std::string test_cross_sections_xml_directory;
 
 Teuchos::RCP<MonteCarlo::NeutronMaterial> material;
 
+MonteCarlo::NeutronMaterial::NuclideTemperatureTableMap 
+nuclide_temperature_table_map;
+
 //---------------------------------------------------------------------------//
 // Testing Functions.
 //---------------------------------------------------------------------------//
@@ -67,6 +71,58 @@ void initializeSolidHydrogen()
 					       nuclide_names ) );
 }
 
+void initializeHydrogenTemperatureTables()
+{
+  // Assign the name of the cross_sections.xml file with path
+  std::string cross_section_xml_file = test_cross_sections_xml_directory;
+  cross_section_xml_file += "/cross_sections.xml";
+
+  // Read in the xml file storing the cross section table information 
+  Teuchos::ParameterList cross_section_table_info;
+  Teuchos::updateParametersFromXmlFile( 
+			         cross_section_xml_file,
+			         Teuchos::inoutArg(cross_section_table_info) );
+
+  // Create a second base table (same data, higher temperature)
+  Teuchos::ParameterList hot_table_info = 
+    cross_section_table_info.sublist( "H-1_293.6K" );
+  
+  hot_table_info.set( MonteCarlo::CrossSectionsXMLProperties::temperature_prop,
+		      1.03410e-07 );
+
+  cross_section_table_info.set( "H-1_1200K", hot_table_info );
+
+  Teuchos::Array<std::string> table_aliases;
+
+  MonteCarlo::CrossSectionsXMLProperties::extractNuclideTemperatureTableAliases(
+					     test_cross_sections_xml_directory,
+					     "H-1_293.6K",
+					     cross_section_table_info,
+					     table_aliases );
+  
+  boost::unordered_set<std::string> nuclide_aliases( table_aliases.begin(),
+						     table_aliases.end() );
+
+  MonteCarlo::NuclideFactory nuclide_factory(test_cross_sections_xml_directory,
+					     cross_section_table_info,
+					     nuclide_aliases,
+					     false,
+					     false );
+
+  boost::unordered_map<std::string,Teuchos::RCP<MonteCarlo::Nuclide> > 
+    nuclide_map;
+
+  nuclide_factory.createNuclideMap( nuclide_map );
+
+  Teuchos::Array<Teuchos::RCP<MonteCarlo::Nuclide> >& tables = 
+    nuclide_temperature_table_map["H-1"];
+
+  tables.clear();
+
+  for( unsigned i = 0; i < table_aliases.size(); ++i )
+    tables.push_back( nuclide_map[table_aliases[i]] );
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -236,6 +292,71 @@ TEUCHOS_UNIT_TEST( NeutronMaterial_hydrogen, collideSurvivalBias )
   std::cout << neutron << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+// Check that a material can be constructed at an arbitrary temperature
+TEUCHOS_UNIT_TEST( NeutronMaterial_hydrogen, constructor_temperature )
+{
+  initializeHydrogenTemperatureTables();
+
+  TEST_EQUALITY_CONST( nuclide_temperature_table_map["H-1"].size(), 2 );
+
+  Teuchos::Array<double> nuclide_fractions( 1 );
+  Teuchos::Array<std::string> nuclide_names( 1 );
+
+  nuclide_fractions[0] = -1.0; // weight fraction
+  nuclide_names[0] = "H-1";
+
+  // Between the base table temperatures
+  Teuchos::RCP<MonteCarlo::NeutronMaterial> interpolated_material( 
+		 new MonteCarlo::NeutronMaterial( 1,
+						  -1.0, // mass density (g/cm^3)
+						  5.17040e-08,
+						  nuclide_temperature_table_map,
+						  nuclide_fractions,
+						  nuclide_names ) );
+
+  TEST_EQUALITY_CONST( interpolated_material->getNumberOfNuclideTables(), 2 );
+  TEST_FLOATING_EQUALITY( interpolated_material->getNumberDensity(), 
+			  0.5975385703365, 
+			  1e-13 );
+
+  // Both base tables have the same data
+  double cross_section = 
+    interpolated_material->getMacroscopicTotalCrossSection( 1.0e-11 );
+
+  TEST_FLOATING_EQUALITY( cross_section, 703.45055504218, 1e-13 );
+
+  cross_section = 
+    interpolated_material->getMacroscopicAbsorptionCrossSection( 2.0e1 );
+
+  TEST_FLOATING_EQUALITY( cross_section, 1.6267115171099e-5, 1e-13 );
+
+  // At a base table temperature
+  interpolated_material.reset( 
+		 new MonteCarlo::NeutronMaterial( 1,
+						  -1.0, // mass density (g/cm^3)
+						  2.53010e-08,
+						  nuclide_temperature_table_map,
+						  nuclide_fractions,
+						  nuclide_names ) );
+
+  TEST_EQUALITY_CONST( interpolated_material->getNumberOfNuclideTables(), 1 );
+
+  cross_section = 
+    interpolated_material->getMacroscopicTotalCrossSection( 1.0e-11 );
+
+  TEST_FLOATING_EQUALITY( cross_section, 703.45055504218, 1e-13 );
+
+  // Outside of the base table temperatures
+  TEST_THROW( MonteCarlo::NeutronMaterial( 1,
+					   -1.0,
+					   2.0e-7,
+					   nuclide_temperature_table_map,
+					   nuclide_fractions,
+					   nuclide_names ),
+	      std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_NuclearReaction.hpp"
+#include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
 
@@ -157,6 +158,50 @@ TEUCHOS_UNIT_TEST( NuclearReaction_elastic, getCrossSection )
   TEST_EQUALITY_CONST( cross_section, 4.827462e-1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cross section can be stored in single precision
+TEUCHOS_UNIT_TEST( NuclearReaction_elastic, getCrossSection_compact )
+{
+  TEST_ASSERT( !nuclear_reaction->hasCompactCrossSection() );
+  
+  MonteCarlo::SimulationNeutronProperties::setCompactCrossSectionStorageModeOn();
+
+  Teuchos::RCP<MonteCarlo::NuclearReaction> double_reaction = 
+    nuclear_reaction;
+
+  initializeElasticReaction( nuclear_reaction );
+
+  Teuchos::RCP<MonteCarlo::NuclearReaction> compact_reaction = 
+    nuclear_reaction;
+
+  nuclear_reaction = double_reaction;
+  
+  MonteCarlo::SimulationNeutronProperties::setCompactCrossSectionStorageModeOff();
+
+  TEST_ASSERT( compact_reaction->hasCompactCrossSection() );
+  
+  double cross_section = 
+    compact_reaction->getCrossSection( 1.00000000000e-11 );
+  
+  TEST_FLOATING_EQUALITY( cross_section, 1.16054600000e+03, 1e-7 );
+
+  cross_section = compact_reaction->getCrossSection( 1.015625e-11 );
+  
+  TEST_FLOATING_EQUALITY( cross_section, 1.151689e3, 1e-7 );
+
+  cross_section = compact_reaction->getCrossSection( 1.90e1 );
+  
+  TEST_FLOATING_EQUALITY( cross_section, 5.087783e-1, 1e-7 );
+
+  cross_section = compact_reaction->getCrossSection( 2.0e1 );
+  
+  TEST_FLOATING_EQUALITY( cross_section, 4.827462e-1, 1e-7 );
+
+  cross_section = compact_reaction->getCrossSection( 2.1e1 );
+  
+  TEST_EQUALITY_CONST( cross_section, 0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
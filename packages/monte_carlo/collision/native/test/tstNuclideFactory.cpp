@@ -17,14 +17,19 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
+#include "MonteCarlo_CrossSectionsXMLProperties.hpp"
 
 //---------------------------------------------------------------------------//
 // Testing Variables.
 //---------------------------------------------------------------------------//
 std::string test_cross_sections_xml_directory;
+std::string test_sab_ace_file_relative_path;
+std::string test_sab_ace_table_name;
 
 Teuchos::RCP<MonteCarlo::NuclideFactory> nuclide_factory;
 
+Teuchos::RCP<MonteCarlo::NuclideFactory> bound_nuclide_factory;
+
 //---------------------------------------------------------------------------//
 // Testing Functions.
 //---------------------------------------------------------------------------//
@@ -51,6 +56,34 @@ void initializeNuclideFactory()
 					     nuclide_aliases,
 					     false,
 					     false ) );
+
+  // Create a bound hydrogen entry that uses the S(alpha,beta) table
+  Teuchos::ParameterList& bound_table_info = 
+    cross_section_table_info.sublist( "H-1_293.6K_lwtr" );
+
+  bound_table_info.setParameters( 
+			    cross_section_table_info.sublist( "H-1_293.6K" ) );
+  bound_table_info.set( 
+	       MonteCarlo::CrossSectionsXMLProperties::s_alpha_beta_file_path_prop,
+	       test_sab_ace_file_relative_path );
+  bound_table_info.set( 
+	       MonteCarlo::CrossSectionsXMLProperties::s_alpha_beta_file_type_prop,
+	       MonteCarlo::CrossSectionsXMLProperties::ace_file );
+  bound_table_info.set( 
+	      MonteCarlo::CrossSectionsXMLProperties::s_alpha_beta_table_name_prop,
+	      test_sab_ace_table_name );
+  bound_table_info.set( 
+	 MonteCarlo::CrossSectionsXMLProperties::s_alpha_beta_file_start_line_prop,
+	 1 );
+
+  nuclide_aliases.insert( "H-1_293.6K_lwtr" );
+
+  bound_nuclide_factory.reset( new MonteCarlo::NuclideFactory( 
+					     test_cross_sections_xml_directory,
+					     cross_section_table_info,
+					     nuclide_aliases,
+					     false,
+					     false ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -70,6 +103,32 @@ TEUCHOS_UNIT_TEST( NuclideFactory, createNuclideMap )
   TEST_ASSERT( !nuclide_map["H-1_300K"].is_null() );
   TEST_ASSERT( nuclide_map.count( "H-1_900K" ) );
   TEST_ASSERT( !nuclide_map["H-1_900K"].is_null() );
+  TEST_ASSERT( !nuclide_map["H-1_293.6K"]->hasSAlphaBeta() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the S(alpha,beta) data of a bound nuclide is attached
+TEUCHOS_UNIT_TEST( NuclideFactory, createNuclideMap_s_alpha_beta )
+{
+  boost::unordered_map<std::string,Teuchos::RCP<MonteCarlo::Nuclide> > nuclide_map;
+
+  bound_nuclide_factory->createNuclideMap( nuclide_map );
+
+  TEST_EQUALITY_CONST( nuclide_map.size(), 4 );
+  TEST_ASSERT( nuclide_map.count( "H-1_293.6K_lwtr" ) );
+  TEST_ASSERT( !nuclide_map["H-1_293.6K_lwtr"].is_null() );
+  TEST_ASSERT( nuclide_map["H-1_293.6K_lwtr"]->hasSAlphaBeta() );
+  TEST_ASSERT( !nuclide_map["H-1_293.6K"]->hasSAlphaBeta() );
+  TEST_ASSERT( !nuclide_map["H-1_300K"]->hasSAlphaBeta() );
+  TEST_ASSERT( !nuclide_map["H-1_900K"]->hasSAlphaBeta() );
+
+  // Below the S(alpha,beta) energy range the bound elastic cross section
+  // differs from the free gas elastic cross section
+  TEST_INEQUALITY( 
+	       nuclide_map["H-1_293.6K_lwtr"]->getReactionCrossSection( 
+				      1e-8, MonteCarlo::N__N_ELASTIC_REACTION ),
+	       nuclide_map["H-1_293.6K"]->getReactionCrossSection( 
+				      1e-8, MonteCarlo::N__N_ELASTIC_REACTION ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -83,6 +142,15 @@ int main( int argc, char** argv )
 		 &test_cross_sections_xml_directory,
 		 "Test cross_sections.xml file name" );
 
+  clp.setOption( "test_sab_ace_file_relative_path",
+		 &test_sab_ace_file_relative_path,
+		 "Test S(alpha,beta) ACE file path relative to the "
+		 "cross_sections.xml directory" );
+
+  clp.setOption( "test_sab_ace_table",
+		 &test_sab_ace_table_name,
+		 "Test S(alpha,beta) ACE table name" );
+
   const Teuchos::RCP<Teuchos::FancyOStream> out = 
     Teuchos::VerboseObjectBase::getDefaultOStream();
 
@@ -12,6 +12,7 @@
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
 #include <Teuchos_XMLParameterListCoreHelpers.hpp>
 #include <Teuchos_VerboseObject.hpp>
 
@@ -59,6 +60,22 @@ TEUCHOS_UNIT_TEST( PhotonMaterial, getMacroscopicTotalCrossSection )
   TEST_FLOATING_EQUALITY( cross_section, 0.11970087585747362, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the macroscopic total cross sections can be returned
+TEUCHOS_UNIT_TEST( PhotonMaterial, getMacroscopicTotalCrossSections )
+{
+  Teuchos::Array<double> energies( 2 );
+  energies[0] = exp( -1.381551055796E+01 );
+  energies[1] = exp( 1.151292546497E+01 );
+
+  Teuchos::Array<double> cross_sections( 2 );
+
+  material->getMacroscopicTotalCrossSections( energies(), cross_sections() );
+
+  TEST_FLOATING_EQUALITY( cross_sections[0], 1.823831998305667e-05, 1e-12 );
+  TEST_FLOATING_EQUALITY( cross_sections[1], 0.11970087585747362, 1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the macroscopic absorption cross section can be returned
 TEUCHOS_UNIT_TEST( PhotonMaterial, getMacroscopicAbsorptionCrossSection )
@@ -0,0 +1,209 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSAlphaBeta.cpp
+//! \author Luke Kersting
+//! \brief  S(alpha,beta) unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+Teuchos::RCP<MonteCarlo::SAlphaBeta> inelastic_s_alpha_beta;
+
+Teuchos::RCP<MonteCarlo::SAlphaBeta> coherent_s_alpha_beta;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the table name can be returned
+TEUCHOS_UNIT_TEST( SAlphaBeta, getTableName )
+{
+  TEST_EQUALITY_CONST( inelastic_s_alpha_beta->getTableName(), "test.10t" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the max energy can be returned
+TEUCHOS_UNIT_TEST( SAlphaBeta, getMaxEnergy )
+{
+  TEST_EQUALITY_CONST( inelastic_s_alpha_beta->getMaxEnergy(), 1e-9 );
+  TEST_ASSERT( inelastic_s_alpha_beta->isEnergyInRange( 5e-10 ) );
+  TEST_ASSERT( !inelastic_s_alpha_beta->isEnergyInRange( 1e-9 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the inelastic cross section can be returned
+TEUCHOS_UNIT_TEST( SAlphaBeta, getInelasticCrossSection )
+{
+  TEST_EQUALITY_CONST( 
+		  inelastic_s_alpha_beta->getInelasticCrossSection( 1e-12 ),
+		  10.0 );
+  TEST_FLOATING_EQUALITY( 
+		 inelastic_s_alpha_beta->getInelasticCrossSection( 5.05e-10 ),
+		 15.0,
+		 1e-12 );
+  TEST_EQUALITY_CONST( 
+		  inelastic_s_alpha_beta->getInelasticCrossSection( 1e-9 ),
+		  20.0 );
+  TEST_EQUALITY_CONST( 
+		  inelastic_s_alpha_beta->getInelasticCrossSection( 1e-8 ),
+		  0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the elastic cross section can be returned
+TEUCHOS_UNIT_TEST( SAlphaBeta, getElasticCrossSection )
+{
+  TEST_EQUALITY_CONST( 
+		    inelastic_s_alpha_beta->getElasticCrossSection( 3e-10 ),
+		    0.0 );
+  TEST_EQUALITY_CONST( 
+		    coherent_s_alpha_beta->getElasticCrossSection( 5e-11 ),
+		    0.0 );
+  TEST_FLOATING_EQUALITY( 
+		    coherent_s_alpha_beta->getElasticCrossSection( 3e-10 ),
+		    1.0,
+		    1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the total cross section can be returned
+TEUCHOS_UNIT_TEST( SAlphaBeta, getTotalCrossSection )
+{
+  TEST_FLOATING_EQUALITY( 
+		  coherent_s_alpha_beta->getTotalCrossSection( 5.05e-10 ),
+		  15.0 + 4e-10/5.05e-10,
+		  1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can be scattered
+TEUCHOS_UNIT_TEST( SAlphaBeta, scatterNeutron )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 3e-10 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+
+  std::vector<double> fake_stream( 7 );
+  fake_stream[0] = 0.0; // elastic
+  fake_stream[1] = 0.0; // first Bragg edge
+  fake_stream[2] = 0.0; // azimuthal angle
+  fake_stream[3] = 0.99; // inelastic
+  fake_stream[4] = 0.0; // first outgoing energy
+  fake_stream[5] = 0.0; // first cosine
+  fake_stream[6] = 0.0; // azimuthal angle
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  coherent_s_alpha_beta->scatterNeutron( neutron );
+
+  TEST_EQUALITY_CONST( neutron.getEnergy(), 3e-10 );
+  TEST_FLOATING_EQUALITY( neutron.getZDirection(), 1.0/3.0, 1e-15 );
+  TEST_EQUALITY_CONST( neutron.getCollisionNumber(), 1 );
+
+  neutron.setEnergy( 1e-11 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+
+  coherent_s_alpha_beta->scatterNeutron( neutron );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  TEST_FLOATING_EQUALITY( neutron.getEnergy(), 1e-12, 1e-15 );
+  TEST_FLOATING_EQUALITY( neutron.getZDirection(), -0.5, 1e-15 );
+  TEST_EQUALITY_CONST( neutron.getCollisionNumber(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  Teuchos::Array<double> inelastic_energy_grid( 2 );
+  inelastic_energy_grid[0] = 1e-11;
+  inelastic_energy_grid[1] = 1e-9;
+
+  Teuchos::Array<double> inelastic_cross_section( 2 );
+  inelastic_cross_section[0] = 10.0;
+  inelastic_cross_section[1] = 20.0;
+
+  Teuchos::Array<double> outgoing_energies( 4 );
+  outgoing_energies[0] = 1e-12;
+  outgoing_energies[1] = 2e-12;
+  outgoing_energies[2] = 1e-10;
+  outgoing_energies[3] = 2e-10;
+
+  Teuchos::Array<double> scattering_angle_cosines( 8 );
+  scattering_angle_cosines[0] = -0.5;
+  scattering_angle_cosines[1] = 0.5;
+  scattering_angle_cosines[2] = -0.5;
+  scattering_angle_cosines[3] = 0.5;
+  scattering_angle_cosines[4] = -1.0;
+  scattering_angle_cosines[5] = 1.0;
+  scattering_angle_cosines[6] = -1.0;
+  scattering_angle_cosines[7] = 1.0;
+
+  Teuchos::RCP<const MonteCarlo::SAlphaBetaInelasticScatteringDistribution>
+    inelastic_distribution( 
+	      new MonteCarlo::SAlphaBetaInelasticScatteringDistribution(
+						    0.999167,
+						    inelastic_energy_grid(),
+						    outgoing_energies(),
+						    scattering_angle_cosines(),
+						    2u,
+						    2u,
+						    false ) );
+
+  inelastic_s_alpha_beta.reset( new MonteCarlo::SAlphaBeta( 
+						    "test.10t",
+						    inelastic_energy_grid(),
+						    inelastic_cross_section(),
+						    inelastic_distribution ) );
+
+  Teuchos::Array<double> bragg_edges( 3 );
+  bragg_edges[0] = 1e-10;
+  bragg_edges[1] = 2e-10;
+  bragg_edges[2] = 4e-10;
+
+  Teuchos::Array<double> cumulative_structure_factors( 3 );
+  cumulative_structure_factors[0] = 1e-10;
+  cumulative_structure_factors[1] = 3e-10;
+  cumulative_structure_factors[2] = 4e-10;
+
+  Teuchos::RCP<const MonteCarlo::SAlphaBetaCoherentElasticScatteringDistribution>
+    coherent_elastic_distribution( 
+	 new MonteCarlo::SAlphaBetaCoherentElasticScatteringDistribution(
+					      0.999167,
+					      bragg_edges(),
+					      cumulative_structure_factors() ) );
+
+  coherent_s_alpha_beta.reset( new MonteCarlo::SAlphaBeta( 
+					       "test.10t",
+					       inelastic_energy_grid(),
+					       inelastic_cross_section(),
+					       inelastic_distribution,
+					       coherent_elastic_distribution ) );
+  
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain( argc, argv );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSAlphaBeta.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSAlphaBetaCoherentElasticScatteringDistribution.cpp
+//! \author Luke Kersting
+//! \brief  S(alpha,beta) coherent elastic scattering distribution tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaCoherentElasticScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+Teuchos::RCP<MonteCarlo::SAlphaBetaCoherentElasticScatteringDistribution>
+  distribution;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the cross section can be evaluated
+TEUCHOS_UNIT_TEST( SAlphaBetaCoherentElasticScatteringDistribution, 
+		   evaluateCrossSection )
+{
+  TEST_EQUALITY_CONST( distribution->evaluateCrossSection( 5e-10 ), 0.0 );
+  TEST_FLOATING_EQUALITY( distribution->evaluateCrossSection( 1e-9 ),
+			  1.0,
+			  1e-15 );
+  TEST_FLOATING_EQUALITY( distribution->evaluateCrossSection( 1.5e-9 ),
+			  2.0/3.0,
+			  1e-15 );
+  TEST_FLOATING_EQUALITY( distribution->evaluateCrossSection( 3e-9 ),
+			  1.0,
+			  1e-15 );
+  TEST_FLOATING_EQUALITY( distribution->evaluateCrossSection( 8e-9 ),
+			  0.5,
+			  1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a scattering angle cosine can be sampled
+TEUCHOS_UNIT_TEST( SAlphaBetaCoherentElasticScatteringDistribution, 
+		   sampleAngleCosine )
+{
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.2; // first Bragg edge
+  fake_stream[1] = 0.5; // second Bragg edge
+  fake_stream[2] = 0.9; // third Bragg edge
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double scattering_angle_cosine = distribution->sampleAngleCosine( 3e-9 );
+
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, 1.0/3.0, 1e-15 );
+
+  scattering_angle_cosine = distribution->sampleAngleCosine( 3e-9 );
+
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, -1.0/3.0, 1e-15 );
+
+  scattering_angle_cosine = distribution->sampleAngleCosine( 8e-9 );
+
+  TEST_ASSERT( std::fabs( scattering_angle_cosine ) < 1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can be scattered
+TEUCHOS_UNIT_TEST( SAlphaBetaCoherentElasticScatteringDistribution, 
+		   scatterParticle )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 3e-9 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.2; // first Bragg edge
+  fake_stream[1] = 0.0; // azimuthal angle
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  distribution->scatterParticle( neutron, neutron, 0.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  TEST_EQUALITY_CONST( neutron.getEnergy(), 3e-9 );
+  TEST_FLOATING_EQUALITY( neutron.getZDirection(), 1.0/3.0, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  Teuchos::Array<double> bragg_edges( 3 );
+  bragg_edges[0] = 1e-9;
+  bragg_edges[1] = 2e-9;
+  bragg_edges[2] = 4e-9;
+
+  Teuchos::Array<double> cumulative_structure_factors( 3 );
+  cumulative_structure_factors[0] = 1e-9;
+  cumulative_structure_factors[1] = 3e-9;
+  cumulative_structure_factors[2] = 4e-9;
+
+  distribution.reset( 
+	 new MonteCarlo::SAlphaBetaCoherentElasticScatteringDistribution(
+					      1.0,
+					      bragg_edges(),
+					      cumulative_structure_factors() ) );
+  
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain( argc, argv );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSAlphaBetaCoherentElasticScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
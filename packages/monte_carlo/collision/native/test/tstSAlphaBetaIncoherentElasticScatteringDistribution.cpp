@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSAlphaBetaIncoherentElasticScatteringDistribution.cpp
+//! \author Luke Kersting
+//! \brief  S(alpha,beta) incoherent elastic scattering distribution tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaIncoherentElasticScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+Teuchos::RCP<MonteCarlo::SAlphaBetaIncoherentElasticScatteringDistribution>
+  distribution;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a scattering angle cosine can be sampled
+TEUCHOS_UNIT_TEST( SAlphaBetaIncoherentElasticScatteringDistribution, 
+		   sampleAngleCosine )
+{
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.99;
+  fake_stream[2] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double scattering_angle_cosine = distribution->sampleAngleCosine( 5.05e-10 );
+
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, -0.75, 1e-12 );
+
+  scattering_angle_cosine = distribution->sampleAngleCosine( 5.05e-10 );
+
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, 0.75, 1e-12 );
+
+  scattering_angle_cosine = distribution->sampleAngleCosine( 1e-12 );
+
+  TEST_EQUALITY_CONST( scattering_angle_cosine, 0.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can be scattered
+TEUCHOS_UNIT_TEST( SAlphaBetaIncoherentElasticScatteringDistribution, 
+		   scatterParticle )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1e-9 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.99; // last cosine
+  fake_stream[1] = 0.0; // azimuthal angle
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  distribution->scatterParticle( neutron, neutron, 0.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  TEST_EQUALITY_CONST( neutron.getEnergy(), 1e-9 );
+  TEST_FLOATING_EQUALITY( neutron.getZDirection(), 1.0, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  Teuchos::Array<double> incoming_energy_grid( 2 );
+  incoming_energy_grid[0] = 1e-11;
+  incoming_energy_grid[1] = 1e-9;
+
+  Teuchos::Array<double> scattering_angle_cosines( 6 );
+  scattering_angle_cosines[0] = -0.5;
+  scattering_angle_cosines[1] = 0.0;
+  scattering_angle_cosines[2] = 0.5;
+  scattering_angle_cosines[3] = -1.0;
+  scattering_angle_cosines[4] = 0.0;
+  scattering_angle_cosines[5] = 1.0;
+
+  distribution.reset( 
+	 new MonteCarlo::SAlphaBetaIncoherentElasticScatteringDistribution(
+						    0.999167,
+						    incoming_energy_grid(),
+						    scattering_angle_cosines(),
+						    3u ) );
+  
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain( argc, argv );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSAlphaBetaIncoherentElasticScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
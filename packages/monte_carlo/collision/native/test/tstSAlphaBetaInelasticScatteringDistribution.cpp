@@ -0,0 +1,202 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSAlphaBetaInelasticScatteringDistribution.cpp
+//! \author Luke Kersting
+//! \brief  S(alpha,beta) inelastic scattering distribution unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaInelasticScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+Teuchos::RCP<MonteCarlo::SAlphaBetaInelasticScatteringDistribution>
+  skewed_distribution;
+
+Teuchos::RCP<MonteCarlo::SAlphaBetaInelasticScatteringDistribution>
+  equiprobable_distribution;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the max energy can be returned
+TEUCHOS_UNIT_TEST( SAlphaBetaInelasticScatteringDistribution, getMaxEnergy )
+{
+  TEST_EQUALITY_CONST( skewed_distribution->getMaxEnergy(), 1e-9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an outgoing energy and angle cosine can be sampled
+TEUCHOS_UNIT_TEST( SAlphaBetaInelasticScatteringDistribution, 
+		   sampleOutgoingEnergyAndAngleCosine_skewed )
+{
+  std::vector<double> fake_stream( 6 );
+  fake_stream[0] = 0.0; // first outgoing energy
+  fake_stream[1] = 0.5; // second cosine
+  fake_stream[2] = 0.5; // third outgoing energy
+  fake_stream[3] = 0.0; // first cosine
+  fake_stream[4] = 0.95; // last outgoing energy
+  fake_stream[5] = 0.99; // second cosine
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  skewed_distribution->sampleOutgoingEnergyAndAngleCosine( 
+						     1e-11,
+						     outgoing_energy,
+						     scattering_angle_cosine );
+
+  TEST_FLOATING_EQUALITY( outgoing_energy, 1e-12, 1e-15 );
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, 0.5, 1e-15 );
+
+  skewed_distribution->sampleOutgoingEnergyAndAngleCosine( 
+						     5.05e-10,
+						     outgoing_energy,
+						     scattering_angle_cosine );
+
+  TEST_FLOATING_EQUALITY( outgoing_energy, 1.515e-10, 1e-12 );
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, -0.75, 1e-12 );
+
+  // Energies above the max energy use the last table
+  skewed_distribution->sampleOutgoingEnergyAndAngleCosine( 
+						     1e-8,
+						     outgoing_energy,
+						     scattering_angle_cosine );
+
+  TEST_FLOATING_EQUALITY( outgoing_energy, 4e-10, 1e-15 );
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, 1.0, 1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that an outgoing energy and angle cosine can be sampled
+TEUCHOS_UNIT_TEST( SAlphaBetaInelasticScatteringDistribution, 
+		   sampleOutgoingEnergyAndAngleCosine_equiprobable )
+{
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.3; // second outgoing energy
+  fake_stream[1] = 0.2; // first cosine
+  fake_stream[2] = 0.5; // third outgoing energy
+  fake_stream[3] = 0.5; // second cosine
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  equiprobable_distribution->sampleOutgoingEnergyAndAngleCosine( 
+						     1e-11,
+						     outgoing_energy,
+						     scattering_angle_cosine );
+
+  TEST_FLOATING_EQUALITY( outgoing_energy, 2e-12, 1e-15 );
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, -0.5, 1e-15 );
+
+  equiprobable_distribution->sampleOutgoingEnergyAndAngleCosine( 
+						     1e-9,
+						     outgoing_energy,
+						     scattering_angle_cosine );
+
+  TEST_FLOATING_EQUALITY( outgoing_energy, 3e-10, 1e-15 );
+  TEST_FLOATING_EQUALITY( scattering_angle_cosine, 1.0, 1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can be scattered
+TEUCHOS_UNIT_TEST( SAlphaBetaInelasticScatteringDistribution, 
+		   scatterParticle )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1e-11 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.0; // first outgoing energy
+  fake_stream[1] = 0.5; // second cosine
+  fake_stream[2] = 0.0; // azimuthal angle
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  skewed_distribution->scatterParticle( neutron, neutron, 0.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  TEST_FLOATING_EQUALITY( neutron.getEnergy(), 1e-12, 1e-15 );
+  TEST_FLOATING_EQUALITY( neutron.getZDirection(), 0.5, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  Teuchos::Array<double> incoming_energy_grid( 2 );
+  incoming_energy_grid[0] = 1e-11;
+  incoming_energy_grid[1] = 1e-9;
+
+  Teuchos::Array<double> outgoing_energies( 8 );
+  outgoing_energies[0] = 1e-12;
+  outgoing_energies[1] = 2e-12;
+  outgoing_energies[2] = 3e-12;
+  outgoing_energies[3] = 4e-12;
+  outgoing_energies[4] = 1e-10;
+  outgoing_energies[5] = 2e-10;
+  outgoing_energies[6] = 3e-10;
+  outgoing_energies[7] = 4e-10;
+
+  Teuchos::Array<double> scattering_angle_cosines( 16 );
+  
+  for( unsigned i = 0; i < 4; ++i )
+  {
+    scattering_angle_cosines[2*i] = -0.5;
+    scattering_angle_cosines[2*i+1] = 0.5;
+    scattering_angle_cosines[8+2*i] = -1.0;
+    scattering_angle_cosines[8+2*i+1] = 1.0;
+  }
+
+  skewed_distribution.reset( 
+	      new MonteCarlo::SAlphaBetaInelasticScatteringDistribution(
+						    0.999167,
+						    incoming_energy_grid(),
+						    outgoing_energies(),
+						    scattering_angle_cosines(),
+						    4u,
+						    2u,
+						    true ) );
+
+  equiprobable_distribution.reset( 
+	      new MonteCarlo::SAlphaBetaInelasticScatteringDistribution(
+						    0.999167,
+						    incoming_energy_grid(),
+						    outgoing_energies(),
+						    scattering_angle_cosines(),
+						    4u,
+						    2u,
+						    false ) );
+  
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain( argc, argv );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSAlphaBetaInelasticScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -35,6 +35,90 @@ Teuchos::RCP<const Utility::TabularDistribution<Utility::LinLin> >
 double angle_cutoff = 1.0e-6;
 double angle_cosine_cutoff = 0.999999;
 
+MonteCarlo::ScreenedRutherfordElasticElectronScatteringDistribution::ParameterArray
+  endl_parameters;
+
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Find the parameter bins and interpolation fraction of an energy
+void findReferenceBins( const double energy,
+                        unsigned& lower_bin, 
+                        unsigned& upper_bin,
+                        double& interpolation_fraction )
+{
+  if( energy < endl_parameters.front().first )
+  {
+    lower_bin = 0u;
+    upper_bin = 0u;
+    interpolation_fraction = 0.0;
+  }
+  else if( energy >= endl_parameters.back().first )
+  {
+    lower_bin = endl_parameters.size() - 1u;
+    upper_bin = lower_bin;
+    interpolation_fraction = 0.0;
+  }
+  else
+  {
+    lower_bin = 0u;
+
+    while( endl_parameters[lower_bin+1].first <= energy )
+      ++lower_bin;
+
+    upper_bin = lower_bin + 1u;
+
+    interpolation_fraction = (energy - endl_parameters[lower_bin].first)/
+      (endl_parameters[upper_bin].first - endl_parameters[lower_bin].first);
+  }
+}
+
+// Evaluate the integrated pdf on the fly (no tabulated values)
+double evaluateReferenceIntegratedPDF( const double energy,
+                                       const double scattering_angle )
+{
+  unsigned lower_bin, upper_bin;
+  double interpolation_fraction;
+
+  findReferenceBins( energy, lower_bin, upper_bin, interpolation_fraction );
+
+  double lower_value = scattering_angle*endl_parameters[lower_bin].third/( 
+                  endl_parameters[lower_bin].second*
+                  ( scattering_angle + endl_parameters[lower_bin].second ) );
+
+  double upper_value = scattering_angle*endl_parameters[upper_bin].third/( 
+                  endl_parameters[upper_bin].second*
+                  ( scattering_angle + endl_parameters[upper_bin].second ) );
+
+  return interpolation_fraction*(upper_value - lower_value) + lower_value;
+}
+
+// Sample an angle cosine with the integrated pdf evaluated on the fly
+double sampleReferenceAngleCosine( const double energy,
+                                   const double random_number )
+{
+  unsigned lower_bin, upper_bin;
+  double interpolation_fraction;
+
+  findReferenceBins( energy, lower_bin, upper_bin, interpolation_fraction );
+
+  double scaled_random_number = random_number*
+    evaluateReferenceIntegratedPDF( energy, angle_cutoff );
+
+  double lower_angle = endl_parameters[lower_bin].second*
+    endl_parameters[lower_bin].second*scaled_random_number/( 
+                  endl_parameters[lower_bin].third -
+                  endl_parameters[lower_bin].second*scaled_random_number );
+
+  double upper_angle = endl_parameters[upper_bin].second*
+    endl_parameters[upper_bin].second*scaled_random_number/( 
+                  endl_parameters[upper_bin].third -
+                  endl_parameters[upper_bin].second*scaled_random_number );
+
+  return 1.0 - 
+    (interpolation_fraction*(upper_angle - lower_angle) + lower_angle);
+}
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -159,6 +243,110 @@ TEUCHOS_UNIT_TEST( ScreenedRutherfordElasticElectronScatteringDistribution,
   TEST_FLOATING_EQUALITY( cdf_value, 0.0, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the tabulated max cdf values match the values evaluated on the 
+// fly (at and between the energy grid points)
+TEUCHOS_UNIT_TEST( ScreenedRutherfordElasticElectronScatteringDistribution, 
+                   evaluateIntegratedPDF_endl )
+{
+  Teuchos::Array<double> energies( 7 );
+  energies[0] = 1.0e-5; // grid point
+  energies[1] = 5.0e-4;
+  energies[2] = 1.0e-3; // grid point
+  energies[3] = 1.0e+1;
+  energies[4] = 1.0e+5; // grid point
+  energies[5] = 1.0e-6; // below the grid
+  energies[6] = 2.0e+5; // above the grid
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+  {
+    TEST_FLOATING_EQUALITY( 
+                endl_elastic_distribution->evaluateIntegratedPDF( energies[i] ),
+                evaluateReferenceIntegratedPDF( energies[i], angle_cutoff ),
+                1e-12 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cdf matches the cdf evaluated on the fly
+TEUCHOS_UNIT_TEST( ScreenedRutherfordElasticElectronScatteringDistribution, 
+                   evaluateCDF_endl )
+{
+  Teuchos::Array<double> energies( 5 );
+  energies[0] = 1.0e-5; // grid point
+  energies[1] = 5.0e-4;
+  energies[2] = 1.0e+1;
+  energies[3] = 1.0e+5; // grid point
+  energies[4] = 2.0e+5; // above the grid
+
+  Teuchos::Array<double> scattering_angles( 3 );
+  scattering_angles[0] = 1.0e-8;
+  scattering_angles[1] = 5.0e-7;
+  scattering_angles[2] = angle_cutoff;
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+  {
+    for( unsigned j = 0; j < scattering_angles.size(); ++j )
+    {
+      double cdf_value = 
+        endl_elastic_distribution->evaluateCDF( energies[i], 
+                                                scattering_angles[j] );
+
+      double expected_cdf_value = 
+        evaluateReferenceIntegratedPDF( energies[i], scattering_angles[j] )/
+        evaluateReferenceIntegratedPDF( energies[i], angle_cutoff );
+      
+      TEST_FLOATING_EQUALITY( cdf_value, expected_cdf_value, 1e-12 );
+    }
+
+    TEST_FLOATING_EQUALITY( 
+              endl_elastic_distribution->evaluateCDF( energies[i], 
+                                                      angle_cutoff ),
+              1.0,
+              1e-12 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the samples match the samples evaluated on the fly
+TEUCHOS_UNIT_TEST( ScreenedRutherfordElasticElectronScatteringDistribution, 
+                   sampleAndRecordTrialsImpl_endl )
+{
+  Teuchos::Array<double> energies( 4 );
+  energies[0] = 1.0e-5; // grid point
+  energies[1] = 5.0e-4;
+  energies[2] = 1.0e+1;
+  energies[3] = 1.0e+5; // grid point
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 1.0 - 1e-15;
+
+  for( unsigned i = 0; i < energies.size(); ++i )
+  {
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    for( unsigned j = 0; j < fake_stream.size(); ++j )
+    {
+      double scattering_angle_cosine;
+      unsigned trials = 0;
+
+      endl_elastic_distribution->sampleAndRecordTrialsImpl( 
+                                                       energies[i],
+                                                       scattering_angle_cosine,
+                                                       trials );
+
+      TEST_FLOATING_EQUALITY( 
+                  scattering_angle_cosine, 
+                  sampleReferenceAngleCosine( energies[i], fake_stream[j] ),
+                  1e-12 );
+    }
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that sampleAndRecordTrialsImpl can be evaluated
 TEUCHOS_UNIT_TEST( ScreenedRutherfordElasticElectronScatteringDistribution, 
@@ -421,6 +609,18 @@ int main( int argc, char** argv )
                 atomic_number,
                 angle_cutoff ) );
 
+  // Create the screened Rutherford distribution with tabulated parameters
+  // (energy, Moliere's screening constant, normalization constant)
+  endl_parameters.resize( 3 );
+  endl_parameters[0]( 1.0e-5, 1.0e-3, 2.0 );
+  endl_parameters[1]( 1.0e-3, 1.0e-5, 5.0 );
+  endl_parameters[2]( 1.0e+5, 1.0e-9, 1.0e-3 );
+
+  endl_elastic_distribution.reset(
+        new MonteCarlo::ScreenedRutherfordElasticElectronScatteringDistribution(
+                endl_parameters,
+                angle_cutoff ) );
+
   // Clear setup data
   ace_file_handler.reset();
   xss_data_extractor.reset();
@@ -14,6 +14,7 @@
 #include <Teuchos_UnitTestHarness.hpp>
 #include <Teuchos_VerboseObject.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_StandardPhotoatomicReaction.hpp"
@@ -122,6 +123,44 @@ TEUCHOS_UNIT_TEST( StandardPhotoatomicReaction, getCrossSection_ace_pe )
   TEST_FLOATING_EQUALITY( cross_section, exp( -1.11594725061E+01 ), 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cross sections can be returned at many energies
+TEUCHOS_UNIT_TEST( StandardPhotoatomicReaction, getCrossSections_ace_pp )
+{
+  Teuchos::Array<double> energies( 4 );
+  energies[0] = 1.0;
+  energies[1] = ace_pp_reaction->getThresholdEnergy();
+  energies[2] = exp( 5.98672834901E+00 );
+  energies[3] = exp( 1.15129254650E+01 );
+
+  Teuchos::Array<double> cross_sections( 4 );
+  
+  ace_pp_reaction->getCrossSections( energies(), cross_sections() );
+
+  TEST_EQUALITY_CONST( cross_sections[0], 0.0 );
+  TEST_FLOATING_EQUALITY( cross_sections[1], exp( -3.84621780013E+01 ), 1e-12 );
+  TEST_FLOATING_EQUALITY( cross_sections[2], exp( 3.62139611703E+00 ), 1e-12 );
+  TEST_FLOATING_EQUALITY( cross_sections[3], exp( 3.71803283438E+00 ), 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cross sections can be returned at many energies
+TEUCHOS_UNIT_TEST( StandardPhotoatomicReaction, getCrossSections_ace_pe )
+{
+  Teuchos::Array<double> energies( 3 );
+  energies[0] = ace_pe_reaction->getThresholdEnergy();
+  energies[1] = exp( 5.98672834901E+00 );
+  energies[2] = exp( 1.15129254650E+01 );
+
+  Teuchos::Array<double> cross_sections( 3 );
+  
+  ace_pe_reaction->getCrossSections( energies(), cross_sections() );
+
+  TEST_FLOATING_EQUALITY( cross_sections[0], exp( 1.43969286532E+01 ), 1e-12 );
+  TEST_FLOATING_EQUALITY( cross_sections[1], exp( -5.62662022605E+00 ), 1e-12 );
+  TEST_FLOATING_EQUALITY( cross_sections[2], exp( -1.11594725061E+01 ), 1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
@@ -0,0 +1,345 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstUnresolvedResonanceProbabilityTable.cpp
+//! \author Luke Kersting
+//! \brief  Unresolved resonance probability table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_VerboseObject.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessExtensions.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables.
+//---------------------------------------------------------------------------//
+
+Teuchos::RCP<MonteCarlo::UnresolvedResonanceProbabilityTable> lin_table;
+Teuchos::RCP<MonteCarlo::UnresolvedResonanceProbabilityTable> log_table;
+Teuchos::RCP<MonteCarlo::UnresolvedResonanceProbabilityTable> factors_table;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check if an energy is in the unresolved resonance range
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable, isEnergyInRange )
+{
+  TEST_ASSERT( !lin_table->isEnergyInRange( 9.0e-3 ) );
+  TEST_ASSERT( lin_table->isEnergyInRange( 1.0e-2 ) );
+  TEST_ASSERT( lin_table->isEnergyInRange( 3.0e-2 ) );
+  TEST_ASSERT( lin_table->isEnergyInRange( 4.0e-2 ) );
+  TEST_ASSERT( !lin_table->isEnergyInRange( 4.1e-2 ) );
+
+  TEST_EQUALITY_CONST( lin_table->getMinEnergy(), 1.0e-2 );
+  TEST_EQUALITY_CONST( lin_table->getMaxEnergy(), 4.0e-2 );
+  TEST_EQUALITY_CONST( lin_table->getNumberOfBands(), 3 );
+  TEST_ASSERT( !lin_table->areBandsFactors() );
+  TEST_ASSERT( factors_table->areBandsFactors() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band cross sections can be evaluated (lin-lin)
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable,
+		   evaluateCrossSections_lin )
+{
+  double elastic, fission, capture;
+
+  lin_table->evaluateCrossSections( 1.5e-2, 0.1, 0.0, 0.0, 0.0,
+				    elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 2.0, 1e-12 );
+  TEST_FLOATING_EQUALITY( fission, 0.2, 1e-12 );
+  TEST_FLOATING_EQUALITY( capture, 1.0, 1e-12 );
+
+  lin_table->evaluateCrossSections( 1.5e-2, 0.5, 0.0, 0.0, 0.0,
+				    elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 3.0, 1e-12 );
+  TEST_FLOATING_EQUALITY( fission, 0.3, 1e-12 );
+  TEST_FLOATING_EQUALITY( capture, 1.5, 1e-12 );
+
+  lin_table->evaluateCrossSections( 4.0e-2, 0.9, 0.0, 0.0, 0.0,
+				    elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 7.0, 1e-12 );
+  TEST_FLOATING_EQUALITY( fission, 0.7, 1e-12 );
+  TEST_FLOATING_EQUALITY( capture, 3.5, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band cross sections can be evaluated (log-log)
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable,
+		   evaluateCrossSections_log )
+{
+  double elastic, fission, capture;
+
+  log_table->evaluateCrossSections( std::sqrt( 2.0 )*1.0e-2, 0.1,
+				    0.0, 0.0, 0.0,
+				    elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, std::sqrt( 3.0 ), 1e-12 );
+  TEST_FLOATING_EQUALITY( fission, std::sqrt( 0.03 ), 1e-12 );
+  TEST_FLOATING_EQUALITY( capture, std::sqrt( 0.75 ), 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band factors are applied to the smooth cross sections
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable,
+		   evaluateCrossSections_factors )
+{
+  double elastic, fission, capture;
+
+  factors_table->evaluateCrossSections( 1.5e-2, 0.1, 10.0, 2.0, 4.0,
+					elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 20.0, 1e-12 );
+  TEST_FLOATING_EQUALITY( fission, 0.4, 1e-12 );
+  TEST_FLOATING_EQUALITY( capture, 4.0, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band selection is cached for a neutron
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable, sampleCrossSections )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1.5e-2 );
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.1;
+  fake_stream[1] = 0.9;
+  fake_stream[2] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double elastic, fission, capture;
+
+  lin_table->sampleCrossSections( neutron, 0.0, 0.0, 0.0,
+				  elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 2.0, 1e-12 );
+
+  // The same track segment - the cached band is used
+  lin_table->sampleCrossSections( neutron, 0.0, 0.0, 0.0,
+				  elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 2.0, 1e-12 );
+
+  // A new collision - a new band is sampled
+  neutron.incrementCollisionNumber();
+
+  lin_table->sampleCrossSections( neutron, 0.0, 0.0, 0.0,
+				  elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 4.0, 1e-12 );
+
+  // A new energy interval - a new band is sampled
+  neutron.setEnergy( 3.0e-2 );
+
+  lin_table->sampleCrossSections( neutron, 0.0, 0.0, 0.0,
+				  elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 5.0, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band selection is not shared between particles
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable, 
+		   sampleCrossSections_new_particle )
+{
+  MonteCarlo::UnresolvedResonanceProbabilityTable::startNewParticle();
+  
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1.5e-2 );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.1;
+  fake_stream[1] = 0.9;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double elastic, fission, capture;
+
+  lin_table->sampleCrossSections( neutron, 0.0, 0.0, 0.0,
+				  elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 2.0, 1e-12 );
+
+  // A sibling particle with the same history, generation and collision 
+  // number - a new band is sampled
+  MonteCarlo::UnresolvedResonanceProbabilityTable::startNewParticle();
+
+  lin_table->sampleCrossSections( neutron, 0.0, 0.0, 0.0,
+				  elastic, fission, capture );
+
+  TEST_FLOATING_EQUALITY( elastic, 4.0, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cross sections sampled for a neutron are cached
+TEUCHOS_UNIT_TEST( UnresolvedResonanceProbabilityTable, 
+		   getCachedCrossSections )
+{
+  MonteCarlo::UnresolvedResonanceProbabilityTable::startNewParticle();
+  
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1.5e-2 );
+
+  double smooth_elastic, smooth_fission, smooth_capture;
+  double elastic, fission, capture;
+
+  TEST_ASSERT( !lin_table->getCachedCrossSections( neutron,
+						   smooth_elastic,
+						   smooth_fission,
+						   smooth_capture,
+						   elastic,
+						   fission,
+						   capture ) );
+
+  std::vector<double> fake_stream( 1 );
+  fake_stream[0] = 0.1;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  lin_table->sampleCrossSections( neutron, 1.0, 2.0, 3.0,
+				  elastic, fission, capture );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  elastic = 0.0;
+  fission = 0.0;
+  capture = 0.0;
+
+  TEST_ASSERT( lin_table->getCachedCrossSections( neutron,
+						  smooth_elastic,
+						  smooth_fission,
+						  smooth_capture,
+						  elastic,
+						  fission,
+						  capture ) );
+  TEST_EQUALITY_CONST( smooth_elastic, 1.0 );
+  TEST_EQUALITY_CONST( smooth_fission, 2.0 );
+  TEST_EQUALITY_CONST( smooth_capture, 3.0 );
+  TEST_FLOATING_EQUALITY( elastic, 2.0, 1e-12 );
+  TEST_FLOATING_EQUALITY( fission, 0.2, 1e-12 );
+  TEST_FLOATING_EQUALITY( capture, 1.0, 1e-12 );
+
+  // The cross sections at a different energy have not been cached
+  neutron.setEnergy( 1.6e-2 );
+
+  TEST_ASSERT( !lin_table->getCachedCrossSections( neutron,
+						   smooth_elastic,
+						   smooth_fission,
+						   smooth_capture,
+						   elastic,
+						   fission,
+						   capture ) );
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  Teuchos::CommandLineProcessor& clp = Teuchos::UnitTestRepository::getCLP();
+
+  const Teuchos::RCP<Teuchos::FancyOStream> out =
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return =
+    clp.parse(argc,argv);
+
+  if ( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL ) {
+    *out << "\nEnd Result: TEST FAILED" << std::endl;
+    return parse_return;
+  }
+
+  // Create the probability tables
+  Teuchos::Array<double> energy_grid( 3 );
+  energy_grid[0] = 1.0e-2;
+  energy_grid[1] = 2.0e-2;
+  energy_grid[2] = 4.0e-2;
+
+  Teuchos::Array<double> band_cdfs( 9 ), elastic_bands( 9 ),
+    fission_bands( 9 ), capture_bands( 9 );
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    band_cdfs[i*3] = 0.2;
+    band_cdfs[i*3+1] = 0.7;
+    band_cdfs[i*3+2] = 1.0;
+
+    for( unsigned j = 0; j < 3; ++j )
+    {
+      elastic_bands[i*3+j] = 1.0 + 2.0*i + j;
+      fission_bands[i*3+j] = 0.1*(1.0 + 2.0*i + j);
+      capture_bands[i*3+j] = 0.5*(1.0 + 2.0*i + j);
+    }
+  }
+
+  lin_table.reset( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+							   energy_grid(),
+							   band_cdfs(),
+							   elastic_bands(),
+							   fission_bands(),
+							   capture_bands(),
+							   3u,
+							   false,
+							   false ) );
+
+  log_table.reset( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+							   energy_grid(),
+							   band_cdfs(),
+							   elastic_bands(),
+							   fission_bands(),
+							   capture_bands(),
+							   3u,
+							   true,
+							   false ) );
+
+  factors_table.reset( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+							   energy_grid(),
+							   band_cdfs(),
+							   elastic_bands(),
+							   fission_bands(),
+							   capture_bands(),
+							   3u,
+							   false,
+							   true ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  // Run the unit tests
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  const bool success = Teuchos::UnitTestRepository::runUnitTests( *out );
+
+  if (success)
+    *out << "\nEnd Result: TEST PASSED" << std::endl;
+  else
+    *out << "\nEnd Result: TEST FAILED" << std::endl;
+
+  clp.printFinalTimerSummary(out.ptr());
+
+  return (success ? 0 : 1);
+}
+
+//---------------------------------------------------------------------------//
+// end tstUnresolvedResonanceProbabilityTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AsynchronousCheckpointWriter.cpp
+//! \author Luke Kersting
+//! \brief  The asynchronous checkpoint writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstdio>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "MonteCarlo_AsynchronousCheckpointWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+AsynchronousCheckpointWriter::AsynchronousCheckpointWriter()
+  : d_checkpoint(),
+    d_writer_thread(),
+    d_error_message(),
+    d_checkpoints_written( 0u )
+{ /* ... */ }
+
+// Destructor
+/*! \details The destructor will wait for the write in progress to finish
+ * but it will not throw if the write failed.
+ */
+AsynchronousCheckpointWriter::~AsynchronousCheckpointWriter()
+{
+  if( d_writer_thread.joinable() )
+    d_writer_thread.join();
+}
+
+// Write the checkpoint to the file on a background thread
+/*! \details The checkpoint will be copied before this method returns so it
+ * is safe to modify the checkpoint while it is being written. If the
+ * previous write failed an exception will be thrown.
+ */
+void AsynchronousCheckpointWriter::write(
+				  const SimulationCheckpoint& checkpoint,
+				  const std::string& checkpoint_file_name )
+{
+  // Make sure the file name is valid
+  testPrecondition( checkpoint_file_name.size() > 0 );
+
+  this->wait();
+
+  d_checkpoint = checkpoint;
+
+  d_writer_thread = std::thread( &AsynchronousCheckpointWriter::writeCheckpoint,
+				 this,
+				 checkpoint_file_name );
+}
+
+// Wait for the write in progress to finish
+void AsynchronousCheckpointWriter::wait()
+{
+  if( d_writer_thread.joinable() )
+    d_writer_thread.join();
+
+  if( !d_error_message.empty() )
+  {
+    std::string error_message;
+    error_message.swap( d_error_message );
+
+    THROW_EXCEPTION( std::runtime_error, error_message );
+  }
+}
+
+// Return the number of checkpoints that have been written
+unsigned AsynchronousCheckpointWriter::getNumberOfCheckpointsWritten() const
+{
+  return d_checkpoints_written;
+}
+
+// Write the checkpoint (called by the background thread)
+/*! \details Exceptions cannot propagate out of the background thread so
+ * the error message is stored and reported by the next call to wait.
+ */
+void AsynchronousCheckpointWriter::writeCheckpoint(
+				       const std::string checkpoint_file_name )
+{
+  const std::string temp_file_name = checkpoint_file_name + ".tmp";
+
+  try{
+    d_checkpoint.exportToHDF5File( temp_file_name );
+  }
+  catch( const std::exception& exception )
+  {
+    d_error_message = exception.what();
+
+    return;
+  }
+
+  if( std::rename( temp_file_name.c_str(),
+		   checkpoint_file_name.c_str() ) != 0 )
+  {
+    d_error_message = "Error: the temporary checkpoint file " +
+      temp_file_name + " could not be renamed to " + checkpoint_file_name +
+      "!";
+  }
+  else
+    ++d_checkpoints_written;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AsynchronousCheckpointWriter.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AsynchronousCheckpointWriter.hpp
+//! \author Luke Kersting
+//! \brief  The asynchronous checkpoint writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ASYNCHRONOUS_CHECKPOINT_WRITER_HPP
+#define MONTE_CARLO_ASYNCHRONOUS_CHECKPOINT_WRITER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <thread>
+
+// FRENSIE Includes
+#include "MonteCarlo_SimulationCheckpoint.hpp"
+
+namespace MonteCarlo{
+
+/*! The asynchronous checkpoint writer class
+ * \details The checkpoint is copied and then written on a background thread
+ * so that the simulation can continue while the file is being written. The
+ * checkpoint is first written to a temporary file (the checkpoint file name
+ * with a .tmp extension) that is renamed once the write is complete, which
+ * means that an interrupted write never corrupts the previous checkpoint.
+ * Only one write can be in progress at a time - a new write will wait for
+ * the previous write to finish.
+ */
+class AsynchronousCheckpointWriter
+{
+
+public:
+
+  //! Constructor
+  AsynchronousCheckpointWriter();
+
+  //! Destructor
+  ~AsynchronousCheckpointWriter();
+
+  //! Write the checkpoint to the file on a background thread
+  void write( const SimulationCheckpoint& checkpoint,
+	      const std::string& checkpoint_file_name );
+
+  //! Wait for the write in progress to finish
+  void wait();
+
+  //! Return the number of checkpoints that have been written
+  unsigned getNumberOfCheckpointsWritten() const;
+
+private:
+
+  // Copy constructor
+  AsynchronousCheckpointWriter( const AsynchronousCheckpointWriter& other );
+
+  // Assignment operator
+  AsynchronousCheckpointWriter& operator=(
+				    const AsynchronousCheckpointWriter& other );
+
+  // Write the checkpoint (called by the background thread)
+  void writeCheckpoint( const std::string checkpoint_file_name );
+
+  // The checkpoint that is being written
+  SimulationCheckpoint d_checkpoint;
+
+  // The background thread
+  std::thread d_writer_thread;
+
+  // The error message from the last write (empty if successful)
+  std::string d_error_message;
+
+  // The number of checkpoints written
+  unsigned d_checkpoints_written;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ASYNCHRONOUS_CHECKPOINT_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AsynchronousCheckpointWriter.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElectronCondensedHistoryHelpers.cpp
+//! \author Luke Kersting
+//! \brief  Electron condensed history helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronCondensedHistoryHelpers.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Apply the continuous (soft) energy loss over a condensed history segment
+/*! \details The energy of the electron at the end of the segment is set 
+ * before any estimators are updated so that track length and collision 
+ * contributions are scored with the energy after the loss. If the loss would
+ * take the electron below the cutoff energy the energy is clamped to the
+ * cutoff and true is returned (the electron should then be killed once the 
+ * estimators have been updated).
+ */
+bool applySoftEnergyLoss( ElectronState& electron,
+			  const double segment_length,
+			  const double soft_stopping_power,
+			  const double min_energy )
+{
+  // Make sure the segment length is valid
+  testPrecondition( segment_length >= 0.0 );
+  // Make sure the stopping power is valid
+  testPrecondition( soft_stopping_power >= 0.0 );
+  // Make sure the min energy is valid
+  testPrecondition( min_energy > 0.0 );
+
+  const double energy = 
+    electron.getEnergy() - segment_length*soft_stopping_power;
+
+  if( energy < min_energy )
+  {
+    electron.setEnergy( min_energy );
+
+    return true;
+  }
+  else
+  {
+    electron.setEnergy( energy );
+
+    return false;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElectronCondensedHistoryHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,29 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElectronCondensedHistoryHelpers.hpp
+//! \author Luke Kersting
+//! \brief  Electron condensed history helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ELECTRON_CONDENSED_HISTORY_HELPERS_HPP
+#define MONTE_CARLO_ELECTRON_CONDENSED_HISTORY_HELPERS_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronState.hpp"
+
+namespace MonteCarlo{
+
+//! Apply the continuous (soft) energy loss over a condensed history segment
+bool applySoftEnergyLoss( ElectronState& electron,
+			  const double segment_length,
+			  const double soft_stopping_power,
+			  const double min_energy );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ELECTRON_CONDENSED_HISTORY_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElectronCondensedHistoryHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,55 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionBank.cpp
+//! \author Luke Kersting
+//! \brief  Fission bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionBank.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+FissionBank::FissionBank( const double immediate_fission_fraction )
+  : d_fission_sites(),
+    d_immediate_fission_fraction( immediate_fission_fraction )
+{
+  // Make sure the immediate fission fraction is valid
+  testPrecondition( immediate_fission_fraction >= 0.0 );
+  testPrecondition( immediate_fission_fraction < 1.0 );
+}
+
+// Insert a neutron that the bank now owns after an interaction
+/*! \details Neutrons that are not emitted by a fission reaction are always
+ * stored in the bank. A random number will only be used when the immediate
+ * fission fraction is not zero.
+ */
+void FissionBank::insert( const std::shared_ptr<NeutronState>& neutron,
+			  const NuclearReactionType reaction )
+{
+  if( isFissionReaction( reaction ) )
+  {
+    if( d_immediate_fission_fraction > 0.0 &&
+	Utility::RandomNumberGenerator::getRandomNumber<double>() <
+	d_immediate_fission_fraction )
+      ParticleBank::insert( neutron );
+    else
+    {
+      std::shared_ptr<NeutronState> fission_site( neutron );
+
+      d_fission_sites.push( fission_site );
+    }
+  }
+  else
+    ParticleBank::insert( neutron );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionBank.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,87 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionBank.hpp
+//! \author Luke Kersting
+//! \brief  Fission bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FISSION_BANK_HPP
+#define MONTE_CARLO_FISSION_BANK_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleBank.hpp"
+
+namespace MonteCarlo{
+
+/*! The fission bank class
+ * \details Neutrons emitted by a fission reaction are stored in a separate
+ * fission site bank instead of being transported with the rest of the
+ * history (power iteration). When an immediate fission fraction is given
+ * (Wielandt acceleration), each fission neutron will be transported in the
+ * current history with that probability.
+ */
+class FissionBank : public ParticleBank
+{
+
+public:
+
+  //! Constructor
+  FissionBank( const double immediate_fission_fraction = 0.0 );
+
+  //! Destructor
+  ~FissionBank()
+  { /* ... */ }
+
+  //! Return the fission site bank
+  ParticleBank& getFissionSiteBank();
+
+  //! Return the fission site bank
+  const ParticleBank& getFissionSiteBank() const;
+
+  //! Return the immediate fission fraction
+  double getImmediateFissionFraction() const;
+
+protected:
+
+  // Allow the base class insert methods to be found
+  using ParticleBank::insert;
+
+  //! Insert a neutron that the bank now owns after an interaction
+  void insert( const std::shared_ptr<NeutronState>& neutron,
+	       const NuclearReactionType reaction );
+
+private:
+
+  // The fission sites
+  ParticleBank d_fission_sites;
+
+  // The probability that a fission neutron is transported immediately
+  double d_immediate_fission_fraction;
+};
+
+// Return the fission site bank
+inline ParticleBank& FissionBank::getFissionSiteBank()
+{
+  return d_fission_sites;
+}
+
+// Return the fission site bank
+inline const ParticleBank& FissionBank::getFissionSiteBank() const
+{
+  return d_fission_sites;
+}
+
+// Return the immediate fission fraction
+inline double FissionBank::getImmediateFissionFraction() const
+{
+  return d_immediate_fission_fraction;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FISSION_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionBank.hpp
+//---------------------------------------------------------------------------//
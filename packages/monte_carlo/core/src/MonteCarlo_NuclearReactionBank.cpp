@@ -25,15 +25,15 @@ NuclearReactionBank::NuclearReactionBank(
     d_nuclear_reaction_banks[reactions[i]];
 }
 
-// Push a neutron to the bank
-void NuclearReactionBank::push( const NeutronState& neutron,
-				const NuclearReactionType reaction )
+// Insert a neutron that the bank now owns after an interaction
+void NuclearReactionBank::insert( const std::shared_ptr<NeutronState>& neutron,
+				  const NuclearReactionType reaction )
 {
   if( d_nuclear_reaction_banks.find( reaction ) != 
       d_nuclear_reaction_banks.end() )
-    d_nuclear_reaction_banks[reaction].emplace_back( neutron.clone() );
+    d_nuclear_reaction_banks[reaction].push_back( neutron );
   else
-    ParticleBank::push( neutron );
+    ParticleBank::insert( neutron );
 }
 
 } // end MonteCarlo namespace
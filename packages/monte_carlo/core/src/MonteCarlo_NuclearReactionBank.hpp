@@ -33,14 +33,19 @@ public:
   //! Constructor
   NuclearReactionBank( const Teuchos::Array<NuclearReactionType>& reactions );
 
-  //! Push a neutron to the bank
-  void push( const NeutronState& neutron,
-	     const NuclearReactionType reaction );
+protected:
+
+  // Allow the base class insert methods to be found
+  using ParticleBank::insert;
+
+  //! Insert a neutron that the bank now owns after an interaction
+  void insert( const std::shared_ptr<NeutronState>& neutron,
+	       const NuclearReactionType reaction );
 
 private:
 
   // The nuclear reactions of interest
-  boost::unordered_map<NuclearReactionType,std::list<boost::scoped_ptr<ParticleState> > > d_nuclear_reaction_banks;
+  boost::unordered_map<NuclearReactionType,std::list<std::shared_ptr<ParticleState> > > d_nuclear_reaction_banks;
 };
 
 } // end MonteCarlo namespace
@@ -442,6 +442,22 @@ NuclearReactionType convertUnsignedToNuclearReactionType(
   }
 }
 
+// Check if a reaction is a fission reaction
+bool isFissionReaction( const NuclearReactionType reaction )
+{
+  switch( reaction )
+  {
+  case N__TOTAL_FISSION_REACTION:
+  case N__FISSION_REACTION:
+  case N__N_FISSION_REACTION:
+  case N__2N_FISSION_REACTION:
+  case N__3N_FISSION_REACTION:
+    return true;
+  default:
+    return false;
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -435,6 +435,9 @@ enum NuclearReactionType{
 NuclearReactionType convertUnsignedToNuclearReactionType( 
 						     const unsigned reaction );
 
+//! Check if a reaction is a fission reaction
+bool isFissionReaction( const NuclearReactionType reaction );
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_NUCLEAR_REACTION_TYPE_HPP
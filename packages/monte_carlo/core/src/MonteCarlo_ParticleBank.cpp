@@ -54,24 +54,38 @@ const ParticleState& ParticleBank::top() const
 }
 
 // Push a particle to the bank
-/*! \details The bank will take ownership of the particle passed into it. To
- * ensure that it has ownership it will create a copy (clone) of the particle.
+/*! \details The bank will take ownership of a copy (clone) of the particle.
  */
 void ParticleBank::push( const ParticleState& particle )
 {    
-  d_particle_states.emplace_back( particle.clone() );
+  this->insert( std::shared_ptr<ParticleState>( particle.clone() ) );
 }
 
 // Push a neutron to the bank
-/*! \details This function behaves identically to the push member function
+/*! \details The bank will take ownership of a copy (clone) of the neutron.
+ */
+void ParticleBank::push( const NeutronState& neutron,
+			 const NuclearReactionType reaction )
+{
+  this->insert( std::shared_ptr<NeutronState>( neutron.clone() ), reaction );
+}
+
+// Insert a particle that the bank now owns
+void ParticleBank::insert( const std::shared_ptr<ParticleState>& particle )
+{
+  d_particle_states.push_back( particle );
+}
+
+// Insert a neutron that the bank now owns after an interaction
+/*! \details This function behaves identically to the insert member function
  * that takes a MonteCarlo::ParticleState base class pointer. It can be
  * overridden in a derived class that needs to store a neutron in a secondary
  * bank if a specific reaction occurs (i.e. fission bank).
  */
-void ParticleBank::push( const NeutronState& neutron,
-			 const NuclearReactionType )
+void ParticleBank::insert( const std::shared_ptr<NeutronState>& neutron,
+			   const NuclearReactionType )
 {
-  this->push( neutron );
+  this->insert( std::shared_ptr<ParticleState>( neutron ) );
 }
 
 // Pop a particle from the bank
@@ -94,7 +108,7 @@ bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 }
 
 // Sort the particle states
-bool ParticleBank::sort( const CompareFunctionType& compare_function )
+void ParticleBank::sort( const CompareFunctionType& compare_function )
 {
   d_particle_states.sort( boost::bind<bool>(compare_function, 
 					    boost::bind<const ParticleState&>(ParticleBank::dereference, _1),
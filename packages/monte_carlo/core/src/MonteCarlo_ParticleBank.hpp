@@ -63,7 +63,7 @@ public:
   void push( SmartPointer<State>& particle );
 
   //! Insert a particle to the bank
-  virtual void push( const ParticleState& particle );
+  void push( const ParticleState& particle );
 
   //! Push a neutron into the bank after an interaction
   template<template<typename> class SmartPointer>
@@ -71,8 +71,8 @@ public:
 	     const NuclearReactionType reaction );
 
   //! Insert a neutron into the bank after an interaction
-  virtual void push( const NeutronState& neutron,
-		     const NuclearReactionType reaction );
+  void push( const NeutronState& neutron,
+	     const NuclearReactionType reaction );
   
   //! Pop the top particle from bank
   void pop();
@@ -85,7 +85,7 @@ public:
   virtual bool isSorted( const CompareFunctionType& compare_function );
 
   //! Sort the particle states
-  virtual bool sort( const CompareFunctionType& compare_function );
+  virtual void sort( const CompareFunctionType& compare_function );
 
   //! Merge the bank with another bank
   virtual void merge( ParticleBank& other_bank,
@@ -94,8 +94,37 @@ public:
   //! Splice the bank with another bank
   virtual void splice( ParticleBank& other_bank );
 
+protected:
+
+  //! Insert a particle that the bank now owns
+  virtual void insert( const std::shared_ptr<ParticleState>& particle );
+
+  //! Insert a neutron that the bank now owns after an interaction
+  virtual void insert( const std::shared_ptr<NeutronState>& neutron,
+		       const NuclearReactionType reaction );
+
 private:
 
+  // The deleter that releases the smart pointer that owned a particle
+  template<typename SmartPointerType>
+  struct SmartPointerDeleter
+  {
+    // The smart pointer that owned the particle
+    SmartPointerType owner;
+
+    // Release the particle
+    void operator()( ParticleState* ) { owner.reset(); }
+  };
+
+  // Take ownership of the particle stored in a smart pointer
+  template<template<typename> class SmartPointer, typename State>
+  static std::shared_ptr<State> takeOwnership( SmartPointer<State>& particle );
+
+  // Take ownership of the particle stored in a std::shared_ptr
+  template<typename State>
+  static std::shared_ptr<State> takeOwnership(
+                                        std::shared_ptr<State>& particle );
+
   // Dereference a smart ptr
   static const ParticleState& dereference( 
                                const std::shared_ptr<ParticleState>& pointer );
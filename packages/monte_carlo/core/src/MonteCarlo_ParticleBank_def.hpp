@@ -15,28 +15,23 @@
 namespace MonteCarlo{
 
 // Push a particle to the bank
-/*! \details The bank will take ownership of the particle passed into it. To
- * ensure that it has ownership it will create a copy (clone) of the particle
- * and the input smart pointer will be reset.
+/*! \details The bank will take ownership of the particle passed into it
+ * (the particle will not be copied) and the input smart pointer will be
+ * reset.
  */
 template<template<typename> class SmartPointer, typename State>
 void ParticleBank::push( SmartPointer<State>& particle )
 {
   // Make sure the particle is valid
   testPrecondition( particle.get() );
-  // Check that use count is 1
-  // testPrecondition( particle.count() == 1 );
 
-  this->push( *particle );
-
-  particle.reset();
+  this->insert( ParticleBank::takeOwnership( particle ) );
 }
 
 // Push a neutron into the bank after an interaction
-/*! \details The bank will take ownership of the particle passed into it. To
- * ensure that it has ownership it will create a copy (clone) of the particle
- * and the input smart pointer will be reset. The smart pointer must point to
- * a NeutronState.
+/*! \details The bank will take ownership of the particle passed into it
+ * (the particle will not be copied) and the input smart pointer will be
+ * reset. The smart pointer must point to a NeutronState.
  */
 template<template<typename> class SmartPointer>
 void ParticleBank::push( SmartPointer<NeutronState>& neutron,
@@ -44,12 +39,37 @@ void ParticleBank::push( SmartPointer<NeutronState>& neutron,
 {
   // Make sure the particle is valid
   testPrecondition( neutron.get() );
-  // Check that use count is 1
-  // testPrecondition( particle.count() == 1 );
 
-  this->push( *neutron, reaction );
+  this->insert( ParticleBank::takeOwnership( neutron ), reaction );
+}
+
+// Take ownership of the particle stored in a smart pointer
+/*! \details The returned pointer shares the particle with a copy of the
+ * input smart pointer, which is released when the particle is no longer
+ * needed. The input smart pointer will be reset.
+ */
+template<template<typename> class SmartPointer, typename State>
+std::shared_ptr<State> ParticleBank::takeOwnership( 
+					       SmartPointer<State>& particle )
+{
+  SmartPointerDeleter<SmartPointer<State> > deleter;
+  deleter.owner = particle;
+
+  particle.reset();
+
+  return std::shared_ptr<State>( deleter.owner.get(), deleter );
+}
+
+// Take ownership of the particle stored in a std::shared_ptr
+template<typename State>
+std::shared_ptr<State> ParticleBank::takeOwnership( 
+					    std::shared_ptr<State>& particle )
+{
+  std::shared_ptr<State> owned_particle;
+
+  owned_particle.swap( particle );
 
-  neutron.reset();
+  return owned_particle;
 }
 
 // Pop the top particle from the bank and store it in the smart pointer
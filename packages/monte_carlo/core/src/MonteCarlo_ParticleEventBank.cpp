@@ -0,0 +1,570 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleEventBank.cpp
+//! \author Luke Kersting
+//! \brief  Particle event bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// Boost Includes
+#include <boost/bind.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventBank.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleEventBank::ParticleEventBank()
+  : d_history_numbers(),
+    d_generator_states(),
+    d_history_particles(),
+    d_committed_histories(),
+    d_estimator_events(),
+    d_particles(),
+    d_particle_histories(),
+    d_cross_sections(),
+    d_optical_paths(),
+    d_ray_start_points(),
+    d_collisions_pending(),
+    d_collision_track_lengths(),
+    d_collision_start_times()
+{ /* ... */ }
+
+// Add a history to the bank (returns the history index)
+unsigned ParticleEventBank::addHistory(
+				      const unsigned long long history_number )
+{
+  d_history_numbers.push_back( history_number );
+  d_generator_states.push_back( 0ull );
+  d_history_particles.push_back( 0ull );
+  d_committed_histories.push_back( false );
+  d_estimator_events.push_back( HistoryEvents() );
+
+  return d_history_numbers.size() - 1;
+}
+
+// Return the number of histories in the bank
+unsigned ParticleEventBank::getNumberOfHistories() const
+{
+  return d_history_numbers.size();
+}
+
+// Return the history number of a history
+unsigned long long ParticleEventBank::getHistoryNumber(
+					       const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_history_numbers[history];
+}
+
+// Set the random number generator state of a history
+void ParticleEventBank::setRandomNumberGeneratorState(
+					      const unsigned history,
+					      const unsigned long long state )
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  d_generator_states[history] = state;
+}
+
+// Return the random number generator state of a history
+unsigned long long ParticleEventBank::getRandomNumberGeneratorState(
+					       const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_generator_states[history];
+}
+
+// Check if a history has been completed (no particles remaining)
+bool ParticleEventBank::isHistoryComplete( const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_history_particles[history] == 0ull;
+}
+
+// Check if a history has been committed
+bool ParticleEventBank::isHistoryCommitted( const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_committed_histories[history];
+}
+
+// Set a history as committed (the recorded events will be cleared)
+void ParticleEventBank::setHistoryCommitted( const unsigned history )
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+  // Make sure the history has been completed
+  testPrecondition( this->isHistoryComplete( history ) );
+
+  d_committed_histories[history] = true;
+
+  HistoryEvents& events = d_estimator_events[history];
+
+  events.generation_events.clear();
+  events.crossing_surface_events.clear();
+  events.colliding_in_cell_events.clear();
+  events.colliding_global_events.clear();
+}
+
+// Return the particle generation events recorded for a history
+const Teuchos::Array<ParticleEventBank::ParticleStateData>&
+ParticleEventBank::getGenerationEvents( const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_estimator_events[history].generation_events;
+}
+
+// Return the particle crossing surface events recorded for a history
+const Teuchos::Array<ParticleEventBank::CrossingSurfaceEvent>&
+ParticleEventBank::getCrossingSurfaceEvents( const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_estimator_events[history].crossing_surface_events;
+}
+
+// Return the particle colliding in cell events recorded for a history
+const Teuchos::Array<ParticleEventBank::CollidingInCellEvent>&
+ParticleEventBank::getCollidingInCellEvents( const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_estimator_events[history].colliding_in_cell_events;
+}
+
+// Return the particle colliding global events recorded for a history
+const Teuchos::Array<ParticleEventBank::CollidingGlobalEvent>&
+ParticleEventBank::getCollidingGlobalEvents( const unsigned history ) const
+{
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+
+  return d_estimator_events[history].colliding_global_events;
+}
+
+// Restore a recorded particle state
+/*! \details The history number and the generation number of the particle
+ * are not recorded and will not be changed.
+ */
+void ParticleEventBank::restoreParticleState( const ParticleStateData& data,
+					      ParticleState& particle )
+{
+  // Make sure the particle type is valid
+  testPrecondition( particle.getParticleType() == data.particle_type );
+  
+  particle.setCell( data.cell );
+  particle.setPosition( data.position );
+  particle.setDirection( data.direction );
+  particle.setEnergy( data.energy );
+  particle.setTime( data.time );
+  particle.setWeight( data.weight );
+
+  particle.resetCollisionNumber();
+  
+  for( unsigned i = 0; i < data.collision_number; ++i )
+    particle.incrementCollisionNumber();
+}
+
+// Check if the bank is empty
+bool ParticleEventBank::isEmpty() const
+{
+  return d_particles.size() == 0;
+}
+
+// The number of particles in the bank
+unsigned long long ParticleEventBank::size() const
+{
+  return d_particles.size();
+}
+
+// Push a particle to the bank (returns the particle index)
+/*! \details The ray start point of the particle will be set to its current
+ * position and no optical path will be assigned to it.
+ */
+unsigned long long ParticleEventBank::push(
+			      const std::shared_ptr<ParticleState>& particle,
+			      const unsigned history )
+{
+  // Make sure the particle is valid
+  testPrecondition( particle.get() );
+  // Make sure the history is valid
+  testPrecondition( history < d_history_numbers.size() );
+  testPrecondition( !d_committed_histories[history] );
+
+  d_particles.push_back( particle );
+  d_particle_histories.push_back( history );
+  d_cross_sections.push_back( 0.0 );
+  d_optical_paths.push_back( 0.0 );
+  d_ray_start_points.push_back( particle->getXPosition() );
+  d_ray_start_points.push_back( particle->getYPosition() );
+  d_ray_start_points.push_back( particle->getZPosition() );
+  d_collisions_pending.push_back( false );
+  d_collision_track_lengths.push_back( 0.0 );
+  d_collision_start_times.push_back( 0.0 );
+
+  ++d_history_particles[history];
+
+  return d_particles.size() - 1;
+}
+
+// Set the total macroscopic cross section of the particle cell
+void ParticleEventBank::setCrossSection( const unsigned long long index,
+					 const double cross_section )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+  // Make sure the cross section is valid
+  testPrecondition( cross_section >= 0.0 );
+
+  d_cross_sections[index] = cross_section;
+}
+
+// Set the optical path remaining on the particle subtrack
+void ParticleEventBank::setOpticalPath( const unsigned long long index,
+					const double optical_path )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+  // Make sure the optical path is valid
+  testPrecondition( optical_path >= 0.0 );
+
+  d_optical_paths[index] = optical_path;
+}
+
+// Set the ray start point of a particle to its current position
+void ParticleEventBank::resetRayStartPoint( const unsigned long long index )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+
+  d_ray_start_points[3*index] = d_particles[index]->getXPosition();
+  d_ray_start_points[3*index+1] = d_particles[index]->getYPosition();
+  d_ray_start_points[3*index+2] = d_particles[index]->getZPosition();
+}
+
+// Set a pending collision (the particle is at the collision site)
+void ParticleEventBank::setCollisionPending( const unsigned long long index,
+					     const double track_length,
+					     const double start_time )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+  // Make sure the track length is valid
+  testPrecondition( track_length >= 0.0 );
+
+  d_collisions_pending[index] = true;
+  d_collision_track_lengths[index] = track_length;
+  d_collision_start_times[index] = start_time;
+}
+
+// Clear a pending collision
+void ParticleEventBank::clearCollisionPending( const unsigned long long index )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+
+  d_collisions_pending[index] = false;
+}
+
+// Return the track length to the pending collision site
+double ParticleEventBank::getCollisionTrackLength(
+				        const unsigned long long index ) const
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+  // Make sure a collision is pending
+  testPrecondition( d_collisions_pending[index] );
+
+  return d_collision_track_lengths[index];
+}
+
+// Return the start time of the subtrack ending at the collision site
+double ParticleEventBank::getCollisionStartTime(
+				        const unsigned long long index ) const
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+  // Make sure a collision is pending
+  testPrecondition( d_collisions_pending[index] );
+
+  return d_collision_start_times[index];
+}
+
+// Record a particle generation event
+void ParticleEventBank::recordGenerationEvent( const unsigned long long index )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+
+  Teuchos::Array<ParticleStateData>& events = 
+    d_estimator_events[d_particle_histories[index]].generation_events;
+
+  events.resize( events.size()+1 );
+  
+  this->recordParticleStateData( index, events.back() );
+}
+
+// Record a particle crossing surface event
+void ParticleEventBank::recordCrossingSurfaceEvent(
+	  const unsigned long long index,
+	  const Geometry::ModuleTraits::InternalCellHandle cell_entering,
+	  const Geometry::ModuleTraits::InternalCellHandle cell_leaving,
+	  const Geometry::ModuleTraits::InternalSurfaceHandle surface_crossing,
+	  const double track_length,
+	  const double start_time,
+	  const double surface_normal[3] )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+
+  Teuchos::Array<CrossingSurfaceEvent>& events = 
+    d_estimator_events[d_particle_histories[index]].crossing_surface_events;
+
+  events.resize( events.size()+1 );
+
+  CrossingSurfaceEvent& event = events.back();
+  
+  this->recordParticleStateData( index, event.particle );
+  event.cell_entering = cell_entering;
+  event.cell_leaving = cell_leaving;
+  event.surface_crossing = surface_crossing;
+  event.track_length = track_length;
+  event.start_time = start_time;
+  event.surface_normal[0] = surface_normal[0];
+  event.surface_normal[1] = surface_normal[1];
+  event.surface_normal[2] = surface_normal[2];
+}
+
+// Record the events of a pending collision (colliding in cell and global)
+/*! \details Both events use the same particle state data.
+ */
+void ParticleEventBank::recordCollisionEvents(
+					      const unsigned long long index )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+  // Make sure a collision is pending
+  testPrecondition( d_collisions_pending[index] );
+  // Make sure the cross section is valid
+  testPrecondition( d_cross_sections[index] > 0.0 );
+
+  Teuchos::Array<CollidingInCellEvent>& events = 
+    d_estimator_events[d_particle_histories[index]].colliding_in_cell_events;
+
+  events.resize( events.size()+1 );
+
+  CollidingInCellEvent& event = events.back();
+  
+  this->recordParticleStateData( index, event.particle );
+  event.track_length = d_collision_track_lengths[index];
+  event.start_time = d_collision_start_times[index];
+  event.inverse_total_cross_section = 1.0/d_cross_sections[index];
+
+  this->recordGlobalEvent( index, event.particle );
+}
+
+// Record a particle colliding global event (end of the particle ray)
+void ParticleEventBank::recordGlobalEvent( const unsigned long long index )
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_particles.size() );
+
+  ParticleStateData particle_data;
+  
+  this->recordParticleStateData( index, particle_data );
+  
+  this->recordGlobalEvent( index, particle_data );
+}
+
+// Record a particle colliding global event using existing state data
+void ParticleEventBank::recordGlobalEvent(
+				      const unsigned long long index,
+				      const ParticleStateData& particle_data )
+{
+  Teuchos::Array<CollidingGlobalEvent>& events = 
+    d_estimator_events[d_particle_histories[index]].colliding_global_events;
+
+  events.resize( events.size()+1 );
+
+  CollidingGlobalEvent& event = events.back();
+  
+  event.particle = particle_data;
+  event.start_point[0] = d_ray_start_points[3*index];
+  event.start_point[1] = d_ray_start_points[3*index+1];
+  event.start_point[2] = d_ray_start_points[3*index+2];
+  event.end_point[0] = d_particles[index]->getXPosition();
+  event.end_point[1] = d_particles[index]->getYPosition();
+  event.end_point[2] = d_particles[index]->getZPosition();
+}
+
+// Sort the particles by cell and energy
+/*! \details The sort is stable so that the order of particles with the same
+ * cell and energy does not change.
+ */
+void ParticleEventBank::sortParticles()
+{
+  Teuchos::Array<unsigned long long> permutation( d_particles.size() );
+
+  for( unsigned long long i = 0; i < permutation.size(); ++i )
+    permutation[i] = i;
+
+  std::stable_sort( permutation.begin(),
+		    permutation.end(),
+		    boost::bind<bool>( &ParticleEventBank::compareParticles,
+				       boost::cref( *this ),
+				       _1,
+				       _2 ) );
+
+  ParticleEventBank::permute( d_particles, permutation );
+  ParticleEventBank::permute( d_particle_histories, permutation );
+  ParticleEventBank::permute( d_cross_sections, permutation );
+  ParticleEventBank::permute( d_optical_paths, permutation );
+  ParticleEventBank::permute( d_ray_start_points, permutation, 3u );
+  ParticleEventBank::permute( d_collisions_pending, permutation );
+  ParticleEventBank::permute( d_collision_track_lengths, permutation );
+  ParticleEventBank::permute( d_collision_start_times, permutation );
+}
+
+// Remove the particles that are gone or lost
+/*! \details The order of the remaining particles will not change.
+ */
+void ParticleEventBank::removeInactiveParticles()
+{
+  unsigned long long active_particles = 0ull;
+
+  for( unsigned long long i = 0; i < d_particles.size(); ++i )
+  {
+    if( d_particles[i]->isGone() || d_particles[i]->isLost() )
+    {
+      --d_history_particles[d_particle_histories[i]];
+
+      continue;
+    }
+
+    if( i != active_particles )
+    {
+      const unsigned long long j = active_particles;
+
+      d_particles[j] = d_particles[i];
+      d_particle_histories[j] = d_particle_histories[i];
+      d_cross_sections[j] = d_cross_sections[i];
+      d_optical_paths[j] = d_optical_paths[i];
+      d_ray_start_points[3*j] = d_ray_start_points[3*i];
+      d_ray_start_points[3*j+1] = d_ray_start_points[3*i+1];
+      d_ray_start_points[3*j+2] = d_ray_start_points[3*i+2];
+      d_collisions_pending[j] = d_collisions_pending[i];
+      d_collision_track_lengths[j] = d_collision_track_lengths[i];
+      d_collision_start_times[j] = d_collision_start_times[i];
+    }
+
+    ++active_particles;
+  }
+
+  d_particles.resize( active_particles );
+  d_particle_histories.resize( active_particles );
+  d_cross_sections.resize( active_particles );
+  d_optical_paths.resize( active_particles );
+  d_ray_start_points.resize( 3*active_particles );
+  d_collisions_pending.resize( active_particles );
+  d_collision_track_lengths.resize( active_particles );
+  d_collision_start_times.resize( active_particles );
+}
+
+// Clear the bank (particles and histories)
+void ParticleEventBank::clear()
+{
+  d_history_numbers.clear();
+  d_generator_states.clear();
+  d_history_particles.clear();
+  d_committed_histories.clear();
+  d_estimator_events.clear();
+  d_particles.clear();
+  d_particle_histories.clear();
+  d_cross_sections.clear();
+  d_optical_paths.clear();
+  d_ray_start_points.clear();
+  d_collisions_pending.clear();
+  d_collision_track_lengths.clear();
+  d_collision_start_times.clear();
+}
+
+// Record the state data of a particle
+void ParticleEventBank::recordParticleStateData( 
+					      const unsigned long long index,
+					      ParticleStateData& data ) const
+{
+  const ParticleState& particle = *d_particles[index];
+  
+  data.particle_type = particle.getParticleType();
+  data.cell = particle.getCell();
+  data.collision_number = particle.getCollisionNumber();
+  data.position[0] = particle.getXPosition();
+  data.position[1] = particle.getYPosition();
+  data.position[2] = particle.getZPosition();
+  data.direction[0] = particle.getXDirection();
+  data.direction[1] = particle.getYDirection();
+  data.direction[2] = particle.getZDirection();
+  data.energy = particle.getEnergy();
+  data.time = particle.getTime();
+  data.weight = particle.getWeight();
+}
+
+// Apply a permutation to an array
+/*! \details The stride is the number of array elements that belong to
+ * every particle.
+ */
+template<typename T>
+void ParticleEventBank::permute(
+			 Teuchos::Array<T>& array,
+			 const Teuchos::Array<unsigned long long>& permutation,
+			 const unsigned stride )
+{
+  // Make sure the permutation is valid
+  testPrecondition( array.size() == stride*permutation.size() );
+
+  Teuchos::Array<T> permuted_array( array.size() );
+
+  for( unsigned long long i = 0; i < permutation.size(); ++i )
+  {
+    for( unsigned j = 0; j < stride; ++j )
+      permuted_array[stride*i+j] = array[stride*permutation[i]+j];
+  }
+
+  array.swap( permuted_array );
+}
+
+// Compare the cells and energies of two particles
+bool ParticleEventBank::compareParticles(
+				      const unsigned long long index_a,
+				      const unsigned long long index_b ) const
+{
+  if( d_particles[index_a]->getCell() != d_particles[index_b]->getCell() )
+    return d_particles[index_a]->getCell() < d_particles[index_b]->getCell();
+  else
+    return d_particles[index_a]->getEnergy() < d_particles[index_b]->getEnergy();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleEventBank.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,415 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleEventBank.hpp
+//! \author Luke Kersting
+//! \brief  Particle event bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_EVENT_BANK_HPP
+#define MONTE_CARLO_PARTICLE_EVENT_BANK_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_ModuleTraits.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle event bank class (structure of arrays)
+ * \details The event bank stores the particles of a batch of histories that
+ * are transported together, one event at a time. The tracking data of the
+ * particles (cross section, optical path, ray start point, pending
+ * collision) is stored in separate arrays so that every transport stage
+ * loops over contiguous data. The particles can be sorted by cell and energy
+ * between stages so that particles in the same material are processed
+ * together. Because the particles of different histories are interleaved,
+ * the estimator events of every history are recorded and must be replayed
+ * (followed by a commit) once the history has been completed. Only the
+ * particle state data that is used by the estimators is recorded and the
+ * events of each type are stored in a separate flat array. The random
+ * number generator state of every history is also stored so that every
+ * history uses its own random number stream.
+ */
+class ParticleEventBank
+{
+
+public:
+
+  //! The particle state data that is recorded with an estimator event
+  struct ParticleStateData
+  {
+    //! The particle type
+    ParticleType particle_type;
+
+    //! The cell containing the particle
+    Geometry::ModuleTraits::InternalCellHandle cell;
+
+    //! The collision number of the particle
+    ParticleState::collisionNumberType collision_number;
+
+    //! The particle position
+    double position[3];
+
+    //! The particle direction
+    double direction[3];
+
+    //! The particle energy
+    double energy;
+
+    //! The particle time
+    double time;
+
+    //! The particle weight
+    double weight;
+  };
+
+  //! A recorded particle crossing surface event
+  struct CrossingSurfaceEvent
+  {
+    //! The particle state at the time of the event
+    ParticleStateData particle;
+
+    //! The cell being entered
+    Geometry::ModuleTraits::InternalCellHandle cell_entering;
+
+    //! The cell being left
+    Geometry::ModuleTraits::InternalCellHandle cell_leaving;
+
+    //! The surface being crossed
+    Geometry::ModuleTraits::InternalSurfaceHandle surface_crossing;
+
+    //! The subtrack length
+    double track_length;
+
+    //! The subtrack start time
+    double start_time;
+
+    //! The surface normal
+    double surface_normal[3];
+  };
+
+  //! A recorded particle colliding in cell event
+  struct CollidingInCellEvent
+  {
+    //! The particle state at the time of the event
+    ParticleStateData particle;
+
+    //! The subtrack length
+    double track_length;
+
+    //! The subtrack start time
+    double start_time;
+
+    //! The inverse total cross section
+    double inverse_total_cross_section;
+  };
+
+  //! A recorded particle colliding global event
+  struct CollidingGlobalEvent
+  {
+    //! The particle state at the time of the event
+    ParticleStateData particle;
+
+    //! The ray start point
+    double start_point[3];
+
+    //! The ray end point
+    double end_point[3];
+  };
+
+  //! Constructor
+  ParticleEventBank();
+
+  //! Destructor
+  ~ParticleEventBank()
+  { /* ... */ }
+
+  //! Add a history to the bank (returns the history index)
+  unsigned addHistory( const unsigned long long history_number );
+
+  //! Return the number of histories in the bank
+  unsigned getNumberOfHistories() const;
+
+  //! Return the history number of a history
+  unsigned long long getHistoryNumber( const unsigned history ) const;
+
+  //! Set the random number generator state of a history
+  void setRandomNumberGeneratorState( const unsigned history,
+				      const unsigned long long state );
+
+  //! Return the random number generator state of a history
+  unsigned long long getRandomNumberGeneratorState(
+					       const unsigned history ) const;
+
+  //! Check if a history has been completed (no particles remaining)
+  bool isHistoryComplete( const unsigned history ) const;
+
+  //! Check if a history has been committed
+  bool isHistoryCommitted( const unsigned history ) const;
+
+  //! Set a history as committed (the recorded events will be cleared)
+  void setHistoryCommitted( const unsigned history );
+
+  //! Return the particle generation events recorded for a history
+  const Teuchos::Array<ParticleStateData>& getGenerationEvents(
+					       const unsigned history ) const;
+
+  //! Return the particle crossing surface events recorded for a history
+  const Teuchos::Array<CrossingSurfaceEvent>& getCrossingSurfaceEvents(
+					       const unsigned history ) const;
+
+  //! Return the particle colliding in cell events recorded for a history
+  const Teuchos::Array<CollidingInCellEvent>& getCollidingInCellEvents(
+					       const unsigned history ) const;
+
+  //! Return the particle colliding global events recorded for a history
+  const Teuchos::Array<CollidingGlobalEvent>& getCollidingGlobalEvents(
+					       const unsigned history ) const;
+
+  //! Restore a recorded particle state
+  static void restoreParticleState( const ParticleStateData& data,
+				    ParticleState& particle );
+
+  //! Check if the bank is empty
+  bool isEmpty() const;
+
+  //! The number of particles in the bank
+  unsigned long long size() const;
+
+  //! Push a particle to the bank (returns the particle index)
+  unsigned long long push( const std::shared_ptr<ParticleState>& particle,
+			   const unsigned history );
+
+  //! Access a particle
+  ParticleState& getParticle( const unsigned long long index );
+
+  //! Access a particle
+  const ParticleState& getParticle( const unsigned long long index ) const;
+
+  //! Access a particle of a known type
+  template<typename ParticleStateType>
+  ParticleStateType& getParticle( const unsigned long long index );
+
+  //! Return the history index of a particle
+  unsigned getHistory( const unsigned long long index ) const;
+
+  //! Set the total macroscopic cross section of the particle cell
+  void setCrossSection( const unsigned long long index,
+			const double cross_section );
+
+  //! Return the total macroscopic cross section of the particle cell
+  double getCrossSection( const unsigned long long index ) const;
+
+  //! Set the optical path remaining on the particle subtrack
+  void setOpticalPath( const unsigned long long index,
+		       const double optical_path );
+
+  //! Return the optical path remaining on the particle subtrack
+  double getOpticalPath( const unsigned long long index ) const;
+
+  //! Set the ray start point of a particle to its current position
+  void resetRayStartPoint( const unsigned long long index );
+
+  //! Return the ray start point of a particle
+  const double* getRayStartPoint( const unsigned long long index ) const;
+
+  //! Set a pending collision (the particle is at the collision site)
+  void setCollisionPending( const unsigned long long index,
+			    const double track_length,
+			    const double start_time );
+
+  //! Clear a pending collision
+  void clearCollisionPending( const unsigned long long index );
+
+  //! Check if a collision is pending
+  bool isCollisionPending( const unsigned long long index ) const;
+
+  //! Return the track length to the pending collision site
+  double getCollisionTrackLength( const unsigned long long index ) const;
+
+  //! Return the start time of the subtrack ending at the collision site
+  double getCollisionStartTime( const unsigned long long index ) const;
+
+  //! Record a particle generation event
+  void recordGenerationEvent( const unsigned long long index );
+
+  //! Record a particle crossing surface event
+  void recordCrossingSurfaceEvent(
+	  const unsigned long long index,
+	  const Geometry::ModuleTraits::InternalCellHandle cell_entering,
+	  const Geometry::ModuleTraits::InternalCellHandle cell_leaving,
+	  const Geometry::ModuleTraits::InternalSurfaceHandle surface_crossing,
+	  const double track_length,
+	  const double start_time,
+	  const double surface_normal[3] );
+
+  //! Record the events of a pending collision (colliding in cell and global)
+  void recordCollisionEvents( const unsigned long long index );
+
+  //! Record a particle colliding global event (end of the particle ray)
+  void recordGlobalEvent( const unsigned long long index );
+
+  //! Sort the particles by cell and energy
+  void sortParticles();
+
+  //! Remove the particles that are gone or lost
+  void removeInactiveParticles();
+
+  //! Clear the bank (particles and histories)
+  void clear();
+
+private:
+
+  // The estimator events recorded for a history
+  struct HistoryEvents
+  {
+    // The particle generation events
+    Teuchos::Array<ParticleStateData> generation_events;
+
+    // The particle crossing surface events
+    Teuchos::Array<CrossingSurfaceEvent> crossing_surface_events;
+
+    // The particle colliding in cell events
+    Teuchos::Array<CollidingInCellEvent> colliding_in_cell_events;
+
+    // The particle colliding global events
+    Teuchos::Array<CollidingGlobalEvent> colliding_global_events;
+  };
+
+  // Record the state data of a particle
+  void recordParticleStateData( const unsigned long long index,
+				ParticleStateData& data ) const;
+
+  // Record a particle colliding global event using existing state data
+  void recordGlobalEvent( const unsigned long long index,
+			  const ParticleStateData& particle_data );
+
+  // Apply a permutation to an array
+  template<typename T>
+  static void permute( Teuchos::Array<T>& array,
+		       const Teuchos::Array<unsigned long long>& permutation,
+		       const unsigned stride = 1u );
+
+  // Compare the cells and energies of two particles
+  bool compareParticles( const unsigned long long index_a,
+			 const unsigned long long index_b ) const;
+
+  // The history numbers
+  Teuchos::Array<unsigned long long> d_history_numbers;
+
+  // The random number generator state of every history
+  Teuchos::Array<unsigned long long> d_generator_states;
+
+  // The number of particles in the bank from every history
+  Teuchos::Array<unsigned long long> d_history_particles;
+
+  // The committed histories
+  Teuchos::Array<bool> d_committed_histories;
+
+  // The estimator events recorded for every history
+  Teuchos::Array<HistoryEvents> d_estimator_events;
+
+  // The particles
+  Teuchos::Array<std::shared_ptr<ParticleState> > d_particles;
+
+  // The history index of every particle
+  Teuchos::Array<unsigned> d_particle_histories;
+
+  // The total macroscopic cross section of the cell of every particle
+  Teuchos::Array<double> d_cross_sections;
+
+  // The optical path remaining on the subtrack of every particle
+  Teuchos::Array<double> d_optical_paths;
+
+  // The ray start point of every particle (x, y, z of every particle)
+  Teuchos::Array<double> d_ray_start_points;
+
+  // The pending collision of every particle
+  Teuchos::Array<bool> d_collisions_pending;
+
+  // The track length to the pending collision site of every particle
+  Teuchos::Array<double> d_collision_track_lengths;
+
+  // The start time of the subtrack ending at the collision site
+  Teuchos::Array<double> d_collision_start_times;
+};
+
+// Access a particle
+inline ParticleState& ParticleEventBank::getParticle(
+					      const unsigned long long index )
+{
+  return *d_particles[index];
+}
+
+// Access a particle
+inline const ParticleState& ParticleEventBank::getParticle(
+				        const unsigned long long index ) const
+{
+  return *d_particles[index];
+}
+
+// Access a particle of a known type
+/*! \details The particle type is only checked when DBC is enabled. This
+ * should be used by the transport stages, which only see particles of the 
+ * type that the batch is transporting.
+ */
+template<typename ParticleStateType>
+inline ParticleStateType& ParticleEventBank::getParticle(
+					      const unsigned long long index )
+{
+  // Make sure the particle type is valid
+  testPrecondition( d_particles[index]->getParticleType() == 
+		    ParticleStateType::type );
+  
+  return static_cast<ParticleStateType&>( *d_particles[index] );
+}
+
+// Return the history index of a particle
+inline unsigned ParticleEventBank::getHistory(
+				        const unsigned long long index ) const
+{
+  return d_particle_histories[index];
+}
+
+// Return the total macroscopic cross section of the particle cell
+inline double ParticleEventBank::getCrossSection(
+				        const unsigned long long index ) const
+{
+  return d_cross_sections[index];
+}
+
+// Return the optical path remaining on the particle subtrack
+inline double ParticleEventBank::getOpticalPath(
+				        const unsigned long long index ) const
+{
+  return d_optical_paths[index];
+}
+
+// Return the ray start point of a particle
+inline const double* ParticleEventBank::getRayStartPoint(
+				        const unsigned long long index ) const
+{
+  return &d_ray_start_points[3*index];
+}
+
+// Check if a collision is pending
+inline bool ParticleEventBank::isCollisionPending(
+				        const unsigned long long index ) const
+{
+  return d_collisions_pending[index];
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_EVENT_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleEventBank.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,256 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PerformanceCounters.cpp
+//! \author Luke Kersting
+//! \brief  The performance counters class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+
+// Trilinos Includes
+#include <Teuchos_CommHelpers.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PerformanceCounters.hpp"
+#include "Utility_HDF5FileHandler.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+Teuchos::Array<Teuchos::Array<unsigned long long> > 
+PerformanceCounters::counters( 
+	     1, Teuchos::Array<unsigned long long>( NUMBER_OF_COUNTERS, 0ull ) );
+
+Teuchos::Array<Teuchos::Array<double> > PerformanceCounters::timers( 
+		     1, Teuchos::Array<double>( NUMBER_OF_TIMERS, 0.0 ) );
+
+// Initialize the counters for the requested number of threads (reset)
+void PerformanceCounters::initialize( const unsigned num_threads )
+{
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+  
+  counters.clear();
+  counters.resize( num_threads, 
+		   Teuchos::Array<unsigned long long>( NUMBER_OF_COUNTERS ) );
+
+  timers.clear();
+  timers.resize( num_threads, Teuchos::Array<double>( NUMBER_OF_TIMERS ) );
+
+  PerformanceCounters::reset();
+}
+
+// Reset the counters
+void PerformanceCounters::reset()
+{
+  for( unsigned i = 0; i < counters.size(); ++i )
+  {
+    counters[i].assign( NUMBER_OF_COUNTERS, 0ull );
+    timers[i].assign( NUMBER_OF_TIMERS, 0.0 );
+  }
+}
+
+// Increment the collision counter of a particle type on the calling thread
+void PerformanceCounters::incrementCollisions( 
+					    const ParticleType particle_type )
+{
+  switch( particle_type )
+  {
+  case NEUTRON:
+    PerformanceCounters::increment( NEUTRON_COLLISIONS );
+    break;
+  case PHOTON:
+    PerformanceCounters::increment( PHOTON_COLLISIONS );
+    break;
+  case ELECTRON:
+    PerformanceCounters::increment( ELECTRON_COLLISIONS );
+    break;
+  default:
+    break;
+  }
+}
+
+// Return the value of a counter (summed over all threads)
+unsigned long long PerformanceCounters::getCount( const Counter counter )
+{
+  // Make sure the counter is valid
+  testPrecondition( counter < NUMBER_OF_COUNTERS );
+  
+  unsigned long long count = 0ull;
+
+  for( unsigned i = 0; i < counters.size(); ++i )
+    count += counters[i][counter];
+
+  return count;
+}
+
+// Return the value of a timer (summed over all threads)
+double PerformanceCounters::getTime( const Timer timer )
+{
+  // Make sure the timer is valid
+  testPrecondition( timer < NUMBER_OF_TIMERS );
+  
+  double time = 0.0;
+
+  for( unsigned i = 0; i < timers.size(); ++i )
+    time += timers[i][timer];
+
+  return time;
+}
+
+// Reduce the counters on all processes in comm (collected on all procs)
+/*! \details The thread counters are summed before the reduction. After the
+ * reduction the summed values are stored in the counters of the first 
+ * thread and the other thread counters are reset.
+ */
+void PerformanceCounters::reduceData( 
+	   const Teuchos::RCP<const Teuchos::Comm<unsigned long long> >& comm )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  // Make sure the comm is valid
+  testPrecondition( !comm.is_null() );
+
+  Teuchos::Array<unsigned long long> local_counts( NUMBER_OF_COUNTERS ),
+    global_counts( NUMBER_OF_COUNTERS );
+
+  for( unsigned i = 0; i < NUMBER_OF_COUNTERS; ++i )
+    local_counts[i] = PerformanceCounters::getCount( (Counter)i );
+
+  Teuchos::Array<double> local_times( NUMBER_OF_TIMERS ),
+    global_times( NUMBER_OF_TIMERS );
+
+  for( unsigned i = 0; i < NUMBER_OF_TIMERS; ++i )
+    local_times[i] = PerformanceCounters::getTime( (Timer)i );
+
+  try{
+    Teuchos::reduceAll<unsigned long long,unsigned long long>( 
+						    *comm,
+						    Teuchos::REDUCE_SUM,
+						    NUMBER_OF_COUNTERS,
+						    local_counts.getRawPtr(),
+						    global_counts.getRawPtr() );
+
+    Teuchos::reduceAll<unsigned long long,double>( *comm,
+						   Teuchos::REDUCE_SUM,
+						   NUMBER_OF_TIMERS,
+						   local_times.getRawPtr(),
+						   global_times.getRawPtr() );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: unable to reduce the performance "
+			   "counters!" );
+
+  PerformanceCounters::reset();
+
+  counters[0] = global_counts;
+  timers[0] = global_times;
+}
+
+// Print a summary of the counters
+void PerformanceCounters::printSummary( std::ostream& os )
+{
+  if( !PerformanceCounters::areCountersEnabled() )
+    return;
+  
+  os << "Performance Counters: " << std::endl;
+  
+  for( unsigned i = 0; i < NUMBER_OF_COUNTERS; ++i )
+  {
+    os << " " << PerformanceCounters::getName( (Counter)i ) << ": " 
+       << PerformanceCounters::getCount( (Counter)i ) << std::endl;
+  }
+
+  os << "Performance Timers (thread time in s): " << std::endl;
+
+  for( unsigned i = 0; i < NUMBER_OF_TIMERS; ++i )
+  {
+    os << " " << PerformanceCounters::getName( (Timer)i ) << ": " 
+       << PerformanceCounters::getTime( (Timer)i ) << std::endl;
+  }
+}
+
+// Export the counters to an HDF5 file (appended to the file)
+/*! \details The counters and timers are stored as attributes of the
+ * /performance_counters/ group.
+ */
+void PerformanceCounters::exportData( const std::string& hdf5_file_name )
+{
+  if( !PerformanceCounters::areCountersEnabled() )
+    return;
+  
+  Utility::HDF5FileHandler hdf5_file;
+  hdf5_file.throwExceptions();
+
+  try{
+    hdf5_file.openHDF5FileAndAppend( hdf5_file_name );
+
+    for( unsigned i = 0; i < NUMBER_OF_COUNTERS; ++i )
+    {
+      hdf5_file.writeValueToGroupAttribute( 
+				  PerformanceCounters::getCount( (Counter)i ),
+				  "/performance_counters/",
+				  PerformanceCounters::getName( (Counter)i ) );
+    }
+
+    for( unsigned i = 0; i < NUMBER_OF_TIMERS; ++i )
+    {
+      hdf5_file.writeValueToGroupAttribute( 
+				    PerformanceCounters::getTime( (Timer)i ),
+				    "/performance_counters/",
+				    PerformanceCounters::getName( (Timer)i ) );
+    }
+
+    hdf5_file.closeHDF5File();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: the performance counters could not be "
+			   "written to file " << hdf5_file_name << "!" );
+}
+
+// Return the name of a counter
+std::string PerformanceCounters::getName( const Counter counter )
+{
+  switch( counter )
+  {
+  case RAY_FIRES: return "ray_fires";
+  case SURFACE_CROSSINGS: return "surface_crossings";
+  case NEUTRON_COLLISIONS: return "neutron_collisions";
+  case PHOTON_COLLISIONS: return "photon_collisions";
+  case ELECTRON_COLLISIONS: return "electron_collisions";
+  case SECONDARIES_BANKED: return "secondaries_banked";
+  case LOST_PARTICLES: return "lost_particles";
+  case CROSS_SECTION_LOOKUPS: return "cross_section_lookups";
+  default:
+    THROW_EXCEPTION( std::logic_error,
+		     "Error: performance counter " << counter << 
+		     " does not have a name!" );
+  }
+}
+
+// Return the name of a timer
+std::string PerformanceCounters::getName( const Timer timer )
+{
+  switch( timer )
+  {
+  case GEOMETRY_TIME: return "geometry_time";
+  case COLLISION_TIME: return "collision_time";
+  case ESTIMATOR_TIME: return "estimator_time";
+  case SOURCE_TIME: return "source_time";
+  default:
+    THROW_EXCEPTION( std::logic_error,
+		     "Error: performance timer " << timer << 
+		     " does not have a name!" );
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PerformanceCounters.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,240 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PerformanceCounters.hpp
+//! \author Luke Kersting
+//! \brief  The performance counters class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PERFORMANCE_COUNTERS_HPP
+#define MONTE_CARLO_PERFORMANCE_COUNTERS_HPP
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+#include <Teuchos_Comm.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleType.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+#include "FRENSIE_config.hpp"
+
+namespace MonteCarlo{
+
+/*! The performance counters class (singleton)
+ * \details Every thread has its own set of counters and timers so that no
+ * synchronization is required on the hot path. The counters should only be
+ * updated with the performance counter macros, which compile to nothing 
+ * unless FRENSIE was configured with FRENSIE_ENABLE_PERFORMANCE_COUNTERS.
+ * The counters must be initialized for the requested number of threads 
+ * before a simulation is run.
+ */
+class PerformanceCounters
+{
+
+public:
+
+  //! The event counters
+  enum Counter{
+    RAY_FIRES = 0,
+    SURFACE_CROSSINGS,
+    NEUTRON_COLLISIONS,
+    PHOTON_COLLISIONS,
+    ELECTRON_COLLISIONS,
+    SECONDARIES_BANKED,
+    LOST_PARTICLES,
+    CROSS_SECTION_LOOKUPS,
+    NUMBER_OF_COUNTERS
+  };
+
+  //! The phase timers
+  enum Timer{
+    GEOMETRY_TIME = 0,
+    COLLISION_TIME,
+    ESTIMATOR_TIME,
+    SOURCE_TIME,
+    NUMBER_OF_TIMERS
+  };
+
+  //! Initialize the counters for the requested number of threads (reset)
+  static void initialize( const unsigned num_threads );
+
+  //! Reset the counters
+  static void reset();
+
+  //! Increment a counter on the calling thread
+  static void increment( const Counter counter,
+			 const unsigned long long value = 1ull );
+
+  //! Increment the collision counter of a particle type on the calling thread
+  static void incrementCollisions( const ParticleType particle_type );
+
+  //! Add time to a timer on the calling thread
+  static void addTime( const Timer timer, const double time );
+
+  //! Return the value of a counter (summed over all threads)
+  static unsigned long long getCount( const Counter counter );
+
+  //! Return the value of a timer (summed over all threads)
+  static double getTime( const Timer timer );
+
+  //! Reduce the counters on all processes in comm (collected on all procs)
+  static void reduceData( 
+	  const Teuchos::RCP<const Teuchos::Comm<unsigned long long> >& comm );
+
+  //! Print a summary of the counters
+  static void printSummary( std::ostream& os );
+
+  //! Export the counters to an HDF5 file (appended to the file)
+  static void exportData( const std::string& hdf5_file_name );
+
+  //! Return the name of a counter
+  static std::string getName( const Counter counter );
+
+  //! Return the name of a timer
+  static std::string getName( const Timer timer );
+
+  //! Check if the performance counters have been compiled in
+  static bool areCountersEnabled();
+
+private:
+
+  // Constructor
+  PerformanceCounters();
+
+  // The counters of every thread
+  static Teuchos::Array<Teuchos::Array<unsigned long long> > counters;
+
+  // The timers of every thread
+  static Teuchos::Array<Teuchos::Array<double> > timers;
+};
+
+/*! The performance timer guard
+ * \details The time between the construction and the destruction of the 
+ * guard is added to the timer on the calling thread. Since the time is added
+ * in the destructor, it will be recorded even when the scope is left early 
+ * (e.g. break, return or a thrown exception). The guard should only be 
+ * created with the SCOPED_PERFORMANCE_TIMER macro.
+ */
+class PerformanceTimerGuard
+{
+
+public:
+
+  //! Constructor (start the timer)
+  PerformanceTimerGuard( const PerformanceCounters::Timer timer )
+    : d_timer( timer ),
+      d_start_time( Utility::GlobalOpenMPSession::getTime() )
+  { /* ... */ }
+
+  //! Destructor (stop the timer)
+  ~PerformanceTimerGuard()
+  { 
+    PerformanceCounters::addTime( 
+		 d_timer, Utility::GlobalOpenMPSession::getTime() - d_start_time );
+  }
+
+private:
+
+  // Copy constructor (not allowed)
+  PerformanceTimerGuard( const PerformanceTimerGuard& other );
+
+  // Assignment operator (not allowed)
+  PerformanceTimerGuard& operator=( const PerformanceTimerGuard& other );
+
+  // The timer
+  PerformanceCounters::Timer d_timer;
+
+  // The start time
+  double d_start_time;
+};
+
+// Increment a counter on the calling thread
+inline void PerformanceCounters::increment( const Counter counter,
+					    const unsigned long long value )
+{
+  counters[Utility::GlobalOpenMPSession::getThreadId()][counter] += value;
+}
+
+// Add time to a timer on the calling thread
+inline void PerformanceCounters::addTime( const Timer timer, 
+					  const double time )
+{
+  timers[Utility::GlobalOpenMPSession::getThreadId()][timer] += time;
+}
+
+// Check if the performance counters have been compiled in
+inline bool PerformanceCounters::areCountersEnabled()
+{
+#if HAVE_FRENSIE_PERFORMANCE_COUNTERS
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Performance counter macros
+//---------------------------------------------------------------------------//
+
+#if HAVE_FRENSIE_PERFORMANCE_COUNTERS
+
+//! Increment a performance counter
+#define INCREMENT_PERFORMANCE_COUNTER( counter, value )			\
+  MonteCarlo::PerformanceCounters::increment(				\
+			   MonteCarlo::PerformanceCounters::counter, value )
+
+//! Increment the collision counter of a particle type
+#define INCREMENT_COLLISION_COUNTER( particle_type )			\
+  MonteCarlo::PerformanceCounters::incrementCollisions( particle_type )
+
+//! Record the size of a particle bank (must be stopped in the same scope)
+#define START_SECONDARIES_BANKED_COUNTER( bank )				\
+  const unsigned long long bank##_start_size = bank.size()
+
+//! Add the particles banked since the counter was started
+#define STOP_SECONDARIES_BANKED_COUNTER( bank )				\
+  MonteCarlo::PerformanceCounters::increment(				\
+			    MonteCarlo::PerformanceCounters::SECONDARIES_BANKED, \
+			    bank.size() - bank##_start_size )
+
+//! Start a performance timer (must be stopped in the same scope)
+/*! \details Use SCOPED_PERFORMANCE_TIMER if the scope can be left early.
+ */
+#define START_PERFORMANCE_TIMER( timer )				\
+  const double timer##_start_time = Utility::GlobalOpenMPSession::getTime()
+
+//! Stop a performance timer
+#define STOP_PERFORMANCE_TIMER( timer )					\
+  MonteCarlo::PerformanceCounters::addTime(				\
+     MonteCarlo::PerformanceCounters::timer,				\
+     Utility::GlobalOpenMPSession::getTime() - timer##_start_time )
+
+//! Time the remainder of the current scope (stopped when the scope is left)
+#define SCOPED_PERFORMANCE_TIMER( timer )				\
+  MonteCarlo::PerformanceTimerGuard timer##_guard(			\
+			      MonteCarlo::PerformanceCounters::timer )
+
+#else
+
+#define INCREMENT_PERFORMANCE_COUNTER( counter, value )
+#define INCREMENT_COLLISION_COUNTER( particle_type )
+#define START_SECONDARIES_BANKED_COUNTER( bank )
+#define STOP_SECONDARIES_BANKED_COUNTER( bank )
+#define START_PERFORMANCE_TIMER( timer )
+#define STOP_PERFORMANCE_TIMER( timer )
+#define SCOPED_PERFORMANCE_TIMER( timer )
+
+#endif // end HAVE_FRENSIE_PERFORMANCE_COUNTERS
+
+#endif // end MONTE_CARLO_PERFORMANCE_COUNTERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PerformanceCounters.hpp
+//---------------------------------------------------------------------------//
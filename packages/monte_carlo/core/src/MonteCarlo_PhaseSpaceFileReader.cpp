@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceFileReader.cpp
+//! \author Luke Kersting
+//! \brief  The phase space file reader class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+
+// POSIX Includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceFileReader.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+PhaseSpaceFileReader::PhaseSpaceFileReader( const std::string& file_name )
+  : d_mapped_file( MAP_FAILED ),
+    d_mapped_file_size( 0 ),
+    d_records( NULL ),
+    d_number_of_records( 0ull ),
+    d_history_offsets()
+{
+  // Make sure the file name is valid
+  testPrecondition( file_name.size() > 0 );
+
+  int file_descriptor = ::open( file_name.c_str(), O_RDONLY );
+
+  TEST_FOR_EXCEPTION( file_descriptor < 0,
+		      std::runtime_error,
+		      "Error: The phase space file " << file_name <<
+		      " could not be opened!" );
+
+  struct stat file_status;
+
+  if( ::fstat( file_descriptor, &file_status ) != 0 ||
+      file_status.st_size < (off_t)sizeof(PhaseSpaceFileHeader) )
+  {
+    ::close( file_descriptor );
+
+    THROW_EXCEPTION( std::runtime_error,
+		     "Error: The phase space file " << file_name <<
+		     " is not a valid phase space file!" );
+  }
+
+  d_mapped_file_size = file_status.st_size;
+
+  d_mapped_file = ::mmap( NULL,
+			  d_mapped_file_size,
+			  PROT_READ,
+			  MAP_PRIVATE,
+			  file_descriptor,
+			  0 );
+
+  // The mapping stays valid after the file descriptor is closed
+  ::close( file_descriptor );
+
+  TEST_FOR_EXCEPTION( d_mapped_file == MAP_FAILED,
+		      std::runtime_error,
+		      "Error: The phase space file " << file_name <<
+		      " could not be memory mapped!" );
+
+  const PhaseSpaceFileHeader& header =
+    *reinterpret_cast<const PhaseSpaceFileHeader*>( d_mapped_file );
+
+  bool valid_file = isPhaseSpaceFileHeaderValid( header ) &&
+    header.number_of_records <=
+    (d_mapped_file_size - sizeof(header))/sizeof(PhaseSpaceRecord);
+
+  if( !valid_file )
+  {
+    ::munmap( d_mapped_file, d_mapped_file_size );
+
+    d_mapped_file = MAP_FAILED;
+
+    THROW_EXCEPTION( std::runtime_error,
+		     "Error: The phase space file " << file_name <<
+		     " is not a valid phase space file (or it was not "
+		     "closed)!" );
+  }
+
+  d_number_of_records = header.number_of_records;
+
+  d_records = reinterpret_cast<const PhaseSpaceRecord*>(
+		 reinterpret_cast<const char*>( d_mapped_file ) + sizeof(header) );
+
+  // The records will be read in order
+  ::madvise( d_mapped_file, d_mapped_file_size, MADV_SEQUENTIAL );
+
+  this->indexHistories();
+
+  // The histories will be sampled in any order
+  ::madvise( d_mapped_file, d_mapped_file_size, MADV_NORMAL );
+}
+
+// Destructor
+PhaseSpaceFileReader::~PhaseSpaceFileReader()
+{
+  if( d_mapped_file != MAP_FAILED )
+    ::munmap( d_mapped_file, d_mapped_file_size );
+}
+
+// Return the number of records in the file
+unsigned long long PhaseSpaceFileReader::getNumberOfRecords() const
+{
+  return d_number_of_records;
+}
+
+// Return the number of histories in the file
+unsigned long long PhaseSpaceFileReader::getNumberOfHistories() const
+{
+  return d_history_offsets.size() - 1;
+}
+
+// Return the number of records of a history
+unsigned long long PhaseSpaceFileReader::getNumberOfHistoryRecords(
+				   const unsigned long long history_index ) const
+{
+  // Make sure the history index is valid
+  testPrecondition( history_index < this->getNumberOfHistories() );
+
+  return d_history_offsets[history_index+1] -
+    d_history_offsets[history_index];
+}
+
+// Return the records of a history
+const PhaseSpaceRecord* PhaseSpaceFileReader::getHistoryRecords(
+				   const unsigned long long history_index ) const
+{
+  // Make sure the history index is valid
+  testPrecondition( history_index < this->getNumberOfHistories() );
+
+  return d_records + d_history_offsets[history_index];
+}
+
+// Return a record
+const PhaseSpaceRecord& PhaseSpaceFileReader::getRecord(
+				    const unsigned long long record_index ) const
+{
+  // Make sure the record index is valid
+  testPrecondition( record_index < d_number_of_records );
+
+  return d_records[record_index];
+}
+
+// Find the first record of each history
+void PhaseSpaceFileReader::indexHistories()
+{
+  d_history_offsets.clear();
+
+  for( unsigned long long i = 0ull; i < d_number_of_records; ++i )
+  {
+    if( i == 0ull ||
+	d_records[i].history_number != d_records[i-1].history_number )
+      d_history_offsets.push_back( i );
+  }
+
+  d_history_offsets.push_back( d_number_of_records );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceFileReader.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceFileReader.hpp
+//! \author Luke Kersting
+//! \brief  The phase space file reader class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PHASE_SPACE_FILE_READER_HPP
+#define MONTE_CARLO_PHASE_SPACE_FILE_READER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <cstddef>
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceRecord.hpp"
+
+namespace MonteCarlo{
+
+/*! The phase space file reader class
+ * \details The file is memory mapped (read only) so that the records are
+ * paged in by the operating system as they are accessed instead of being
+ * loaded all at once. The only data that is stored is the offset of the
+ * first record of each history, which is found with a single pass over the
+ * records when the file is opened. The records of a history must be stored
+ * contiguously (see MonteCarlo::PhaseSpaceFileWriter). The histories are
+ * indexed in the order that they appear in the file.
+ */
+class PhaseSpaceFileReader
+{
+
+public:
+
+  //! Constructor
+  PhaseSpaceFileReader( const std::string& file_name );
+
+  //! Destructor
+  ~PhaseSpaceFileReader();
+
+  //! Return the number of records in the file
+  unsigned long long getNumberOfRecords() const;
+
+  //! Return the number of histories in the file
+  unsigned long long getNumberOfHistories() const;
+
+  //! Return the number of records of a history
+  unsigned long long getNumberOfHistoryRecords(
+				  const unsigned long long history_index ) const;
+
+  //! Return the records of a history
+  const PhaseSpaceRecord* getHistoryRecords(
+				  const unsigned long long history_index ) const;
+
+  //! Return a record
+  const PhaseSpaceRecord& getRecord(
+				   const unsigned long long record_index ) const;
+
+private:
+
+  // Copy constructor
+  PhaseSpaceFileReader( const PhaseSpaceFileReader& other );
+
+  // Assignment operator
+  PhaseSpaceFileReader& operator=( const PhaseSpaceFileReader& other );
+
+  // Find the first record of each history
+  void indexHistories();
+
+  // The mapped file
+  void* d_mapped_file;
+
+  // The size of the mapped file
+  std::size_t d_mapped_file_size;
+
+  // The records
+  const PhaseSpaceRecord* d_records;
+
+  // The number of records
+  unsigned long long d_number_of_records;
+
+  // The first record of each history (the last entry is the number of recs.)
+  Teuchos::Array<unsigned long long> d_history_offsets;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PHASE_SPACE_FILE_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceFileReader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceFileWriter.cpp
+//! \author Luke Kersting
+//! \brief  The phase space file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details Any existing file with the same name will be overwritten.
+ */
+PhaseSpaceFileWriter::PhaseSpaceFileWriter( const std::string& file_name )
+  : d_file_name( file_name ),
+    d_file( NULL ),
+    d_number_of_records( 0ull )
+{
+  // Make sure the file name is valid
+  testPrecondition( file_name.size() > 0 );
+
+  d_file = std::fopen( file_name.c_str(), "wb" );
+
+  TEST_FOR_EXCEPTION( d_file == NULL,
+		      std::runtime_error,
+		      "Error: The phase space file " << file_name <<
+		      " could not be opened!" );
+
+  PhaseSpaceFileHeader header;
+  initializePhaseSpaceFileHeader( header );
+
+  TEST_FOR_EXCEPTION( std::fwrite( &header, sizeof(header), 1, d_file ) != 1,
+		      std::runtime_error,
+		      "Error: The phase space file header could not be "
+		      "written to " << file_name << "!" );
+}
+
+// Destructor
+/*! \details The destructor will close the file but it will not throw if
+ * the header could not be updated.
+ */
+PhaseSpaceFileWriter::~PhaseSpaceFileWriter()
+{
+  try{
+    this->close();
+  }
+  catch( ... )
+  { /* ... */ }
+}
+
+// Append a block of records to the file
+void PhaseSpaceFileWriter::write( const PhaseSpaceRecord* records,
+				  const unsigned long long number_of_records )
+{
+  // Make sure the file is open
+  testPrecondition( this->isOpen() );
+  // Make sure the records are valid
+  testPrecondition( records != NULL || number_of_records == 0ull );
+
+  if( number_of_records > 0ull )
+  {
+    bool write_failed;
+
+    #pragma omp critical( phase_space_file_write )
+    {
+      write_failed = std::fwrite( records,
+				  sizeof(PhaseSpaceRecord),
+				  number_of_records,
+				  d_file ) != number_of_records;
+
+      if( !write_failed )
+	d_number_of_records += number_of_records;
+    }
+
+    TEST_FOR_EXCEPTION( write_failed,
+			std::runtime_error,
+			"Error: The phase space records could not be written "
+			"to " << d_file_name << "!" );
+  }
+}
+
+// Close the file
+/*! \details The number of records in the file header will be updated
+ * before the file is closed.
+ */
+void PhaseSpaceFileWriter::close()
+{
+  if( this->isOpen() )
+  {
+    PhaseSpaceFileHeader header;
+    initializePhaseSpaceFileHeader( header );
+
+    header.number_of_records = d_number_of_records;
+
+    bool update_failed = std::fseek( d_file, 0, SEEK_SET ) != 0 ||
+      std::fwrite( &header, sizeof(header), 1, d_file ) != 1;
+
+    update_failed = (std::fclose( d_file ) != 0) || update_failed;
+
+    d_file = NULL;
+
+    TEST_FOR_EXCEPTION( update_failed,
+			std::runtime_error,
+			"Error: The phase space file " << d_file_name <<
+			" could not be closed!" );
+  }
+}
+
+// Check if the file is open
+bool PhaseSpaceFileWriter::isOpen() const
+{
+  return d_file != NULL;
+}
+
+// Return the number of records that have been written
+unsigned long long PhaseSpaceFileWriter::getNumberOfRecords() const
+{
+  return d_number_of_records;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceFileWriter.cpp
+//---------------------------------------------------------------------------//
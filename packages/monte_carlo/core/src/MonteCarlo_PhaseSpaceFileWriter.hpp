@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceFileWriter.hpp
+//! \author Luke Kersting
+//! \brief  The phase space file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PHASE_SPACE_FILE_WRITER_HPP
+#define MONTE_CARLO_PHASE_SPACE_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <cstdio>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceRecord.hpp"
+
+namespace MonteCarlo{
+
+/*! The phase space file writer class
+ * \details Blocks of fixed size records are appended to the file as they
+ * are written so that the phase space never has to be stored in memory.
+ * The number of records in the file header is updated when the file is
+ * closed. The write method can be called by multiple threads - each block
+ * is appended atomically.
+ */
+class PhaseSpaceFileWriter
+{
+
+public:
+
+  //! Constructor
+  PhaseSpaceFileWriter( const std::string& file_name );
+
+  //! Destructor
+  ~PhaseSpaceFileWriter();
+
+  //! Append a block of records to the file
+  void write( const PhaseSpaceRecord* records,
+	      const unsigned long long number_of_records );
+
+  //! Close the file
+  void close();
+
+  //! Check if the file is open
+  bool isOpen() const;
+
+  //! Return the number of records that have been written
+  unsigned long long getNumberOfRecords() const;
+
+private:
+
+  // Copy constructor
+  PhaseSpaceFileWriter( const PhaseSpaceFileWriter& other );
+
+  // Assignment operator
+  PhaseSpaceFileWriter& operator=( const PhaseSpaceFileWriter& other );
+
+  // The file name
+  std::string d_file_name;
+
+  // The file
+  std::FILE* d_file;
+
+  // The number of records written
+  unsigned long long d_number_of_records;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PHASE_SPACE_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceFileWriter.hpp
+//---------------------------------------------------------------------------//
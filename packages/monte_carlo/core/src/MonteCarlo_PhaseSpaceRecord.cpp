@@ -0,0 +1,93 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceRecord.cpp
+//! \author Luke Kersting
+//! \brief  Phase space record definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceRecord.hpp"
+#include "MonteCarlo_ParticleStateFactory.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// The phase space file identifier
+const char phase_space_file_identifier[8] = {'F','R','N','S','P','S','F','\0'};
+
+// The phase space file format version
+const unsigned phase_space_file_version = 1u;
+
+// Initialize a phase space file header
+void initializePhaseSpaceFileHeader( PhaseSpaceFileHeader& header )
+{
+  std::memcpy( header.identifier, phase_space_file_identifier, 8 );
+
+  header.version = phase_space_file_version;
+  header.record_size = sizeof( PhaseSpaceRecord );
+  header.number_of_records = 0ull;
+}
+
+// Check if a phase space file header is valid
+bool isPhaseSpaceFileHeaderValid( const PhaseSpaceFileHeader& header )
+{
+  return std::memcmp( header.identifier, phase_space_file_identifier, 8 ) == 0 &&
+    header.version == phase_space_file_version &&
+    header.record_size == sizeof( PhaseSpaceRecord );
+}
+
+// Fill a phase space record using a particle state
+void fillPhaseSpaceRecord(
+	       PhaseSpaceRecord& record,
+	       const ParticleState& particle,
+	       const Geometry::ModuleTraits::InternalSurfaceHandle surface_id )
+{
+  record.history_number = particle.getHistoryNumber();
+  record.surface_id = surface_id;
+  record.particle_type = particle.getParticleType();
+  record.collision_number = particle.getCollisionNumber();
+
+  std::memcpy( record.position, particle.getPosition(), 3*sizeof(double) );
+  std::memcpy( record.direction, particle.getDirection(), 3*sizeof(double) );
+
+  record.energy = particle.getEnergy();
+  record.time = particle.getTime();
+  record.weight = particle.getWeight();
+}
+
+// Create a particle state from a phase space record
+/*! \details The history number stored in the record is replaced with the
+ * requested history number.
+ */
+void createParticleState(
+		       boost::shared_ptr<ParticleState>& particle,
+		       const PhaseSpaceRecord& record,
+		       const ParticleState::historyNumberType history_number )
+{
+  // Make sure the record particle type is valid
+  testPrecondition( record.particle_type < UNKNOWN_PARTICLE );
+
+  ParticleStateFactory::createState(
+			   particle,
+			   static_cast<ParticleType>( record.particle_type ),
+			   history_number );
+
+  particle->setPosition( record.position );
+  particle->setDirection( record.direction );
+  particle->setEnergy( record.energy );
+  particle->setTime( record.time );
+  particle->setWeight( record.weight );
+
+  for( unsigned i = 0; i < record.collision_number; ++i )
+    particle->incrementCollisionNumber();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceRecord.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceRecord.hpp
+//! \author Luke Kersting
+//! \brief  Phase space record declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PHASE_SPACE_RECORD_HPP
+#define MONTE_CARLO_PHASE_SPACE_RECORD_HPP
+
+// Boost Includes
+#include <boost/shared_ptr.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_ModuleTraits.hpp"
+
+namespace MonteCarlo{
+
+/*! The phase space file header
+ * \details The header is stored at the beginning of every phase space file.
+ * The records follow the header directly. The file is written in the native
+ * byte order of the machine that wrote it.
+ */
+struct PhaseSpaceFileHeader
+{
+  //! The file identifier
+  char identifier[8];
+
+  //! The file format version
+  unsigned version;
+
+  //! The size of a record (bytes)
+  unsigned record_size;
+
+  //! The number of records in the file
+  unsigned long long number_of_records;
+};
+
+/*! The phase space record (fixed size)
+ * \details One record is stored for every particle state. The records of a
+ * history are always stored contiguously.
+ */
+struct PhaseSpaceRecord
+{
+  //! The history number of the particle
+  unsigned long long history_number;
+
+  //! The surface that the particle was crossing
+  unsigned long long surface_id;
+
+  //! The particle type
+  unsigned particle_type;
+
+  //! The collision number of the particle
+  unsigned collision_number;
+
+  //! The particle position
+  double position[3];
+
+  //! The particle direction
+  double direction[3];
+
+  //! The particle energy
+  double energy;
+
+  //! The particle time
+  double time;
+
+  //! The particle weight
+  double weight;
+};
+
+//! The phase space file identifier
+extern const char phase_space_file_identifier[8];
+
+//! The phase space file format version
+extern const unsigned phase_space_file_version;
+
+//! Initialize a phase space file header
+void initializePhaseSpaceFileHeader( PhaseSpaceFileHeader& header );
+
+//! Check if a phase space file header is valid
+bool isPhaseSpaceFileHeaderValid( const PhaseSpaceFileHeader& header );
+
+//! Fill a phase space record using a particle state
+void fillPhaseSpaceRecord(
+	      PhaseSpaceRecord& record,
+	      const ParticleState& particle,
+	      const Geometry::ModuleTraits::InternalSurfaceHandle surface_id );
+
+//! Create a particle state from a phase space record
+void createParticleState(
+		       boost::shared_ptr<ParticleState>& particle,
+		       const PhaseSpaceRecord& record,
+		       const ParticleState::historyNumberType history_number );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PHASE_SPACE_RECORD_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceRecord.hpp
+//---------------------------------------------------------------------------//
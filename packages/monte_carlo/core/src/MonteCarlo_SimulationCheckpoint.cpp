@@ -0,0 +1,252 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SimulationCheckpoint.cpp
+//! \author Luke Kersting
+//! \brief  The simulation checkpoint class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <sstream>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "MonteCarlo_SimulationCheckpoint.hpp"
+#include "Utility_HDF5FileHandler.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+SimulationCheckpoint::SimulationCheckpoint()
+  : d_completed_history_ranges(),
+    d_histories_completed( 0ull ),
+    d_run_time( 0.0 ),
+    d_estimator_ids(),
+    d_estimator_raw_moments()
+{ /* ... */ }
+
+// Add a range of completed histories [start,end)
+/*! \details A range that starts where the last range ends will be merged
+ * with the last range.
+ */
+void SimulationCheckpoint::addCompletedHistoryRange(
+				        const unsigned long long start_history,
+				        const unsigned long long end_history )
+{
+  // Make sure the range is valid
+  testPrecondition( start_history <= end_history );
+
+  if( start_history == end_history )
+    return;
+
+  if( d_completed_history_ranges.size() > 0 &&
+      d_completed_history_ranges.back().second == start_history )
+    d_completed_history_ranges.back().second = end_history;
+  else
+  {
+    d_completed_history_ranges.push_back(
+				 HistoryRange( start_history, end_history ) );
+  }
+}
+
+// Return the completed history ranges
+const Teuchos::Array<SimulationCheckpoint::HistoryRange>&
+SimulationCheckpoint::getCompletedHistoryRanges() const
+{
+  return d_completed_history_ranges;
+}
+
+// Return the next history that needs to be simulated
+/*! \details The default history will be returned if no histories have been
+ * completed.
+ */
+unsigned long long SimulationCheckpoint::getNextHistory(
+			       const unsigned long long default_history ) const
+{
+  if( d_completed_history_ranges.size() > 0 )
+    return d_completed_history_ranges.back().second;
+  else
+    return default_history;
+}
+
+// Set the number of histories completed
+void SimulationCheckpoint::setNumberOfHistoriesCompleted(
+			        const unsigned long long histories_completed )
+{
+  d_histories_completed = histories_completed;
+}
+
+// Return the number of histories completed
+unsigned long long SimulationCheckpoint::getNumberOfHistoriesCompleted() const
+{
+  return d_histories_completed;
+}
+
+// Set the run time (s)
+void SimulationCheckpoint::setRunTime( const double run_time )
+{
+  // Make sure the run time is valid
+  testPrecondition( run_time >= 0.0 );
+
+  d_run_time = run_time;
+}
+
+// Return the run time (s)
+double SimulationCheckpoint::getRunTime() const
+{
+  return d_run_time;
+}
+
+// Return the estimator ids (used to fill in the estimator snapshot)
+Teuchos::Array<SimulationCheckpoint::EstimatorIdType>&
+SimulationCheckpoint::getEstimatorIds()
+{
+  return d_estimator_ids;
+}
+
+// Return the estimator ids
+const Teuchos::Array<SimulationCheckpoint::EstimatorIdType>&
+SimulationCheckpoint::getEstimatorIds() const
+{
+  return d_estimator_ids;
+}
+
+// Return the estimator raw moments (used to fill in the snapshot)
+Teuchos::Array<Teuchos::Array<double> >&
+SimulationCheckpoint::getEstimatorRawMoments()
+{
+  return d_estimator_raw_moments;
+}
+
+// Return the estimator raw moments
+const Teuchos::Array<Teuchos::Array<double> >&
+SimulationCheckpoint::getEstimatorRawMoments() const
+{
+  return d_estimator_raw_moments;
+}
+
+// Export the checkpoint to an HDF5 file
+/*! \details The counters are stored as attributes of the /checkpoint/ group.
+ * The raw moments of every estimator are stored in the
+ * /checkpoint/estimators/id/raw_moments data set. Empty arrays are not
+ * written.
+ */
+void SimulationCheckpoint::exportToHDF5File(
+				     const std::string& hdf5_file_name ) const
+{
+  // Make sure the estimator snapshot is valid
+  testPrecondition( d_estimator_ids.size() ==
+		    d_estimator_raw_moments.size() );
+
+  Utility::HDF5FileHandler hdf5_file;
+  hdf5_file.throwExceptions();
+
+  try{
+    hdf5_file.openHDF5FileAndOverwrite( hdf5_file_name );
+
+    hdf5_file.writeValueToGroupAttribute( d_histories_completed,
+					  "/checkpoint/",
+					  "histories_completed" );
+
+    hdf5_file.writeValueToGroupAttribute( d_run_time,
+					  "/checkpoint/",
+					  "run_time" );
+
+    if( d_completed_history_ranges.size() > 0 )
+    {
+      hdf5_file.writeArrayToDataSet(
+				 d_completed_history_ranges,
+				 "/checkpoint/completed_history_ranges" );
+    }
+
+    if( d_estimator_ids.size() > 0 )
+    {
+      hdf5_file.writeArrayToDataSet( d_estimator_ids,
+				     "/checkpoint/estimator_ids" );
+    }
+
+    for( unsigned i = 0; i < d_estimator_ids.size(); ++i )
+    {
+      if( d_estimator_raw_moments[i].size() > 0 )
+      {
+	std::ostringstream location;
+	location << "/checkpoint/estimators/" << d_estimator_ids[i]
+		 << "/raw_moments";
+
+	hdf5_file.writeArrayToDataSet( d_estimator_raw_moments[i],
+				       location.str() );
+      }
+    }
+
+    hdf5_file.closeHDF5File();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: the checkpoint could not be written to "
+			   "file " << hdf5_file_name << "!" );
+}
+
+// Import the checkpoint from an HDF5 file
+void SimulationCheckpoint::importFromHDF5File(
+					  const std::string& hdf5_file_name )
+{
+  Utility::HDF5FileHandler hdf5_file;
+  hdf5_file.throwExceptions();
+
+  d_completed_history_ranges.clear();
+  d_estimator_ids.clear();
+  d_estimator_raw_moments.clear();
+
+  try{
+    hdf5_file.openHDF5FileAndReadOnly( hdf5_file_name );
+
+    hdf5_file.readValueFromGroupAttribute( d_histories_completed,
+					   "/checkpoint/",
+					   "histories_completed" );
+
+    hdf5_file.readValueFromGroupAttribute( d_run_time,
+					   "/checkpoint/",
+					   "run_time" );
+
+    if( hdf5_file.doesDataSetExist( "/checkpoint/completed_history_ranges" ) )
+    {
+      hdf5_file.readArrayFromDataSet(
+				 d_completed_history_ranges,
+				 "/checkpoint/completed_history_ranges" );
+    }
+
+    if( hdf5_file.doesDataSetExist( "/checkpoint/estimator_ids" ) )
+    {
+      hdf5_file.readArrayFromDataSet( d_estimator_ids,
+				      "/checkpoint/estimator_ids" );
+    }
+
+    d_estimator_raw_moments.resize( d_estimator_ids.size() );
+
+    for( unsigned i = 0; i < d_estimator_ids.size(); ++i )
+    {
+      std::ostringstream location;
+      location << "/checkpoint/estimators/" << d_estimator_ids[i]
+	       << "/raw_moments";
+
+      if( hdf5_file.doesDataSetExist( location.str() ) )
+      {
+	hdf5_file.readArrayFromDataSet( d_estimator_raw_moments[i],
+					location.str() );
+      }
+    }
+
+    hdf5_file.closeHDF5File();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: the checkpoint could not be read from "
+			   "file " << hdf5_file_name << "!" );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SimulationCheckpoint.cpp
+//---------------------------------------------------------------------------//
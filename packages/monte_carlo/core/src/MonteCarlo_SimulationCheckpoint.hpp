@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SimulationCheckpoint.hpp
+//! \author Luke Kersting
+//! \brief  The simulation checkpoint class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SIMULATION_CHECKPOINT_HPP
+#define MONTE_CARLO_SIMULATION_CHECKPOINT_HPP
+
+// Std Lib Includes
+#include <string>
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ModuleTraits.hpp"
+#include "Utility_Tuple.hpp"
+
+namespace MonteCarlo{
+
+/*! The simulation checkpoint class
+ * \details A checkpoint stores everything that is needed to resume a
+ * simulation: the ranges of histories that have been completed, the number
+ * of histories completed, the run time and the raw moments of every
+ * estimator. The random number generator is initialized from the history
+ * number at the start of every history so the next history that needs to be
+ * simulated (the end of the last completed range) fully determines the
+ * random number stream position.
+ */
+class SimulationCheckpoint
+{
+
+public:
+
+  //! Typedef for the estimator id
+  typedef ModuleTraits::InternalEstimatorHandle EstimatorIdType;
+
+  //! Typedef for a history range [start,end)
+  typedef Utility::Pair<unsigned long long,unsigned long long> HistoryRange;
+
+  //! Constructor
+  SimulationCheckpoint();
+
+  //! Destructor
+  ~SimulationCheckpoint()
+  { /* ... */ }
+
+  //! Add a range of completed histories [start,end)
+  void addCompletedHistoryRange( const unsigned long long start_history,
+				 const unsigned long long end_history );
+
+  //! Return the completed history ranges
+  const Teuchos::Array<HistoryRange>& getCompletedHistoryRanges() const;
+
+  //! Return the next history that needs to be simulated
+  unsigned long long getNextHistory(
+			  const unsigned long long default_history = 0ull ) const;
+
+  //! Set the number of histories completed
+  void setNumberOfHistoriesCompleted(
+			       const unsigned long long histories_completed );
+
+  //! Return the number of histories completed
+  unsigned long long getNumberOfHistoriesCompleted() const;
+
+  //! Set the run time (s)
+  void setRunTime( const double run_time );
+
+  //! Return the run time (s)
+  double getRunTime() const;
+
+  //! Return the estimator ids (used to fill in the estimator snapshot)
+  Teuchos::Array<EstimatorIdType>& getEstimatorIds();
+
+  //! Return the estimator ids
+  const Teuchos::Array<EstimatorIdType>& getEstimatorIds() const;
+
+  //! Return the estimator raw moments (used to fill in the snapshot)
+  Teuchos::Array<Teuchos::Array<double> >& getEstimatorRawMoments();
+
+  //! Return the estimator raw moments
+  const Teuchos::Array<Teuchos::Array<double> >&
+  getEstimatorRawMoments() const;
+
+  //! Export the checkpoint to an HDF5 file
+  void exportToHDF5File( const std::string& hdf5_file_name ) const;
+
+  //! Import the checkpoint from an HDF5 file
+  void importFromHDF5File( const std::string& hdf5_file_name );
+
+private:
+
+  // The completed history ranges
+  Teuchos::Array<HistoryRange> d_completed_history_ranges;
+
+  // The number of histories completed
+  unsigned long long d_histories_completed;
+
+  // The run time
+  double d_run_time;
+
+  // The estimator ids
+  Teuchos::Array<EstimatorIdType> d_estimator_ids;
+
+  // The estimator raw moments (same order as the estimator ids)
+  Teuchos::Array<Teuchos::Array<double> > d_estimator_raw_moments;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SIMULATION_CHECKPOINT_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SimulationCheckpoint.hpp
+//---------------------------------------------------------------------------//
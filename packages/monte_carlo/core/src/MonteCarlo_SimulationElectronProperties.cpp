@@ -39,6 +39,14 @@ double SimulationElectronProperties::elastic_cutoff_angle = 1.0e-6;
 
 // The number of electron has grid bins
 unsigned SimulationElectronProperties::num_electron_hash_grid_bins = 1000;
+
+// The condensed history mode (true = on, false = off - default)
+bool SimulationElectronProperties::condensed_history_mode_on = false;
+
+// The max fractional energy loss per condensed history step (0.05 default)
+double 
+SimulationElectronProperties::condensed_history_max_fractional_energy_loss = 
+  0.05;
     
 // Set the minimum electron energy (MeV)
 void SimulationElectronProperties::setMinElectronEnergy( const double energy )
@@ -89,6 +97,30 @@ void SimulationElectronProperties::setNumberOfElectronHashGridBins( const unsign
   SimulationElectronProperties::num_electron_hash_grid_bins = bins;
 }
 
+// Set condensed history mode to on (off by default)
+void SimulationElectronProperties::setCondensedHistoryModeOn()
+{
+  SimulationElectronProperties::condensed_history_mode_on = true;
+}
+
+// Set condensed history mode to off (off by default)
+void SimulationElectronProperties::setCondensedHistoryModeOff()
+{
+  SimulationElectronProperties::condensed_history_mode_on = false;
+}
+
+// Set the max fractional energy loss per condensed history step
+void SimulationElectronProperties::setCondensedHistoryMaxFractionalEnergyLoss(
+                                                        const double fraction )
+{
+  // Make sure the fraction is valid
+  testPrecondition( fraction > 0.0 );
+  testPrecondition( fraction < 1.0 );
+
+  SimulationElectronProperties::condensed_history_max_fractional_energy_loss =
+    fraction;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -68,6 +68,22 @@ public:
   //! Return the number of electron hash grid bins
   static unsigned getNumberOfElectronHashGridBins();
 
+  //! Set condensed history mode to on (off by default)
+  static void setCondensedHistoryModeOn();
+
+  //! Set condensed history mode to off (off by default)
+  static void setCondensedHistoryModeOff();
+
+  //! Return if condensed history mode is on
+  static bool isCondensedHistoryModeOn();
+
+  //! Set the max fractional energy loss per condensed history step
+  static void setCondensedHistoryMaxFractionalEnergyLoss( 
+                                                       const double fraction );
+
+  //! Return the max fractional energy loss per condensed history step
+  static double getCondensedHistoryMaxFractionalEnergyLoss();
+
 private:
 
   // The absolute minimum electron energy
@@ -97,6 +113,12 @@ private:
 
   // The number of electron hash grid bins
   static unsigned num_electron_hash_grid_bins;
+
+  // The condensed history mode (true = on, false = off - default)
+  static bool condensed_history_mode_on;
+
+  // The max fractional energy loss per condensed history step (0.05 default)
+  static double condensed_history_max_fractional_energy_loss;
 };
 
 // Return the minimum electron energy (MeV)
@@ -148,6 +170,19 @@ inline unsigned SimulationElectronProperties::getNumberOfElectronHashGridBins()
   return SimulationElectronProperties::num_electron_hash_grid_bins;
 }
 
+// Return if condensed history mode is on
+inline bool SimulationElectronProperties::isCondensedHistoryModeOn()
+{
+  return SimulationElectronProperties::condensed_history_mode_on;
+}
+
+// Return the max fractional energy loss per condensed history step
+inline double 
+SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss()
+{
+  return SimulationElectronProperties::condensed_history_max_fractional_energy_loss;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_SIMULATION_ELECTRON_PROPERTIES_HPP
@@ -116,6 +116,37 @@ void SimulationElectronPropertiesFactory::initializeSimulationElectronProperties
 
     SimulationElectronProperties::setNumberOfElectronHashGridBins( bins );
   }
+
+  // Get the condensed history mode - optional
+  if( properties.isParameter( "Electron Condensed History" ) )
+  {
+    if( properties.get<bool>( "Electron Condensed History" ) )
+      SimulationElectronProperties::setCondensedHistoryModeOn();
+    else
+      SimulationElectronProperties::setCondensedHistoryModeOff();
+  }
+
+  // Get the condensed history max fractional energy loss - optional
+  if( properties.isParameter( "Condensed History Max Fractional Energy Loss" ) )
+  {
+    double fraction = 
+      properties.get<double>( "Condensed History Max Fractional Energy Loss" );
+
+    if( fraction > 0.0 && fraction < 1.0 )
+    {
+      SimulationElectronProperties::setCondensedHistoryMaxFractionalEnergyLoss(
+                                                                    fraction );
+    }
+    else
+    {
+      std::cerr << "Warning: the condensed history max fractional energy "
+		<< "loss must have a value between 0 and 1. The default value "
+		<< "of "
+		<< SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss()
+		<< " will be used instead of " << fraction << "." 
+		<< std::endl;
+    }
+  }
   
   properties.unused( std::cerr );
 }
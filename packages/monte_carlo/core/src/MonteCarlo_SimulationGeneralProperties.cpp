@@ -26,6 +26,43 @@ bool SimulationGeneralProperties::display_warnings = true;
 
 // The capture mode (true = implicit, false = analogue - default)
 bool SimulationGeneralProperties::implicit_capture_mode_on = false;
+
+// The weight cutoff (0.0 = weight roulette off - default)
+double SimulationGeneralProperties::weight_cutoff = 0.0;
+
+// The weight given to particles that survive weight roulette
+double SimulationGeneralProperties::weight_roulette_survival_weight = 0.0;
+
+// The weight window file (empty = weight windows off - default)
+std::string SimulationGeneralProperties::weight_window_file;
+
+// The checkpoint file
+std::string SimulationGeneralProperties::checkpoint_file = "checkpoint.h5";
+
+// The checkpoint wall time interval (0.0 = off - default)
+double SimulationGeneralProperties::checkpoint_wall_time_interval = 0.0;
+
+// The checkpoint history interval (0 = off - default)
+unsigned long long SimulationGeneralProperties::checkpoint_history_interval = 0;
+
+// The restart file (empty = restart mode off - default)
+std::string SimulationGeneralProperties::restart_file;
+
+// The wall time limit (0.0 = no limit - default)
+double SimulationGeneralProperties::wall_time_limit = 0.0;
+
+// The target relative error (0.0 = convergence termination off - default)
+double SimulationGeneralProperties::target_relative_error = 0.0;
+
+// The convergence estimators (empty = all estimators - default)
+Teuchos::Array<unsigned long long> 
+SimulationGeneralProperties::convergence_estimators;
+
+// The event batch size (0 = history-based transport - default)
+unsigned long long SimulationGeneralProperties::event_batch_size = 0;
+
+// The estimator output mode (true = chunked, false = per entity - default)
+bool SimulationGeneralProperties::chunked_estimator_output_mode_on = false;
                              
 // The ideal number of batches per processor
 unsigned SimulationGeneralProperties::number_of_batches_per_processor = 25;
@@ -71,6 +108,163 @@ void SimulationGeneralProperties::setImplicitCaptureModeOn()
   SimulationGeneralProperties::implicit_capture_mode_on = true;
 }
 
+// Set implicit capture mode to off (off by default)
+void SimulationGeneralProperties::setImplicitCaptureModeOff()
+{
+  SimulationGeneralProperties::implicit_capture_mode_on = false;
+}
+
+// Set the weight cutoff (weight roulette is off by default)
+/*! \details Particles with a weight below the cutoff will play Russian
+ * roulette after every collision. A cutoff of zero turns weight roulette
+ * off. If the survival weight is not above the new cutoff it will be set to
+ * twice the cutoff.
+ */
+void SimulationGeneralProperties::setWeightCutoff( const double weight_cutoff )
+{
+  // Make sure the weight cutoff is valid
+  testPrecondition( weight_cutoff >= 0.0 );
+
+  SimulationGeneralProperties::weight_cutoff = weight_cutoff;
+
+  if( SimulationGeneralProperties::weight_roulette_survival_weight <= 
+      weight_cutoff )
+  {
+    SimulationGeneralProperties::weight_roulette_survival_weight = 
+      2.0*weight_cutoff;
+  }
+}
+
+// Set the weight given to particles that survive weight roulette
+void SimulationGeneralProperties::setWeightRouletteSurvivalWeight( 
+					          const double survival_weight )
+{
+  // Make sure the survival weight is valid
+  testPrecondition( survival_weight > 
+		    SimulationGeneralProperties::weight_cutoff );
+
+  SimulationGeneralProperties::weight_roulette_survival_weight = 
+    survival_weight;
+}
+
+// Set the weight window file (weight windows are off by default)
+/*! \details The file must be an HDF5 file that can be read by
+ * MonteCarlo::WeightWindowMesh::createFromHDF5File. An empty file name
+ * turns weight windows off.
+ */
+void SimulationGeneralProperties::setWeightWindowFile( 
+				        const std::string& weight_window_file )
+{
+  SimulationGeneralProperties::weight_window_file = weight_window_file;
+}
+
+// Set the checkpoint file
+void SimulationGeneralProperties::setCheckpointFile( 
+					   const std::string& checkpoint_file )
+{
+  // Make sure the file name is valid
+  testPrecondition( checkpoint_file.size() > 0 );
+  
+  SimulationGeneralProperties::checkpoint_file = checkpoint_file;
+}
+
+// Set the checkpoint wall time interval (s) (checkpoints are off by default)
+/*! \details A checkpoint will be written once the wall time interval has
+ * elapsed since the last checkpoint. An interval of zero turns wall time
+ * checkpoints off.
+ */
+void SimulationGeneralProperties::setCheckpointWallTimeInterval( 
+						        const double interval )
+{
+  // Make sure the interval is valid
+  testPrecondition( interval >= 0.0 );
+
+  SimulationGeneralProperties::checkpoint_wall_time_interval = interval;
+}
+
+// Set the checkpoint history interval (checkpoints are off by default)
+/*! \details A checkpoint will be written every time the history interval
+ * has been simulated. An interval of zero turns history checkpoints off.
+ */
+void SimulationGeneralProperties::setCheckpointHistoryInterval( 
+					     const unsigned long long interval )
+{
+  SimulationGeneralProperties::checkpoint_history_interval = interval;
+}
+
+// Set the restart file (restart mode is off by default)
+/*! \details The file must be a checkpoint file that was written by a
+ * previous simulation. An empty file name turns restart mode off.
+ */
+void SimulationGeneralProperties::setRestartFile( 
+					      const std::string& restart_file )
+{
+  SimulationGeneralProperties::restart_file = restart_file;
+}
+
+// Set the wall time limit (s) (no limit by default)
+/*! \details The simulation will be stopped at a batch boundary if the next
+ * batch is not expected to finish before the wall time limit. A limit of 
+ * zero turns the wall time limit off.
+ */
+void SimulationGeneralProperties::setWallTimeLimit( 
+						 const double wall_time_limit )
+{
+  // Make sure the wall time limit is valid
+  testPrecondition( wall_time_limit >= 0.0 );
+
+  SimulationGeneralProperties::wall_time_limit = wall_time_limit;
+}
+
+// Set the target relative error (convergence termination off by default)
+/*! \details The simulation will be stopped at a batch boundary once the
+ * relative error of every bin of the convergence estimators is at or below
+ * the target. A target of zero turns convergence termination off.
+ */
+void SimulationGeneralProperties::setTargetRelativeError( 
+					   const double target_relative_error )
+{
+  // Make sure the target relative error is valid
+  testPrecondition( target_relative_error >= 0.0 );
+  testPrecondition( target_relative_error < 1.0 );
+  
+  SimulationGeneralProperties::target_relative_error = target_relative_error;
+}
+
+// Set the estimators that must reach the target relative error
+/*! \details If no estimators are set every estimator must reach the target
+ * relative error.
+ */
+void SimulationGeneralProperties::setConvergenceEstimators( 
+		        const Teuchos::Array<unsigned long long>& estimator_ids )
+{
+  SimulationGeneralProperties::convergence_estimators = estimator_ids;
+}
+
+// Set the event batch size (history-based transport by default)
+/*! \details When the batch size is greater than zero the particles are 
+ * transported with the event-based transport loop. Every thread will 
+ * transport the particles of batch size histories together, one event at 
+ * a time. A batch size of zero turns event-based transport off.
+ */
+void SimulationGeneralProperties::setEventBatchSize( 
+				     const unsigned long long batch_size )
+{
+  SimulationGeneralProperties::event_batch_size = batch_size;
+}
+
+// Set chunked estimator output mode to on (off by default)
+/*! \details When chunked estimator output mode is on the moments of all of
+ * the entities of an estimator are exported to a single chunked and
+ * compressed data set (entity x bin) instead of to a group for every entity.
+ * This greatly reduces the size of the output file and the export time for
+ * estimators with many entities (e.g. mesh estimators).
+ */
+void SimulationGeneralProperties::setChunkedEstimatorOutputModeOn()
+{
+  SimulationGeneralProperties::chunked_estimator_output_mode_on = true;
+}
+
 // Set the ideal number of batches per processor for an MPI configuration
 void SimulationGeneralProperties::setNumberOfBatchesPerProcessor( 
                                                        const unsigned batches )
@@ -9,6 +9,12 @@
 #ifndef MONTE_CARLO_SIMULATION_GENERAL_PROPERTIES_HPP
 #define MONTE_CARLO_SIMULATION_GENERAL_PROPERTIES_HPP
 
+// Std Lib Includes
+#include <string>
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_ParticleModeType.hpp"
 
@@ -58,8 +64,106 @@ public:
   //! Set implicit capture mode to on (off by default)
   static void setImplicitCaptureModeOn();
 
+  //! Set implicit capture mode to off (off by default)
+  static void setImplicitCaptureModeOff();
+
   //! Return if implicit capture mode has been set
   static bool isImplicitCaptureModeOn();
+
+  //! Set the weight cutoff (weight roulette is off by default)
+  static void setWeightCutoff( const double weight_cutoff );
+
+  //! Return the weight cutoff
+  static double getWeightCutoff();
+
+  //! Set the weight given to particles that survive weight roulette
+  static void setWeightRouletteSurvivalWeight( const double survival_weight );
+
+  //! Return the weight given to particles that survive weight roulette
+  static double getWeightRouletteSurvivalWeight();
+
+  //! Return if weight roulette has been turned on
+  static bool isWeightRouletteOn();
+
+  //! Set the weight window file (weight windows are off by default)
+  static void setWeightWindowFile( const std::string& weight_window_file );
+
+  //! Return the weight window file
+  static const std::string& getWeightWindowFile();
+
+  //! Return if weight windows have been turned on
+  static bool isWeightWindowModeOn();
+
+  //! Set the checkpoint file
+  static void setCheckpointFile( const std::string& checkpoint_file );
+
+  //! Return the checkpoint file
+  static const std::string& getCheckpointFile();
+
+  //! Set the checkpoint wall time interval (s) (checkpoints are off by default)
+  static void setCheckpointWallTimeInterval( const double interval );
+
+  //! Return the checkpoint wall time interval (s)
+  static double getCheckpointWallTimeInterval();
+
+  //! Set the checkpoint history interval (checkpoints are off by default)
+  static void setCheckpointHistoryInterval(
+				       const unsigned long long interval );
+
+  //! Return the checkpoint history interval
+  static unsigned long long getCheckpointHistoryInterval();
+
+  //! Return if checkpoints have been turned on
+  static bool isCheckpointModeOn();
+
+  //! Set the restart file (restart mode is off by default)
+  static void setRestartFile( const std::string& restart_file );
+
+  //! Return the restart file
+  static const std::string& getRestartFile();
+
+  //! Return if restart mode has been turned on
+  static bool isRestartModeOn();
+
+  //! Set the wall time limit (s) (no limit by default)
+  static void setWallTimeLimit( const double wall_time_limit );
+
+  //! Return the wall time limit (s)
+  static double getWallTimeLimit();
+
+  //! Return if the wall time limit has been turned on
+  static bool isWallTimeLimitOn();
+
+  //! Set the target relative error (convergence termination off by default)
+  static void setTargetRelativeError( const double target_relative_error );
+
+  //! Return the target relative error
+  static double getTargetRelativeError();
+
+  //! Set the estimators that must reach the target relative error
+  static void setConvergenceEstimators( 
+		        const Teuchos::Array<unsigned long long>& estimator_ids );
+
+  //! Return the estimators that must reach the target relative error
+  static const Teuchos::Array<unsigned long long>& getConvergenceEstimators();
+
+  //! Return if convergence termination has been turned on
+  static bool isConvergenceTerminationOn();
+
+  //! Set the event batch size (history-based transport by default)
+  static void setEventBatchSize( const unsigned long long batch_size );
+
+  //! Return the event batch size
+  static unsigned long long getEventBatchSize();
+
+  //! Return if event-based transport has been turned on
+  static bool isEventBasedTransportModeOn();
+
+  //! Set chunked estimator output mode to on (off by default)
+  static void setChunkedEstimatorOutputModeOn();
+
+  //! Return if chunked estimator output mode has been set
+  static bool isChunkedEstimatorOutputModeOn();
           
   //! Set the number of batches for an MPI configuration
   static void setNumberOfBatchesPerProcessor( const unsigned batches_per_processor );
@@ -83,6 +187,42 @@ private:
 
   // The capture mode (true = implicit, false = analogue - default)
   static bool implicit_capture_mode_on;
+
+  // The weight cutoff (0.0 = weight roulette off - default)
+  static double weight_cutoff;
+
+  // The weight given to particles that survive weight roulette
+  static double weight_roulette_survival_weight;
+
+  // The weight window file (empty = weight windows off - default)
+  static std::string weight_window_file;
+
+  // The checkpoint file
+  static std::string checkpoint_file;
+
+  // The checkpoint wall time interval (0.0 = off - default)
+  static double checkpoint_wall_time_interval;
+
+  // The checkpoint history interval (0 = off - default)
+  static unsigned long long checkpoint_history_interval;
+
+  // The restart file (empty = restart mode off - default)
+  static std::string restart_file;
+
+  // The wall time limit (0.0 = no limit - default)
+  static double wall_time_limit;
+
+  // The target relative error (0.0 = convergence termination off - default)
+  static double target_relative_error;
+
+  // The convergence estimators (empty = all estimators - default)
+  static Teuchos::Array<unsigned long long> convergence_estimators;
+
+  // The event batch size (0 = history-based transport - default)
+  static unsigned long long event_batch_size;
+
+  // The estimator output mode (true = chunked, false = per entity - default)
+  static bool chunked_estimator_output_mode_on;
            
   // The number of batches to run for MPI configuration
   static unsigned number_of_batches_per_processor; 
@@ -118,6 +258,123 @@ inline bool SimulationGeneralProperties::isImplicitCaptureModeOn()
   return SimulationGeneralProperties::implicit_capture_mode_on;
 }
 
+// Return the weight cutoff
+inline double SimulationGeneralProperties::getWeightCutoff()
+{
+  return SimulationGeneralProperties::weight_cutoff;
+}
+
+// Return the weight given to particles that survive weight roulette
+inline double SimulationGeneralProperties::getWeightRouletteSurvivalWeight()
+{
+  return SimulationGeneralProperties::weight_roulette_survival_weight;
+}
+
+// Return if weight roulette has been turned on
+inline bool SimulationGeneralProperties::isWeightRouletteOn()
+{
+  return SimulationGeneralProperties::weight_cutoff > 0.0;
+}
+
+// Return the weight window file
+inline const std::string& SimulationGeneralProperties::getWeightWindowFile()
+{
+  return SimulationGeneralProperties::weight_window_file;
+}
+
+// Return if weight windows have been turned on
+inline bool SimulationGeneralProperties::isWeightWindowModeOn()
+{
+  return !SimulationGeneralProperties::weight_window_file.empty();
+}
+
+// Return the checkpoint file
+inline const std::string& SimulationGeneralProperties::getCheckpointFile()
+{
+  return SimulationGeneralProperties::checkpoint_file;
+}
+
+// Return the checkpoint wall time interval (s)
+inline double SimulationGeneralProperties::getCheckpointWallTimeInterval()
+{
+  return SimulationGeneralProperties::checkpoint_wall_time_interval;
+}
+
+// Return the checkpoint history interval
+inline unsigned long long 
+SimulationGeneralProperties::getCheckpointHistoryInterval()
+{
+  return SimulationGeneralProperties::checkpoint_history_interval;
+}
+
+// Return if checkpoints have been turned on
+inline bool SimulationGeneralProperties::isCheckpointModeOn()
+{
+  return SimulationGeneralProperties::checkpoint_wall_time_interval > 0.0 ||
+    SimulationGeneralProperties::checkpoint_history_interval > 0ull;
+}
+
+// Return the restart file
+inline const std::string& SimulationGeneralProperties::getRestartFile()
+{
+  return SimulationGeneralProperties::restart_file;
+}
+
+// Return if restart mode has been turned on
+inline bool SimulationGeneralProperties::isRestartModeOn()
+{
+  return !SimulationGeneralProperties::restart_file.empty();
+}
+
+// Return the wall time limit (s)
+inline double SimulationGeneralProperties::getWallTimeLimit()
+{
+  return SimulationGeneralProperties::wall_time_limit;
+}
+
+// Return if the wall time limit has been turned on
+inline bool SimulationGeneralProperties::isWallTimeLimitOn()
+{
+  return SimulationGeneralProperties::wall_time_limit > 0.0;
+}
+
+// Return the target relative error
+inline double SimulationGeneralProperties::getTargetRelativeError()
+{
+  return SimulationGeneralProperties::target_relative_error;
+}
+
+// Return the estimators that must reach the target relative error
+inline const Teuchos::Array<unsigned long long>& 
+SimulationGeneralProperties::getConvergenceEstimators()
+{
+  return SimulationGeneralProperties::convergence_estimators;
+}
+
+// Return if convergence termination has been turned on
+inline bool SimulationGeneralProperties::isConvergenceTerminationOn()
+{
+  return SimulationGeneralProperties::target_relative_error > 0.0;
+}
+
+// Return the event batch size
+inline unsigned long long SimulationGeneralProperties::getEventBatchSize()
+{
+  return SimulationGeneralProperties::event_batch_size;
+}
+
+// Return if event-based transport has been turned on
+inline bool SimulationGeneralProperties::isEventBasedTransportModeOn()
+{
+  return SimulationGeneralProperties::event_batch_size > 0ull;
+}
+
+// Return if chunked estimator output mode has been set
+inline bool SimulationGeneralProperties::isChunkedEstimatorOutputModeOn()
+{
+  return SimulationGeneralProperties::chunked_estimator_output_mode_on;
+}
+
 // Return the number of batches for an MPI configuration
 inline unsigned SimulationGeneralProperties::getNumberOfBatchesPerProcessor()
 {
@@ -70,6 +70,149 @@ void SimulationGeneralPropertiesFactory::initializeSimulationGeneralProperties(
   {
     if( properties.get<bool>( "Implicit Capture" ) )
       SimulationGeneralProperties::setImplicitCaptureModeOn();
+    else
+      SimulationGeneralProperties::setImplicitCaptureModeOff();
+  }
+
+  // Get the weight cutoff - optional
+  if( properties.isParameter( "Weight Cutoff" ) )
+  {
+    double weight_cutoff = properties.get<double>( "Weight Cutoff" );
+
+    TEST_FOR_EXCEPTION( weight_cutoff < 0.0,
+			std::runtime_error,
+			"Error: The weight cutoff must be a positive number!" );
+
+    SimulationGeneralProperties::setWeightCutoff( weight_cutoff );
+  }
+
+  // Get the weight roulette survival weight - optional
+  if( properties.isParameter( "Weight Roulette Survival Weight" ) )
+  {
+    double survival_weight = 
+      properties.get<double>( "Weight Roulette Survival Weight" );
+
+    TEST_FOR_EXCEPTION( survival_weight <= 
+			SimulationGeneralProperties::getWeightCutoff(),
+			std::runtime_error,
+			"Error: The weight roulette survival weight must be "
+			"greater than the weight cutoff!" );
+
+    SimulationGeneralProperties::setWeightRouletteSurvivalWeight( 
+							     survival_weight );
+  }
+
+  // Get the weight window file - optional
+  if( properties.isParameter( "Weight Window File" ) )
+  {
+    SimulationGeneralProperties::setWeightWindowFile( 
+			  properties.get<std::string>( "Weight Window File" ) );
+  }
+
+  // Get the checkpoint file - optional
+  if( properties.isParameter( "Checkpoint File" ) )
+  {
+    std::string checkpoint_file = 
+      properties.get<std::string>( "Checkpoint File" );
+
+    TEST_FOR_EXCEPTION( checkpoint_file.size() == 0,
+			std::runtime_error,
+			"Error: The checkpoint file name cannot be empty!" );
+
+    SimulationGeneralProperties::setCheckpointFile( checkpoint_file );
+  }
+
+  // Get the checkpoint wall time interval - optional
+  if( properties.isParameter( "Checkpoint Wall Time Interval" ) )
+  {
+    double interval = 
+      properties.get<double>( "Checkpoint Wall Time Interval" );
+
+    TEST_FOR_EXCEPTION( interval < 0.0,
+			std::runtime_error,
+			"Error: The checkpoint wall time interval must be a "
+			"positive number!" );
+
+    SimulationGeneralProperties::setCheckpointWallTimeInterval( interval );
+  }
+
+  // Get the checkpoint history interval - optional
+  if( properties.isParameter( "Checkpoint History Interval" ) )
+  {
+    SimulationGeneralProperties::setCheckpointHistoryInterval( 
+		  properties.get<unsigned int>( "Checkpoint History Interval" ) );
+  }
+
+  // Get the restart file - optional
+  if( properties.isParameter( "Restart File" ) )
+  {
+    SimulationGeneralProperties::setRestartFile( 
+			       properties.get<std::string>( "Restart File" ) );
+  }
+
+  // Get the wall time limit - optional
+  if( properties.isParameter( "Wall Time Limit" ) )
+  {
+    double wall_time_limit = properties.get<double>( "Wall Time Limit" );
+
+    TEST_FOR_EXCEPTION( wall_time_limit < 0.0,
+			std::runtime_error,
+			"Error: The wall time limit must be a positive "
+			"number!" );
+
+    SimulationGeneralProperties::setWallTimeLimit( wall_time_limit );
+  }
+
+  // Get the target relative error - optional
+  if( properties.isParameter( "Target Relative Error" ) )
+  {
+    double target_relative_error = 
+      properties.get<double>( "Target Relative Error" );
+
+    TEST_FOR_EXCEPTION( target_relative_error < 0.0 ||
+			target_relative_error >= 1.0,
+			std::runtime_error,
+			"Error: The target relative error must be in the "
+			"range [0.0,1.0)!" );
+
+    SimulationGeneralProperties::setTargetRelativeError( 
+						       target_relative_error );
+  }
+
+  // Get the convergence estimators - optional
+  if( properties.isParameter( "Convergence Estimators" ) )
+  {
+    const Teuchos::Array<int>& requested_estimators = 
+      properties.get<Teuchos::Array<int> >( "Convergence Estimators" );
+
+    Teuchos::Array<unsigned long long> estimator_ids( 
+						 requested_estimators.size() );
+
+    for( unsigned i = 0; i < requested_estimators.size(); ++i )
+    {
+      TEST_FOR_EXCEPTION( requested_estimators[i] < 0,
+			  std::runtime_error,
+			  "Error: The convergence estimator ids must be "
+			  "positive!" );
+
+      estimator_ids[i] = requested_estimators[i];
+    }
+
+    SimulationGeneralProperties::setConvergenceEstimators( estimator_ids );
+  }
+
+  // Get the event batch size - optional
+  if( properties.isParameter( "Event Batch Size" ) )
+  {
+    SimulationGeneralProperties::setEventBatchSize( 
+			     properties.get<unsigned int>( "Event Batch Size" ) );
+  }
+
+  // Get the estimator output mode - optional
+  if( properties.isParameter( "Chunked Estimator Output" ) )
+  {
+    if( properties.get<bool>( "Chunked Estimator Output" ) )
+      SimulationGeneralProperties::setChunkedEstimatorOutputModeOn();
   }
   
   properties.unused( std::cerr );
@@ -6,8 +6,12 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <stdexcept>
+
 // FRENSIE Includes
 #include "MonteCarlo_SimulationNeutronProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -29,6 +33,22 @@ const double SimulationNeutronProperties::absolute_max_neutron_energy = 20.0;
 double SimulationNeutronProperties::max_neutron_energy = 
   SimulationNeutronProperties::absolute_max_neutron_energy;
 
+// The compact cross section storage mode (true = on, false = off - default)
+bool SimulationNeutronProperties::compact_cross_section_storage_mode_on = 
+  false;
+
+// The criticality mode (true = on, false = off - default)
+bool SimulationNeutronProperties::criticality_mode_on = false;
+
+// The number of inactive cycles
+unsigned SimulationNeutronProperties::number_of_inactive_cycles = 10u;
+
+// The number of active cycles
+unsigned SimulationNeutronProperties::number_of_active_cycles = 100u;
+
+// The Wielandt shift eigenvalue (0.0 = off - default)
+double SimulationNeutronProperties::wielandt_shift = 0.0;
+
 // Set the free gas thermal treatment temperature threshold
 /*! \details The value given is the number of times above the material 
  * temperature that the energy of a neutron can be before the free gas
@@ -62,6 +82,79 @@ void SimulationNeutronProperties::setMaxNeutronEnergy( const double energy )
   SimulationNeutronProperties::max_neutron_energy = energy;
 }
 
+// Set compact (single precision) cross section storage mode to off
+void SimulationNeutronProperties::setCompactCrossSectionStorageModeOff()
+{
+  SimulationNeutronProperties::compact_cross_section_storage_mode_on = false;
+}
+
+// Set compact (single precision) cross section storage mode to on
+/*! \details When this mode is on, the reaction cross sections of every 
+ * nuclide that is created will be stored in single precision. This halves
+ * the memory required for the cross section values, which is useful when 
+ * many nuclides (or nuclide temperature tables) must be loaded. The energy 
+ * grids are always stored in double precision. The relative difference
+ * in the cross section values (~1e-7) is well below the reconstruction 
+ * tolerance of the processed data.
+ */
+void SimulationNeutronProperties::setCompactCrossSectionStorageModeOn()
+{
+  SimulationNeutronProperties::compact_cross_section_storage_mode_on = true;
+}
+
+// Set criticality (k-eigenvalue) mode to off
+void SimulationNeutronProperties::setCriticalityModeOff()
+{
+  SimulationNeutronProperties::criticality_mode_on = false;
+}
+
+// Set criticality (k-eigenvalue) mode to on
+/*! \details When this mode is on, the simulation will be run as a sequence
+ * of power iteration cycles. The number of histories in the general 
+ * properties will be used as the number of histories per cycle. Estimator
+ * data is only collected during the active cycles.
+ */
+void SimulationNeutronProperties::setCriticalityModeOn()
+{
+  SimulationNeutronProperties::criticality_mode_on = true;
+}
+
+// Set the number of inactive cycles
+void SimulationNeutronProperties::setNumberOfInactiveCycles( 
+                                                       const unsigned cycles )
+{
+  SimulationNeutronProperties::number_of_inactive_cycles = cycles;
+}
+
+// Set the number of active cycles
+void SimulationNeutronProperties::setNumberOfActiveCycles( 
+                                                       const unsigned cycles )
+{
+  // Make sure the number of cycles is valid
+  testPrecondition( cycles > 0 );
+  
+  SimulationNeutronProperties::number_of_active_cycles = cycles;
+}
+
+// Set the Wielandt shift eigenvalue (0.0 = off)
+/*! \details The shift eigenvalue must be larger than the multiplication
+ * factor of the system (it is usually chosen to be 0.1-0.5 larger than the
+ * expected value). The closer the shift eigenvalue is to the multiplication
+ * factor the smaller the dominance ratio (and the fewer inactive cycles 
+ * needed for source convergence) but the longer each cycle will take.
+ */
+void SimulationNeutronProperties::setWielandtShift( 
+                                               const double shift_eigenvalue )
+{
+  // The fission bank requires an immediate fission fraction less than one
+  TEST_FOR_EXCEPTION( !(shift_eigenvalue == 0.0 || shift_eigenvalue > 1.0),
+		      std::invalid_argument,
+		      "Error: The Wielandt shift eigenvalue must be greater "
+		      "than 1.0 (or 0.0 to turn off Wielandt acceleration)!" );
+
+  SimulationNeutronProperties::wielandt_shift = shift_eigenvalue;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -47,6 +47,45 @@ public:
   //! Return the absolute maximum neutron
   static double getAbsoluteMaxNeutronEnergy();
 
+  //! Set compact (single precision) cross section storage mode to off
+  static void setCompactCrossSectionStorageModeOff();
+
+  //! Set compact (single precision) cross section storage mode to on
+  static void setCompactCrossSectionStorageModeOn();
+
+  //! Return if compact (single precision) cross section storage mode is on
+  static bool isCompactCrossSectionStorageModeOn();
+
+  //! Set criticality (k-eigenvalue) mode to off
+  static void setCriticalityModeOff();
+
+  //! Set criticality (k-eigenvalue) mode to on
+  static void setCriticalityModeOn();
+
+  //! Return if criticality (k-eigenvalue) mode is on
+  static bool isCriticalityModeOn();
+
+  //! Set the number of inactive cycles
+  static void setNumberOfInactiveCycles( const unsigned cycles );
+
+  //! Return the number of inactive cycles
+  static unsigned getNumberOfInactiveCycles();
+
+  //! Set the number of active cycles
+  static void setNumberOfActiveCycles( const unsigned cycles );
+
+  //! Return the number of active cycles
+  static unsigned getNumberOfActiveCycles();
+
+  //! Set the Wielandt shift eigenvalue (0.0 = off)
+  static void setWielandtShift( const double shift_eigenvalue );
+
+  //! Return the Wielandt shift eigenvalue
+  static double getWielandtShift();
+
+  //! Return if Wielandt acceleration is on
+  static bool isWielandtAccelerationOn();
+
 private:
 
   // The free gas thermal treatment temperature threshold
@@ -67,6 +106,21 @@ private:
 
   // The absolute minimum photon energy (MeV)
   static const double absolute_min_photon_energy;
+
+  // The compact cross section storage mode (true = on, false = off - default)
+  static bool compact_cross_section_storage_mode_on;
+
+  // The criticality mode (true = on, false = off - default)
+  static bool criticality_mode_on;
+
+  // The number of inactive cycles
+  static unsigned number_of_inactive_cycles;
+
+  // The number of active cycles
+  static unsigned number_of_active_cycles;
+
+  // The Wielandt shift eigenvalue (0.0 = off - default)
+  static double wielandt_shift;
 };
 
 // Return the free gas thermal treatment temperature threshold
@@ -99,6 +153,42 @@ inline double SimulationNeutronProperties::getAbsoluteMaxNeutronEnergy()
   return SimulationNeutronProperties::absolute_max_neutron_energy;
 }
 
+// Return if compact (single precision) cross section storage mode is on
+inline bool SimulationNeutronProperties::isCompactCrossSectionStorageModeOn()
+{
+  return SimulationNeutronProperties::compact_cross_section_storage_mode_on;
+}
+
+// Return if criticality (k-eigenvalue) mode is on
+inline bool SimulationNeutronProperties::isCriticalityModeOn()
+{
+  return SimulationNeutronProperties::criticality_mode_on;
+}
+
+// Return the number of inactive cycles
+inline unsigned SimulationNeutronProperties::getNumberOfInactiveCycles()
+{
+  return SimulationNeutronProperties::number_of_inactive_cycles;
+}
+
+// Return the number of active cycles
+inline unsigned SimulationNeutronProperties::getNumberOfActiveCycles()
+{
+  return SimulationNeutronProperties::number_of_active_cycles;
+}
+
+// Return the Wielandt shift eigenvalue
+inline double SimulationNeutronProperties::getWielandtShift()
+{
+  return SimulationNeutronProperties::wielandt_shift;
+}
+
+// Return if Wielandt acceleration is on
+inline bool SimulationNeutronProperties::isWielandtAccelerationOn()
+{
+  return SimulationNeutronProperties::wielandt_shift > 0.0;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_SIMULATION_NEUTRON_PROPERTIES_HPP
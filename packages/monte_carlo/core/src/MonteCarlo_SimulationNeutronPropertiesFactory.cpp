@@ -69,6 +69,56 @@ void SimulationNeutronPropertiesFactory::initializeSimulationNeutronProperties(
     }
   }
 
+  // Get the compact cross section storage mode - optional
+  if( properties.isParameter( "Compact Cross Section Storage" ) )
+  {
+    if( properties.get<bool>( "Compact Cross Section Storage" ) )
+      SimulationNeutronProperties::setCompactCrossSectionStorageModeOn();
+    else
+      SimulationNeutronProperties::setCompactCrossSectionStorageModeOff();
+  }
+
+  // Get the criticality mode - optional
+  if( properties.isParameter( "Criticality Mode" ) )
+  {
+    if( properties.get<bool>( "Criticality Mode" ) )
+      SimulationNeutronProperties::setCriticalityModeOn();
+    else
+      SimulationNeutronProperties::setCriticalityModeOff();
+  }
+
+  // Get the number of inactive cycles - optional
+  if( properties.isParameter( "Inactive Cycles" ) )
+  {
+    SimulationNeutronProperties::setNumberOfInactiveCycles( 
+                          properties.get<unsigned int>( "Inactive Cycles" ) );
+  }
+
+  // Get the number of active cycles - optional
+  if( properties.isParameter( "Active Cycles" ) )
+  {
+    unsigned active_cycles = properties.get<unsigned int>( "Active Cycles" );
+
+    TEST_FOR_EXCEPTION( active_cycles == 0,
+			std::runtime_error,
+			"Error: at least one active cycle must be run!" );
+
+    SimulationNeutronProperties::setNumberOfActiveCycles( active_cycles );
+  }
+
+  // Get the Wielandt shift eigenvalue - optional
+  if( properties.isParameter( "Wielandt Shift" ) )
+  {
+    double shift = properties.get<double>( "Wielandt Shift" );
+
+    TEST_FOR_EXCEPTION( !(shift == 0.0 || shift > 1.0),
+			std::runtime_error,
+			"Error: The Wielandt shift eigenvalue must be greater "
+			"than 1.0 (or 0.0 to turn off Wielandt acceleration)!" );
+
+    SimulationNeutronProperties::setWielandtShift( shift );
+  }
+
   properties.unused( std::cerr );
 }
 
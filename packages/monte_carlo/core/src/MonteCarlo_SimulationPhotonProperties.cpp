@@ -50,6 +50,13 @@ bool SimulationPhotonProperties::detailed_pair_production_mode_on = false;
 // The photonuclear interaction mode (true = on, false = off - default)
 bool SimulationPhotonProperties::photonuclear_interaction_mode_on = false;
 
+// The thick-target bremsstrahlung mode (true = on, false = off - default)
+bool SimulationPhotonProperties::thick_target_bremsstrahlung_mode_on = false;
+
+// The inverse cdf Doppler broadening sampling mode (true = on, 
+// false = off - default)
+bool SimulationPhotonProperties::inverse_cdf_doppler_broadening_sampling_mode_on = false;
+
 // Set the minimum photon energy (MeV)
 void SimulationPhotonProperties::setMinPhotonEnergy( const double energy )
 {
@@ -113,6 +120,27 @@ void SimulationPhotonProperties::setPhotonuclearInteractionModeOn()
   SimulationPhotonProperties::photonuclear_interaction_mode_on = true;
 }
 
+// Set thick-target bremsstrahlung mode to on (off by default)
+/*! \details When this mode is on, the secondary electrons created by photon
+ * interactions will deposit their energy locally and immediately emit the
+ * bremsstrahlung photons that they would have produced while slowing down
+ * (only used in photon mode).
+ */
+void SimulationPhotonProperties::setThickTargetBremsstrahlungModeOn()
+{
+  SimulationPhotonProperties::thick_target_bremsstrahlung_mode_on = true;
+}
+
+// Set inverse cdf Doppler broadening sampling mode to on (off by default)
+/*! \details When this mode is on, the complete Doppler broadened photon 
+ * energy distributions will sample the interaction subshell directly from
+ * the accessible subshells instead of using a rejection loop.
+ */
+void SimulationPhotonProperties::setInverseCDFDopplerBroadeningSamplingModeOn()
+{
+  SimulationPhotonProperties::inverse_cdf_doppler_broadening_sampling_mode_on = true;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
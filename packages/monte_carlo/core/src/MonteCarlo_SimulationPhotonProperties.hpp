@@ -81,6 +81,18 @@ public:
   //! Return if photonuclear interaction mode is on
   static bool isPhotonuclearInteractionModeOn();
 
+  //! Set thick-target bremsstrahlung mode to on (off by default)
+  static void setThickTargetBremsstrahlungModeOn();
+
+  //! Return if thick-target bremsstrahlung mode is on
+  static bool isThickTargetBremsstrahlungModeOn();
+
+  //! Set inverse cdf Doppler broadening sampling mode to on (off by default)
+  static void setInverseCDFDopplerBroadeningSamplingModeOn();
+
+  //! Return if inverse cdf Doppler broadening sampling mode is on
+  static bool isInverseCDFDopplerBroadeningSamplingModeOn();
+
 private:
 
   // The absolute minimum photon energy (MeV)
@@ -115,6 +127,13 @@ private:
 
   // The photonuclear interaction mode (true = on, false = off - default)
   static bool photonuclear_interaction_mode_on;
+
+  // The thick-target bremsstrahlung mode (true = on, false = off - default)
+  static bool thick_target_bremsstrahlung_mode_on;
+
+  // The inverse cdf Doppler broadening sampling mode (true = on, 
+  // false = off - default)
+  static bool inverse_cdf_doppler_broadening_sampling_mode_on;
 };
 
 // Return the minimum photon energy (MeV)
@@ -183,6 +202,18 @@ inline bool SimulationPhotonProperties::isPhotonuclearInteractionModeOn()
   return SimulationPhotonProperties::photonuclear_interaction_mode_on;
 }
 
+// Return if thick-target bremsstrahlung mode is on
+inline bool SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn()
+{
+  return SimulationPhotonProperties::thick_target_bremsstrahlung_mode_on;
+}
+
+// Return if inverse cdf Doppler broadening sampling mode is on
+inline bool SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn()
+{
+  return SimulationPhotonProperties::inverse_cdf_doppler_broadening_sampling_mode_on;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_SIMULATION_PHOTON_PROPERTIES_HPP
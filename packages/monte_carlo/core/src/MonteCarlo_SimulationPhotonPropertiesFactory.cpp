@@ -129,6 +129,20 @@ void SimulationPhotonPropertiesFactory::initializeSimulationPhotonProperties(
     if( properties.get<bool>( "Photonuclear Interaction" ) )
       SimulationPhotonProperties::setPhotonuclearInteractionModeOn();
   }
+
+  // Get the thick-target bremsstrahlung mode - optional
+  if( properties.isParameter( "Thick Target Bremsstrahlung" ) )
+  {
+    if( properties.get<bool>( "Thick Target Bremsstrahlung" ) )
+      SimulationPhotonProperties::setThickTargetBremsstrahlungModeOn();
+  }
+
+  // Get the inverse cdf Doppler broadening sampling mode - optional
+  if( properties.isParameter( "Inverse CDF Doppler Broadening Sampling" ) )
+  {
+    if( properties.get<bool>( "Inverse CDF Doppler Broadening Sampling" ) )
+      SimulationPhotonProperties::setInverseCDFDopplerBroadeningSamplingModeOn();
+  }
   
   properties.unused( std::cerr );
 }
@@ -13,6 +13,7 @@
 #include "MonteCarlo_SimulationPhotonPropertiesFactory.hpp"
 #include "MonteCarlo_SimulationElectronPropertiesFactory.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
+#include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
 
@@ -120,6 +121,13 @@ void SimulationPropertiesFactory::initializeSimulationProperties(
       general_properties );
   }
 
+  // Fission sites are only banked by analogue collisions
+  TEST_FOR_EXCEPTION( SimulationNeutronProperties::isCriticalityModeOn() &&
+		      SimulationGeneralProperties::isImplicitCaptureModeOn(),
+		      std::runtime_error,
+		      "Error: implicit capture cannot be used in criticality "
+		      "mode!" );
+
   properties.unused( *os_warn );
 }
 
@@ -0,0 +1,309 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMesh.cpp
+//! \author Luke Kersting
+//! \brief  The weight window mesh class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "Utility_HDF5FileHandler.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Create a weight window mesh from an HDF5 file
+/*! \details The mesh planes, the energy group boundaries and the lower
+ * weight bounds are stored in data sets in the /weight_windows/ group. The
+ * upper bound ratio, survival ratio and max split are optional attributes
+ * of the group.
+ */
+Teuchos::RCP<WeightWindowMesh> WeightWindowMesh::createFromHDF5File(
+				           const std::string& hdf5_file_name )
+{
+  Utility::HDF5FileHandler hdf5_file;
+  hdf5_file.throwExceptions();
+
+  Teuchos::Array<double> x_planes, y_planes, z_planes,
+    energy_group_boundaries, lower_weight_bounds;
+
+  double upper_bound_ratio = 5.0;
+  double survival_ratio = 3.0;
+  unsigned max_split = 5u;
+
+  try{
+    hdf5_file.openHDF5FileAndReadOnly( hdf5_file_name );
+
+    hdf5_file.readArrayFromDataSet( x_planes, "/weight_windows/x_planes" );
+    hdf5_file.readArrayFromDataSet( y_planes, "/weight_windows/y_planes" );
+    hdf5_file.readArrayFromDataSet( z_planes, "/weight_windows/z_planes" );
+    hdf5_file.readArrayFromDataSet( energy_group_boundaries,
+				    "/weight_windows/energy_groups" );
+    hdf5_file.readArrayFromDataSet( lower_weight_bounds,
+				    "/weight_windows/lower_weight_bounds" );
+
+    if( hdf5_file.doesGroupAttributeExist( "/weight_windows/",
+					   "upper_bound_ratio" ) )
+    {
+      hdf5_file.readValueFromGroupAttribute( upper_bound_ratio,
+					     "/weight_windows/",
+					     "upper_bound_ratio" );
+    }
+
+    if( hdf5_file.doesGroupAttributeExist( "/weight_windows/",
+					   "survival_ratio" ) )
+    {
+      hdf5_file.readValueFromGroupAttribute( survival_ratio,
+					     "/weight_windows/",
+					     "survival_ratio" );
+    }
+
+    if( hdf5_file.doesGroupAttributeExist( "/weight_windows/",
+					   "max_split" ) )
+    {
+      hdf5_file.readValueFromGroupAttribute( max_split,
+					     "/weight_windows/",
+					     "max_split" );
+    }
+
+    hdf5_file.closeHDF5File();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: the weight windows could not be read from "
+			   "file " << hdf5_file_name << "!" );
+
+  TEST_FOR_EXCEPTION( lower_weight_bounds.size() !=
+		      (x_planes.size()-1)*(y_planes.size()-1)*
+		      (z_planes.size()-1)*(energy_group_boundaries.size()-1),
+		      std::runtime_error,
+		      "Error: the number of lower weight bounds in file "
+		      << hdf5_file_name << " does not match the mesh!" );
+
+  return Teuchos::rcp( new WeightWindowMesh( x_planes,
+					     y_planes,
+					     z_planes,
+					     energy_group_boundaries,
+					     lower_weight_bounds,
+					     upper_bound_ratio,
+					     survival_ratio,
+					     max_split ) );
+}
+
+// Constructor
+WeightWindowMesh::WeightWindowMesh(
+		        const Teuchos::Array<double>& x_planes,
+			const Teuchos::Array<double>& y_planes,
+			const Teuchos::Array<double>& z_planes,
+			const Teuchos::Array<double>& energy_group_boundaries,
+			const Teuchos::Array<double>& lower_weight_bounds,
+			const double upper_bound_ratio,
+			const double survival_ratio,
+			const unsigned max_split )
+  : d_x_planes( x_planes ),
+    d_y_planes( y_planes ),
+    d_z_planes( z_planes ),
+    d_energy_group_boundaries( energy_group_boundaries ),
+    d_lower_weight_bounds( lower_weight_bounds ),
+    d_upper_bound_ratio( upper_bound_ratio ),
+    d_survival_ratio( survival_ratio ),
+    d_max_split( max_split )
+{
+  // Make sure the mesh planes are valid
+  testPrecondition( x_planes.size() > 1 );
+  testPrecondition( y_planes.size() > 1 );
+  testPrecondition( z_planes.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( x_planes.begin(),
+						      x_planes.end() ) );
+  testPrecondition( Utility::Sort::isSortedAscending( y_planes.begin(),
+						      y_planes.end() ) );
+  testPrecondition( Utility::Sort::isSortedAscending( z_planes.begin(),
+						      z_planes.end() ) );
+  // Make sure the energy groups are valid
+  testPrecondition( energy_group_boundaries.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+					   energy_group_boundaries.begin(),
+					   energy_group_boundaries.end() ) );
+  // Make sure the lower weight bounds are valid
+  testPrecondition( lower_weight_bounds.size() ==
+		    (x_planes.size()-1)*(y_planes.size()-1)*
+		    (z_planes.size()-1)*(energy_group_boundaries.size()-1) );
+  // Make sure the window parameters are valid
+  testPrecondition( upper_bound_ratio > 1.0 );
+  testPrecondition( survival_ratio >= 1.0 );
+  testPrecondition( survival_ratio <= upper_bound_ratio );
+  testPrecondition( max_split > 1u );
+}
+
+// Export the weight window mesh to an HDF5 file
+void WeightWindowMesh::exportToHDF5File(
+				     const std::string& hdf5_file_name ) const
+{
+  Utility::HDF5FileHandler hdf5_file;
+  hdf5_file.throwExceptions();
+
+  try{
+    hdf5_file.openHDF5FileAndOverwrite( hdf5_file_name );
+
+    hdf5_file.writeArrayToDataSet( d_x_planes, "/weight_windows/x_planes" );
+    hdf5_file.writeArrayToDataSet( d_y_planes, "/weight_windows/y_planes" );
+    hdf5_file.writeArrayToDataSet( d_z_planes, "/weight_windows/z_planes" );
+    hdf5_file.writeArrayToDataSet( d_energy_group_boundaries,
+				   "/weight_windows/energy_groups" );
+    hdf5_file.writeArrayToDataSet( d_lower_weight_bounds,
+				   "/weight_windows/lower_weight_bounds" );
+
+    hdf5_file.writeValueToGroupAttribute( d_upper_bound_ratio,
+					  "/weight_windows/",
+					  "upper_bound_ratio" );
+
+    hdf5_file.writeValueToGroupAttribute( d_survival_ratio,
+					  "/weight_windows/",
+					  "survival_ratio" );
+
+    hdf5_file.writeValueToGroupAttribute( d_max_split,
+					  "/weight_windows/",
+					  "max_split" );
+
+    hdf5_file.closeHDF5File();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: the weight windows could not be written to "
+			   "file " << hdf5_file_name << "!" );
+}
+
+// Return the lower weight bound at the particle phase space point
+/*! \details A lower weight bound of zero is returned if the particle is
+ * outside of the mesh or the energy groups.
+ */
+double WeightWindowMesh::getLowerWeightBound(
+				        const ParticleState& particle ) const
+{
+  unsigned i, j, k, g;
+
+  if( !WeightWindowMesh::findBin( d_x_planes, particle.getXPosition(), i ) ||
+      !WeightWindowMesh::findBin( d_y_planes, particle.getYPosition(), j ) ||
+      !WeightWindowMesh::findBin( d_z_planes, particle.getZPosition(), k ) ||
+      !WeightWindowMesh::findBin( d_energy_group_boundaries,
+				  particle.getEnergy(),
+				  g ) )
+    return 0.0;
+
+  const unsigned nx = d_x_planes.size() - 1;
+  const unsigned ny = d_y_planes.size() - 1;
+  const unsigned nz = d_z_planes.size() - 1;
+
+  return d_lower_weight_bounds[i + nx*(j + ny*(k + nz*g))];
+}
+
+// Apply the weight window to the particle (split or roulette)
+/*! \details A particle above the upper weight bound is split into n
+ * particles of equal weight, where n is the ratio of the particle weight to
+ * the upper weight bound rounded up (but no larger than the max split). The
+ * n-1 new particles are pushed to the bank. A particle below the lower
+ * weight bound survives Russian roulette with a probability equal to its
+ * weight divided by the survival weight and is given the survival weight.
+ */
+void WeightWindowMesh::applyWeightWindow( ParticleState& particle,
+					  ParticleBank& bank ) const
+{
+  if( particle.isGone() )
+    return;
+
+  const double lower_weight_bound = this->getLowerWeightBound( particle );
+
+  // No window has been defined at this phase space point
+  if( lower_weight_bound <= 0.0 )
+    return;
+
+  const double weight = particle.getWeight();
+
+  const double upper_weight_bound = lower_weight_bound*d_upper_bound_ratio;
+
+  if( weight > upper_weight_bound )
+  {
+    unsigned number_of_particles =
+      (unsigned)std::ceil( weight/upper_weight_bound );
+
+    if( number_of_particles > d_max_split )
+      number_of_particles = d_max_split;
+
+    particle.setWeight( weight/number_of_particles );
+
+    for( unsigned n = 1u; n < number_of_particles; ++n )
+      bank.push( particle );
+  }
+  else if( weight < lower_weight_bound )
+  {
+    const double survival_weight = lower_weight_bound*d_survival_ratio;
+
+    if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+	survival_weight < weight )
+      particle.setWeight( survival_weight );
+    else
+      particle.setAsGone();
+  }
+}
+
+// Return the upper bound ratio
+double WeightWindowMesh::getUpperBoundRatio() const
+{
+  return d_upper_bound_ratio;
+}
+
+// Return the survival ratio
+double WeightWindowMesh::getSurvivalRatio() const
+{
+  return d_survival_ratio;
+}
+
+// Return the max split
+unsigned WeightWindowMesh::getMaxSplit() const
+{
+  return d_max_split;
+}
+
+// Return the number of mesh elements
+unsigned WeightWindowMesh::getNumberOfMeshElements() const
+{
+  return (d_x_planes.size()-1)*(d_y_planes.size()-1)*(d_z_planes.size()-1);
+}
+
+// Return the number of energy groups
+unsigned WeightWindowMesh::getNumberOfEnergyGroups() const
+{
+  return d_energy_group_boundaries.size() - 1;
+}
+
+// Find the bin that contains a value (false if outside of the boundaries)
+bool WeightWindowMesh::findBin( const Teuchos::Array<double>& boundaries,
+				const double value,
+				unsigned& bin )
+{
+  if( value < boundaries.front() || value > boundaries.back() )
+    return false;
+  else if( value == boundaries.back() )
+    bin = boundaries.size() - 2;
+  else
+  {
+    bin = Utility::Search::binaryLowerBoundIndex( boundaries.begin(),
+						  boundaries.end(),
+						  value );
+  }
+
+  return true;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMesh.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMesh.hpp
+//! \author Luke Kersting
+//! \brief  The weight window mesh class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_HPP
+
+// Std Lib Includes
+#include <string>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh class
+ * \details A lower weight bound is stored for every element of a Cartesian
+ * mesh and every energy group. The upper weight bound and the survival
+ * weight of a window are the lower weight bound multiplied by the upper
+ * bound ratio and the survival ratio respectively. Particles above the
+ * upper bound are split (the number of particles created is limited by the
+ * max split) and particles below the lower bound play Russian roulette.
+ * A lower weight bound of zero, a position outside of the mesh or an
+ * energy outside of the energy groups means that no window is applied. The
+ * lower weight bounds are ordered by energy group, z index, y index and
+ * then x index (the x index varies fastest).
+ */
+class WeightWindowMesh
+{
+
+public:
+
+  //! Create a weight window mesh from an HDF5 file
+  static Teuchos::RCP<WeightWindowMesh>
+  createFromHDF5File( const std::string& hdf5_file_name );
+
+  //! Constructor
+  WeightWindowMesh( const Teuchos::Array<double>& x_planes,
+		    const Teuchos::Array<double>& y_planes,
+		    const Teuchos::Array<double>& z_planes,
+		    const Teuchos::Array<double>& energy_group_boundaries,
+		    const Teuchos::Array<double>& lower_weight_bounds,
+		    const double upper_bound_ratio = 5.0,
+		    const double survival_ratio = 3.0,
+		    const unsigned max_split = 5u );
+
+  //! Destructor
+  ~WeightWindowMesh()
+  { /* ... */ }
+
+  //! Export the weight window mesh to an HDF5 file
+  void exportToHDF5File( const std::string& hdf5_file_name ) const;
+
+  //! Return the lower weight bound at the particle phase space point
+  double getLowerWeightBound( const ParticleState& particle ) const;
+
+  //! Apply the weight window to the particle (split or roulette)
+  void applyWeightWindow( ParticleState& particle, ParticleBank& bank ) const;
+
+  //! Return the upper bound ratio
+  double getUpperBoundRatio() const;
+
+  //! Return the survival ratio
+  double getSurvivalRatio() const;
+
+  //! Return the max split
+  unsigned getMaxSplit() const;
+
+  //! Return the number of mesh elements
+  unsigned getNumberOfMeshElements() const;
+
+  //! Return the number of energy groups
+  unsigned getNumberOfEnergyGroups() const;
+
+private:
+
+  // Find the bin that contains a value (false if outside of the boundaries)
+  static bool findBin( const Teuchos::Array<double>& boundaries,
+		       const double value,
+		       unsigned& bin );
+
+  // The x planes of the mesh
+  Teuchos::Array<double> d_x_planes;
+
+  // The y planes of the mesh
+  Teuchos::Array<double> d_y_planes;
+
+  // The z planes of the mesh
+  Teuchos::Array<double> d_z_planes;
+
+  // The energy group boundaries
+  Teuchos::Array<double> d_energy_group_boundaries;
+
+  // The lower weight bounds (indexed by group, z, y and x)
+  Teuchos::Array<double> d_lower_weight_bounds;
+
+  // The upper bound ratio
+  double d_upper_bound_ratio;
+
+  // The survival ratio
+  double d_survival_ratio;
+
+  // The max number of particles that a particle can be split into
+  unsigned d_max_split;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMesh.hpp
+//---------------------------------------------------------------------------//
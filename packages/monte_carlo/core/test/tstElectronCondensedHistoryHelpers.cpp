@@ -0,0 +1,66 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstElectronCondensedHistoryHelpers.cpp
+//! \author Luke Kersting
+//! \brief  Electron condensed history helper function unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronCondensedHistoryHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the soft energy loss of a segment can be applied
+TEUCHOS_UNIT_TEST( ElectronCondensedHistoryHelpers, applySoftEnergyLoss )
+{
+  MonteCarlo::ElectronState electron( 0ull );
+  electron.setEnergy( 1.0 );
+
+  bool cutoff_reached = 
+    MonteCarlo::applySoftEnergyLoss( electron, 0.1, 2.0, 1e-3 );
+
+  TEST_ASSERT( !cutoff_reached );
+  TEST_FLOATING_EQUALITY( electron.getEnergy(), 0.8, 1e-15 );
+
+  // No energy is lost in a void
+  cutoff_reached = MonteCarlo::applySoftEnergyLoss( electron, 0.1, 0.0, 1e-3 );
+
+  TEST_ASSERT( !cutoff_reached );
+  TEST_FLOATING_EQUALITY( electron.getEnergy(), 0.8, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a segment that crosses the cutoff energy ends at the cutoff
+TEUCHOS_UNIT_TEST( ElectronCondensedHistoryHelpers, 
+		   applySoftEnergyLoss_cutoff )
+{
+  MonteCarlo::ElectronState electron( 0ull );
+  electron.setEnergy( 1.0 );
+
+  // The segment would take the electron to 0.2 MeV
+  bool cutoff_reached = 
+    MonteCarlo::applySoftEnergyLoss( electron, 0.4, 2.0, 0.5 );
+
+  TEST_ASSERT( cutoff_reached );
+  TEST_EQUALITY_CONST( electron.getEnergy(), 0.5 );
+
+  // The segment would take the electron to exactly the cutoff
+  electron.setEnergy( 1.0 );
+
+  cutoff_reached = MonteCarlo::applySoftEnergyLoss( electron, 0.25, 2.0, 0.5 );
+
+  TEST_ASSERT( !cutoff_reached );
+  TEST_EQUALITY_CONST( electron.getEnergy(), 0.5 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstElectronCondensedHistoryHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFissionBank.cpp
+//! \author Luke Kersting
+//! \brief  Fission bank unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the fission reactions can be identified
+TEUCHOS_UNIT_TEST( FissionBank, isFissionReaction )
+{
+  TEST_ASSERT( MonteCarlo::isFissionReaction( 
+				     MonteCarlo::N__TOTAL_FISSION_REACTION ) );
+  TEST_ASSERT( MonteCarlo::isFissionReaction( 
+					   MonteCarlo::N__FISSION_REACTION ) );
+  TEST_ASSERT( MonteCarlo::isFissionReaction( 
+					 MonteCarlo::N__N_FISSION_REACTION ) );
+  TEST_ASSERT( MonteCarlo::isFissionReaction( 
+					MonteCarlo::N__2N_FISSION_REACTION ) );
+  TEST_ASSERT( MonteCarlo::isFissionReaction( 
+					MonteCarlo::N__3N_FISSION_REACTION ) );
+  TEST_ASSERT( !MonteCarlo::isFissionReaction( 
+				         MonteCarlo::N__N_ELASTIC_REACTION ) );
+  TEST_ASSERT( !MonteCarlo::isFissionReaction( 
+					     MonteCarlo::N__2N_REACTION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that fission neutrons are stored in the fission site bank
+TEUCHOS_UNIT_TEST( FissionBank, push )
+{
+  MonteCarlo::FissionBank bank;
+
+  TEST_EQUALITY_CONST( bank.getImmediateFissionFraction(), 0.0 );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+
+  bank.push( neutron, MonteCarlo::N__2N_REACTION );
+  
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 0 );
+
+  bank.push( neutron, MonteCarlo::N__FISSION_REACTION );
+  bank.push( neutron, MonteCarlo::N__TOTAL_FISSION_REACTION );
+
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 2 );
+
+  MonteCarlo::PhotonState photon( 0ull );
+
+  bank.push( photon );
+
+  TEST_EQUALITY_CONST( bank.size(), 2 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that fission neutron smart pointers are stored in the fission site
+// bank
+TEUCHOS_UNIT_TEST( FissionBank, push_smart_ptr )
+{
+  MonteCarlo::FissionBank bank;
+
+  Teuchos::RCP<MonteCarlo::NeutronState> neutron(
+					new MonteCarlo::NeutronState( 0ull ) );
+
+  MonteCarlo::ParticleState* neutron_ptr = neutron.get();
+
+  bank.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  TEST_ASSERT( neutron.is_null() );
+  TEST_EQUALITY_CONST( bank.size(), 0 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 1 );
+  TEST_EQUALITY( &bank.getFissionSiteBank().top(), neutron_ptr );
+
+  neutron.reset( new MonteCarlo::NeutronState( 1ull ) );
+  neutron_ptr = neutron.get();
+
+  bank.push( neutron, MonteCarlo::N__2N_REACTION );
+
+  TEST_ASSERT( neutron.is_null() );
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 1 );
+  TEST_EQUALITY( &bank.top(), neutron_ptr );
+}
+
+//---------------------------------------------------------------------------//
+// Check that fission neutrons can be transported immediately
+TEUCHOS_UNIT_TEST( FissionBank, push_immediate )
+{
+  MonteCarlo::FissionBank bank( 0.75 );
+
+  TEST_EQUALITY_CONST( bank.getImmediateFissionFraction(), 0.75 );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.8;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+
+  bank.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 0 );
+
+  bank.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.getFissionSiteBank().size(), 1 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain( argc, argv );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFissionBank.cpp
+//---------------------------------------------------------------------------//
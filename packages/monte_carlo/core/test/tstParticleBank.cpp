@@ -132,6 +132,35 @@ TEUCHOS_UNIT_TEST( ParticleBank, push_smart_ptr )
   TEST_EQUALITY_CONST( bank.size(), 4 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the bank takes the particle stored in a smart pointer
+TEUCHOS_UNIT_TEST( ParticleBank, push_smart_ptr_no_copy )
+{
+  MonteCarlo::ParticleBank bank;
+
+  Teuchos::RCP<MonteCarlo::ParticleState> photon( 
+					 new MonteCarlo::PhotonState( 0ull ) );
+
+  MonteCarlo::ParticleState* photon_ptr = photon.get();
+    
+  bank.push( photon );
+
+  TEST_ASSERT( photon.is_null() );
+  TEST_EQUALITY( &bank.top(), photon_ptr );
+
+  bank.pop();
+
+  boost::shared_ptr<MonteCarlo::NeutronState> neutron( 
+					new MonteCarlo::NeutronState( 1ull ) );
+
+  MonteCarlo::ParticleState* neutron_ptr = neutron.get();
+
+  bank.push( neutron, MonteCarlo::N__N_ELASTIC_REACTION );
+
+  TEST_ASSERT( !neutron.get() );
+  TEST_EQUALITY( &bank.top(), neutron_ptr );
+}
+
 //---------------------------------------------------------------------------//
 // Check that that the top element of the bank can be accessed
 TEUCHOS_UNIT_TEST( ParticleBank, top )
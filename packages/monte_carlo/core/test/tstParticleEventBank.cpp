@@ -0,0 +1,324 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParticleEventBank.cpp
+//! \author Luke Kersting
+//! \brief  Particle event bank unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+std::shared_ptr<MonteCarlo::ParticleState> createNeutron(
+		     const unsigned long long history,
+		     const Geometry::ModuleTraits::InternalCellHandle cell,
+		     const double energy )
+{
+  std::shared_ptr<MonteCarlo::ParticleState>
+    neutron( new MonteCarlo::NeutronState( history ) );
+
+  neutron->setCell( cell );
+  neutron->setEnergy( energy );
+  neutron->setPosition( 1.0, 2.0, 3.0 );
+
+  return neutron;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that histories can be added to the bank
+TEUCHOS_UNIT_TEST( ParticleEventBank, addHistory )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  TEST_EQUALITY_CONST( bank.getNumberOfHistories(), 0 );
+
+  TEST_EQUALITY_CONST( bank.addHistory( 10ull ), 0 );
+  TEST_EQUALITY_CONST( bank.addHistory( 11ull ), 1 );
+
+  TEST_EQUALITY_CONST( bank.getNumberOfHistories(), 2 );
+  TEST_EQUALITY_CONST( bank.getHistoryNumber( 0 ), 10ull );
+  TEST_EQUALITY_CONST( bank.getHistoryNumber( 1 ), 11ull );
+
+  bank.setRandomNumberGeneratorState( 1, 100ull );
+
+  TEST_EQUALITY_CONST( bank.getRandomNumberGeneratorState( 1 ), 100ull );
+
+  // A history without particles is complete
+  TEST_ASSERT( bank.isHistoryComplete( 0 ) );
+  TEST_ASSERT( !bank.isHistoryCommitted( 0 ) );
+
+  bank.setHistoryCommitted( 0 );
+
+  TEST_ASSERT( bank.isHistoryCommitted( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles can be pushed to the bank
+TEUCHOS_UNIT_TEST( ParticleEventBank, push )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history = bank.addHistory( 0ull );
+
+  TEST_ASSERT( bank.isEmpty() );
+
+  TEST_EQUALITY_CONST( bank.push( createNeutron( 0ull, 1, 2.0 ), history ),
+		       0 );
+  TEST_EQUALITY_CONST( bank.push( createNeutron( 0ull, 2, 1.0 ), history ),
+		       1 );
+
+  TEST_ASSERT( !bank.isEmpty() );
+  TEST_EQUALITY_CONST( bank.size(), 2 );
+  TEST_ASSERT( !bank.isHistoryComplete( history ) );
+  TEST_EQUALITY_CONST( bank.getHistory( 1 ), history );
+  TEST_EQUALITY_CONST( bank.getParticle( 1 ).getCell(), 2 );
+  TEST_ASSERT( !bank.isCollisionPending( 0 ) );
+  TEST_EQUALITY_CONST( bank.getRayStartPoint( 0 )[0], 1.0 );
+  TEST_EQUALITY_CONST( bank.getRayStartPoint( 0 )[1], 2.0 );
+  TEST_EQUALITY_CONST( bank.getRayStartPoint( 0 )[2], 3.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the tracking data of a particle can be set
+TEUCHOS_UNIT_TEST( ParticleEventBank, setTrackingData )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history = bank.addHistory( 0ull );
+
+  bank.push( createNeutron( 0ull, 1, 2.0 ), history );
+
+  bank.setCrossSection( 0, 0.5 );
+  bank.setOpticalPath( 0, 2.0 );
+
+  TEST_EQUALITY_CONST( bank.getCrossSection( 0 ), 0.5 );
+  TEST_EQUALITY_CONST( bank.getOpticalPath( 0 ), 2.0 );
+
+  bank.setCollisionPending( 0, 4.0, 1e-9 );
+
+  TEST_ASSERT( bank.isCollisionPending( 0 ) );
+  TEST_EQUALITY_CONST( bank.getCollisionTrackLength( 0 ), 4.0 );
+  TEST_EQUALITY_CONST( bank.getCollisionStartTime( 0 ), 1e-9 );
+
+  bank.clearCollisionPending( 0 );
+
+  TEST_ASSERT( !bank.isCollisionPending( 0 ) );
+
+  bank.getParticle( 0 ).setPosition( 4.0, 5.0, 6.0 );
+  bank.resetRayStartPoint( 0 );
+
+  TEST_EQUALITY_CONST( bank.getRayStartPoint( 0 )[0], 4.0 );
+  TEST_EQUALITY_CONST( bank.getRayStartPoint( 0 )[1], 5.0 );
+  TEST_EQUALITY_CONST( bank.getRayStartPoint( 0 )[2], 6.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that estimator events can be recorded
+TEUCHOS_UNIT_TEST( ParticleEventBank, recordEvents )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history = bank.addHistory( 0ull );
+
+  bank.push( createNeutron( 0ull, 1, 2.0 ), history );
+  bank.setCrossSection( 0, 0.5 );
+
+  bank.recordGenerationEvent( 0 );
+
+  double surface_normal[3] = {0.0, 0.0, 1.0};
+
+  bank.recordCrossingSurfaceEvent( 0, 2, 1, 3, 1.5, 0.0, surface_normal );
+
+  bank.getParticle( 0 ).setEnergy( 1.0 );
+  bank.setCollisionPending( 0, 2.5, 1e-9 );
+  bank.recordCollisionEvents( 0 );
+
+  const Teuchos::Array<MonteCarlo::ParticleEventBank::ParticleStateData>&
+    generation_events = bank.getGenerationEvents( history );
+
+  TEST_EQUALITY_CONST( generation_events.size(), 1 );
+  TEST_EQUALITY_CONST( generation_events[0].particle_type, 
+		       MonteCarlo::NEUTRON );
+  TEST_EQUALITY_CONST( generation_events[0].cell, 1 );
+  TEST_EQUALITY_CONST( generation_events[0].energy, 2.0 );
+  TEST_EQUALITY_CONST( generation_events[0].position[1], 2.0 );
+
+  const Teuchos::Array<MonteCarlo::ParticleEventBank::CrossingSurfaceEvent>&
+    crossing_surface_events = bank.getCrossingSurfaceEvents( history );
+
+  TEST_EQUALITY_CONST( crossing_surface_events.size(), 1 );
+  TEST_EQUALITY_CONST( crossing_surface_events[0].cell_entering, 2 );
+  TEST_EQUALITY_CONST( crossing_surface_events[0].cell_leaving, 1 );
+  TEST_EQUALITY_CONST( crossing_surface_events[0].surface_crossing, 3 );
+  TEST_EQUALITY_CONST( crossing_surface_events[0].track_length, 1.5 );
+  TEST_EQUALITY_CONST( crossing_surface_events[0].surface_normal[2], 1.0 );
+
+  const Teuchos::Array<MonteCarlo::ParticleEventBank::CollidingInCellEvent>&
+    colliding_in_cell_events = bank.getCollidingInCellEvents( history );
+
+  TEST_EQUALITY_CONST( colliding_in_cell_events.size(), 1 );
+  TEST_EQUALITY_CONST( colliding_in_cell_events[0].particle.energy, 1.0 );
+  TEST_EQUALITY_CONST( colliding_in_cell_events[0].track_length, 2.5 );
+  TEST_EQUALITY_CONST( colliding_in_cell_events[0].start_time, 1e-9 );
+  TEST_EQUALITY_CONST( 
+		 colliding_in_cell_events[0].inverse_total_cross_section, 2.0 );
+
+  const Teuchos::Array<MonteCarlo::ParticleEventBank::CollidingGlobalEvent>&
+    colliding_global_events = bank.getCollidingGlobalEvents( history );
+
+  TEST_EQUALITY_CONST( colliding_global_events.size(), 1 );
+  TEST_EQUALITY_CONST( colliding_global_events[0].particle.energy, 1.0 );
+  TEST_EQUALITY_CONST( colliding_global_events[0].start_point[0], 1.0 );
+  TEST_EQUALITY_CONST( colliding_global_events[0].end_point[2], 3.0 );
+
+  // The recorded particle state does not change with the particle
+  bank.getParticle( 0 ).setEnergy( 0.5 );
+
+  TEST_EQUALITY_CONST( colliding_in_cell_events[0].particle.energy, 1.0 );
+
+  // The recorded events are cleared when the history is committed
+  bank.getParticle( 0 ).setAsGone();
+  bank.removeInactiveParticles();
+  bank.setHistoryCommitted( history );
+
+  TEST_EQUALITY_CONST( bank.getGenerationEvents( history ).size(), 0 );
+  TEST_EQUALITY_CONST( bank.getCrossingSurfaceEvents( history ).size(), 0 );
+  TEST_EQUALITY_CONST( bank.getCollidingInCellEvents( history ).size(), 0 );
+  TEST_EQUALITY_CONST( bank.getCollidingGlobalEvents( history ).size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a recorded particle state can be restored
+TEUCHOS_UNIT_TEST( ParticleEventBank, restoreParticleState )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history = bank.addHistory( 0ull );
+
+  bank.push( createNeutron( 0ull, 1, 2.0 ), history );
+
+  bank.getParticle( 0 ).setDirection( 0.0, 1.0, 0.0 );
+  bank.getParticle( 0 ).setTime( 1e-8 );
+  bank.getParticle( 0 ).setWeight( 0.5 );
+  bank.getParticle( 0 ).incrementCollisionNumber();
+  bank.getParticle( 0 ).incrementCollisionNumber();
+
+  bank.recordGenerationEvent( 0 );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+
+  neutron.incrementCollisionNumber();
+  neutron.incrementCollisionNumber();
+  neutron.incrementCollisionNumber();
+
+  MonteCarlo::ParticleEventBank::restoreParticleState( 
+				   bank.getGenerationEvents( history )[0],
+				   neutron );
+
+  TEST_EQUALITY_CONST( neutron.getCell(), 1 );
+  TEST_EQUALITY_CONST( neutron.getXPosition(), 1.0 );
+  TEST_EQUALITY_CONST( neutron.getYPosition(), 2.0 );
+  TEST_EQUALITY_CONST( neutron.getZPosition(), 3.0 );
+  TEST_EQUALITY_CONST( neutron.getYDirection(), 1.0 );
+  TEST_EQUALITY_CONST( neutron.getEnergy(), 2.0 );
+  TEST_EQUALITY_CONST( neutron.getTime(), 1e-8 );
+  TEST_EQUALITY_CONST( neutron.getWeight(), 0.5 );
+  TEST_EQUALITY_CONST( neutron.getCollisionNumber(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a particle of a known type can be accessed
+TEUCHOS_UNIT_TEST( ParticleEventBank, getParticle_type )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history = bank.addHistory( 0ull );
+
+  bank.push( createNeutron( 0ull, 1, 2.0 ), history );
+
+  MonteCarlo::NeutronState& neutron = 
+    bank.getParticle<MonteCarlo::NeutronState>( 0 );
+
+  TEST_EQUALITY( &neutron, &bank.getParticle( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the particles can be sorted by cell and energy
+TEUCHOS_UNIT_TEST( ParticleEventBank, sortParticles )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history_a = bank.addHistory( 0ull );
+  unsigned history_b = bank.addHistory( 1ull );
+
+  bank.push( createNeutron( 0ull, 2, 1.0 ), history_a );
+  bank.push( createNeutron( 0ull, 1, 2.0 ), history_a );
+  bank.push( createNeutron( 1ull, 1, 1.0 ), history_b );
+
+  bank.setCrossSection( 0, 0.2 );
+  bank.setCrossSection( 1, 0.1 );
+  bank.setCrossSection( 2, 0.3 );
+
+  bank.sortParticles();
+
+  TEST_EQUALITY_CONST( bank.getParticle( 0 ).getCell(), 1 );
+  TEST_EQUALITY_CONST( bank.getParticle( 0 ).getEnergy(), 1.0 );
+  TEST_EQUALITY_CONST( bank.getHistory( 0 ), history_b );
+  TEST_EQUALITY_CONST( bank.getCrossSection( 0 ), 0.3 );
+  TEST_EQUALITY_CONST( bank.getParticle( 1 ).getCell(), 1 );
+  TEST_EQUALITY_CONST( bank.getParticle( 1 ).getEnergy(), 2.0 );
+  TEST_EQUALITY_CONST( bank.getHistory( 1 ), history_a );
+  TEST_EQUALITY_CONST( bank.getCrossSection( 1 ), 0.1 );
+  TEST_EQUALITY_CONST( bank.getParticle( 2 ).getCell(), 2 );
+  TEST_EQUALITY_CONST( bank.getHistory( 2 ), history_a );
+  TEST_EQUALITY_CONST( bank.getCrossSection( 2 ), 0.2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that inactive particles can be removed
+TEUCHOS_UNIT_TEST( ParticleEventBank, removeInactiveParticles )
+{
+  MonteCarlo::ParticleEventBank bank;
+
+  unsigned history_a = bank.addHistory( 0ull );
+  unsigned history_b = bank.addHistory( 1ull );
+
+  bank.push( createNeutron( 0ull, 1, 1.0 ), history_a );
+  bank.push( createNeutron( 1ull, 2, 2.0 ), history_b );
+  bank.push( createNeutron( 1ull, 3, 3.0 ), history_b );
+
+  bank.setOpticalPath( 2, 3.0 );
+
+  bank.getParticle( 0 ).setAsGone();
+  bank.getParticle( 1 ).setAsLost();
+
+  bank.removeInactiveParticles();
+
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.getParticle( 0 ).getCell(), 3 );
+  TEST_EQUALITY_CONST( bank.getOpticalPath( 0 ), 3.0 );
+  TEST_ASSERT( bank.isHistoryComplete( history_a ) );
+  TEST_ASSERT( !bank.isHistoryComplete( history_b ) );
+
+  bank.clear();
+
+  TEST_ASSERT( bank.isEmpty() );
+  TEST_EQUALITY_CONST( bank.getNumberOfHistories(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstParticleEventBank.cpp
+//---------------------------------------------------------------------------//
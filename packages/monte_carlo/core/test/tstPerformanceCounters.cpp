@@ -0,0 +1,229 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPerformanceCounters.cpp
+//! \author Luke Kersting
+//! \brief  Performance counters unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_DefaultComm.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PerformanceCounters.hpp"
+#include "Utility_HDF5FileHandler.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the counters and timers have names
+TEUCHOS_UNIT_TEST( PerformanceCounters, getName )
+{
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+			      MonteCarlo::PerformanceCounters::RAY_FIRES ),
+		       "ray_fires" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+		      MonteCarlo::PerformanceCounters::SURFACE_CROSSINGS ),
+		       "surface_crossings" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+		     MonteCarlo::PerformanceCounters::NEUTRON_COLLISIONS ),
+		       "neutron_collisions" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+		      MonteCarlo::PerformanceCounters::PHOTON_COLLISIONS ),
+		       "photon_collisions" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+		    MonteCarlo::PerformanceCounters::ELECTRON_COLLISIONS ),
+		       "electron_collisions" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+		     MonteCarlo::PerformanceCounters::SECONDARIES_BANKED ),
+		       "secondaries_banked" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+			 MonteCarlo::PerformanceCounters::LOST_PARTICLES ),
+		       "lost_particles" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+		  MonteCarlo::PerformanceCounters::CROSS_SECTION_LOOKUPS ),
+		       "cross_section_lookups" );
+
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+			  MonteCarlo::PerformanceCounters::GEOMETRY_TIME ),
+		       "geometry_time" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+			 MonteCarlo::PerformanceCounters::COLLISION_TIME ),
+		       "collision_time" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+			 MonteCarlo::PerformanceCounters::ESTIMATOR_TIME ),
+		       "estimator_time" );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getName(
+			    MonteCarlo::PerformanceCounters::SOURCE_TIME ),
+		       "source_time" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the counters can be incremented
+TEUCHOS_UNIT_TEST( PerformanceCounters, increment )
+{
+  MonteCarlo::PerformanceCounters::initialize( 1 );
+
+  MonteCarlo::PerformanceCounters::increment(
+				  MonteCarlo::PerformanceCounters::RAY_FIRES );
+  MonteCarlo::PerformanceCounters::increment(
+			     MonteCarlo::PerformanceCounters::RAY_FIRES, 2ull );
+  MonteCarlo::PerformanceCounters::incrementCollisions( MonteCarlo::NEUTRON );
+  MonteCarlo::PerformanceCounters::incrementCollisions( MonteCarlo::PHOTON );
+  MonteCarlo::PerformanceCounters::incrementCollisions( MonteCarlo::PHOTON );
+
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getCount(
+			     MonteCarlo::PerformanceCounters::RAY_FIRES ), 3 );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getCount(
+		    MonteCarlo::PerformanceCounters::NEUTRON_COLLISIONS ), 1 );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getCount(
+		     MonteCarlo::PerformanceCounters::PHOTON_COLLISIONS ), 2 );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getCount(
+		   MonteCarlo::PerformanceCounters::ELECTRON_COLLISIONS ), 0 );
+
+  MonteCarlo::PerformanceCounters::reset();
+
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getCount(
+			     MonteCarlo::PerformanceCounters::RAY_FIRES ), 0 );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getCount(
+		     MonteCarlo::PerformanceCounters::PHOTON_COLLISIONS ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that time can be added to the timers
+TEUCHOS_UNIT_TEST( PerformanceCounters, addTime )
+{
+  MonteCarlo::PerformanceCounters::initialize( 1 );
+
+  MonteCarlo::PerformanceCounters::addTime(
+			  MonteCarlo::PerformanceCounters::GEOMETRY_TIME, 1.5 );
+  MonteCarlo::PerformanceCounters::addTime(
+			  MonteCarlo::PerformanceCounters::GEOMETRY_TIME, 0.5 );
+
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getTime(
+		       MonteCarlo::PerformanceCounters::GEOMETRY_TIME ), 2.0 );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getTime(
+		       MonteCarlo::PerformanceCounters::SOURCE_TIME ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a timer guard adds time when its scope is left
+TEUCHOS_UNIT_TEST( PerformanceCounters, PerformanceTimerGuard )
+{
+  MonteCarlo::PerformanceCounters::initialize( 1 );
+
+  unsigned iterations = 0;
+
+  // The time must be added even when the scope is left early
+  while( true )
+  {
+    MonteCarlo::PerformanceTimerGuard guard( 
+			       MonteCarlo::PerformanceCounters::GEOMETRY_TIME );
+
+    ++iterations;
+
+    // Wait until the clock has advanced past the guard start time
+    const double guard_time = Utility::GlobalOpenMPSession::getTime();
+
+    while( Utility::GlobalOpenMPSession::getTime() <= guard_time );
+
+    break;
+  }
+
+  TEST_EQUALITY_CONST( iterations, 1 );
+  TEST_ASSERT( MonteCarlo::PerformanceCounters::getTime(
+		 MonteCarlo::PerformanceCounters::GEOMETRY_TIME ) > 0.0 );
+  TEST_EQUALITY_CONST( MonteCarlo::PerformanceCounters::getTime(
+		       MonteCarlo::PerformanceCounters::SOURCE_TIME ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the counters can be reduced
+TEUCHOS_UNIT_TEST( PerformanceCounters, reduceData )
+{
+  Teuchos::RCP<const Teuchos::Comm<unsigned long long> > comm =
+    Teuchos::DefaultComm<unsigned long long>::getComm();
+
+  MonteCarlo::PerformanceCounters::initialize( 1 );
+
+  MonteCarlo::PerformanceCounters::increment(
+			MonteCarlo::PerformanceCounters::LOST_PARTICLES, 2ull );
+  MonteCarlo::PerformanceCounters::addTime(
+			  MonteCarlo::PerformanceCounters::SOURCE_TIME, 1.0 );
+
+  MonteCarlo::PerformanceCounters::reduceData( comm );
+
+  TEST_EQUALITY( MonteCarlo::PerformanceCounters::getCount(
+			   MonteCarlo::PerformanceCounters::LOST_PARTICLES ),
+		 2ull*comm->getSize() );
+  TEST_EQUALITY( MonteCarlo::PerformanceCounters::getTime(
+			      MonteCarlo::PerformanceCounters::SOURCE_TIME ),
+		 1.0*comm->getSize() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the counters can be exported (if they have been compiled in)
+TEUCHOS_UNIT_TEST( PerformanceCounters, exportData )
+{
+  MonteCarlo::PerformanceCounters::initialize( 1 );
+
+  MonteCarlo::PerformanceCounters::increment(
+		       MonteCarlo::PerformanceCounters::SURFACE_CROSSINGS, 5ull );
+
+  {
+    Utility::HDF5FileHandler hdf5_file;
+    hdf5_file.openHDF5FileAndOverwrite( "test_performance_counters.h5" );
+    hdf5_file.closeHDF5File();
+  }
+
+  MonteCarlo::PerformanceCounters::exportData(
+					      "test_performance_counters.h5" );
+
+  Utility::HDF5FileHandler hdf5_file;
+  hdf5_file.openHDF5FileAndReadOnly( "test_performance_counters.h5" );
+
+  if( MonteCarlo::PerformanceCounters::areCountersEnabled() )
+  {
+    unsigned long long surface_crossings;
+
+    hdf5_file.readValueFromGroupAttribute( surface_crossings,
+					   "/performance_counters/",
+					   "surface_crossings" );
+
+    TEST_EQUALITY_CONST( surface_crossings, 5ull );
+  }
+  else
+  {
+    TEST_ASSERT( !hdf5_file.doesGroupAttributeExist(
+						    "/performance_counters/",
+						    "surface_crossings" ) );
+  }
+
+  hdf5_file.closeHDF5File();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a summary of the counters can be printed
+TEUCHOS_UNIT_TEST( PerformanceCounters, printSummary )
+{
+  MonteCarlo::PerformanceCounters::initialize( 1 );
+
+  std::ostringstream oss;
+
+  MonteCarlo::PerformanceCounters::printSummary( oss );
+
+  if( MonteCarlo::PerformanceCounters::areCountersEnabled() )
+    TEST_ASSERT( oss.str().size() > 0 );
+  else
+    TEST_EQUALITY_CONST( oss.str().size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPerformanceCounters.cpp
+//---------------------------------------------------------------------------//
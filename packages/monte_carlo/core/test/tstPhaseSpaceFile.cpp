@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPhaseSpaceFile.cpp
+//! \author Luke Kersting
+//! \brief  Phase space file writer and reader unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// Boost Includes
+#include <boost/shared_ptr.hpp>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceFileWriter.hpp"
+#include "MonteCarlo_PhaseSpaceFileReader.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+MonteCarlo::PhaseSpaceRecord createRecord(
+		      const MonteCarlo::ParticleState::historyNumberType history,
+		      const double energy )
+{
+  MonteCarlo::NeutronState neutron( history );
+  neutron.setPosition( 1.0, 2.0, 3.0 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( energy );
+  neutron.setTime( 1e-9 );
+  neutron.setWeight( 0.5 );
+  neutron.incrementCollisionNumber();
+
+  MonteCarlo::PhaseSpaceRecord record;
+  MonteCarlo::fillPhaseSpaceRecord( record, neutron, 4 );
+
+  return record;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a record can be filled and converted back to a particle state
+TEUCHOS_UNIT_TEST( PhaseSpaceRecord, createParticleState )
+{
+  MonteCarlo::PhotonState photon( 3ull );
+  photon.setPosition( 1.0, 2.0, 3.0 );
+  photon.setDirection( 1.0, 0.0, 0.0 );
+  photon.setEnergy( 2.0 );
+  photon.setTime( 1e-8 );
+  photon.setWeight( 0.25 );
+  photon.incrementCollisionNumber();
+  photon.incrementCollisionNumber();
+
+  MonteCarlo::PhaseSpaceRecord record;
+  MonteCarlo::fillPhaseSpaceRecord( record, photon, 7 );
+
+  TEST_EQUALITY_CONST( sizeof(record), 96 );
+  TEST_EQUALITY_CONST( record.history_number, 3ull );
+  TEST_EQUALITY_CONST( record.surface_id, 7ull );
+  TEST_EQUALITY_CONST( record.particle_type, MonteCarlo::PHOTON );
+  TEST_EQUALITY_CONST( record.collision_number, 2u );
+
+  boost::shared_ptr<MonteCarlo::ParticleState> particle;
+
+  MonteCarlo::createParticleState( particle, record, 10ull );
+
+  TEST_EQUALITY_CONST( particle->getHistoryNumber(), 10ull );
+  TEST_EQUALITY_CONST( particle->getParticleType(), MonteCarlo::PHOTON );
+  TEST_EQUALITY_CONST( particle->getXPosition(), 1.0 );
+  TEST_EQUALITY_CONST( particle->getZPosition(), 3.0 );
+  TEST_EQUALITY_CONST( particle->getXDirection(), 1.0 );
+  TEST_EQUALITY_CONST( particle->getEnergy(), 2.0 );
+  TEST_EQUALITY_CONST( particle->getTime(), 1e-8 );
+  TEST_EQUALITY_CONST( particle->getWeight(), 0.25 );
+  TEST_EQUALITY_CONST( particle->getCollisionNumber(), 2u );
+
+  // The created state can be handed directly to a bank
+  MonteCarlo::ParticleBank bank;
+
+  bank.push( particle );
+
+  TEST_ASSERT( !particle.get() );
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+  TEST_EQUALITY_CONST( bank.top().getHistoryNumber(), 10ull );
+  TEST_EQUALITY_CONST( bank.top().getParticleType(), MonteCarlo::PHOTON );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a phase space file can be written and read
+TEUCHOS_UNIT_TEST( PhaseSpaceFile, write_read )
+{
+  {
+    MonteCarlo::PhaseSpaceFileWriter writer( "test_phase_space_file.psf" );
+
+    TEST_ASSERT( writer.isOpen() );
+
+    MonteCarlo::PhaseSpaceRecord records[3] = { createRecord( 0ull, 1.0 ),
+						createRecord( 0ull, 2.0 ),
+						createRecord( 5ull, 3.0 ) };
+
+    writer.write( records, 3 );
+
+    MonteCarlo::PhaseSpaceRecord record = createRecord( 2ull, 4.0 );
+
+    writer.write( &record, 1 );
+
+    TEST_EQUALITY_CONST( writer.getNumberOfRecords(), 4ull );
+
+    writer.close();
+
+    TEST_ASSERT( !writer.isOpen() );
+  }
+
+  MonteCarlo::PhaseSpaceFileReader reader( "test_phase_space_file.psf" );
+
+  TEST_EQUALITY_CONST( reader.getNumberOfRecords(), 4ull );
+  TEST_EQUALITY_CONST( reader.getNumberOfHistories(), 3ull );
+  TEST_EQUALITY_CONST( reader.getNumberOfHistoryRecords( 0 ), 2ull );
+  TEST_EQUALITY_CONST( reader.getNumberOfHistoryRecords( 1 ), 1ull );
+  TEST_EQUALITY_CONST( reader.getNumberOfHistoryRecords( 2 ), 1ull );
+
+  TEST_EQUALITY_CONST( reader.getHistoryRecords( 0 )[1].energy, 2.0 );
+  TEST_EQUALITY_CONST( reader.getHistoryRecords( 1 )->history_number, 5ull );
+  TEST_EQUALITY_CONST( reader.getHistoryRecords( 2 )->energy, 4.0 );
+  TEST_EQUALITY_CONST( reader.getRecord( 3 ).surface_id, 4ull );
+  TEST_EQUALITY_CONST( reader.getRecord( 3 ).weight, 0.5 );
+  TEST_EQUALITY_CONST( reader.getRecord( 3 ).collision_number, 1u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an invalid phase space file cannot be read
+TEUCHOS_UNIT_TEST( PhaseSpaceFile, read_invalid )
+{
+  TEST_THROW( MonteCarlo::PhaseSpaceFileReader reader( "dummy_file.psf" ),
+	      std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPhaseSpaceFile.cpp
+//---------------------------------------------------------------------------//
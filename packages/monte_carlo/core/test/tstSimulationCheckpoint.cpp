@@ -0,0 +1,159 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSimulationCheckpoint.cpp
+//! \author Luke Kersting
+//! \brief  Simulation checkpoint unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <fstream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_VerboseObject.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SimulationCheckpoint.hpp"
+#include "MonteCarlo_AsynchronousCheckpointWriter.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Fill a checkpoint with test data
+void fillCheckpoint( MonteCarlo::SimulationCheckpoint& checkpoint )
+{
+  checkpoint.addCompletedHistoryRange( 0ull, 100ull );
+  checkpoint.addCompletedHistoryRange( 200ull, 300ull );
+  checkpoint.setNumberOfHistoriesCompleted( 200ull );
+  checkpoint.setRunTime( 10.0 );
+
+  checkpoint.getEstimatorIds().resize( 2 );
+  checkpoint.getEstimatorIds()[0] = 0ull;
+  checkpoint.getEstimatorIds()[1] = 5ull;
+
+  checkpoint.getEstimatorRawMoments().resize( 2 );
+  checkpoint.getEstimatorRawMoments()[0].resize( 4, 1.0 );
+  checkpoint.getEstimatorRawMoments()[1].resize( 2, 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that completed history ranges can be added
+TEUCHOS_UNIT_TEST( SimulationCheckpoint, addCompletedHistoryRange )
+{
+  MonteCarlo::SimulationCheckpoint checkpoint;
+
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges().size(), 0 );
+  TEST_EQUALITY_CONST( checkpoint.getNextHistory(), 0ull );
+  TEST_EQUALITY_CONST( checkpoint.getNextHistory( 10ull ), 10ull );
+
+  checkpoint.addCompletedHistoryRange( 10ull, 20ull );
+
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges().size(), 1 );
+  TEST_EQUALITY_CONST( checkpoint.getNextHistory(), 20ull );
+
+  // Contiguous ranges are merged
+  checkpoint.addCompletedHistoryRange( 20ull, 30ull );
+
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges().size(), 1 );
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges()[0].first, 
+		       10ull );
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges()[0].second, 
+		       30ull );
+  TEST_EQUALITY_CONST( checkpoint.getNextHistory(), 30ull );
+
+  // Empty ranges are ignored
+  checkpoint.addCompletedHistoryRange( 40ull, 40ull );
+
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges().size(), 1 );
+
+  checkpoint.addCompletedHistoryRange( 40ull, 50ull );
+
+  TEST_EQUALITY_CONST( checkpoint.getCompletedHistoryRanges().size(), 2 );
+  TEST_EQUALITY_CONST( checkpoint.getNextHistory(), 50ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a checkpoint can be exported to and imported from HDF5
+TEUCHOS_UNIT_TEST( SimulationCheckpoint, hdf5 )
+{
+  MonteCarlo::SimulationCheckpoint checkpoint;
+
+  fillCheckpoint( checkpoint );
+
+  checkpoint.exportToHDF5File( "test_checkpoint.h5" );
+
+  MonteCarlo::SimulationCheckpoint imported_checkpoint;
+
+  imported_checkpoint.importFromHDF5File( "test_checkpoint.h5" );
+
+  TEST_EQUALITY_CONST( imported_checkpoint.getCompletedHistoryRanges().size(),
+		       2 );
+  TEST_EQUALITY_CONST( imported_checkpoint.getNextHistory(), 300ull );
+  TEST_EQUALITY_CONST( imported_checkpoint.getNumberOfHistoriesCompleted(),
+		       200ull );
+  TEST_EQUALITY_CONST( imported_checkpoint.getRunTime(), 10.0 );
+  TEST_COMPARE_ARRAYS( imported_checkpoint.getEstimatorIds(),
+		       checkpoint.getEstimatorIds() );
+  TEST_EQUALITY_CONST( imported_checkpoint.getEstimatorRawMoments().size(),
+		       2 );
+  TEST_COMPARE_ARRAYS( imported_checkpoint.getEstimatorRawMoments()[0],
+		       checkpoint.getEstimatorRawMoments()[0] );
+  TEST_COMPARE_ARRAYS( imported_checkpoint.getEstimatorRawMoments()[1],
+		       checkpoint.getEstimatorRawMoments()[1] );
+
+  // An empty checkpoint can also be exported
+  MonteCarlo::SimulationCheckpoint empty_checkpoint;
+
+  empty_checkpoint.exportToHDF5File( "test_checkpoint.h5" );
+
+  imported_checkpoint.importFromHDF5File( "test_checkpoint.h5" );
+
+  TEST_EQUALITY_CONST( imported_checkpoint.getCompletedHistoryRanges().size(),
+		       0 );
+  TEST_EQUALITY_CONST( imported_checkpoint.getNumberOfHistoriesCompleted(),
+		       0ull );
+  TEST_EQUALITY_CONST( imported_checkpoint.getEstimatorIds().size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a checkpoint can be written on a background thread
+TEUCHOS_UNIT_TEST( AsynchronousCheckpointWriter, write )
+{
+  MonteCarlo::SimulationCheckpoint checkpoint;
+
+  fillCheckpoint( checkpoint );
+
+  MonteCarlo::AsynchronousCheckpointWriter writer;
+
+  writer.write( checkpoint, "test_async_checkpoint.h5" );
+
+  // The checkpoint can be modified while it is being written
+  checkpoint.addCompletedHistoryRange( 300ull, 400ull );
+
+  writer.write( checkpoint, "test_async_checkpoint.h5" );
+  writer.wait();
+
+  TEST_EQUALITY_CONST( writer.getNumberOfCheckpointsWritten(), 2u );
+
+  // The temporary file is renamed once the write is complete
+  std::ifstream temp_file( "test_async_checkpoint.h5.tmp" );
+
+  TEST_ASSERT( !temp_file.good() );
+
+  MonteCarlo::SimulationCheckpoint imported_checkpoint;
+
+  imported_checkpoint.importFromHDF5File( "test_async_checkpoint.h5" );
+
+  TEST_EQUALITY_CONST( imported_checkpoint.getNextHistory(), 400ull );
+  TEST_EQUALITY_CONST( imported_checkpoint.getCompletedHistoryRanges().size(),
+		       2 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSimulationCheckpoint.cpp
+//---------------------------------------------------------------------------//
@@ -42,6 +42,11 @@ TEUCHOS_UNIT_TEST( SimulationElectronProperties, defaults )
   TEST_EQUALITY_CONST( 
 	MonteCarlo::SimulationElectronProperties::getElasticCutoffAngle(),
 	1.0e-6 );	
+  TEST_ASSERT( 
+	!MonteCarlo::SimulationElectronProperties::isCondensedHistoryModeOn() );
+  TEST_EQUALITY_CONST( 
+	MonteCarlo::SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss(),
+	0.05 );
 }
 
 //---------------------------------------------------------------------------//
@@ -144,6 +149,37 @@ TEUCHOS_UNIT_TEST( SimulationElectronProperties, setElasticCutoffAngle )
         0.1 );
 }
 
+//---------------------------------------------------------------------------//
+// Test that condensed history mode can be turned on and off
+TEUCHOS_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryModeOn )
+{
+  TEST_ASSERT( !MonteCarlo::SimulationElectronProperties::isCondensedHistoryModeOn() );
+  
+  MonteCarlo::SimulationElectronProperties::setCondensedHistoryModeOn();
+
+  TEST_ASSERT( MonteCarlo::SimulationElectronProperties::isCondensedHistoryModeOn() );
+
+  MonteCarlo::SimulationElectronProperties::setCondensedHistoryModeOff();
+
+  TEST_ASSERT( !MonteCarlo::SimulationElectronProperties::isCondensedHistoryModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the condensed history max fractional energy loss can be set
+TEUCHOS_UNIT_TEST( SimulationElectronProperties, 
+                   setCondensedHistoryMaxFractionalEnergyLoss )
+{
+  TEST_EQUALITY_CONST( 
+    MonteCarlo::SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss(),
+    0.05 );
+  
+  MonteCarlo::SimulationElectronProperties::setCondensedHistoryMaxFractionalEnergyLoss( 0.02 );
+
+  TEST_EQUALITY_CONST( 
+    MonteCarlo::SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss(),
+    0.02 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstSimulationElectronProperties.cpp
 //---------------------------------------------------------------------------//
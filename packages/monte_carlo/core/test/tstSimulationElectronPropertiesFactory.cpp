@@ -50,6 +50,10 @@ TEUCHOS_UNIT_TEST( SimulationElectronPropertiesFactory,
   TEST_EQUALITY_CONST(  
     MonteCarlo::SimulationElectronProperties::getElasticCutoffAngle(),
 	0.1 );
+  TEST_ASSERT( MonteCarlo::SimulationElectronProperties::isCondensedHistoryModeOn() );
+  TEST_EQUALITY_CONST(
+    MonteCarlo::SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss(),
+	0.1 );
 }
 
 //---------------------------------------------------------------------------//
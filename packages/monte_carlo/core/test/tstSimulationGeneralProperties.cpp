@@ -29,7 +29,18 @@ TEUCHOS_UNIT_TEST( SimulationGeneralProperties, defaults )
 		      0.001 );
   TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::displayWarnings() );
   TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isImplicitCaptureModeOn() );
-
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightCutoff(),
+		       0.0 );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isWeightRouletteOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isWeightWindowModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointFile(),
+		       "checkpoint.h5" );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isCheckpointModeOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isRestartModeOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isWallTimeLimitOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isConvergenceTerminationOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getConvergenceEstimators().size(),
+		       0 );
 }
 
 //---------------------------------------------------------------------------//
@@ -196,6 +207,174 @@ TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOn )
   TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that implicit capture mode can be turned off
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOff )
+{
+  MonteCarlo::SimulationGeneralProperties::setImplicitCaptureModeOn();
+  
+  MonteCarlo::SimulationGeneralProperties::setImplicitCaptureModeOff();
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isImplicitCaptureModeOn() );
+
+  MonteCarlo::SimulationGeneralProperties::setImplicitCaptureModeOn();
+}
+
+//---------------------------------------------------------------------------//
+// Test that the weight roulette parameters can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setWeightCutoff )
+{
+  MonteCarlo::SimulationGeneralProperties::setWeightCutoff( 0.25 );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isWeightRouletteOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightCutoff(),
+		       0.25 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightRouletteSurvivalWeight(),
+		       0.5 );
+
+  MonteCarlo::SimulationGeneralProperties::setWeightRouletteSurvivalWeight( 1.0 );
+
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightRouletteSurvivalWeight(),
+		       1.0 );
+
+  MonteCarlo::SimulationGeneralProperties::setWeightCutoff( 0.0 );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isWeightRouletteOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the weight window file can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setWeightWindowFile )
+{
+  MonteCarlo::SimulationGeneralProperties::setWeightWindowFile( 
+						       "weight_windows.h5" );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isWeightWindowModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightWindowFile(),
+		       "weight_windows.h5" );
+
+  MonteCarlo::SimulationGeneralProperties::setWeightWindowFile( "" );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isWeightWindowModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the checkpoint intervals can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setCheckpointInterval )
+{
+  MonteCarlo::SimulationGeneralProperties::setCheckpointFile( 
+						         "test_checkpoint.h5" );
+
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointFile(),
+		       "test_checkpoint.h5" );
+  
+  MonteCarlo::SimulationGeneralProperties::setCheckpointWallTimeInterval( 60.0 );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isCheckpointModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointWallTimeInterval(),
+		       60.0 );
+
+  MonteCarlo::SimulationGeneralProperties::setCheckpointWallTimeInterval( 0.0 );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isCheckpointModeOn() );
+
+  MonteCarlo::SimulationGeneralProperties::setCheckpointHistoryInterval( 100 );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isCheckpointModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointHistoryInterval(),
+		       100 );
+
+  MonteCarlo::SimulationGeneralProperties::setCheckpointHistoryInterval( 0 );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isCheckpointModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the restart file can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setRestartFile )
+{
+  MonteCarlo::SimulationGeneralProperties::setRestartFile( "checkpoint.h5" );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isRestartModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getRestartFile(),
+		       "checkpoint.h5" );
+
+  MonteCarlo::SimulationGeneralProperties::setRestartFile( "" );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isRestartModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the wall time limit can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setWallTimeLimit )
+{
+  MonteCarlo::SimulationGeneralProperties::setWallTimeLimit( 3600.0 );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isWallTimeLimitOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWallTimeLimit(),
+		       3600.0 );
+
+  MonteCarlo::SimulationGeneralProperties::setWallTimeLimit( 0.0 );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isWallTimeLimitOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the convergence termination criteria can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setTargetRelativeError )
+{
+  MonteCarlo::SimulationGeneralProperties::setTargetRelativeError( 0.05 );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isConvergenceTerminationOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getTargetRelativeError(),
+		       0.05 );
+
+  Teuchos::Array<unsigned long long> estimator_ids( 2 );
+  estimator_ids[0] = 1ull;
+  estimator_ids[1] = 3ull;
+  
+  MonteCarlo::SimulationGeneralProperties::setConvergenceEstimators( 
+							       estimator_ids );
+
+  TEST_COMPARE_ARRAYS( MonteCarlo::SimulationGeneralProperties::getConvergenceEstimators(),
+		       estimator_ids );
+
+  MonteCarlo::SimulationGeneralProperties::setTargetRelativeError( 0.0 );
+  MonteCarlo::SimulationGeneralProperties::setConvergenceEstimators( 
+					  Teuchos::Array<unsigned long long>() );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isConvergenceTerminationOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the event batch size can be set
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setEventBatchSize )
+{
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isEventBasedTransportModeOn() );
+  
+  MonteCarlo::SimulationGeneralProperties::setEventBatchSize( 1000 );
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isEventBasedTransportModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getEventBatchSize(),
+		       1000 );
+
+  MonteCarlo::SimulationGeneralProperties::setEventBatchSize( 0 );
+
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isEventBasedTransportModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that chunked estimator output mode can be turned on
+TEUCHOS_UNIT_TEST( SimulationGeneralProperties, 
+		   setChunkedEstimatorOutputModeOn )
+{
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isChunkedEstimatorOutputModeOn() );
+
+  MonteCarlo::SimulationGeneralProperties::setChunkedEstimatorOutputModeOn();
+
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isChunkedEstimatorOutputModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Test that the number of batches per processor can be set
 TEUCHOS_UNIT_TEST( SimulationGeneralProperties, setNumberOfBatchesPerProcessor )
@@ -45,6 +45,40 @@ TEUCHOS_UNIT_TEST( SimulationGeneralPropertiesFactory,
 		       0.1 );
   TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::displayWarnings() );
   TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isImplicitCaptureModeOn() );	
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isWeightRouletteOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightCutoff(),
+		       0.25 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightRouletteSurvivalWeight(),
+		       0.75 );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isWeightWindowModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWeightWindowFile(),
+		       "weight_windows.h5" );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointFile(),
+		       "test_checkpoint.h5" );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isCheckpointModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointWallTimeInterval(),
+		       600.0 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getCheckpointHistoryInterval(),
+		       1000 );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isRestartModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getRestartFile(),
+		       "checkpoint.h5" );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isWallTimeLimitOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getWallTimeLimit(),
+		       3600.0 );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isConvergenceTerminationOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getTargetRelativeError(),
+		       0.05 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getConvergenceEstimators().size(),
+		       2 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getConvergenceEstimators()[0],
+		       1ull );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getConvergenceEstimators()[1],
+		       3ull );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isEventBasedTransportModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getEventBatchSize(),
+		       1000 );
+  TEST_ASSERT( MonteCarlo::SimulationGeneralProperties::isChunkedEstimatorOutputModeOn() );
   TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getNumberOfBatchesPerProcessor(),
 	  25 );
 }
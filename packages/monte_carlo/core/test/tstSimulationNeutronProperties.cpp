@@ -8,6 +8,8 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <limits>
+#include <stdexcept>
 
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
@@ -33,6 +35,15 @@ TEUCHOS_UNIT_TEST( SimulationNeutronProperties, defaults )
   TEST_EQUALITY_CONST( 
                MonteCarlo::SimulationNeutronProperties::getAbsoluteMaxNeutronEnergy(),
                20.0 );
+  TEST_ASSERT( !MonteCarlo::SimulationNeutronProperties::isCompactCrossSectionStorageModeOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationNeutronProperties::isCriticalityModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getNumberOfInactiveCycles(),
+                       10 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getNumberOfActiveCycles(),
+                       100 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getWielandtShift(),
+                       0.0 );
+  TEST_ASSERT( !MonteCarlo::SimulationNeutronProperties::isWielandtAccelerationOn() );
 }
 
 
@@ -90,6 +101,102 @@ TEUCHOS_UNIT_TEST( SimulationNeutronProperties, setMaxNeutronEnergy )
   MonteCarlo::SimulationNeutronProperties::setMaxNeutronEnergy( default_value );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the compact cross section storage mode can be turned on
+TEUCHOS_UNIT_TEST( SimulationNeutronProperties, 
+		   setCompactCrossSectionStorageModeOn )
+{
+  MonteCarlo::SimulationNeutronProperties::setCompactCrossSectionStorageModeOn();
+  
+  TEST_ASSERT( MonteCarlo::SimulationNeutronProperties::isCompactCrossSectionStorageModeOn() );
+
+  // Reset the default
+  MonteCarlo::SimulationNeutronProperties::setCompactCrossSectionStorageModeOff();
+
+  TEST_ASSERT( !MonteCarlo::SimulationNeutronProperties::isCompactCrossSectionStorageModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the criticality mode can be turned on
+TEUCHOS_UNIT_TEST( SimulationNeutronProperties, setCriticalityModeOn )
+{
+  MonteCarlo::SimulationNeutronProperties::setCriticalityModeOn();
+  
+  TEST_ASSERT( MonteCarlo::SimulationNeutronProperties::isCriticalityModeOn() );
+
+  // Reset the default
+  MonteCarlo::SimulationNeutronProperties::setCriticalityModeOff();
+
+  TEST_ASSERT( !MonteCarlo::SimulationNeutronProperties::isCriticalityModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the number of inactive cycles can be set
+TEUCHOS_UNIT_TEST( SimulationNeutronProperties, setNumberOfInactiveCycles )
+{
+  unsigned default_value = 
+    MonteCarlo::SimulationNeutronProperties::getNumberOfInactiveCycles();
+
+  MonteCarlo::SimulationNeutronProperties::setNumberOfInactiveCycles( 25 );
+  
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getNumberOfInactiveCycles(),
+		       25 );
+
+  // Reset the default
+  MonteCarlo::SimulationNeutronProperties::setNumberOfInactiveCycles( default_value );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the number of active cycles can be set
+TEUCHOS_UNIT_TEST( SimulationNeutronProperties, setNumberOfActiveCycles )
+{
+  unsigned default_value = 
+    MonteCarlo::SimulationNeutronProperties::getNumberOfActiveCycles();
+
+  MonteCarlo::SimulationNeutronProperties::setNumberOfActiveCycles( 250 );
+  
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getNumberOfActiveCycles(),
+		       250 );
+
+  // Reset the default
+  MonteCarlo::SimulationNeutronProperties::setNumberOfActiveCycles( default_value );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the Wielandt shift eigenvalue can be set
+TEUCHOS_UNIT_TEST( SimulationNeutronProperties, setWielandtShift )
+{
+  MonteCarlo::SimulationNeutronProperties::setWielandtShift( 1.3 );
+  
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getWielandtShift(),
+		       1.3 );
+  TEST_ASSERT( MonteCarlo::SimulationNeutronProperties::isWielandtAccelerationOn() );
+
+  // Reset the default
+  MonteCarlo::SimulationNeutronProperties::setWielandtShift( 0.0 );
+
+  TEST_ASSERT( !MonteCarlo::SimulationNeutronProperties::isWielandtAccelerationOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that an invalid Wielandt shift eigenvalue cannot be set
+TEUCHOS_UNIT_TEST( SimulationNeutronProperties, setWielandtShift_invalid )
+{
+  TEST_THROW( MonteCarlo::SimulationNeutronProperties::setWielandtShift( 1.0 ),
+	      std::invalid_argument );
+  TEST_THROW( MonteCarlo::SimulationNeutronProperties::setWielandtShift( 0.5 ),
+	      std::invalid_argument );
+  TEST_THROW( MonteCarlo::SimulationNeutronProperties::setWielandtShift( -1.3 ),
+	      std::invalid_argument );
+  TEST_THROW( MonteCarlo::SimulationNeutronProperties::setWielandtShift( 
+			       std::numeric_limits<double>::quiet_NaN() ),
+	      std::invalid_argument );
+
+  // The shift eigenvalue must not have changed
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getWielandtShift(),
+		       0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstSimulationNeutronProperties.cpp
 //---------------------------------------------------------------------------//
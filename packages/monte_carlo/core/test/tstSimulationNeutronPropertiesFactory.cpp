@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <stdexcept>
 
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
@@ -47,6 +48,36 @@ TEUCHOS_UNIT_TEST( SimulationNeutronPropertiesFactory,
 		       1e-2 );
   TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getMaxNeutronEnergy(),
 		       10.0 );
+  TEST_ASSERT( MonteCarlo::SimulationNeutronProperties::isCompactCrossSectionStorageModeOn() );
+  TEST_ASSERT( MonteCarlo::SimulationNeutronProperties::isCriticalityModeOn() );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getNumberOfInactiveCycles(),
+		       20 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getNumberOfActiveCycles(),
+		       50 );
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getWielandtShift(),
+		       1.2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an invalid Wielandt shift eigenvalue is rejected
+TEUCHOS_UNIT_TEST( SimulationNeutronPropertiesFactory,
+		   initializeSimulationNeutronProperties_invalid_shift )
+{
+  Teuchos::ParameterList invalid_properties;
+
+  invalid_properties.set<double>( "Wielandt Shift", 0.9 );
+  
+  TEST_THROW( MonteCarlo::SimulationNeutronPropertiesFactory::initializeSimulationNeutronProperties( invalid_properties ),
+	      std::runtime_error );
+
+  invalid_properties.set<double>( "Wielandt Shift", 1.0 );
+
+  TEST_THROW( MonteCarlo::SimulationNeutronPropertiesFactory::initializeSimulationNeutronProperties( invalid_properties ),
+	      std::runtime_error );
+  
+  // The previously set shift eigenvalue must not have changed
+  TEST_EQUALITY_CONST( MonteCarlo::SimulationNeutronProperties::getWielandtShift(),
+		       1.2 );
 }
 
 //---------------------------------------------------------------------------//
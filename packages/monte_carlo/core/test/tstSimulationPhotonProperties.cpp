@@ -42,7 +42,8 @@ TEUCHOS_UNIT_TEST( SimulationPhotonProperties, defaults )
   TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isAtomicRelaxationModeOn() );
   TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isDetailedPairProductionModeOn() );
   TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isPhotonuclearInteractionModeOn() );
-
+  TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -175,6 +176,30 @@ TEUCHOS_UNIT_TEST( SimulationPhotonProperties, setPhotonuclearInteractionModeOn
   TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isPhotonuclearInteractionModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the thick-target bremsstrahlung mode can be turned on
+TEUCHOS_UNIT_TEST( SimulationPhotonProperties, 
+		   setThickTargetBremsstrahlungModeOn )
+{
+  TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() );
+  
+  MonteCarlo::SimulationPhotonProperties::setThickTargetBremsstrahlungModeOn();
+
+  TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the inverse cdf Doppler broadening sampling mode can be turned on
+TEUCHOS_UNIT_TEST( SimulationPhotonProperties, 
+		   setInverseCDFDopplerBroadeningSamplingModeOn )
+{
+  TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() );
+  
+  MonteCarlo::SimulationPhotonProperties::setInverseCDFDopplerBroadeningSamplingModeOn();
+
+  TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstSimulationPhotonProperties.cpp
 //---------------------------------------------------------------------------//
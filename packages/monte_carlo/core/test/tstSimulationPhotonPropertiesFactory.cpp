@@ -53,6 +53,8 @@ TEUCHOS_UNIT_TEST( SimulationPhotonPropertiesFactory,
   TEST_ASSERT( !MonteCarlo::SimulationPhotonProperties::isAtomicRelaxationModeOn() );
   TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isDetailedPairProductionModeOn() );
   TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isPhotonuclearInteractionModeOn() );
+  TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() );
+  TEST_ASSERT( MonteCarlo::SimulationPhotonProperties::isInverseCDFDopplerBroadeningSamplingModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -17,6 +17,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
+#include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "MonteCarlo_SimulationPropertiesFactory.hpp"
 
 //---------------------------------------------------------------------------//
@@ -32,11 +33,29 @@ Teuchos::ParameterList properties;
 TEUCHOS_UNIT_TEST( SimulationPropertiesFactory,
 		   initializeSimulationProperties )
 {
+  // Implicit capture cannot be used with criticality mode
+  Teuchos::ParameterList analogue_properties = properties;
+  
+  analogue_properties.sublist( "General Properties" ).set( "Implicit Capture",
+							   false );
+  
   MonteCarlo::SimulationPropertiesFactory::initializeSimulationProperties( 
-								  properties );
+							 analogue_properties );
 
   TEST_EQUALITY_CONST( MonteCarlo::SimulationGeneralProperties::getParticleMode(),
 		       MonteCarlo::NEUTRON_PHOTON_MODE );
+  TEST_ASSERT( MonteCarlo::SimulationNeutronProperties::isCriticalityModeOn() );
+  TEST_ASSERT( !MonteCarlo::SimulationGeneralProperties::isImplicitCaptureModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that implicit capture and criticality mode cannot be combined
+TEUCHOS_UNIT_TEST( SimulationPropertiesFactory,
+		   initializeSimulationProperties_criticality_implicit_capture )
+{
+  TEST_THROW( MonteCarlo::SimulationPropertiesFactory::initializeSimulationProperties( 
+								  properties ),
+	      std::runtime_error );
 }
 
 //---------------------------------------------------------------------------//
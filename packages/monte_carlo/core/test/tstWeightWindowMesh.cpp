@@ -0,0 +1,234 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMesh.cpp
+//! \author Luke Kersting
+//! \brief  Weight window mesh unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_VerboseObject.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables.
+//---------------------------------------------------------------------------//
+
+Teuchos::RCP<MonteCarlo::WeightWindowMesh> weight_windows;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the mesh dimensions can be returned
+TEUCHOS_UNIT_TEST( WeightWindowMesh, getDimensions )
+{
+  TEST_EQUALITY_CONST( weight_windows->getNumberOfMeshElements(), 2 );
+  TEST_EQUALITY_CONST( weight_windows->getNumberOfEnergyGroups(), 2 );
+  TEST_EQUALITY_CONST( weight_windows->getUpperBoundRatio(), 5.0 );
+  TEST_EQUALITY_CONST( weight_windows->getSurvivalRatio(), 3.0 );
+  TEST_EQUALITY_CONST( weight_windows->getMaxSplit(), 5u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lower weight bound at a phase space point can be returned
+TEUCHOS_UNIT_TEST( WeightWindowMesh, getLowerWeightBound )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setPosition( 0.5, 0.5, 0.5 );
+  neutron.setEnergy( 0.5 );
+
+  TEST_EQUALITY_CONST( weight_windows->getLowerWeightBound( neutron ), 0.5 );
+
+  neutron.setEnergy( 10.0 );
+
+  TEST_EQUALITY_CONST( weight_windows->getLowerWeightBound( neutron ), 0.1 );
+
+  neutron.setPosition( 1.5, 0.5, 0.5 );
+
+  TEST_EQUALITY_CONST( weight_windows->getLowerWeightBound( neutron ), 0.2 );
+
+  neutron.setEnergy( 0.5 );
+
+  TEST_EQUALITY_CONST( weight_windows->getLowerWeightBound( neutron ), 0.0 );
+
+  // Outside of the mesh
+  neutron.setPosition( 3.0, 0.5, 0.5 );
+
+  TEST_EQUALITY_CONST( weight_windows->getLowerWeightBound( neutron ), 0.0 );
+
+  // Outside of the energy groups
+  neutron.setPosition( 0.5, 0.5, 0.5 );
+  neutron.setEnergy( 30.0 );
+
+  TEST_EQUALITY_CONST( weight_windows->getLowerWeightBound( neutron ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a particle above the window is split
+TEUCHOS_UNIT_TEST( WeightWindowMesh, applyWeightWindow_split )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setPosition( 0.5, 0.5, 0.5 );
+  neutron.setEnergy( 0.5 );
+  neutron.setWeight( 6.0 );
+
+  weight_windows->applyWeightWindow( neutron, bank );
+
+  TEST_ASSERT( !neutron.isGone() );
+  TEST_FLOATING_EQUALITY( neutron.getWeight(), 2.0, 1e-12 );
+  TEST_EQUALITY_CONST( bank.size(), 2 );
+  TEST_FLOATING_EQUALITY( bank.top().getWeight(), 2.0, 1e-12 );
+
+  // The number of particles created is limited by the max split
+  neutron.setWeight( 20.0 );
+
+  weight_windows->applyWeightWindow( neutron, bank );
+
+  TEST_FLOATING_EQUALITY( neutron.getWeight(), 4.0, 1e-12 );
+  TEST_EQUALITY_CONST( bank.size(), 6 );
+
+  // A particle inside of the window is not changed
+  weight_windows->applyWeightWindow( neutron, bank );
+
+  TEST_FLOATING_EQUALITY( neutron.getWeight(), 4.0, 1e-12 );
+  TEST_EQUALITY_CONST( bank.size(), 6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a particle below the window plays Russian roulette
+TEUCHOS_UNIT_TEST( WeightWindowMesh, applyWeightWindow_roulette )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setPosition( 0.5, 0.5, 0.5 );
+  neutron.setEnergy( 0.5 );
+  neutron.setWeight( 0.1 );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.05;
+  fake_stream[1] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  // The particle survives
+  weight_windows->applyWeightWindow( neutron, bank );
+
+  TEST_ASSERT( !neutron.isGone() );
+  TEST_FLOATING_EQUALITY( neutron.getWeight(), 1.5, 1e-12 );
+
+  // The particle is killed
+  neutron.setWeight( 0.1 );
+
+  weight_windows->applyWeightWindow( neutron, bank );
+
+  TEST_ASSERT( neutron.isGone() );
+  TEST_EQUALITY_CONST( bank.size(), 0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be exported to and read from HDF5
+TEUCHOS_UNIT_TEST( WeightWindowMesh, hdf5 )
+{
+  weight_windows->exportToHDF5File( "test_weight_windows.h5" );
+
+  Teuchos::RCP<MonteCarlo::WeightWindowMesh> imported_windows =
+    MonteCarlo::WeightWindowMesh::createFromHDF5File(
+					            "test_weight_windows.h5" );
+
+  TEST_EQUALITY_CONST( imported_windows->getNumberOfMeshElements(), 2 );
+  TEST_EQUALITY_CONST( imported_windows->getNumberOfEnergyGroups(), 2 );
+  TEST_EQUALITY_CONST( imported_windows->getUpperBoundRatio(), 5.0 );
+  TEST_EQUALITY_CONST( imported_windows->getSurvivalRatio(), 3.0 );
+  TEST_EQUALITY_CONST( imported_windows->getMaxSplit(), 5u );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setPosition( 1.5, 0.5, 0.5 );
+  neutron.setEnergy( 10.0 );
+
+  TEST_EQUALITY_CONST( imported_windows->getLowerWeightBound( neutron ), 0.2 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom main function
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  Teuchos::CommandLineProcessor& clp = Teuchos::UnitTestRepository::getCLP();
+
+  const Teuchos::RCP<Teuchos::FancyOStream> out =
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return =
+    clp.parse(argc,argv);
+
+  if ( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL ) {
+    *out << "\nEnd Result: TEST FAILED" << std::endl;
+    return parse_return;
+  }
+
+  // Create the weight window mesh
+  Teuchos::Array<double> x_planes( 3 ), y_planes( 2 ), z_planes( 2 );
+  x_planes[0] = 0.0;
+  x_planes[1] = 1.0;
+  x_planes[2] = 2.0;
+  y_planes[0] = 0.0;
+  y_planes[1] = 1.0;
+  z_planes[0] = 0.0;
+  z_planes[1] = 1.0;
+
+  Teuchos::Array<double> energy_group_boundaries( 3 );
+  energy_group_boundaries[0] = 0.0;
+  energy_group_boundaries[1] = 1.0;
+  energy_group_boundaries[2] = 20.0;
+
+  Teuchos::Array<double> lower_weight_bounds( 4 );
+  lower_weight_bounds[0] = 0.5;
+  lower_weight_bounds[1] = 0.0;
+  lower_weight_bounds[2] = 0.1;
+  lower_weight_bounds[3] = 0.2;
+
+  weight_windows.reset( new MonteCarlo::WeightWindowMesh(
+						   x_planes,
+						   y_planes,
+						   z_planes,
+						   energy_group_boundaries,
+						   lower_weight_bounds ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  // Run the unit tests
+  Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+  const bool success = Teuchos::UnitTestRepository::runUnitTests( *out );
+
+  if (success)
+    *out << "\nEnd Result: TEST PASSED" << std::endl;
+  else
+    *out << "\nEnd Result: TEST FAILED" << std::endl;
+
+  clp.printFinalTimerSummary(out.ptr());
+
+  return (success ? 0 : 1);
+}
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMesh.cpp
+//---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 
 // Trilinos Includes
 #include <Teuchos_Comm.hpp>
+#include <Teuchos_Array.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ModuleTraits.hpp"
@@ -99,6 +100,13 @@ public:
 				     const double inverse_total_cross_section )
   { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
 
+  //! Update the estimators from a subtrack ending event (no collision)
+  static inline void updateEstimatorsFromParticleSubtrackEndingInCellEvent(
+				     const ParticleState& particle,
+				     const double particle_subtrack_length,
+				     const double subtrack_start_time )
+  { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
+
   //! Update the global estimators from a collision event
   static inline void updateEstimatorsFromParticleCollidingGlobalEvent(
 						 const ParticleState& particle,
@@ -106,6 +114,10 @@ public:
 						 const double end_point[3] )
   { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
 
+  //! Check if any estimator can score a particle type
+  static inline bool isParticleTypeObserved( const ParticleType particle_type )
+  { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); return true; }
+
   //! Commit the estimator history contributions
   static inline void commitEstimatorHistoryContributions()
   { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
@@ -134,6 +146,24 @@ public:
 				  const bool process_data )
   { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
 
+  //! Get the raw moments of every estimator
+  static inline void getEstimatorRawMoments( 
+	       Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+	       Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments )
+  { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
+
+  //! Set the raw moments of every estimator
+  static inline void setEstimatorRawMoments( 
+	  const Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+	  const Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments )
+  { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); }
+
+  //! Return the max relative error of the requested estimators
+  static inline double getMaxEstimatorRelativeError(
+		  const Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+		  const unsigned long long histories_completed )
+  { (void)UndefinedEstimatorHandler<EstimatorHandler>::notDefined(); return 0.0; }
+
   //! Get the internal estimator handle corresponding to the external handle
   static inline InternalEstimatorHandle getInternalEstimatorHandle(
 			     const ExternalEstimatorHandle estimator_external )
@@ -74,6 +74,16 @@ public:
   virtual void exportData( EstimatorHDF5FileHandler& hdf5_file,
 			   const bool process_data ) const;
 
+  //! Get the raw moments of the estimator (appended to the array)
+  virtual void getRawMoments( Teuchos::Array<double>& raw_moments ) const;
+
+  //! Set the raw moments of the estimator (returns the number used)
+  virtual unsigned setRawMoments( 
+			 const Teuchos::ArrayView<const double>& raw_moments );
+
+  //! Return the max relative error of the estimator total bins
+  virtual double getMaxRelativeError() const;
+
 protected:
 
   //! Constructor with no entities (for mesh estimators)
@@ -113,6 +123,9 @@ protected:
   //! Get the bin data for an entity
   const Estimator::TwoEstimatorMomentsArray& getEntityBinData(
 					      const EntityId entity_id ) const;
+
+  //! Return the entity ids in ascending order
+  void getSortedEntityIds( Teuchos::Array<EntityId>& entity_ids ) const;
   
 private:
 
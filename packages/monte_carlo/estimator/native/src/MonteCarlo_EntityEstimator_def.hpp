@@ -11,8 +11,10 @@
 
 // Std Lib Includes
 #include <sstream>
+#include <algorithm>
 
 // FRENSIE Includes
+#include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "Utility_GlobalOpenMPSession.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
@@ -395,6 +397,10 @@ void EntityEstimator<EntityId>::reduceData(
 }
 
 // Export the estimator data
+/*! \details If chunked estimator output mode is on, the bin data of every
+ * entity is exported to a single data set with one row per entity (in 
+ * ascending entity id order) instead of to a group for every entity.
+ */
 template<typename EntityId>
 void EntityEstimator<EntityId>::exportData(EstimatorHDF5FileHandler& hdf5_file,
 					   const bool process_data ) const
@@ -410,7 +416,66 @@ void EntityEstimator<EntityId>::exportData(EstimatorHDF5FileHandler& hdf5_file,
   hdf5_file.setEstimatorTotalNormConstant( this->getId(), 
 					   d_total_norm_constant );
   
-  // Export all of the estimator data
+  // Export all of the estimator data to single data sets (entity x bin)
+  if( SimulationGeneralProperties::isChunkedEstimatorOutputModeOn() )
+  {
+    Teuchos::Array<EntityId> entity_ids;
+
+    this->getSortedEntityIds( entity_ids );
+
+    if( entity_ids.size() > 0 )
+    {
+      // Export the entity ids (row index of the data sets)
+      hdf5_file.setEstimatorEntityIds( this->getId(), entity_ids );
+      
+      Teuchos::Array<Utility::Pair<double,double> > raw_data, processed_data;
+
+      raw_data.reserve( entity_ids.size()*
+			d_estimator_total_bin_data.size() );
+
+      for( unsigned i = 0u; i < entity_ids.size(); ++i )
+      {
+	const TwoEstimatorMomentsArray& entity_bin_data = 
+	  d_entity_estimator_moments_map.find( entity_ids[i] )->second;
+
+	raw_data.insert( raw_data.end(),
+			 entity_bin_data.begin(),
+			 entity_bin_data.end() );
+
+	if( process_data )
+	{
+	  const double norm_constant = 
+	    d_entity_norm_constants_map.find( entity_ids[i] )->second;
+
+	  for( unsigned j = 0; j < entity_bin_data.size(); ++j )
+	  {
+	    Utility::Pair<double,double> processed_moments;
+
+	    this->processMoments( entity_bin_data[j],
+				  norm_constant,
+				  processed_moments.first,
+				  processed_moments.second );
+
+	    processed_data.push_back( processed_moments );
+	  }
+	}
+      }
+      
+      // Export the raw entity moment data
+      hdf5_file.setRawEstimatorEntitiesBinData( this->getId(),
+						entity_ids.size(),
+						raw_data );
+
+      if( process_data )
+      {
+	hdf5_file.setProcessedEstimatorEntitiesBinData( this->getId(),
+							entity_ids.size(),
+							processed_data );
+      }
+    }
+  }
+  // Export all of the estimator data (group for every entity)
+  else
   {
     typename EntityEstimatorMomentsArrayMap::const_iterator entity_data;
     unsigned i;
@@ -477,6 +542,129 @@ void EntityEstimator<EntityId>::exportData(EstimatorHDF5FileHandler& hdf5_file,
   }
 }
 
+// Get the raw moments of the estimator (appended to the array)
+/*! \details The first and second moments of the total bins are appended
+ * first followed by the moments of the bins of every entity (in ascending 
+ * entity id order).
+ */
+template<typename EntityId>
+void EntityEstimator<EntityId>::getRawMoments( 
+				     Teuchos::Array<double>& raw_moments ) const
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  
+  Estimator::getRawMoments( raw_moments );
+  
+  for( unsigned i = 0; i < d_estimator_total_bin_data.size(); ++i )
+  {
+    raw_moments.push_back( d_estimator_total_bin_data[i].first );
+    raw_moments.push_back( d_estimator_total_bin_data[i].second );
+  }
+
+  Teuchos::Array<EntityId> entity_ids;
+
+  this->getSortedEntityIds( entity_ids );
+
+  for( unsigned i = 0; i < entity_ids.size(); ++i )
+  {
+    const TwoEstimatorMomentsArray& entity_data = 
+      d_entity_estimator_moments_map.find( entity_ids[i] )->second;
+
+    for( unsigned j = 0; j < entity_data.size(); ++j )
+    {
+      raw_moments.push_back( entity_data[j].first );
+      raw_moments.push_back( entity_data[j].second );
+    }
+  }
+}
+
+// Set the raw moments of the estimator (returns the number used)
+template<typename EntityId>
+unsigned EntityEstimator<EntityId>::setRawMoments( 
+			  const Teuchos::ArrayView<const double>& raw_moments )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  
+  unsigned index = Estimator::setRawMoments( raw_moments );
+
+  Teuchos::Array<EntityId> entity_ids;
+
+  this->getSortedEntityIds( entity_ids );
+
+  unsigned required_moments = d_estimator_total_bin_data.size();
+
+  for( unsigned i = 0; i < entity_ids.size(); ++i )
+  {
+    required_moments += 
+      d_entity_estimator_moments_map.find( entity_ids[i] )->second.size();
+  }
+
+  TEST_FOR_EXCEPTION( index + 2*required_moments > raw_moments.size(),
+		      std::runtime_error,
+		      "Error: entity estimator " << this->getId() << 
+		      " requires " << 2*required_moments << " raw moments "
+		      "but only " << raw_moments.size() - index << 
+		      " were given!" );
+
+  for( unsigned i = 0; i < d_estimator_total_bin_data.size(); ++i )
+  {
+    d_estimator_total_bin_data[i].first = raw_moments[index++];
+    d_estimator_total_bin_data[i].second = raw_moments[index++];
+  }
+
+  for( unsigned i = 0; i < entity_ids.size(); ++i )
+  {
+    TwoEstimatorMomentsArray& entity_data = 
+      d_entity_estimator_moments_map.find( entity_ids[i] )->second;
+
+    for( unsigned j = 0; j < entity_data.size(); ++j )
+    {
+      entity_data[j].first = raw_moments[index++];
+      entity_data[j].second = raw_moments[index++];
+    }
+  }
+
+  return index;
+}
+
+// Return the max relative error of the estimator total bins
+/*! \details Only the total bins (summed over all entities) are considered.
+ * A bin without any contributions has not converged and is assigned a 
+ * relative error of one (as is an estimator without any bins).
+ */
+template<typename EntityId>
+double EntityEstimator<EntityId>::getMaxRelativeError() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+
+  if( d_estimator_total_bin_data.size() == 0 )
+    return 1.0;
+  
+  double max_relative_error = 0.0;
+
+  for( unsigned i = 0; i < d_estimator_total_bin_data.size(); ++i )
+  {
+    // A bin without any contributions has not converged
+    if( d_estimator_total_bin_data[i].first == 0.0 )
+      return 1.0;
+    
+    double mean, relative_error;
+      
+    this->processMoments( d_estimator_total_bin_data[i],
+			  1.0,
+			  mean,
+			  relative_error );
+
+    if( relative_error > max_relative_error )
+      max_relative_error = relative_error;
+  }
+
+  return max_relative_error;
+}
+
 // Commit history contribution to a bin of an entity
 template<typename EntityId>
 void EntityEstimator<EntityId>::commitHistoryContributionToBinOfEntity(
@@ -656,6 +844,30 @@ EntityEstimator<EntityId>::getEntityBinData( const EntityId entity_id ) const
   return d_entity_estimator_moments_map.find( entity_id )->second;
 }
 
+// Return the entity ids in ascending order
+/*! \details The entity moments are stored in an unordered map. A sorted
+ * list of entity ids is used whenever a repeatable ordering is required.
+ */
+template<typename EntityId>
+void EntityEstimator<EntityId>::getSortedEntityIds( 
+			          Teuchos::Array<EntityId>& entity_ids ) const
+{
+  entity_ids.clear();
+  entity_ids.reserve( d_entity_estimator_moments_map.size() );
+
+  typename EntityEstimatorMomentsArrayMap::const_iterator entity_data = 
+    d_entity_estimator_moments_map.begin();
+
+  while( entity_data != d_entity_estimator_moments_map.end() )
+  {
+    entity_ids.push_back( entity_data->first );
+
+    ++entity_data;
+  }
+
+  std::sort( entity_ids.begin(), entity_ids.end() );
+}
+
 // Initialize entity estimator moments map
 template<typename EntityId>
 void EntityEstimator<EntityId>::initializeEntityEstimatorMomentsMap(
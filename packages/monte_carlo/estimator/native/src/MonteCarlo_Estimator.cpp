@@ -8,9 +8,11 @@
 
 // Std Lib Includes
 #include <limits>
+#include <stdexcept>
 
 // FRENSIE Includes
 #include "MonteCarlo_Estimator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
 
@@ -49,7 +51,8 @@ void Estimator::setEndTime( const double end_time )
     d_id( id ),
     d_multiplier( multiplier ),
     d_has_uncommitted_history_contribution( 1, false ),
-    d_response_functions( 1 )
+    d_response_functions( 1 ),
+    d_number_of_dispatchers( 0u )
 {
   // Make sure the multiplier is valid
   testPrecondition( multiplier > 0.0 );
@@ -81,6 +84,14 @@ void Estimator::setParticleTypes(
   testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
   // Make sure at least one particle type is specified
   testPrecondition( particle_types.size() > 0 );
+
+  // The dispatchers only check the particle types when the estimator is
+  // attached
+  TEST_FOR_EXCEPTION( this->isAttachedToDispatcher(),
+		      std::logic_error,
+		      "Error: the particle types of estimator " << d_id <<
+		      " cannot be set after it has been attached to an "
+		      "event dispatcher!" );
   
   d_particle_types.clear();
 
@@ -88,6 +99,25 @@ void Estimator::setParticleTypes(
     d_particle_types.insert( particle_types[i] );
 }
 
+// Record that the estimator has been attached to an event dispatcher
+/*! \details The event dispatchers store the particle types that their 
+ * attached estimators can score. Once the estimator has been attached to a
+ * dispatcher its particle types can no longer be changed.
+ */
+void Estimator::recordDispatcherAttachment()
+{
+  ++d_number_of_dispatchers;
+}
+
+// Record that the estimator has been detached from an event dispatcher
+void Estimator::recordDispatcherDetachment()
+{
+  // Make sure the estimator has been attached to a dispatcher
+  testPrecondition( d_number_of_dispatchers > 0u );
+  
+  --d_number_of_dispatchers;
+}
+
 // Check if the estimator has uncommitted history contributions
 bool Estimator::hasUncommittedHistoryContribution( 
 					       const unsigned thread_id ) const
@@ -146,6 +176,37 @@ void Estimator::exportData( EstimatorHDF5FileHandler& hdf5_file,
   hdf5_file.setEstimatorMultiplier( d_id, d_multiplier );
 }
 
+// Get the raw moments of the estimator (appended to the array)
+/*! \details The raw moments are the unprocessed moments that are stored in
+ * the estimator. They can be used to checkpoint the estimator state and to
+ * restore it with the setRawMoments member function. The base class has no
+ * moments.
+ */
+void Estimator::getRawMoments( Teuchos::Array<double>& raw_moments ) const
+{ /* ... */ }
+
+// Set the raw moments of the estimator (returns the number used)
+/*! \details The raw moments must have been created by the getRawMoments
+ * member function of an estimator with an identical set up. Any raw moments
+ * that are not used belong to derived classes. The base class has no
+ * moments.
+ */
+unsigned Estimator::setRawMoments( 
+			  const Teuchos::ArrayView<const double>& raw_moments )
+{
+  return 0u;
+}
+
+// Return the max relative error of the estimator bins
+/*! \details The relative errors are calculated using the number of histories
+ * that has been set with the setNumberOfHistories static member function.
+ * The base class has no bins.
+ */
+double Estimator::getMaxRelativeError() const
+{
+  return 0.0;
+}
+
 // Set the has uncommited history contribution flag
 /*! \details This should be called whenever the current history contributes
  * to the estimator.
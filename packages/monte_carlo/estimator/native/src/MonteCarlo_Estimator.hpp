@@ -20,6 +20,7 @@
 
 // Trilinos Includes
 #include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
 #include <Teuchos_TwoDArray.hpp>
 #include <Teuchos_ScalarTraits.hpp>
 #include <Teuchos_any.hpp>
@@ -116,6 +117,15 @@ public:
   //! Check if the particle type is assigned to the estimator
   bool isParticleTypeAssigned( const ParticleType particle_type ) const;
 
+  //! Record that the estimator has been attached to an event dispatcher
+  void recordDispatcherAttachment();
+
+  //! Record that the estimator has been detached from an event dispatcher
+  void recordDispatcherDetachment();
+
+  //! Check if the estimator is attached to an event dispatcher
+  bool isAttachedToDispatcher() const;
+
   //! Check if the estimator has uncommitted history contributions
   bool hasUncommittedHistoryContribution( const unsigned thread_id ) const;
 
@@ -139,6 +149,16 @@ public:
   //! Export the estimator data
   virtual void exportData( EstimatorHDF5FileHandler& hdf5_file,
 			   const bool process_data ) const;
+
+  //! Get the raw moments of the estimator (appended to the array)
+  virtual void getRawMoments( Teuchos::Array<double>& raw_moments ) const;
+
+  //! Set the raw moments of the estimator (returns the number used)
+  virtual unsigned setRawMoments( 
+			 const Teuchos::ArrayView<const double>& raw_moments );
+
+  //! Return the max relative error of the estimator bins
+  virtual double getMaxRelativeError() const;
   
 protected:
 
@@ -280,6 +300,9 @@ private:
 
   // The particle types that this estimator will take contributions from
   std::set<ParticleType> d_particle_types;
+
+  // The number of event dispatchers that this estimator is attached to
+  unsigned d_number_of_dispatchers;
 };
 
 // Return the estimator id
@@ -328,6 +351,12 @@ inline bool Estimator::isParticleTypeAssigned(
   return d_particle_types.count( particle_type );
 }
 
+// Check if the estimator is attached to an event dispatcher
+inline bool Estimator::isAttachedToDispatcher() const
+{
+  return d_number_of_dispatchers > 0u;
+}
+
 // Return the response function name
 inline const std::string& Estimator::getResponseFunctionName( 
 				 const unsigned response_function_index ) const
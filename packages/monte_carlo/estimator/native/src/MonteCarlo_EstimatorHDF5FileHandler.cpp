@@ -354,6 +354,158 @@ void EstimatorHDF5FileHandler::getEstimatorTotalNormConstant(
 			   "Get Total Norm Constant Error" );
 }
 
+// Check if the estimator entity data is stored in single data sets
+bool EstimatorHDF5FileHandler::isEstimatorEntityDataChunked( 
+					    const unsigned estimator_id ) const
+{
+  std::string entity_ids_data_set = 
+    this->getEstimatorGroupLocation( estimator_id );
+
+  entity_ids_data_set += "entity_ids";
+
+  return d_hdf5_file->doesDataSetExist( entity_ids_data_set );
+}
+
+// Set the raw estimator bin data for all entities (1st, 2nd moments)
+/*! \details The data for every entity is stored in a single chunked and 
+ * compressed data set with one row per entity. The row order is the order of
+ * the estimator entity ids.
+ */
+void EstimatorHDF5FileHandler::setRawEstimatorEntitiesBinData(
+	   const unsigned estimator_id,
+	   const unsigned number_of_entities,
+	   const Teuchos::Array<Utility::Pair<double,double> >& raw_bin_data )
+{
+  try{
+    this->writeEntityDataToChunkedDataSet( estimator_id,
+					   number_of_entities,
+					   raw_bin_data,
+					   "raw_entity_bin_data" );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Set Raw Estimator Entities Bin Data Error" );
+}
+
+// Get the raw estimator bin data for all entities (1st, 2nd moments)
+void EstimatorHDF5FileHandler::getRawEstimatorEntitiesBinData(
+	   const unsigned estimator_id,
+	   Teuchos::Array<Utility::Pair<double,double> >& raw_bin_data ) const
+{
+  std::string data_set_location = 
+    this->getEstimatorGroupLocation( estimator_id );
+  
+  data_set_location += "raw_entity_bin_data";
+  
+  try{
+    d_hdf5_file->readArrayFromDataSet( raw_bin_data, data_set_location );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Get Raw Estimator Entities Bin Data Error" );
+}
+
+// Set the processed estimator bin data for all entities (mean, rel. err.)
+void EstimatorHDF5FileHandler::setProcessedEstimatorEntitiesBinData(
+     const unsigned estimator_id,
+     const unsigned number_of_entities,
+     const Teuchos::Array<Utility::Pair<double,double> >& processed_bin_data )
+{
+  try{
+    this->writeEntityDataToChunkedDataSet( estimator_id,
+					   number_of_entities,
+					   processed_bin_data,
+					   "processed_entity_bin_data" );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Set Processed Estimator Entities Bin Data Error" );
+}
+
+// Get the processed estimator bin data for all entities (mean, rel. err.)
+void EstimatorHDF5FileHandler::getProcessedEstimatorEntitiesBinData(
+     const unsigned estimator_id,
+     Teuchos::Array<Utility::Pair<double,double> >& processed_bin_data ) const
+{
+  std::string data_set_location = 
+    this->getEstimatorGroupLocation( estimator_id );
+  
+  data_set_location += "processed_entity_bin_data";
+  
+  try{
+    d_hdf5_file->readArrayFromDataSet( processed_bin_data, data_set_location );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Get Processed Estimator Entities Bin Data Error" );
+}
+
+// Set the raw estimator total data for all entities
+void EstimatorHDF5FileHandler::setRawEstimatorEntitiesTotalData(
+	     const unsigned estimator_id,
+	     const unsigned number_of_entities,
+	     const Teuchos::Array<Utility::Quad<double,double,double,double> >&
+	     raw_total_data )
+{
+  try{
+    this->writeEntityDataToChunkedDataSet( estimator_id,
+					   number_of_entities,
+					   raw_total_data,
+					   "raw_entity_total_data" );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Set Raw Estimator Entities Total Data Error" );
+}
+
+// Get the raw estimator total data for all entities
+void EstimatorHDF5FileHandler::getRawEstimatorEntitiesTotalData(
+		   const unsigned estimator_id,
+		   Teuchos::Array<Utility::Quad<double,double,double,double> >&
+		   raw_total_data ) const
+{
+  std::string data_set_location = 
+    this->getEstimatorGroupLocation( estimator_id );
+  
+  data_set_location += "raw_entity_total_data";
+  
+  try{
+    d_hdf5_file->readArrayFromDataSet( raw_total_data, data_set_location );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Get Raw Estimator Entities Total Data Error" );
+}
+
+// Set the processed estimator total data for all entities
+void EstimatorHDF5FileHandler::setProcessedEstimatorEntitiesTotalData(
+	     const unsigned estimator_id,
+	     const unsigned number_of_entities,
+	     const Teuchos::Array<Utility::Quad<double,double,double,double> >&
+	     processed_total_data )
+{
+  try{
+    this->writeEntityDataToChunkedDataSet( estimator_id,
+					   number_of_entities,
+					   processed_total_data,
+					   "processed_entity_total_data" );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Set Processed Estimator Entities Total Data Error" );
+}
+
+// Get the processed estimator total data for all entities
+void EstimatorHDF5FileHandler::getProcessedEstimatorEntitiesTotalData(
+		   const unsigned estimator_id,
+		   Teuchos::Array<Utility::Quad<double,double,double,double> >&
+		   processed_total_data ) const
+{
+  std::string data_set_location = 
+    this->getEstimatorGroupLocation( estimator_id );
+  
+  data_set_location += "processed_entity_total_data";
+  
+  try{
+    d_hdf5_file->readArrayFromDataSet(processed_total_data, data_set_location);
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error, 
+			   "Get Processed Estimator Entities Total Data Error" );
+}
+
 // Set the raw estimator bin data over all entities (1st, 2nd moments)
 void EstimatorHDF5FileHandler::setRawEstimatorTotalBinData(
 	   const unsigned estimator_id,
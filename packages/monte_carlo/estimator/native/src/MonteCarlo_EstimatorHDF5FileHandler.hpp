@@ -237,6 +237,75 @@ public:
                    Teuchos::Array<Utility::Quad<double,double,double,double> >&
 		   processed_total_data ) const;
 
+  //! Set the estimator entity ids (row index of the entity data sets)
+  template<typename EntityIdType>
+  void setEstimatorEntityIds( const unsigned estimator_id,
+			      const Teuchos::Array<EntityIdType>& entity_ids );
+
+  //! Get the estimator entity ids (row index of the entity data sets)
+  template<typename EntityIdType>
+  void getEstimatorEntityIds( const unsigned estimator_id,
+			      Teuchos::Array<EntityIdType>& entity_ids ) const;
+
+  //! Check if the estimator entity data is stored in single data sets
+  bool isEstimatorEntityDataChunked( const unsigned estimator_id ) const;
+
+  //! Set the raw estimator bin data for all entities (1st, 2nd moments)
+  void setRawEstimatorEntitiesBinData(
+	   const unsigned estimator_id,
+	   const unsigned number_of_entities,
+	   const Teuchos::Array<Utility::Pair<double,double> >& raw_bin_data );
+
+  //! Get the raw estimator bin data for all entities (1st, 2nd moments)
+  void getRawEstimatorEntitiesBinData(
+	   const unsigned estimator_id,
+	   Teuchos::Array<Utility::Pair<double,double> >& raw_bin_data ) const;
+
+  //! Set the processed estimator bin data for all entities (mean, rel. err.)
+  void setProcessedEstimatorEntitiesBinData(
+     const unsigned estimator_id,
+     const unsigned number_of_entities,
+     const Teuchos::Array<Utility::Pair<double,double> >& processed_bin_data );
+
+  //! Get the processed estimator bin data for all entities (mean, rel. err.)
+  void getProcessedEstimatorEntitiesBinData(
+     const unsigned estimator_id,
+     Teuchos::Array<Utility::Pair<double,double> >& processed_bin_data ) const;
+
+  /*! \brief Set the raw estimator total data for all entities
+   * (1st, 2nd, 3rd, 4th moments)
+   */
+  void setRawEstimatorEntitiesTotalData(
+	     const unsigned estimator_id,
+	     const unsigned number_of_entities,
+	     const Teuchos::Array<Utility::Quad<double,double,double,double> >&
+	     raw_total_data );
+
+  /*! \brief Get the raw estimator total data for all entities
+   * (1st, 2nd, 3rd, 4th moments)
+   */
+  void getRawEstimatorEntitiesTotalData(
+		   const unsigned estimator_id,
+		   Teuchos::Array<Utility::Quad<double,double,double,double> >&
+		   raw_total_data ) const;
+
+  /*! \brief Set the processed estimator total data for all entities
+   * (mean, relative error, variance of variance, figure of merit)
+   */
+  void setProcessedEstimatorEntitiesTotalData(
+	     const unsigned estimator_id,
+	     const unsigned number_of_entities,
+	     const Teuchos::Array<Utility::Quad<double,double,double,double> >&
+	     processed_total_data );
+
+  /*! \brief Get the processed estimator total data for all entities
+   * (mean, relative error, variance of variance, figure of merit)
+   */
+  void getProcessedEstimatorEntitiesTotalData(
+		   const unsigned estimator_id,
+		   Teuchos::Array<Utility::Quad<double,double,double,double> >&
+		   processed_total_data ) const;
+
   //! Set the raw estimator bin data over all entities (1st, 2nd moments)
   void setRawEstimatorTotalBinData(
 	   const unsigned estimator_id,
@@ -310,6 +379,13 @@ private:
 					  const unsigned estimator_id,
 					  const EntityIdType entity_id ) const;
 
+  // Write entity data to a chunked data set (entity x value)
+  template<typename T>
+  void writeEntityDataToChunkedDataSet( const unsigned estimator_id,
+					const unsigned number_of_entities,
+					const Teuchos::Array<T>& entity_data,
+					const std::string& data_set_name );
+
   // The estimator group location and name
   static const std::string estimator_group_loc_name;
 
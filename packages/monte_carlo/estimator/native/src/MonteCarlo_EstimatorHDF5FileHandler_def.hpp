@@ -352,6 +352,76 @@ void EstimatorHDF5FileHandler::getProcessedEstimatorEntityTotalData(
 			   "Get Processed Estimator Entity Total Data Error" );
 }
 
+// Set the estimator entity ids (row index of the entity data sets)
+/*! \details The entity ids are stored in a single data set. The order of the
+ * ids determines the row order of the entity data sets (e.g. the raw entity 
+ * bin data set).
+ */
+template<typename EntityIdType>
+void EstimatorHDF5FileHandler::setEstimatorEntityIds( 
+			       const unsigned estimator_id,
+			       const Teuchos::Array<EntityIdType>& entity_ids )
+{
+  // Make sure the entity ids are valid
+  testPrecondition( entity_ids.size() > 0 );
+  
+  std::string entity_ids_data_set = 
+    this->getEstimatorGroupLocation( estimator_id );
+
+  entity_ids_data_set += "entity_ids";
+
+  try{
+    d_hdf5_file->writeArrayToDataSet( entity_ids, entity_ids_data_set );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Set Estimator Entity Ids Error" );
+}
+
+// Get the estimator entity ids (row index of the entity data sets)
+template<typename EntityIdType>
+void EstimatorHDF5FileHandler::getEstimatorEntityIds( 
+			      const unsigned estimator_id,
+			      Teuchos::Array<EntityIdType>& entity_ids ) const
+{
+  std::string entity_ids_data_set = 
+    this->getEstimatorGroupLocation( estimator_id );
+
+  entity_ids_data_set += "entity_ids";
+
+  try{
+    d_hdf5_file->readArrayFromDataSet( entity_ids, entity_ids_data_set );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Get Estimator Entity Ids Error" );
+}
+
+// Write entity data to a chunked data set (entity x value)
+template<typename T>
+void EstimatorHDF5FileHandler::writeEntityDataToChunkedDataSet( 
+					  const unsigned estimator_id,
+					  const unsigned number_of_entities,
+					  const Teuchos::Array<T>& entity_data,
+					  const std::string& data_set_name )
+{
+  // Make sure the entity data is valid
+  testPrecondition( number_of_entities > 0 );
+  testPrecondition( entity_data.size() > 0 );
+  testPrecondition( entity_data.size() % number_of_entities == 0 );
+  
+  std::string data_set_location = 
+    this->getEstimatorGroupLocation( estimator_id );
+
+  data_set_location += data_set_name;
+
+  Teuchos::Array<hsize_t> dimensions( 2 );
+  dimensions[0] = number_of_entities;
+  dimensions[1] = entity_data.size()/number_of_entities;
+
+  d_hdf5_file->writeArrayToChunkedDataSet( entity_data,
+					   dimensions,
+					   data_set_location );
+}
+
 // Get the estimator entity location
 template<typename EntityIdType>
 std::string EstimatorHDF5FileHandler::getEstimatorEntityGroupLocation( 
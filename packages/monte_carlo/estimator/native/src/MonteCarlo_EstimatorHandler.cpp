@@ -6,9 +6,13 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_EstimatorHandler.hpp"
 #include "Utility_GlobalOpenMPSession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -154,6 +158,115 @@ void EstimatorHandler::exportEstimatorData(
   }
 }
 
+// Get the raw moments of every estimator
+/*! \details The raw moments of an estimator are stored at the same index as
+ * the estimator id.
+ */
+void EstimatorHandler::getEstimatorRawMoments( 
+	        Teuchos::Array<Estimator::idType>& estimator_ids,
+	        Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+
+  estimator_ids.resize( EstimatorHandler::master_array.size() );
+  estimator_raw_moments.resize( EstimatorHandler::master_array.size() );
+
+  for( unsigned i = 0; i < EstimatorHandler::master_array.size(); ++i )
+  {
+    estimator_ids[i] = EstimatorHandler::master_array[i]->getId();
+
+    estimator_raw_moments[i].clear();
+
+    EstimatorHandler::master_array[i]->getRawMoments( 
+						    estimator_raw_moments[i] );
+  }
+}
+
+// Set the raw moments of every estimator
+/*! \details Every estimator that has been added to the handler must have
+ * raw moments.
+ */
+void EstimatorHandler::setEstimatorRawMoments( 
+	   const Teuchos::Array<Estimator::idType>& estimator_ids,
+	   const Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  // Make sure the raw moments are valid
+  testPrecondition( estimator_ids.size() == estimator_raw_moments.size() );
+
+  for( unsigned i = 0; i < EstimatorHandler::master_array.size(); ++i )
+  {
+    const Estimator::idType id = EstimatorHandler::master_array[i]->getId();
+    
+    Teuchos::Array<Estimator::idType>::const_iterator id_it = 
+      std::find( estimator_ids.begin(), estimator_ids.end(), id );
+
+    TEST_FOR_EXCEPTION( id_it == estimator_ids.end(),
+			std::runtime_error,
+			"Error: there are no raw moments for estimator "
+			<< id << "!" );
+
+    const Teuchos::Array<double>& raw_moments = 
+      estimator_raw_moments[id_it - estimator_ids.begin()];
+
+    const unsigned moments_used = 
+      EstimatorHandler::master_array[i]->setRawMoments( raw_moments() );
+
+    TEST_FOR_EXCEPTION( moments_used != raw_moments.size(),
+			std::runtime_error,
+			"Error: estimator " << id << " only used " 
+			<< moments_used << " of the " << raw_moments.size()
+			<< " raw moments given!" );
+  }
+}
+
+// Return the max relative error of the requested estimators
+/*! \details If no estimator ids are given every estimator will be checked.
+ * A max relative error of zero will be returned if there are no estimators.
+ */
+double EstimatorHandler::getMaxEstimatorRelativeError(
+		     const Teuchos::Array<Estimator::idType>& estimator_ids,
+		     const unsigned long long histories_completed )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  // Make sure the number of histories is valid
+  testPrecondition( histories_completed > 0ull );
+
+  Estimator::setNumberOfHistories( histories_completed );
+
+  double max_relative_error = 0.0;
+
+  unsigned estimators_checked = 0u;
+
+  for( unsigned i = 0; i < EstimatorHandler::master_array.size(); ++i )
+  {
+    if( estimator_ids.size() == 0 ||
+	std::find( estimator_ids.begin(), 
+		   estimator_ids.end(), 
+		   EstimatorHandler::master_array[i]->getId() ) != 
+	estimator_ids.end() )
+    {
+      const double relative_error = 
+	EstimatorHandler::master_array[i]->getMaxRelativeError();
+
+      if( relative_error > max_relative_error )
+	max_relative_error = relative_error;
+
+      ++estimators_checked;
+    }
+  }
+
+  TEST_FOR_EXCEPTION( estimators_checked < estimator_ids.size(),
+		      std::runtime_error,
+		      "Error: at least one of the requested convergence "
+		      "estimators does not exist!" );
+
+  return max_relative_error;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -65,6 +65,21 @@ public:
 				  const double start_time,
 				  const double end_time,
 				  const bool process_data );
+
+  //! Get the raw moments of every estimator
+  static void getEstimatorRawMoments( 
+	       Teuchos::Array<Estimator::idType>& estimator_ids,
+	       Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments );
+
+  //! Set the raw moments of every estimator
+  static void setEstimatorRawMoments( 
+	  const Teuchos::Array<Estimator::idType>& estimator_ids,
+	  const Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments );
+
+  //! Return the max relative error of the requested estimators
+  static double getMaxEstimatorRelativeError(
+		     const Teuchos::Array<Estimator::idType>& estimator_ids,
+		     const unsigned long long histories_completed );
   
 private:
 
@@ -67,12 +67,21 @@ public:
 				    const double subtrack_start_time,
 				    const double inverse_total_cross_section );
 
+  //! Update the estimators from a subtrack ending event (no collision)
+  static void updateEstimatorsFromParticleSubtrackEndingInCellEvent(
+				    const ParticleState& particle,
+				    const double particle_subtrack_length,
+				    const double subtrack_start_time );
+
   //! Update the global estimators from a collision event
   static void updateEstimatorsFromParticleCollidingGlobalEvent(
 						 const ParticleState& particle,
 						 const double start_point[3],
 						 const double end_point[3] );
 
+  //! Check if any estimator can score a particle type
+  static bool isParticleTypeObserved( const ParticleType particle_type );
+
   //! Commit the estimator history constributions
   static void commitEstimatorHistoryContributions();
 
@@ -98,6 +107,21 @@ public:
 				  const double end_time,
 				  const bool process_data );
 
+  //! Get the raw moments of every estimator
+  static void getEstimatorRawMoments( 
+	       Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+	       Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments );
+
+  //! Set the raw moments of every estimator
+  static void setEstimatorRawMoments( 
+	  const Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+	  const Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments );
+
+  //! Return the max relative error of the requested estimators
+  static double getMaxEstimatorRelativeError(
+		  const Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+		  const unsigned long long histories_completed );
+
   //! Get the internal estimator handle corresponding to the external handle
   static InternalEstimatorHandle getInternalEstimatorHandle(
 			    const ExternalEstimatorHandle estimator_external );
@@ -155,14 +179,19 @@ EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::updateEstimatorsFromPart
 							        particle,
 							        cell_leaving );
 
-  double angle_cosine = Utility::calculateCosineOfAngleBetweenVectors(
+  // Only calculate the angle cosine if a surface estimator can use it
+  if( ParticleCrossingSurfaceEventDispatcherDB::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+  {
+    double angle_cosine = Utility::calculateCosineOfAngleBetweenVectors(
 						       particle.getDirection(),
 						       surface_normal );
 
-  ParticleCrossingSurfaceEventDispatcherDB::dispatchParticleCrossingSurfaceEvent(
+    ParticleCrossingSurfaceEventDispatcherDB::dispatchParticleCrossingSurfaceEvent(
 							      particle,
 							      surface_crossing,
 							      angle_cosine );
+  }
 
   ParticleSubtrackEndingInCellEventDispatcherDB::dispatchParticleSubtrackEndingInCellEvent(
 						    particle,
@@ -189,6 +218,22 @@ EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::updateEstimatorsFromPart
 						 inverse_total_cross_section );
 }
 
+// Update the estimators from a subtrack ending event (no collision)
+/*! \details This event is used when a particle's direction changes without
+ * a collision occurring (e.g. at a condensed history step hinge).
+ */
+inline void 
+EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::updateEstimatorsFromParticleSubtrackEndingInCellEvent(
+				     const ParticleState& particle,
+				     const double particle_subtrack_length,
+				     const double subtrack_start_time )
+{
+  ParticleSubtrackEndingInCellEventDispatcherDB::dispatchParticleSubtrackEndingInCellEvent(
+						    particle,
+						    particle.getCell(),
+						    particle_subtrack_length );
+}
+
 // Update the global estimators from a collision event
 inline void 
 EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::updateEstimatorsFromParticleCollidingGlobalEvent(
@@ -196,10 +241,37 @@ EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::updateEstimatorsFromPart
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  ParticleSubtrackEndingGlobalEventDispatcher::dispatchParticleSubtrackEndingGlobalEvent(
+  if( ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+  {
+    ParticleSubtrackEndingGlobalEventDispatcher::dispatchParticleSubtrackEndingGlobalEvent(
 								   particle,
 								   start_point,
 								   end_point );
+  }
+}
+
+// Check if any estimator can score a particle type
+/*! \details If no estimator can score the particle type the estimator
+ * update calls for the particle can be skipped entirely.
+ */
+inline bool 
+EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::isParticleTypeObserved(
+					     const ParticleType particle_type )
+{
+  return 
+    ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( 
+							       particle_type ) ||
+    ParticleCrossingSurfaceEventDispatcherDB::isParticleTypeObserved( 
+							       particle_type ) ||
+    ParticleEnteringCellEventDispatcherDB::isParticleTypeObserved( 
+							       particle_type ) ||
+    ParticleLeavingCellEventDispatcherDB::isParticleTypeObserved( 
+							       particle_type ) ||
+    ParticleSubtrackEndingInCellEventDispatcherDB::isParticleTypeObserved( 
+							       particle_type ) ||
+    ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( 
+							       particle_type );
 }
 
 // Commit the estimator history constributions
@@ -257,6 +329,35 @@ EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::exportEstimatorData(
 					 process_data );
 }
 
+// Get the raw moments of every estimator
+inline void 
+EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::getEstimatorRawMoments(
+	        Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+	        Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments )
+{
+  EstimatorHandler::getEstimatorRawMoments( estimator_ids, 
+					    estimator_raw_moments );
+}
+
+// Set the raw moments of every estimator
+inline void 
+EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::setEstimatorRawMoments(
+	   const Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+	   const Teuchos::Array<Teuchos::Array<double> >& estimator_raw_moments )
+{
+  EstimatorHandler::setEstimatorRawMoments( estimator_ids, 
+					    estimator_raw_moments );
+}
+
+// Return the max relative error of the requested estimators
+inline double EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::getMaxEstimatorRelativeError(
+		  const Teuchos::Array<InternalEstimatorHandle>& estimator_ids,
+		  const unsigned long long histories_completed )
+{
+  return EstimatorHandler::getMaxEstimatorRelativeError( estimator_ids,
+							 histories_completed );
+}
+
 // Get the internal estimator handle corresponding to the external handle
 inline EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::InternalEstimatorHandle 
 EstimatorModuleInterface<MonteCarlo::EstimatorHandler>::getInternalEstimatorHandle(
@@ -29,16 +29,17 @@ ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEvent(
   // Make sure the cell being collided in is valid
   testPrecondition( cell_of_collision == this->getId() );
 
-  ObserverIdMap::iterator it = observer_id_map().begin();
+  // Observers cannot be attached or detached during the dispatch
+  ActiveDispatchGuard guard( this->active_dispatches() );
+  
+  const ObserverArray& observers = observer_array();
 
-  while( it != observer_id_map().end() )
+  for( unsigned i = 0; i < observers.size(); ++i )
   {
-    it->second->updateFromParticleCollidingInCellEvent( 
-						 particle, 
-						 cell_of_collision,
-						 inverse_total_cross_section );
-
-    ++it;
+    observers[i]->updateFromParticleCollidingInCellEvent( 
+						   particle, 
+						   cell_of_collision,
+						   inverse_total_cross_section );
   }
 }
 
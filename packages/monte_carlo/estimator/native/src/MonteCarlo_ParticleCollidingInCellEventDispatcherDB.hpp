@@ -47,11 +47,17 @@ ParticleCollidingInCellEventDispatcherDB::dispatchParticleCollidingInCellEvent(
 	    const Geometry::ModuleTraits::InternalCellHandle cell_of_collision,
 	    const double inverse_total_cross_section )
 {
+  // Skip the lookup if no observer can score the particle type
+  if( !ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+    return;
+  
   DispatcherMap::iterator it = 
     ParticleCollidingInCellEventDispatcherDB::master_disp_map().find( 
 							   cell_of_collision );
 
-  if( it != ParticleCollidingInCellEventDispatcherDB::master_disp_map().end() )
+  if( it != ParticleCollidingInCellEventDispatcherDB::master_disp_map().end() &&
+      it->second->isParticleTypeObserved( particle.getParticleType() ) )
   {
     it->second->dispatchParticleCollidingInCellEvent( 
 						 particle, 
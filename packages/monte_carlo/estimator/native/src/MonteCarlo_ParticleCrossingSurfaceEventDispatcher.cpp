@@ -29,15 +29,16 @@ ParticleCrossingSurfaceEventDispatcher::dispatchParticleCrossingSurfaceEvent(
   // Make sure the surface being crossed is valid
   testPrecondition( surface_crossing == this->getId() );
 
-  ObserverIdMap::iterator it = observer_id_map().begin();
+  // Observers cannot be attached or detached during the dispatch
+  ActiveDispatchGuard guard( this->active_dispatches() );
+  
+  const ObserverArray& observers = observer_array();
 
-  while( it != observer_id_map().end() )
+  for( unsigned i = 0; i < observers.size(); ++i )
   {
-    it->second->updateFromParticleCrossingSurfaceEvent( particle,
-							surface_crossing,
-							angle_cosine );
-
-    ++it;
+    observers[i]->updateFromParticleCrossingSurfaceEvent( particle,
+							  surface_crossing,
+							  angle_cosine );
   }
 }
 
@@ -47,11 +47,17 @@ ParticleCrossingSurfaceEventDispatcherDB::dispatchParticleCrossingSurfaceEvent(
 	  const Geometry::ModuleTraits::InternalSurfaceHandle surface_crossing,
 	  const double angle_cosine )
 {
+  // Skip the lookup if no observer can score the particle type
+  if( !ParticleCrossingSurfaceEventDispatcherDB::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+    return;
+  
   DispatcherMap::iterator it = 
     ParticleCrossingSurfaceEventDispatcherDB::master_disp_map().find( 
 							    surface_crossing );
 
-  if( it != ParticleCrossingSurfaceEventDispatcherDB::master_disp_map().end() )
+  if( it != ParticleCrossingSurfaceEventDispatcherDB::master_disp_map().end() &&
+      it->second->isParticleTypeObserved( particle.getParticleType() ) )
   {
     it->second->dispatchParticleCrossingSurfaceEvent( particle,
 						      surface_crossing,
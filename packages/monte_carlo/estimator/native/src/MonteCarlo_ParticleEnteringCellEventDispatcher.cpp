@@ -27,13 +27,14 @@ void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
   // Make sure the cell being entered is valid
   testPrecondition( cell_entering == this->getId() );
 
-  ObserverIdMap::iterator it = observer_id_map().begin();
+  // Observers cannot be attached or detached during the dispatch
+  ActiveDispatchGuard guard( this->active_dispatches() );
+  
+  const ObserverArray& observers = observer_array();
 
-  while( it != observer_id_map().end() )
+  for( unsigned i = 0; i < observers.size(); ++i )
   {
-    it->second->updateFromParticleEnteringCellEvent( particle, cell_entering );
-
-    ++it;
+    observers[i]->updateFromParticleEnteringCellEvent( particle, cell_entering );
   }
 }
 
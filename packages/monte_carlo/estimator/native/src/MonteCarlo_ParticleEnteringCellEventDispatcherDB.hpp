@@ -45,11 +45,17 @@ ParticleEnteringCellEventDispatcherDB::dispatchParticleEnteringCellEvent(
 	       const ParticleState& particle,
 	       const Geometry::ModuleTraits::InternalCellHandle cell_entering )
 {
+  // Skip the lookup if no observer can score the particle type
+  if( !ParticleEnteringCellEventDispatcherDB::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+    return;
+  
   DispatcherMap::iterator it = 
     ParticleEnteringCellEventDispatcherDB::master_disp_map().find( 
 							       cell_entering );
 
-  if( it != ParticleEnteringCellEventDispatcherDB::master_disp_map().end() )
+  if( it != ParticleEnteringCellEventDispatcherDB::master_disp_map().end() &&
+      it->second->isParticleTypeObserved( particle.getParticleType() ) )
     it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
 }
 
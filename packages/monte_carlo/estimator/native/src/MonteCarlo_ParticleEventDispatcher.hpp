@@ -14,13 +14,26 @@
 
 // Teuchos Includes
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ModuleTraits.hpp"
+#include "MonteCarlo_ParticleType.hpp"
 
 namespace MonteCarlo{
 
-//! The particle event dispatcher base class
+/*! The particle event dispatcher base class
+ * \details The attached observers are owned by the observer map. A flat
+ * array of the observers, grouped by the concrete observer type, is
+ * rebuilt every time that an observer is attached or detached. The derived
+ * dispatchers loop over this array when dispatching an event so that no
+ * hash map iteration or reference count access is needed and consecutive
+ * calls go to the same update method whenever possible. The particle types
+ * that the attached observers can score are also stored so that events
+ * with other particle types can be skipped. Observers must not be attached
+ * or detached while events are being dispatched (this is checked when 
+ * design-by-contract is enabled).
+ */
 template<typename EntityHandle, typename Observer>
 class ParticleEventDispatcher
 {
@@ -37,8 +50,7 @@ public:
   ParticleEventDispatcher( const EntityHandle entity_id );
 
   //! Destructor
-  virtual ~ParticleEventDispatcher()
-  { /* ... */ }
+  virtual ~ParticleEventDispatcher();
 
   //! Attach an observer to the dispatcher
   void attachObserver( const ModuleTraits::InternalEstimatorHandle id,
@@ -53,22 +65,48 @@ public:
   //! Get the number of attached observers
   unsigned getNumberOfObservers() const;
 
+  //! Check if an attached observer can score the particle type
+  bool isParticleTypeObserved( const ParticleType particle_type ) const;
+
+  //! Get the mask of the particle types that can be scored
+  unsigned getObservedParticleTypeMask() const;
+
 protected:
 
   // The observer map
   typedef typename boost::unordered_map<ModuleTraits::InternalEstimatorHandle,
 					Teuchos::RCP<Observer> > ObserverIdMap;
 
-
   // Get the observer map
-  ObserverIdMap& observer_id_map();
+  const ObserverIdMap& observer_id_map() const;
+
+  // The observer array
+  typedef Teuchos::Array<Observer*> ObserverArray;
+
+  // Get the observer array (grouped by observer type)
+  const ObserverArray& observer_array() const;
+
+  // Get the number of active dispatches (see ActiveDispatchGuard)
+  unsigned& active_dispatches();
   
 private:
 
+  // Update the observer array
+  void updateObserverArray();
+
   // The entity id for which the particle event will be dispatched
   EntityHandle d_entity_id;
 
   ObserverIdMap d_observer_map;
+
+  // The observers (grouped by observer type)
+  ObserverArray d_observer_array;
+
+  // The particle types that can be scored by the observers
+  unsigned d_particle_type_mask;
+
+  // The number of events that are being dispatched
+  unsigned d_active_dispatches;
 };
 
 } // end MonteCarlo namespace
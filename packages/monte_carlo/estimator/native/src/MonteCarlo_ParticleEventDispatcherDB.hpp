@@ -15,9 +15,19 @@
 // Teuchos Includes
 #include <Teuchos_RCP.hpp>
 
+// FRENSIE Includes
+#include "MonteCarlo_ModuleTraits.hpp"
+#include "MonteCarlo_ParticleEventDispatcherHelpers.hpp"
+
 namespace MonteCarlo{
 
-//! The particle event dispatcher database base class
+/*! The particle event dispatcher database base class
+ * \details The database stores the particle types that can be scored by
+ * any of the attached observers so that events with other particle types can
+ * be skipped without looking up the dispatcher. Observers must be attached
+ * and detached through the database (not the dispatchers directly) so that
+ * the particle types stay up to date.
+ */
 template<typename Dispatcher>
 class ParticleEventDispatcherDB
 {
@@ -46,6 +56,9 @@ public:
   //! Detach all observers
   static void detachAllObservers();
 
+  //! Check if an attached observer can score the particle type
+  static bool isParticleTypeObserved( const ParticleType particle_type );
+
 protected:
   
   // Typedef for the dispatcher map
@@ -61,7 +74,13 @@ private:
   // Constructor
   ParticleEventDispatcherDB();
 
+  // Update the mask of the particle types that can be scored
+  static void updateParticleTypeMask();
+
   static DispatcherMap master_map;
+
+  // The particle types that can be scored by the observers
+  static unsigned master_particle_type_mask;
 };
 
 } // end MonteCarlo namespace
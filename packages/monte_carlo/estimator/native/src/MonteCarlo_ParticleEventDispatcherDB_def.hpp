@@ -16,6 +16,9 @@ template<typename Dispatcher>
 typename ParticleEventDispatcherDB<Dispatcher>::DispatcherMap
 ParticleEventDispatcherDB<Dispatcher>::master_map;
 
+template<typename Dispatcher>
+unsigned ParticleEventDispatcherDB<Dispatcher>::master_particle_type_mask = 0u;
+
 // Get the appropriate dispatcher for the given cell id
 template<typename Dispatcher>
 inline Teuchos::RCP<Dispatcher>& 
@@ -45,9 +48,13 @@ inline void ParticleEventDispatcherDB<Dispatcher>::attachObserver(
 		    const ModuleTraits::InternalEstimatorHandle estimator_id,
 		    Teuchos::RCP<typename Dispatcher::ObserverType>& observer )
 {
-  ParticleEventDispatcherDB<Dispatcher>::getDispatcher(entity_id)->attachObserver(
-								  estimator_id,
-								  observer );
+  Teuchos::RCP<Dispatcher>& dispatcher = 
+    ParticleEventDispatcherDB<Dispatcher>::getDispatcher( entity_id );
+  
+  dispatcher->attachObserver( estimator_id, observer );
+
+  ParticleEventDispatcherDB<Dispatcher>::master_particle_type_mask |=
+    dispatcher->getObservedParticleTypeMask();
 }
   
 // Detach an observer from the appropriate dispatcher
@@ -58,6 +65,8 @@ inline void ParticleEventDispatcherDB<Dispatcher>::detachObserver(
 {
   ParticleEventDispatcherDB<Dispatcher>::getDispatcher(entity_id)->detachObserver( 
 								estimator_id );
+
+  ParticleEventDispatcherDB<Dispatcher>::updateParticleTypeMask();
 }
 
 // Detach the observer from all dispatchers
@@ -74,6 +83,8 @@ inline void ParticleEventDispatcherDB<Dispatcher>::detachObserver(
 
     ++it;
   }
+
+  ParticleEventDispatcherDB<Dispatcher>::updateParticleTypeMask();
 }
 
 // Get the master map
@@ -89,6 +100,38 @@ template<typename Dispatcher>
 void ParticleEventDispatcherDB<Dispatcher>::detachAllObservers()
 {
   ParticleEventDispatcherDB<Dispatcher>::master_map.clear();
+  
+  ParticleEventDispatcherDB<Dispatcher>::master_particle_type_mask = 0u;
+}
+
+// Check if an attached observer can score the particle type
+template<typename Dispatcher>
+inline bool ParticleEventDispatcherDB<Dispatcher>::isParticleTypeObserved(
+					     const ParticleType particle_type )
+{
+  return isParticleTypeInMask( 
+		 particle_type,
+		 ParticleEventDispatcherDB<Dispatcher>::master_particle_type_mask );
+}
+
+// Update the mask of the particle types that can be scored
+template<typename Dispatcher>
+void ParticleEventDispatcherDB<Dispatcher>::updateParticleTypeMask()
+{
+  unsigned particle_type_mask = 0u;
+  
+  typename DispatcherMap::const_iterator it = 
+    ParticleEventDispatcherDB<Dispatcher>::master_map.begin();
+
+  while( it != ParticleEventDispatcherDB<Dispatcher>::master_map.end() )
+  {
+    particle_type_mask |= it->second->getObservedParticleTypeMask();
+
+    ++it;
+  }
+
+  ParticleEventDispatcherDB<Dispatcher>::master_particle_type_mask = 
+    particle_type_mask;
 }
 
 } // end MonteCarlo namespace
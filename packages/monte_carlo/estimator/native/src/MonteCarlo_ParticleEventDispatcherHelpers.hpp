@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleEventDispatcherHelpers.hpp
+//! \author Luke Kersting
+//! \brief  Particle event dispatcher helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_HELPERS_HPP
+#define MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_HELPERS_HPP
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleType.hpp"
+#include "FRENSIE_config.hpp"
+
+namespace MonteCarlo{
+
+//! Return the particle type mask bit of a particle type
+unsigned getParticleTypeMaskBit( const ParticleType particle_type );
+
+//! Check if a particle type is in a particle type mask
+bool isParticleTypeInMask( const ParticleType particle_type,
+			   const unsigned particle_type_mask );
+
+//! Return the mask of the particle types that an observer can score
+template<typename Observer>
+unsigned getObserverParticleTypeMask( const Observer& observer );
+
+//! Record that an observer has been attached to a dispatcher
+template<typename Observer>
+void recordObserverAttachment( Observer& observer );
+
+//! Record that an observer has been detached from a dispatcher
+template<typename Observer>
+void recordObserverDetachment( Observer& observer );
+
+//! Compile the observer array of an observer map (grouped by observer type)
+template<typename ObserverIdMap, typename Observer>
+void compileObservers( const ObserverIdMap& observer_map,
+		       Teuchos::Array<Observer*>& observer_array );
+
+//! Return the mask of the particle types that the observers can score
+template<typename ObserverIdMap>
+unsigned getObserversParticleTypeMask( const ObserverIdMap& observer_map );
+
+/*! The active dispatch guard
+ * \details The guard counts the event dispatches that are in progress for
+ * the lifetime of the guard. Observers must not be attached or detached
+ * while an event is being dispatched since the observer array would be 
+ * rebuilt while it is being iterated over. The dispatch count is only 
+ * tracked when design-by-contract is enabled (it is used in preconditions).
+ */
+class ActiveDispatchGuard
+{
+
+public:
+
+  //! Constructor
+  ActiveDispatchGuard( unsigned& active_dispatches )
+    : d_active_dispatches( active_dispatches )
+  {
+#if HAVE_FRENSIE_DBC
+    #pragma omp atomic
+    ++d_active_dispatches;
+#endif
+  }
+
+  //! Destructor
+  ~ActiveDispatchGuard()
+  {
+#if HAVE_FRENSIE_DBC
+    #pragma omp atomic
+    --d_active_dispatches;
+#endif
+  }
+
+private:
+
+  // The number of active dispatches
+  unsigned& d_active_dispatches;
+};
+
+// Return the particle type mask bit of a particle type
+inline unsigned getParticleTypeMaskBit( const ParticleType particle_type )
+{
+  return 1u << particle_type;
+}
+
+// Check if a particle type is in a particle type mask
+inline bool isParticleTypeInMask( const ParticleType particle_type,
+				  const unsigned particle_type_mask )
+{
+  return particle_type_mask & getParticleTypeMaskBit( particle_type );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes.
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_ParticleEventDispatcherHelpers_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleEventDispatcherHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleEventDispatcherHelpers_def.hpp
+//! \author Luke Kersting
+//! \brief  Particle event dispatcher helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_HELPERS_DEF_HPP
+#define MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_HELPERS_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+// FRENSIE Includes
+#include "MonteCarlo_Estimator.hpp"
+#include "MonteCarlo_ModuleTraits.hpp"
+
+namespace MonteCarlo{
+
+// Return the mask of the particle types that an observer can score
+/*! \details An estimator can only score the particle types that have been
+ * assigned to it. Any other observer is assumed to accept every particle
+ * type. The particle types of an estimator must be set before it is
+ * attached to a dispatcher (see MonteCarlo::recordObserverAttachment).
+ */
+template<typename Observer>
+unsigned getObserverParticleTypeMask( const Observer& observer )
+{
+  const Estimator* estimator = dynamic_cast<const Estimator*>( &observer );
+
+  unsigned particle_type_mask = 0u;
+
+  for( int i = PHOTON; i < UNKNOWN_PARTICLE; ++i )
+  {
+    ParticleType particle_type = static_cast<ParticleType>( i );
+
+    if( estimator == NULL || estimator->isParticleTypeAssigned( particle_type ) )
+      particle_type_mask |= getParticleTypeMaskBit( particle_type );
+  }
+
+  return particle_type_mask;
+}
+
+// Record that an observer has been attached to a dispatcher
+/*! \details The particle types of an estimator cannot be changed while it
+ * is attached to a dispatcher since the dispatcher particle type mask would 
+ * no longer be valid. Any other observer can score every particle type.
+ */
+template<typename Observer>
+void recordObserverAttachment( Observer& observer )
+{
+  Estimator* estimator = dynamic_cast<Estimator*>( &observer );
+
+  if( estimator != NULL )
+    estimator->recordDispatcherAttachment();
+}
+
+// Record that an observer has been detached from a dispatcher
+template<typename Observer>
+void recordObserverDetachment( Observer& observer )
+{
+  Estimator* estimator = dynamic_cast<Estimator*>( &observer );
+
+  if( estimator != NULL )
+    estimator->recordDispatcherDetachment();
+}
+
+// Compile the observer array of an observer map (grouped by observer type)
+/*! \details The observers are sorted by their concrete type and then by
+ * their id so that calls to the same update method are consecutive and the
+ * dispatch order does not depend on the hash map.
+ */
+template<typename ObserverIdMap, typename Observer>
+void compileObservers( const ObserverIdMap& observer_map,
+		       Teuchos::Array<Observer*>& observer_array )
+{
+  typedef std::pair<std::type_index,ModuleTraits::InternalEstimatorHandle>
+    ObserverKey;
+
+  Teuchos::Array<std::pair<ObserverKey,Observer*> > sorted_observers;
+  sorted_observers.reserve( observer_map.size() );
+
+  typename ObserverIdMap::const_iterator it = observer_map.begin();
+
+  while( it != observer_map.end() )
+  {
+    sorted_observers.push_back(
+       std::make_pair( ObserverKey( std::type_index( typeid( *it->second ) ),
+				    it->first ),
+		       it->second.getRawPtr() ) );
+
+    ++it;
+  }
+
+  std::sort( sorted_observers.begin(), sorted_observers.end() );
+
+  observer_array.resize( sorted_observers.size() );
+
+  for( unsigned i = 0; i < sorted_observers.size(); ++i )
+    observer_array[i] = sorted_observers[i].second;
+}
+
+// Return the mask of the particle types that the observers can score
+template<typename ObserverIdMap>
+unsigned getObserversParticleTypeMask( const ObserverIdMap& observer_map )
+{
+  unsigned particle_type_mask = 0u;
+
+  typename ObserverIdMap::const_iterator it = observer_map.begin();
+
+  while( it != observer_map.end() )
+  {
+    particle_type_mask |= getObserverParticleTypeMask( *it->second );
+
+    ++it;
+  }
+
+  return particle_type_mask;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_HELPERS_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleEventDispatcherHelpers_def.hpp
+//---------------------------------------------------------------------------//
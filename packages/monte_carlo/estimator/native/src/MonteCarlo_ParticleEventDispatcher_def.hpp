@@ -10,6 +10,7 @@
 #define FACEMC_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_ParticleEventDispatcherHelpers.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -18,9 +19,29 @@ namespace MonteCarlo{
 template<typename EntityHandle, typename Observer>
 ParticleEventDispatcher<EntityHandle,Observer>::ParticleEventDispatcher(
 						 const EntityHandle entity_id )
-  : d_entity_id( entity_id )
+  : d_entity_id( entity_id ),
+    d_observer_map(),
+    d_observer_array(),
+    d_particle_type_mask( 0u ),
+    d_active_dispatches( 0u )
 { /* ... */ }
 
+// Destructor
+/*! \details The observers that are still attached will be detached.
+ */
+template<typename EntityHandle, typename Observer>
+ParticleEventDispatcher<EntityHandle,Observer>::~ParticleEventDispatcher()
+{
+  typename ObserverIdMap::iterator it = d_observer_map.begin();
+
+  while( it != d_observer_map.end() )
+  {
+    recordObserverDetachment( *it->second );
+
+    ++it;
+  }
+}
+
 // Attach an observer to the dispatcher
 template<typename EntityHandle, typename Observer>
 void ParticleEventDispatcher<EntityHandle,Observer>::attachObserver(
@@ -29,9 +50,17 @@ void ParticleEventDispatcher<EntityHandle,Observer>::attachObserver(
 {
   // Make sure the observer has not been attached yet
   testPrecondition( d_observer_map.find( id ) == d_observer_map.end() );
+  // Make sure that no events are being dispatched
+  testPrecondition( d_active_dispatches == 0u );
   
   if( d_observer_map.find( id ) == d_observer_map.end() )
+  {
     d_observer_map[id] = observer;
+
+    recordObserverAttachment( *observer );
+
+    this->updateObserverArray();
+  }
 }
 
 // Detach an observer from the dispatcher
@@ -39,7 +68,19 @@ template<typename EntityHandle, typename Observer>
 void ParticleEventDispatcher<EntityHandle,Observer>::detachObserver(
 			       const ModuleTraits::InternalEstimatorHandle id )
 {
-  d_observer_map.erase( id );
+  // Make sure that no events are being dispatched
+  testPrecondition( d_active_dispatches == 0u );
+  
+  typename ObserverIdMap::iterator it = d_observer_map.find( id );
+  
+  if( it != d_observer_map.end() )
+  {
+    recordObserverDetachment( *it->second );
+    
+    d_observer_map.erase( it );
+    
+    this->updateObserverArray();
+  }
 }
 
 // Get the entity id corresponding to this particle event dispatcher
@@ -58,14 +99,56 @@ ParticleEventDispatcher<EntityHandle,Observer>::getNumberOfObservers() const
   return d_observer_map.size();
 }
 
+// Check if an attached observer can score the particle type
+template<typename EntityHandle, typename Observer>
+inline bool 
+ParticleEventDispatcher<EntityHandle,Observer>::isParticleTypeObserved(
+			            const ParticleType particle_type ) const
+{
+  return isParticleTypeInMask( particle_type, d_particle_type_mask );
+}
+
+// Get the mask of the particle types that can be scored
+template<typename EntityHandle, typename Observer>
+inline unsigned 
+ParticleEventDispatcher<EntityHandle,Observer>::getObservedParticleTypeMask() const
+{
+  return d_particle_type_mask;
+}
+
 // Get the observer map
 template<typename EntityHandle, typename Observer>
-inline typename ParticleEventDispatcher<EntityHandle,Observer>::ObserverIdMap&
-ParticleEventDispatcher<EntityHandle,Observer>::observer_id_map()
+inline const typename ParticleEventDispatcher<EntityHandle,Observer>::ObserverIdMap&
+ParticleEventDispatcher<EntityHandle,Observer>::observer_id_map() const
 {
   return d_observer_map;
 }
 
+// Get the observer array (grouped by observer type)
+template<typename EntityHandle, typename Observer>
+inline const typename ParticleEventDispatcher<EntityHandle,Observer>::ObserverArray&
+ParticleEventDispatcher<EntityHandle,Observer>::observer_array() const
+{
+  return d_observer_array;
+}
+
+// Get the number of active dispatches (see ActiveDispatchGuard)
+template<typename EntityHandle, typename Observer>
+inline unsigned& 
+ParticleEventDispatcher<EntityHandle,Observer>::active_dispatches()
+{
+  return d_active_dispatches;
+}
+
+// Update the observer array
+template<typename EntityHandle, typename Observer>
+void ParticleEventDispatcher<EntityHandle,Observer>::updateObserverArray()
+{
+  compileObservers( d_observer_map, d_observer_array );
+
+  d_particle_type_mask = getObserversParticleTypeMask( d_observer_map );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end FACEMC_PARTICLE_EVENT_DISPATCHER_DEF_HPP
@@ -14,13 +14,21 @@
 
 // Teuchos Includes
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ModuleTraits.hpp"
+#include "MonteCarlo_ParticleType.hpp"
 
 namespace MonteCarlo{
 
-//! The particle global event dispatcher base class
+/*! The particle global event dispatcher base class
+ * \details A flat array of the attached observers, grouped by the concrete
+ * observer type, and the mask of particle types that can be scored are
+ * maintained alongside the observer map. Observers must not be attached or
+ * detached while events are being dispatched (see
+ * MonteCarlo::ParticleEventDispatcher).
+ */
 template<typename Observer>
 class ParticleGlobalEventDispatcher
 {
@@ -43,6 +51,9 @@ public:
   //! Get the number of attached observers
   static unsigned getNumberOfObservers();
 
+  //! Check if an attached observer can score the particle type
+  static bool isParticleTypeObserved( const ParticleType particle_type );
+
 protected:
 
   // The observer map
@@ -50,14 +61,35 @@ protected:
 					Teuchos::RCP<Observer> > ObserverIdMap;
 
   // Get the oberver map
-  static ObserverIdMap& observer_id_map();
+  static const ObserverIdMap& observer_id_map();
+
+  // The observer array
+  typedef Teuchos::Array<Observer*> ObserverArray;
+
+  // Get the observer array (grouped by observer type)
+  static const ObserverArray& observer_array();
+
+  // Get the number of active dispatches (see ActiveDispatchGuard)
+  static unsigned& active_dispatches();
 
 private:
 
   // Constructor
   ParticleGlobalEventDispatcher();
 
+  // Update the observer array
+  static void updateObserverArray();
+
   static ObserverIdMap d_observer_map;
+
+  // The observers (grouped by observer type)
+  static ObserverArray d_observer_array;
+
+  // The particle types that can be scored by the observers
+  static unsigned d_particle_type_mask;
+
+  // The number of events that are being dispatched
+  static unsigned d_active_dispatches;
 };
 
 } // end MonteCarlo namespace
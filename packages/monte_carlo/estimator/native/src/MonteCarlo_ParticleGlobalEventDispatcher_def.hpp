@@ -10,6 +10,7 @@
 #define FACEMC_PARTICLE_GLOBAL_EVENT_DISPATCHER_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_ParticleEventDispatcherHelpers.hpp"
 #include "Utility_ContractException.hpp"
 
 namespace MonteCarlo{
@@ -18,6 +19,15 @@ namespace MonteCarlo{
 template<typename Observer>
 typename ParticleGlobalEventDispatcher<Observer>::ObserverIdMap ParticleGlobalEventDispatcher<Observer>::d_observer_map;
 
+template<typename Observer>
+typename ParticleGlobalEventDispatcher<Observer>::ObserverArray ParticleGlobalEventDispatcher<Observer>::d_observer_array;
+
+template<typename Observer>
+unsigned ParticleGlobalEventDispatcher<Observer>::d_particle_type_mask = 0u;
+
+template<typename Observer>
+unsigned ParticleGlobalEventDispatcher<Observer>::d_active_dispatches = 0u;
+
 // Constructor
 template<typename Observer>
 ParticleGlobalEventDispatcher<Observer>::ParticleGlobalEventDispatcher()
@@ -31,9 +41,17 @@ void ParticleGlobalEventDispatcher<Observer>::attachObserver(
 {
   // Make sure the observer has not been attached yet
   testPrecondition( d_observer_map.find( id ) == d_observer_map.end() );
+  // Make sure that no events are being dispatched
+  testPrecondition( d_active_dispatches == 0u );
   
   if( d_observer_map.find( id ) == d_observer_map.end() )
+  {
     d_observer_map[id] = observer;
+
+    recordObserverAttachment( *observer );
+
+    ParticleGlobalEventDispatcher<Observer>::updateObserverArray();
+  }
 }
 
 // Detach an observer from the dispatcher
@@ -41,7 +59,19 @@ template<typename Observer>
 void ParticleGlobalEventDispatcher<Observer>::detachObserver(
 			       const ModuleTraits::InternalEstimatorHandle id )
 {
-  d_observer_map.erase( id );
+  // Make sure that no events are being dispatched
+  testPrecondition( d_active_dispatches == 0u );
+  
+  typename ObserverIdMap::iterator it = d_observer_map.find( id );
+  
+  if( it != d_observer_map.end() )
+  {
+    recordObserverDetachment( *it->second );
+    
+    d_observer_map.erase( it );
+    
+    ParticleGlobalEventDispatcher<Observer>::updateObserverArray();
+  }
 }
 
 // Get the number of attached observers
@@ -51,20 +81,65 @@ unsigned ParticleGlobalEventDispatcher<Observer>::getNumberOfObservers()
   return d_observer_map.size();
 }
 
+// Check if an attached observer can score the particle type
+template<typename Observer>
+inline bool ParticleGlobalEventDispatcher<Observer>::isParticleTypeObserved(
+					     const ParticleType particle_type )
+{
+  return isParticleTypeInMask( particle_type, d_particle_type_mask );
+}
+
 // Detach an observer from the dispatcher
 template<typename Observer>
 void ParticleGlobalEventDispatcher<Observer>::detachAllObservers()
 {
-  d_observer_map.clear( );
+  // Make sure that no events are being dispatched
+  testPrecondition( d_active_dispatches == 0u );
+  
+  typename ObserverIdMap::iterator it = d_observer_map.begin();
+
+  while( it != d_observer_map.end() )
+  {
+    recordObserverDetachment( *it->second );
+
+    ++it;
+  }
+  
+  d_observer_map.clear();
+  d_observer_array.clear();
+  d_particle_type_mask = 0u;
 }
 
 // Get the observer id map
 template<typename Observer>
-typename ParticleGlobalEventDispatcher<Observer>::ObserverIdMap& ParticleGlobalEventDispatcher<Observer>::observer_id_map()
+const typename ParticleGlobalEventDispatcher<Observer>::ObserverIdMap& ParticleGlobalEventDispatcher<Observer>::observer_id_map()
 {
   return d_observer_map;
 }
 
+// Get the observer array (grouped by observer type)
+template<typename Observer>
+inline const typename ParticleGlobalEventDispatcher<Observer>::ObserverArray&
+ParticleGlobalEventDispatcher<Observer>::observer_array()
+{
+  return d_observer_array;
+}
+
+// Get the number of active dispatches (see ActiveDispatchGuard)
+template<typename Observer>
+inline unsigned& ParticleGlobalEventDispatcher<Observer>::active_dispatches()
+{
+  return d_active_dispatches;
+}
+
+// Update the observer array
+template<typename Observer>
+void ParticleGlobalEventDispatcher<Observer>::updateObserverArray()
+{
+  compileObservers( d_observer_map, d_observer_array );
+
+  d_particle_type_mask = getObserversParticleTypeMask( d_observer_map );
+}
 
 } // end MonteCarlo namespace
 
@@ -45,10 +45,16 @@ ParticleLeavingCellEventDispatcherDB::dispatchParticleLeavingCellEvent(
 	        const ParticleState& particle,
 	        const Geometry::ModuleTraits::InternalCellHandle cell_leaving )
 {
+  // Skip the lookup if no observer can score the particle type
+  if( !ParticleLeavingCellEventDispatcherDB::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+    return;
+  
   DispatcherMap::iterator it = 
     ParticleLeavingCellEventDispatcherDB::master_disp_map().find(cell_leaving);
 
-  if( it != ParticleLeavingCellEventDispatcherDB::master_disp_map().end() )
+  if( it != ParticleLeavingCellEventDispatcherDB::master_disp_map().end() &&
+      it->second->isParticleTypeObserved( particle.getParticleType() ) )
     it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
 }
 
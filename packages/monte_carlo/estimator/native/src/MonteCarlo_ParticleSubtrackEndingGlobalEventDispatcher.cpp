@@ -18,16 +18,17 @@ void ParticleSubtrackEndingGlobalEventDispatcher::dispatchParticleSubtrackEnding
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  ObserverIdMap::iterator it = observer_id_map().begin();
+  // Observers cannot be attached or detached during the dispatch
+  ActiveDispatchGuard guard( active_dispatches() );
+  
+  const ObserverArray& observers = observer_array();
 
-  while( it != observer_id_map().end() )
+  for( unsigned i = 0; i < observers.size(); ++i )
   {
-    it->second->updateFromGlobalParticleSubtrackEndingEvent(
-							    particle,
-							    start_point,
-							    end_point );
-
-    ++it;
+    observers[i]->updateFromGlobalParticleSubtrackEndingEvent(
+							      particle,
+							      start_point,
+							      end_point );
   }
 }
 
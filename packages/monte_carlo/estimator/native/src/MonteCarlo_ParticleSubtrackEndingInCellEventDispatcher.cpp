@@ -28,16 +28,17 @@ void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEnding
   // Make sure the cell being collided with is valid
   testPrecondition( cell_of_subtrack == this->getId() );
 
-  ObserverIdMap::iterator it = observer_id_map().begin();
+  // Observers cannot be attached or detached during the dispatch
+  ActiveDispatchGuard guard( this->active_dispatches() );
+  
+  const ObserverArray& observers = observer_array();
 
-  while( it != observer_id_map().end() )
+  for( unsigned i = 0; i < observers.size(); ++i )
   {
-    it->second->updateFromParticleSubtrackEndingInCellEvent(
-							    particle,
-							    cell_of_subtrack,
-							    track_length );
-
-    ++it;
+    observers[i]->updateFromParticleSubtrackEndingInCellEvent(
+							      particle,
+							      cell_of_subtrack,
+							      track_length );
   }
 }
 
@@ -47,11 +47,17 @@ ParticleSubtrackEndingInCellEventDispatcherDB::dispatchParticleSubtrackEndingInC
 	    const Geometry::ModuleTraits::InternalCellHandle  cell_of_subtrack,
 	    const double track_length )
 {
+  // Skip the lookup if no observer can score the particle type
+  if( !ParticleSubtrackEndingInCellEventDispatcherDB::isParticleTypeObserved(
+						 particle.getParticleType() ) )
+    return;
+  
   DispatcherMap::iterator it = 
     ParticleSubtrackEndingInCellEventDispatcherDB::master_disp_map().find( 
 							    cell_of_subtrack );
 
-  if( it != ParticleSubtrackEndingInCellEventDispatcherDB::master_disp_map().end() )
+  if( it != ParticleSubtrackEndingInCellEventDispatcherDB::master_disp_map().end() &&
+      it->second->isParticleTypeObserved( particle.getParticleType() ) )
   {
     it->second->dispatchParticleSubtrackEndingInCellEvent( particle, 
 							   cell_of_subtrack,
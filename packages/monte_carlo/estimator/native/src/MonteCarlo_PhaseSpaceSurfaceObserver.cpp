@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceSurfaceObserver.cpp
+//! \author Luke Kersting
+//! \brief  Phase space surface observer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceSurfaceObserver.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+PhaseSpaceSurfaceObserver::PhaseSpaceSurfaceObserver(
+					       const std::string& file_name,
+					       const unsigned buffer_size )
+  : d_writer( file_name ),
+    d_buffer_size( buffer_size ),
+    d_thread_buffers( 1 )
+{
+  // Make sure the buffer size is valid
+  testPrecondition( buffer_size > 0u );
+
+  d_thread_buffers[0].reserve( buffer_size );
+}
+
+// Destructor
+PhaseSpaceSurfaceObserver::~PhaseSpaceSurfaceObserver()
+{
+  if( d_writer.isOpen() )
+  {
+    for( unsigned i = 0; i < d_thread_buffers.size(); ++i )
+    {
+      try{
+	this->flushThreadBuffer( i );
+      }
+      catch( ... )
+      { /* ... */ }
+    }
+  }
+}
+
+// Update the observer
+/*! \details The buffer of the calling thread will be written to the file
+ * if it is full and the particle belongs to a new history.
+ */
+void PhaseSpaceSurfaceObserver::updateFromParticleCrossingSurfaceEvent(
+	  const ParticleState& particle,
+	  const Geometry::ModuleTraits::InternalSurfaceHandle surface_crossing,
+	  const double angle_cosine )
+{
+  // Make sure the file is still open
+  testPrecondition( d_writer.isOpen() );
+
+  unsigned thread_id = Utility::GlobalOpenMPSession::getThreadId();
+
+  // Make sure thread support has been enabled for this thread
+  testPrecondition( thread_id < d_thread_buffers.size() );
+
+  Teuchos::Array<PhaseSpaceRecord>& buffer = d_thread_buffers[thread_id];
+
+  if( buffer.size() >= d_buffer_size &&
+      buffer.back().history_number != particle.getHistoryNumber() )
+    this->flushThreadBuffer( thread_id );
+
+  buffer.resize( buffer.size()+1 );
+
+  fillPhaseSpaceRecord( buffer.back(), particle, surface_crossing );
+}
+
+// Enable support for multiple threads
+/*! \details This must be called before the observer is updated by more
+ * than one thread.
+ */
+void PhaseSpaceSurfaceObserver::enableThreadSupport(
+						  const unsigned num_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0u );
+
+  if( num_threads > d_thread_buffers.size() )
+  {
+    unsigned old_size = d_thread_buffers.size();
+
+    d_thread_buffers.resize( num_threads );
+
+    for( unsigned i = old_size; i < num_threads; ++i )
+      d_thread_buffers[i].reserve( d_buffer_size );
+  }
+}
+
+// Write all buffered records to the file
+/*! \details This should only be called by the master thread once all
+ * histories have been completed.
+ */
+void PhaseSpaceSurfaceObserver::flush()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+
+  if( d_writer.isOpen() )
+  {
+    for( unsigned i = 0; i < d_thread_buffers.size(); ++i )
+      this->flushThreadBuffer( i );
+  }
+}
+
+// Write all buffered records to the file and close it
+void PhaseSpaceSurfaceObserver::close()
+{
+  this->flush();
+
+  d_writer.close();
+}
+
+// Return the number of records that have been written to the file
+unsigned long long
+PhaseSpaceSurfaceObserver::getNumberOfRecordsWritten() const
+{
+  return d_writer.getNumberOfRecords();
+}
+
+// Write the buffered records of a thread to the file
+void PhaseSpaceSurfaceObserver::flushThreadBuffer( const unsigned thread_id )
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_buffers.size() );
+
+  Teuchos::Array<PhaseSpaceRecord>& buffer = d_thread_buffers[thread_id];
+
+  if( buffer.size() > 0 )
+  {
+    d_writer.write( buffer.getRawPtr(), buffer.size() );
+
+    buffer.clear();
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceSurfaceObserver.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhaseSpaceSurfaceObserver.hpp
+//! \author Luke Kersting
+//! \brief  Phase space surface observer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PHASE_SPACE_SURFACE_OBSERVER_HPP
+#define MONTE_CARLO_PHASE_SPACE_SURFACE_OBSERVER_HPP
+
+// Std Lib Includes
+#include <string>
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleCrossingSurfaceEventObserver.hpp"
+#include "MonteCarlo_PhaseSpaceFileWriter.hpp"
+
+namespace MonteCarlo{
+
+/*! The phase space surface observer class
+ * \details The state of every particle that crosses one of the surfaces that
+ * the observer is attached to is recorded in a phase space file (surface
+ * source) that can be used by a MonteCarlo::StateSource. Each thread
+ * records the particles in its own buffer. A buffer is only appended to the
+ * file once it is full and a new history has started so that the records
+ * of a history are always stored contiguously. The observer must be
+ * attached to the surfaces of interest using the
+ * MonteCarlo::ParticleCrossingSurfaceEventDispatcherDB.
+ */
+class PhaseSpaceSurfaceObserver : public ParticleCrossingSurfaceEventObserver
+{
+
+public:
+
+  //! Constructor
+  PhaseSpaceSurfaceObserver( const std::string& file_name,
+			     const unsigned buffer_size = 10000u );
+
+  //! Destructor
+  ~PhaseSpaceSurfaceObserver();
+
+  //! Update the observer
+  void updateFromParticleCrossingSurfaceEvent(
+	  const ParticleState& particle,
+	  const Geometry::ModuleTraits::InternalSurfaceHandle surface_crossing,
+	  const double angle_cosine );
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads );
+
+  //! Write all buffered records to the file
+  void flush();
+
+  //! Write all buffered records to the file and close it
+  void close();
+
+  //! Return the number of records that have been written to the file
+  unsigned long long getNumberOfRecordsWritten() const;
+
+private:
+
+  // Write the buffered records of a thread to the file
+  void flushThreadBuffer( const unsigned thread_id );
+
+  // The phase space file writer
+  PhaseSpaceFileWriter d_writer;
+
+  // The buffer size (number of records)
+  unsigned d_buffer_size;
+
+  // The record buffers (one for each thread)
+  Teuchos::Array<Teuchos::Array<PhaseSpaceRecord> > d_thread_buffers;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PHASE_SPACE_SURFACE_OBSERVER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhaseSpaceSurfaceObserver.hpp
+//---------------------------------------------------------------------------//
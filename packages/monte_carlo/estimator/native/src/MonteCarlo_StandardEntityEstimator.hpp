@@ -98,6 +98,13 @@ public:
   //! Export the estimator data
   virtual void exportData( EstimatorHDF5FileHandler& hdf5_file,
 			   const bool process_data ) const;
+
+  //! Get the raw moments of the estimator (appended to the array)
+  virtual void getRawMoments( Teuchos::Array<double>& raw_moments ) const;
+
+  //! Set the raw moments of the estimator (returns the number used)
+  virtual unsigned setRawMoments( 
+			 const Teuchos::ArrayView<const double>& raw_moments );
   
 protected:
 
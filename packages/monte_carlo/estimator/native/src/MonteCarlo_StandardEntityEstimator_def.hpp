@@ -10,6 +10,7 @@
 #define FACEMC_STANDARD_ENTITY_ESTIMATOR_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "Utility_GlobalOpenMPSession.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ContractException.hpp"
@@ -550,7 +551,65 @@ void StandardEntityEstimator<EntityId>::exportData(
   // Export the lower level data first
   EntityEstimator<EntityId>::exportData( hdf5_file, process_data );
 
-  // Export the raw total data for each entity
+  // Export the raw total data for each entity to single data sets
+  if( SimulationGeneralProperties::isChunkedEstimatorOutputModeOn() )
+  {
+    // The entity order must match the exported entity ids
+    Teuchos::Array<EntityId> entity_ids;
+
+    this->getSortedEntityIds( entity_ids );
+
+    if( entity_ids.size() > 0 )
+    {
+      Teuchos::Array<Utility::Quad<double,double,double,double> > 
+	raw_data, processed_data;
+
+      raw_data.reserve( entity_ids.size()*d_total_estimator_moments.size() );
+
+      for( unsigned i = 0u; i < entity_ids.size(); ++i )
+      {
+	const Estimator::FourEstimatorMomentsArray& entity_total_data = 
+	  d_entity_total_estimator_moments_map.find( entity_ids[i] )->second;
+
+	raw_data.insert( raw_data.end(),
+			 entity_total_data.begin(),
+			 entity_total_data.end() );
+
+	if( process_data )
+	{
+	  const double norm_constant = 
+	    this->getEntityNormConstant( entity_ids[i] );
+	  
+	  for( unsigned j = 0; j < entity_total_data.size(); ++j )
+	  {
+	    Utility::Quad<double,double,double,double> processed_moments;
+	    
+	    this->processMoments( entity_total_data[j],
+				  norm_constant,
+				  processed_moments.first,
+				  processed_moments.second,
+				  processed_moments.third,
+				  processed_moments.fourth );
+
+	    processed_data.push_back( processed_moments );
+	  }
+	}
+      }
+
+      hdf5_file.setRawEstimatorEntitiesTotalData( this->getId(),
+						  entity_ids.size(),
+						  raw_data );
+
+      if( process_data )
+      {
+	hdf5_file.setProcessedEstimatorEntitiesTotalData( this->getId(),
+							  entity_ids.size(),
+							  processed_data );
+      }
+    }
+  }
+  // Export the raw total data for each entity (group for every entity)
+  else
   {
     typename EntityEstimatorMomentsArrayMap::const_iterator entity_data = 
       d_entity_total_estimator_moments_map.begin();
@@ -610,6 +669,105 @@ void StandardEntityEstimator<EntityId>::exportData(
   }
 }
 
+// Get the raw moments of the estimator (appended to the array)
+/*! \details The four moments of the totals over all entities are appended
+ * after the lower level moments followed by the four moments of the total of
+ * every entity (in ascending entity id order).
+ */
+template<typename EntityId>
+void StandardEntityEstimator<EntityId>::getRawMoments( 
+				     Teuchos::Array<double>& raw_moments ) const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  
+  EntityEstimator<EntityId>::getRawMoments( raw_moments );
+
+  for( unsigned i = 0; i < d_total_estimator_moments.size(); ++i )
+  {
+    raw_moments.push_back( d_total_estimator_moments[i].first );
+    raw_moments.push_back( d_total_estimator_moments[i].second );
+    raw_moments.push_back( d_total_estimator_moments[i].third );
+    raw_moments.push_back( d_total_estimator_moments[i].fourth );
+  }
+
+  Teuchos::Array<EntityId> entity_ids;
+
+  this->getSortedEntityIds( entity_ids );
+
+  for( unsigned i = 0; i < entity_ids.size(); ++i )
+  {
+    const Estimator::FourEstimatorMomentsArray& entity_data = 
+      d_entity_total_estimator_moments_map.find( entity_ids[i] )->second;
+
+    for( unsigned j = 0; j < entity_data.size(); ++j )
+    {
+      raw_moments.push_back( entity_data[j].first );
+      raw_moments.push_back( entity_data[j].second );
+      raw_moments.push_back( entity_data[j].third );
+      raw_moments.push_back( entity_data[j].fourth );
+    }
+  }
+}
+
+// Set the raw moments of the estimator (returns the number used)
+template<typename EntityId>
+unsigned StandardEntityEstimator<EntityId>::setRawMoments( 
+			  const Teuchos::ArrayView<const double>& raw_moments )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::GlobalOpenMPSession::getThreadId() == 0 );
+  
+  unsigned index = EntityEstimator<EntityId>::setRawMoments( raw_moments );
+
+  Teuchos::Array<EntityId> entity_ids;
+
+  this->getSortedEntityIds( entity_ids );
+
+  unsigned required_moments = d_total_estimator_moments.size();
+
+  for( unsigned i = 0; i < entity_ids.size(); ++i )
+  {
+    required_moments += 
+      d_entity_total_estimator_moments_map.find( entity_ids[i] )->second.size();
+  }
+
+  TEST_FOR_EXCEPTION( index + 4*required_moments > raw_moments.size(),
+		      std::runtime_error,
+		      "Error: standard entity estimator " << this->getId() << 
+		      " requires " << 4*required_moments << " total raw "
+		      "moments but only " << raw_moments.size() - index << 
+		      " were given!" );
+
+  for( unsigned i = 0; i < d_total_estimator_moments.size(); ++i )
+  {
+    d_total_estimator_moments[i]( raw_moments[index], 
+				  raw_moments[index+1],
+				  raw_moments[index+2],
+				  raw_moments[index+3] );
+
+    index += 4;
+  }
+
+  for( unsigned i = 0; i < entity_ids.size(); ++i )
+  {
+    Estimator::FourEstimatorMomentsArray& entity_data = 
+      d_entity_total_estimator_moments_map.find( entity_ids[i] )->second;
+
+    for( unsigned j = 0; j < entity_data.size(); ++j )
+    {
+      entity_data[j]( raw_moments[index], 
+		      raw_moments[index+1],
+		      raw_moments[index+2],
+		      raw_moments[index+3] );
+
+      index += 4;
+    }
+  }
+
+  return index;
+}
+
 // Assign entities
 template<typename EntityId>
 void StandardEntityEstimator<EntityId>::assignEntities(
@@ -775,6 +775,102 @@ TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( EstimatorHDF5FileHandler,
 ENTITY_ID_UNIT_TEST_INSTANTIATION( EstimatorHDF5FileHandler,
 				   set_get_all_entity_data );
 
+//---------------------------------------------------------------------------//
+// Check that the estimator entity ids can be set
+TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( EstimatorHDF5FileHandler,
+				   set_getEstimatorEntityIds,
+				   EntityIdType )
+{
+  MonteCarlo::EstimatorHDF5FileHandler file_handler( hdf5_file_name );
+
+  TEST_ASSERT( !file_handler.isEstimatorEntityDataChunked( 0u ) );
+  
+  Teuchos::Array<EntityIdType> entity_ids( 3 );
+  entity_ids[0] = 0;
+  entity_ids[1] = 5;
+  entity_ids[2] = 10;
+
+  file_handler.setEstimatorEntityIds( 0u, entity_ids );
+
+  TEST_ASSERT( file_handler.isEstimatorEntityDataChunked( 0u ) );
+  
+  Teuchos::Array<EntityIdType> entity_ids_copy;
+
+  file_handler.getEstimatorEntityIds( 0u, entity_ids_copy );
+
+  TEST_COMPARE_ARRAYS( entity_ids, entity_ids_copy );
+}
+
+ENTITY_ID_UNIT_TEST_INSTANTIATION( EstimatorHDF5FileHandler,
+				   set_getEstimatorEntityIds );
+
+//---------------------------------------------------------------------------//
+// Check that the data of all entities can be set in single data sets
+TEUCHOS_UNIT_TEST( EstimatorHDF5FileHandler, set_get_all_entities_data )
+{
+  MonteCarlo::EstimatorHDF5FileHandler file_handler( hdf5_file_name );
+
+  // Initialize the entity data (2 entities)
+  Teuchos::Array<Utility::Pair<double,double> > raw_bin_data( 6 );
+  raw_bin_data[0]( 1.0, 1.0 );
+  raw_bin_data[1]( 0.0, 0.0 );
+  raw_bin_data[2]( 0.5, 1.5 );
+  raw_bin_data[3]( 2.0, 4.0 );
+  raw_bin_data[4]( 3.0, 9.0 );
+  raw_bin_data[5]( 0.1, 0.2 );
+
+  Teuchos::Array<Utility::Pair<double,double> > processed_bin_data( 6 );
+  processed_bin_data[0]( 1.0, 0.1 );
+  processed_bin_data[1]( 0.0, 0.0 );
+  processed_bin_data[2]( 0.5, 0.2 );
+  processed_bin_data[3]( 2.0, 0.3 );
+  processed_bin_data[4]( 3.0, 0.4 );
+  processed_bin_data[5]( 0.1, 0.5 );
+
+  Teuchos::Array<Utility::Quad<double,double,double,double> > 
+    raw_total_data( 2 );
+  raw_total_data[0]( 1.5, 2.5, 3.5, 4.5 );
+  raw_total_data[1]( 5.1, 9.2, 2.0, 1.0 );
+
+  Teuchos::Array<Utility::Quad<double,double,double,double> > 
+    processed_total_data( 2 );
+  processed_total_data[0]( 1.5, 0.1, 0.01, 100.0 );
+  processed_total_data[1]( 5.1, 0.2, 0.02, 50.0 );
+
+  // Set the entity data
+  file_handler.setRawEstimatorEntitiesBinData( 0u, 2u, raw_bin_data );
+  file_handler.setProcessedEstimatorEntitiesBinData( 0u, 
+						     2u, 
+						     processed_bin_data );
+  file_handler.setRawEstimatorEntitiesTotalData( 0u, 2u, raw_total_data );
+  file_handler.setProcessedEstimatorEntitiesTotalData( 0u, 
+						       2u, 
+						       processed_total_data );
+
+  // Get the entity data back
+  Teuchos::Array<Utility::Pair<double,double> > raw_bin_data_copy;
+  Teuchos::Array<Utility::Pair<double,double> > processed_bin_data_copy;
+  Teuchos::Array<Utility::Quad<double,double,double,double> > 
+    raw_total_data_copy;
+  Teuchos::Array<Utility::Quad<double,double,double,double> > 
+    processed_total_data_copy;
+
+  file_handler.getRawEstimatorEntitiesBinData( 0u, raw_bin_data_copy );
+  file_handler.getProcessedEstimatorEntitiesBinData( 0u, 
+						     processed_bin_data_copy );
+  file_handler.getRawEstimatorEntitiesTotalData( 0u, raw_total_data_copy );
+  file_handler.getProcessedEstimatorEntitiesTotalData( 
+						   0u, 
+						   processed_total_data_copy );
+
+  // Compare the retrieved entity data
+  UTILITY_TEST_COMPARE_ARRAYS( raw_bin_data, raw_bin_data_copy );
+  UTILITY_TEST_COMPARE_ARRAYS( processed_bin_data, processed_bin_data_copy );
+  UTILITY_TEST_COMPARE_ARRAYS( raw_total_data, raw_total_data_copy );
+  UTILITY_TEST_COMPARE_ARRAYS( processed_total_data, 
+			       processed_total_data_copy );
+}
+
 //---------------------------------------------------------------------------//
 // Check that raw estimator total bin data can be set
 TEUCHOS_UNIT_TEST( EstimatorHDF5FileHandler, set_getRawEstimatorTotalBinData )
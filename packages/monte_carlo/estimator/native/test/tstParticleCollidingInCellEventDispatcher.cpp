@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <utility>
 
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
@@ -19,6 +20,7 @@
 #include "MonteCarlo_ParticleCollidingInCellEventDispatcher.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "Geometry_ModuleTraits.hpp"
+#include "Utility_ContractException.hpp"
 
 //---------------------------------------------------------------------------//
 // Testing Variables
@@ -32,9 +34,73 @@ Teuchos::RCP<MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightAndEnergyM
 Teuchos::RCP<MonteCarlo::ParticleCollidingInCellEventDispatcher> dispatcher( 
 		     new MonteCarlo::ParticleCollidingInCellEventDispatcher( 0 ) );
 
+// The observers that have been updated (observer type, observer id)
+Teuchos::Array<std::pair<char,unsigned> > update_log;
+
+//---------------------------------------------------------------------------//
+// Testing Structs.
+//---------------------------------------------------------------------------//
+// An observer that records its updates
+template<char type>
+class LoggingObserver : public MonteCarlo::ParticleCollidingInCellEventObserver
+{
+public:
+
+  LoggingObserver( const unsigned id )
+    : d_id( id )
+  { /* ... */ }
+
+  void updateFromParticleCollidingInCellEvent(
+	    const MonteCarlo::ParticleState& particle,
+	    const Geometry::ModuleTraits::InternalCellHandle cell_of_collision,
+	    const double inverse_total_cross_section )
+  { update_log.push_back( std::make_pair( type, d_id ) ); }
+
+private:
+
+  unsigned d_id;
+};
+
+// An observer that detaches an observer when it is updated
+class DetachingObserver : public MonteCarlo::ParticleCollidingInCellEventObserver
+{
+public:
+
+  DetachingObserver( 
+	     MonteCarlo::ParticleCollidingInCellEventDispatcher& dispatcher,
+	     const unsigned detach_id )
+    : d_dispatcher( dispatcher ),
+      d_detach_id( detach_id )
+  { /* ... */ }
+
+  void updateFromParticleCollidingInCellEvent(
+	    const MonteCarlo::ParticleState& particle,
+	    const Geometry::ModuleTraits::InternalCellHandle cell_of_collision,
+	    const double inverse_total_cross_section )
+  { d_dispatcher.detachObserver( d_detach_id ); }
+
+private:
+
+  MonteCarlo::ParticleCollidingInCellEventDispatcher& d_dispatcher;
+
+  unsigned d_detach_id;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Functions.
 //---------------------------------------------------------------------------//
+// Attach a logging observer to a dispatcher
+template<char type>
+void attachLoggingObserver( 
+		MonteCarlo::ParticleCollidingInCellEventDispatcher& dispatcher,
+		const unsigned id )
+{
+  Teuchos::RCP<MonteCarlo::ParticleCollidingInCellEventObserver> observer(
+					       new LoggingObserver<type>( id ) );
+
+  dispatcher.attachObserver( id, observer );
+}
+
 // Initialize the estimator
 template<typename CellCollisionFluxEstimator>
 void initializeCellCollisionFluxEstimator( 
@@ -129,12 +195,25 @@ TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcher,
 // Check that an observer can be detached from the dispatcher
 TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcher, detachObserver )
 {
+  estimator_1->commitHistoryContribution();
+  estimator_2->commitHistoryContribution();
+  
   dispatcher->detachObserver( 0u );
 
   TEST_EQUALITY_CONST( estimator_1.total_count(), 1 );
   TEST_EQUALITY_CONST( estimator_2.total_count(), 2 );
   TEST_EQUALITY_CONST( dispatcher->getNumberOfObservers(), 1 );
 
+  // Only the attached observer should be updated
+  MonteCarlo::PhotonState particle( 1ull );
+  particle.setWeight( 1.0 );
+  particle.setEnergy( 1.0 );
+
+  dispatcher->dispatchParticleCollidingInCellEvent( particle, 0, 1.0 );
+
+  TEST_ASSERT( !estimator_1->hasUncommittedHistoryContribution() );
+  TEST_ASSERT( estimator_2->hasUncommittedHistoryContribution() );
+
   dispatcher->detachObserver( 1u );
 
   TEST_EQUALITY_CONST( estimator_1.total_count(), 1 );
@@ -149,6 +228,121 @@ TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcher, detachObserver )
   TEST_EQUALITY_CONST( dispatcher->getNumberOfObservers(), 0 );  
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dispatch order does not depend on the attachment order
+TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcher, dispatch_order )
+{
+  MonteCarlo::ParticleCollidingInCellEventDispatcher dispatcher_a( 1 );
+
+  attachLoggingObserver<'b'>( dispatcher_a, 3u );
+  attachLoggingObserver<'a'>( dispatcher_a, 2u );
+  attachLoggingObserver<'a'>( dispatcher_a, 0u );
+  attachLoggingObserver<'b'>( dispatcher_a, 1u );
+
+  MonteCarlo::ParticleCollidingInCellEventDispatcher dispatcher_b( 1 );
+
+  attachLoggingObserver<'a'>( dispatcher_b, 0u );
+  attachLoggingObserver<'b'>( dispatcher_b, 1u );
+  attachLoggingObserver<'b'>( dispatcher_b, 3u );
+  attachLoggingObserver<'a'>( dispatcher_b, 2u );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setWeight( 1.0 );
+  particle.setEnergy( 1.0 );
+
+  update_log.clear();
+  
+  dispatcher_a.dispatchParticleCollidingInCellEvent( particle, 1, 1.0 );
+
+  Teuchos::Array<std::pair<char,unsigned> > update_log_a = update_log;
+
+  update_log.clear();
+
+  dispatcher_b.dispatchParticleCollidingInCellEvent( particle, 1, 1.0 );
+
+  TEST_EQUALITY_CONST( update_log_a.size(), 4 );
+  TEST_ASSERT( update_log_a == update_log );
+
+  // The observers are grouped by type and sorted by id within a group
+  TEST_EQUALITY( update_log[0].first, update_log[1].first );
+  TEST_EQUALITY( update_log[2].first, update_log[3].first );
+  TEST_INEQUALITY( update_log[1].first, update_log[2].first );
+  
+  for( unsigned i = 0; i < update_log.size(); i += 2 )
+  {
+    if( update_log[i].first == 'a' )
+    {
+      TEST_EQUALITY_CONST( update_log[i].second, 0u );
+      TEST_EQUALITY_CONST( update_log[i+1].second, 2u );
+    }
+    else
+    {
+      TEST_EQUALITY_CONST( update_log[i].second, 1u );
+      TEST_EQUALITY_CONST( update_log[i+1].second, 3u );
+    }
+  }
+
+  // Detaching an observer must not change the order of the others
+  dispatcher_a.detachObserver( 2u );
+  
+  update_log.clear();
+
+  dispatcher_a.dispatchParticleCollidingInCellEvent( particle, 1, 1.0 );
+
+  Teuchos::Array<std::pair<char,unsigned> > expected_update_log;
+
+  for( unsigned i = 0; i < update_log_a.size(); ++i )
+  {
+    if( update_log_a[i] != std::make_pair( 'a', 2u ) )
+      expected_update_log.push_back( update_log_a[i] );
+  }
+  
+  TEST_EQUALITY_CONST( update_log.size(), 3 );
+  TEST_ASSERT( update_log == expected_update_log );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an observer cannot be detached while an event is dispatched
+TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcher, 
+		   detachObserver_during_dispatch )
+{
+  MonteCarlo::ParticleCollidingInCellEventDispatcher local_dispatcher( 1 );
+
+  attachLoggingObserver<'a'>( local_dispatcher, 0u );
+
+  Teuchos::RCP<MonteCarlo::ParticleCollidingInCellEventObserver> observer(
+			    new DetachingObserver( local_dispatcher, 0u ) );
+
+  local_dispatcher.attachObserver( 1u, observer );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setWeight( 1.0 );
+  particle.setEnergy( 1.0 );
+
+  update_log.clear();
+  
+#if HAVE_FRENSIE_DBC
+  TEST_THROW( local_dispatcher.dispatchParticleCollidingInCellEvent( 
+							    particle, 1, 1.0 ),
+	      Utility::ContractException );
+
+  // The observers must not have changed
+  TEST_EQUALITY_CONST( local_dispatcher.getNumberOfObservers(), 2 );
+#endif
+
+  // Observers can be detached once the dispatch is complete
+  local_dispatcher.detachObserver( 1u );
+
+  TEST_EQUALITY_CONST( local_dispatcher.getNumberOfObservers(), 1 );
+
+  update_log.clear();
+  
+  local_dispatcher.dispatchParticleCollidingInCellEvent( particle, 1, 1.0 );
+
+  TEST_EQUALITY_CONST( update_log.size(), 1 );
+  TEST_EQUALITY_CONST( update_log[0].second, 0u );
+}
+
 //---------------------------------------------------------------------------//
 // end tstParticleCollidingInCellEventDispatcher.cpp
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <stdexcept>
 
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
@@ -29,6 +30,21 @@ Teuchos::RCP<MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier
 Teuchos::RCP<MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> >
     estimator_2;
 
+//---------------------------------------------------------------------------//
+// Testing Structs.
+//---------------------------------------------------------------------------//
+// An observer that is not an estimator (observes every particle type)
+class NullObserver : public MonteCarlo::ParticleCollidingInCellEventObserver
+{
+public:
+
+  void updateFromParticleCollidingInCellEvent(
+	    const MonteCarlo::ParticleState& particle,
+	    const Geometry::ModuleTraits::InternalCellHandle cell_of_collision,
+	    const double inverse_total_cross_section )
+  { /* ... */ }
+};
+
 //---------------------------------------------------------------------------//
 // Testing Functions.
 //---------------------------------------------------------------------------//
@@ -256,6 +272,82 @@ TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcherDB,
   TEST_EQUALITY_CONST( dispatcher->getNumberOfObservers(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the observed particle types are tracked
+TEUCHOS_UNIT_TEST( ParticleCollidingInCellEventDispatcherDB,
+		   isParticleTypeObserved )
+{
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::detachAllObservers();
+
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+
+  // The estimator only observes photons
+  Teuchos::RCP<MonteCarlo::ParticleCollidingInCellEventObserver> observer_1 =
+    Teuchos::rcp_dynamic_cast<MonteCarlo::ParticleCollidingInCellEventObserver>( 
+								 estimator_1 );
+
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::attachObserver(
+							  0,
+							  estimator_1->getId(),
+							  observer_1 );
+
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::ELECTRON ) );
+
+  // An observer that is not an estimator observes every particle type
+  Teuchos::RCP<MonteCarlo::ParticleCollidingInCellEventObserver> 
+    observer_2( new NullObserver );
+
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::attachObserver(
+							  1, 10u, observer_2 );
+
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::ELECTRON ) );
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::getDispatcher( 1 )->isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::getDispatcher( 0 )->isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+
+  // The mask must be updated when an observer is detached
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::detachObserver( 1, 10u );
+
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+  TEST_EQUALITY_CONST( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::getDispatcher( 1 )->getObservedParticleTypeMask(), 0u );
+
+  // The particle types of an attached estimator cannot be changed
+  Teuchos::Array<MonteCarlo::ParticleType> particle_types( 1 );
+  particle_types[0] = MonteCarlo::NEUTRON;
+
+  TEST_THROW( estimator_1->setParticleTypes( particle_types ),
+	      std::logic_error );
+  TEST_ASSERT( estimator_1->isAttachedToDispatcher() );
+
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::detachObserver( 
+						       estimator_1->getId() );
+
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !estimator_1->isAttachedToDispatcher() );
+
+  // The particle types can be changed once the estimator is detached
+  estimator_1->setParticleTypes( particle_types );
+
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::attachObserver(
+							  0,
+							  estimator_1->getId(),
+							  observer_1 );
+
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+
+  // Detaching all observers also releases the estimators
+  MonteCarlo::ParticleCollidingInCellEventDispatcherDB::detachAllObservers();
+
+  TEST_ASSERT( !MonteCarlo::ParticleCollidingInCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+  TEST_ASSERT( !estimator_1->isAttachedToDispatcher() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstParticleCollidingInCellEventDispatcher.cpp
 //---------------------------------------------------------------------------//
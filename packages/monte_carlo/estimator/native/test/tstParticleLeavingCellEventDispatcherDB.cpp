@@ -18,6 +18,7 @@
 #include "MonteCarlo_CellPulseHeightEstimator.hpp"
 #include "MonteCarlo_ParticleLeavingCellEventDispatcherDB.hpp"
 #include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
 #include "Geometry_ModuleTraits.hpp"
 
 //---------------------------------------------------------------------------//
@@ -156,6 +157,29 @@ TEUCHOS_UNIT_TEST( ParticleLeavingCellEventDispatcherDB,
   TEST_ASSERT( estimator_2->hasUncommittedHistoryContribution() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that events of unobserved particle types are skipped
+TEUCHOS_UNIT_TEST( ParticleLeavingCellEventDispatcherDB,
+		   isParticleTypeObserved )
+{
+  TEST_ASSERT( MonteCarlo::ParticleLeavingCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleLeavingCellEventDispatcherDB::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+
+  estimator_1->commitHistoryContribution();
+  estimator_2->commitHistoryContribution();
+
+  MonteCarlo::NeutronState particle( 0ull );
+  particle.setWeight( 1.0 );
+  particle.setEnergy( 1.0 );
+
+  MonteCarlo::ParticleLeavingCellEventDispatcherDB::dispatchParticleLeavingCellEvent(
+								      particle,
+								      0 );
+
+  TEST_ASSERT( !estimator_1->hasUncommittedHistoryContribution() );
+  TEST_ASSERT( !estimator_2->hasUncommittedHistoryContribution() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an observer can be detached from the dispatcher
 TEUCHOS_UNIT_TEST( ParticleLeavingCellEventDispatcherDB, 
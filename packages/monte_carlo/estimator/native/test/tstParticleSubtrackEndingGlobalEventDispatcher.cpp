@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <stdexcept>
 
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
@@ -30,6 +31,21 @@ estimator;
 
 std::string test_input_mesh_file_name;
 
+//---------------------------------------------------------------------------//
+// Testing Structs.
+//---------------------------------------------------------------------------//
+// An observer that is not an estimator (observes every particle type)
+class NullObserver : public MonteCarlo::ParticleSubtrackEndingGlobalEventObserver
+{
+public:
+
+  void updateFromGlobalParticleSubtrackEndingEvent(
+					const MonteCarlo::ParticleState& particle,
+					const double start_point[3],
+					const double end_point[3] )
+  { /* ... */ }
+};
+
 //---------------------------------------------------------------------------//
 // Testing Functions.
 //---------------------------------------------------------------------------//
@@ -141,6 +157,53 @@ TEUCHOS_UNIT_TEST( ParticleSubtrackEndingGlobalEventDispatcher,
   TEST_EQUALITY_CONST( MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::getNumberOfObservers(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the observed particle types are tracked
+TEUCHOS_UNIT_TEST( ParticleSubtrackEndingGlobalEventDispatcher, 
+		   isParticleTypeObserved )
+{
+  TEST_ASSERT( !MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  
+  // The estimator only observes photons
+  Teuchos::RCP<MonteCarlo::ParticleSubtrackEndingGlobalEventObserver> observer =
+    Teuchos::rcp_dynamic_cast<MonteCarlo::ParticleSubtrackEndingGlobalEventObserver>( estimator );
+
+  MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::attachObserver(  
+                                                      estimator->getId(),
+                                                      observer );
+
+  TEST_ASSERT( MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+
+  // An observer that is not an estimator observes every particle type
+  Teuchos::RCP<MonteCarlo::ParticleSubtrackEndingGlobalEventObserver> 
+    null_observer( new NullObserver );
+
+  MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::attachObserver(  
+                                                      10u, null_observer );
+
+  TEST_ASSERT( MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+  TEST_ASSERT( MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::ELECTRON ) );
+
+  // The mask must be updated when an observer is detached
+  MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::detachObserver( 10u );
+
+  TEST_ASSERT( MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::NEUTRON ) );
+
+  // The particle types of an attached estimator cannot be changed
+  Teuchos::Array<MonteCarlo::ParticleType> particle_types( 1 );
+  particle_types[0] = MonteCarlo::NEUTRON;
+
+  TEST_THROW( estimator->setParticleTypes( particle_types ),
+	      std::logic_error );
+  
+  MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::detachAllObservers();
+
+  TEST_ASSERT( !MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher::isParticleTypeObserved( MonteCarlo::PHOTON ) );
+  TEST_ASSERT( !estimator->isAttachedToDispatcher() );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
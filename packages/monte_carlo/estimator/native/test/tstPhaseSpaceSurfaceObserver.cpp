@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPhaseSpaceSurfaceObserver.cpp
+//! \author Luke Kersting
+//! \brief  Phase space surface observer unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// Trilinos Includes
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_RCP.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhaseSpaceSurfaceObserver.hpp"
+#include "MonteCarlo_PhaseSpaceFileReader.hpp"
+#include "MonteCarlo_ParticleCrossingSurfaceEventDispatcherDB.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the records of a history are written contiguously
+TEUCHOS_UNIT_TEST( PhaseSpaceSurfaceObserver,
+		   updateFromParticleCrossingSurfaceEvent )
+{
+  {
+    MonteCarlo::PhaseSpaceSurfaceObserver observer( "test_observer.psf", 2 );
+
+    MonteCarlo::PhotonState photon( 0ull );
+    photon.setEnergy( 1.0 );
+
+    observer.updateFromParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+    observer.updateFromParticleCrossingSurfaceEvent( photon, 2, 1.0 );
+    observer.updateFromParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+
+    // The buffer is full but the history has not changed
+    TEST_EQUALITY_CONST( observer.getNumberOfRecordsWritten(), 0ull );
+
+    MonteCarlo::NeutronState neutron( 1ull );
+    neutron.setEnergy( 2.0 );
+
+    observer.updateFromParticleCrossingSurfaceEvent( neutron, 2, 1.0 );
+
+    TEST_EQUALITY_CONST( observer.getNumberOfRecordsWritten(), 3ull );
+
+    observer.close();
+
+    TEST_EQUALITY_CONST( observer.getNumberOfRecordsWritten(), 4ull );
+  }
+
+  MonteCarlo::PhaseSpaceFileReader reader( "test_observer.psf" );
+
+  TEST_EQUALITY_CONST( reader.getNumberOfHistories(), 2ull );
+  TEST_EQUALITY_CONST( reader.getNumberOfHistoryRecords( 0 ), 3ull );
+  TEST_EQUALITY_CONST( reader.getNumberOfHistoryRecords( 1 ), 1ull );
+  TEST_EQUALITY_CONST( reader.getRecord( 1 ).surface_id, 2ull );
+  TEST_EQUALITY_CONST( reader.getRecord( 3 ).particle_type,
+		       MonteCarlo::NEUTRON );
+  TEST_EQUALITY_CONST( reader.getRecord( 3 ).energy, 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the observer can be attached to a dispatcher
+TEUCHOS_UNIT_TEST( PhaseSpaceSurfaceObserver, dispatch )
+{
+  {
+    Teuchos::RCP<MonteCarlo::ParticleCrossingSurfaceEventObserver>
+      observer( new MonteCarlo::PhaseSpaceSurfaceObserver(
+						     "test_dispatch.psf" ) );
+
+    MonteCarlo::ParticleCrossingSurfaceEventDispatcherDB::attachObserver(
+							       0, 0, observer );
+
+    MonteCarlo::PhotonState photon( 0ull );
+
+    Teuchos::RCP<MonteCarlo::ParticleCrossingSurfaceEventDispatcher>
+      dispatcher =
+      MonteCarlo::ParticleCrossingSurfaceEventDispatcherDB::getDispatcher( 0 );
+
+    dispatcher->dispatchParticleCrossingSurfaceEvent( photon, 0, 1.0 );
+
+    // No observer is attached to surface 1
+    dispatcher =
+      MonteCarlo::ParticleCrossingSurfaceEventDispatcherDB::getDispatcher( 1 );
+
+    dispatcher->dispatchParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+
+    MonteCarlo::ParticleCrossingSurfaceEventDispatcherDB::detachAllObservers();
+  }
+
+  MonteCarlo::PhaseSpaceFileReader reader( "test_dispatch.psf" );
+
+  TEST_EQUALITY_CONST( reader.getNumberOfRecords(), 1ull );
+  TEST_EQUALITY_CONST( reader.getRecord( 0 ).surface_id, 0ull );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPhaseSpaceSurfaceObserver.cpp
+//---------------------------------------------------------------------------//
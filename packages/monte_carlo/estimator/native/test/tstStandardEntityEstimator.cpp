@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
 
 // Trilinos Includes
 #include <Teuchos_UnitTestHarness.hpp>
@@ -1803,6 +1804,109 @@ TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( StandardEntityEstimator,
 
 UNIT_TEST_INSTANTIATION( StandardEntityEstimator, resetData );
 
+//---------------------------------------------------------------------------//
+// Check that the raw moments can be retrieved and restored
+TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( StandardEntityEstimator,
+				   getRawMoments,
+				   EntityId )
+{
+  Teuchos::RCP<TestStandardEntityEstimator<EntityId> > estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setEnergy( 1.0 );
+  particle.setTime( 2.0 );
+
+  estimator->addPartialHistoryContribution( 0, particle, 1.0, 1.0 );
+  estimator->addPartialHistoryContribution( 1, particle, 1.0, 2.0 );
+
+  estimator->commitHistoryContribution();
+
+  Teuchos::Array<double> raw_moments;
+
+  estimator->getRawMoments( raw_moments );
+
+  // 2 moments for 24 bins of the total and of 2 entities + 4 moments for
+  // the total of the estimator and of 2 entities
+  TEST_EQUALITY_CONST( raw_moments.size(), 156 );
+
+  // Restore the moments in a new estimator
+  Teuchos::RCP<TestStandardEntityEstimator<EntityId> > restored_estimator;
+  initializeStandardEntityEstimator( restored_estimator );
+
+  TEST_EQUALITY_CONST( restored_estimator->setRawMoments( raw_moments() ),
+		       156 );
+
+  Teuchos::Array<double> restored_raw_moments;
+
+  restored_estimator->getRawMoments( restored_raw_moments );
+
+  TEST_COMPARE_ARRAYS( raw_moments, restored_raw_moments );
+
+  // Too few moments
+  TEST_THROW( restored_estimator->setRawMoments( raw_moments( 0, 100 ) ),
+	      std::runtime_error );
+}
+
+UNIT_TEST_INSTANTIATION( StandardEntityEstimator, getRawMoments );
+
+//---------------------------------------------------------------------------//
+// Check that the max relative error of the total bins can be returned
+TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( StandardEntityEstimator,
+				   getMaxRelativeError,
+				   EntityId )
+{
+  Teuchos::RCP<TestStandardEntityEstimator<EntityId> > estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  MonteCarlo::Estimator::setNumberOfHistories( 2ull );
+
+  // No contributions
+  TEST_EQUALITY_CONST( estimator->getMaxRelativeError(), 1.0 );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setEnergy( 1.0 );
+  particle.setTime( 2.0 );
+
+  estimator->addPartialHistoryContribution( 0, particle, 1.0, 1.0 );
+  estimator->addPartialHistoryContribution( 1, particle, 1.0, 2.0 );
+
+  estimator->commitHistoryContribution();
+
+  // Only some of the bins have contributions
+  TEST_EQUALITY_CONST( estimator->getMaxRelativeError(), 1.0 );
+
+  // Give every bin a single unit contribution
+  Teuchos::Array<double> raw_moments;
+
+  estimator->getRawMoments( raw_moments );
+
+  std::fill( raw_moments.begin(), raw_moments.end(), 1.0 );
+
+  estimator->setRawMoments( raw_moments() );
+
+  // One history with contributions: sqrt(1 - 1/N)
+  TEST_FLOATING_EQUALITY( estimator->getMaxRelativeError(), 
+			  0.7071067811865476,
+			  1e-15 );
+
+  MonteCarlo::Estimator::setNumberOfHistories( 4ull );
+
+  TEST_FLOATING_EQUALITY( estimator->getMaxRelativeError(), 
+			  0.8660254037844386,
+			  1e-15 );
+
+  // Empty the first total bin (the total bin moments are stored first)
+  raw_moments[0] = 0.0;
+  raw_moments[1] = 0.0;
+
+  estimator->setRawMoments( raw_moments() );
+
+  TEST_EQUALITY_CONST( estimator->getMaxRelativeError(), 1.0 );
+}
+
+UNIT_TEST_INSTANTIATION( StandardEntityEstimator, getMaxRelativeError );
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
@@ -64,11 +64,35 @@ public:
   // Signal handler
   void signalHandler(int signal);
 
+protected:
+
+  //! Return the range of cycle histories simulated by this process
+  void getCycleHistoryRange( unsigned long long& cycle_start_history,
+                             unsigned long long& cycle_end_history ) const;
+
+  //! Return the number of fission sites produced by every process
+  unsigned long long getTotalNumberOfFissionSites( 
+                                          const ParticleBank& fission_sites );
+
+  //! Collect the fission sites produced by every process on the root
+  bool collectFissionSites( ParticleBank& fission_sites );
+
+  //! Distribute the source sites from the root to every process
+  void distributeSourceSites( ParticleBank& source_sites );
+
+  //! Check if any process has requested an end to the simulation
+  bool isSimulationEndRequested();
+
 private:
 
   // Coordinate workers (master only)
   void coordinateWorkers();
 
+  // Check if the wall time limit has been reached
+  bool isWallTimeLimitReached( 
+			 const Teuchos::MpiComm<unsigned long long>& mpi_comm,
+			 const unsigned batches_assigned ) const;
+
   // Tell workers to stop working
   void stopWorkersAndRecordWork( 
 		        const Teuchos::MpiComm<unsigned long long>& mpi_comm );
@@ -88,6 +112,17 @@ private:
   // Complete work for the master
   void work();  
 
+  // Send a particle bank to another process
+  void sendParticleBank( const Teuchos::MpiComm<unsigned long long>& mpi_comm,
+			 const ParticleBank& bank,
+			 const int destination_process ) const;
+
+  // Receive a particle bank from another process
+  void receiveParticleBank( 
+			 const Teuchos::MpiComm<unsigned long long>& mpi_comm,
+			 ParticleBank& bank,
+			 const int source_process ) const;
+
   // The mpi communicator
   Teuchos::RCP<const Teuchos::Comm<unsigned long long> > d_comm;
 
@@ -9,6 +9,14 @@
 #ifndef FACEMC_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 #define FACEMC_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
+// Std Lib Includes
+#include <sstream>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+
 // Trilinos Includes
 #include <Teuchos_GlobalMPISession.hpp>
 #include <Teuchos_Tuple.hpp>
@@ -18,6 +26,8 @@
 #endif
 
 // FRENSIE Includes
+#include "MonteCarlo_SimulationNeutronProperties.hpp"
+#include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "Utility_ContractException.hpp"
 #include "FRENSIE_mpi_config.hpp"
 
@@ -72,6 +82,10 @@ void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,E
   EMI::enableThreadSupport( 
 		 Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() );
 
+  // Set up the performance counters for the number of threads requested
+  PerformanceCounters::initialize(
+		 Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() );
+
   d_comm->barrier();
 
   if( d_comm->getRank() == d_root_process )
@@ -85,7 +99,26 @@ void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,E
   // Set the start time
   this->setStartTime( ::MPI_Wtime() );
 
-  if( d_comm->getRank() == d_root_process )
+  // Every process simulates its share of each criticality cycle
+  if( SimulationNeutronProperties::isCriticalityModeOn() )
+  {
+    this->runCriticalitySimulation();
+
+    // Record the histories completed by every process
+    unsigned long long histories_completed = 
+      this->getNumberOfHistoriesCompleted();
+
+    unsigned long long total_histories_completed;
+
+    Teuchos::reduceAll( *d_comm,
+			Teuchos::REDUCE_SUM,
+			histories_completed,
+			Teuchos::outArg( total_histories_completed ) );
+
+    this->setHistoriesCompleted( d_initial_histories_completed + 
+				 total_histories_completed );
+  }
+  else if( d_comm->getRank() == d_root_process )
     this->coordinateWorkers();
   else
     this->work();
@@ -93,6 +126,9 @@ void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,E
   // Perform a reduction of the estimator data on the root process
   EMI::reduceEstimatorData( d_comm, d_root_process );
 
+  // Sum the performance counters of every process
+  PerformanceCounters::reduceData( d_comm );
+
   // Set the end time
   this->setEndTime( ::MPI_Wtime() );
 
@@ -154,6 +190,16 @@ void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,E
 
       break;
     }
+    // Wall time limit reached - tell workers to stop
+    else if( this->isWallTimeLimitReached( *mpi_comm, batch_number ) )
+    {
+      std::cout << "wall time limit reached ... ";
+      std::cout.flush();
+      
+      this->stopWorkersAndRecordWork( *mpi_comm );
+
+      break;
+    }
     // Check for an idle worker to assign the next batch to
     else if( this->isIdleWorkerPresent( *mpi_comm, idle_worker_info ) )
     {  
@@ -179,6 +225,44 @@ void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,E
 #endif // end HAVE_FRENSIE_MPI
 }
 
+// Check if the wall time limit has been reached (master only)
+/*! \details The wall time limit has been reached if a new batch (assumed to
+ * take as long as the average batch assigned so far) would not finish 
+ * before the limit. Only the root process checks the limit so the decision
+ * to stop is made globally.
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::isWallTimeLimitReached(
+			 const Teuchos::MpiComm<unsigned long long>& mpi_comm,
+			 const unsigned batches_assigned ) const
+{
+#ifdef HAVE_FRENSIE_MPI
+  // Make sure the root process is calling this function
+  testPrecondition( mpi_comm.getRank() == d_root_process );
+  
+  if( !SimulationGeneralProperties::isWallTimeLimitOn() || 
+      batches_assigned == 0u )
+    return false;
+
+  const double elapsed_time = ::MPI_Wtime() - this->getStartTime();
+
+  // Only the workers simulate batches
+  const unsigned number_of_workers = 
+    std::max( mpi_comm.getSize() - 1, 1 );
+    
+  const double average_batch_time = 
+    elapsed_time*number_of_workers/batches_assigned;
+
+  return elapsed_time + average_batch_time > 
+    SimulationGeneralProperties::getWallTimeLimit();
+#else
+  return false;
+#endif // end HAVE_FRENSIE_MPI
+}
+
 // Tell workers to stop working
 template<typename GeometryHandler, 
 	 typename SourceHandler,
@@ -471,6 +555,326 @@ void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,E
 #endif // end HAVE_FRENSIE_MPI
 }
 
+// Return the range of cycle histories simulated by this process
+/*! \details The histories in a cycle are divided evenly (and contiguously)
+ * between the processes in the order of their ranks.
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::getCycleHistoryRange(
+			       unsigned long long& cycle_start_history,
+			       unsigned long long& cycle_end_history ) const
+{
+  const unsigned long long number_of_histories = 
+    this->getNumberOfHistories();
+
+  const unsigned long long rank = d_comm->getRank();
+  const unsigned long long size = d_comm->getSize();
+
+  cycle_start_history = (number_of_histories*rank)/size;
+  cycle_end_history = (number_of_histories*(rank+1))/size;
+}
+
+// Return the number of fission sites produced by every process
+/*! \details The fission site counts of every process are reduced so that
+ * every process can detect a cycle without any fission sites (and fail 
+ * together instead of waiting on the fission site collection). This must be
+ * called by every process (it is a collective operation).
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+unsigned long long BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::getTotalNumberOfFissionSites(
+					   const ParticleBank& fission_sites )
+{
+  const unsigned long long local_fission_sites = fission_sites.size();
+
+#ifdef HAVE_FRENSIE_MPI
+  // Make sure the global MPI session has been initialized
+  testPrecondition( Teuchos::GlobalMPISession::mpiIsInitialized() );
+  testPrecondition( !Teuchos::GlobalMPISession::mpiIsFinalized() );
+
+  unsigned long long global_fission_sites;
+
+  Teuchos::reduceAll( *d_comm,
+		      Teuchos::REDUCE_SUM,
+		      local_fission_sites,
+		      Teuchos::outArg( global_fission_sites ) );
+
+  return global_fission_sites;
+#else
+  return local_fission_sites;
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Collect the fission sites produced by every process on the root
+/*! \details The fission sites of each worker are sent to the root process
+ * and merged with the root process fission sites (in rank order). Since the
+ * fission sites of every process are sorted by history number, the merged
+ * fission sites will not depend on the number of processes. True will only
+ * be returned on the root process.
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::collectFissionSites(
+						 ParticleBank& fission_sites )
+{
+#ifdef HAVE_FRENSIE_MPI
+  // Make sure the global MPI session has been initialized
+  testPrecondition( Teuchos::GlobalMPISession::mpiIsInitialized() );
+  testPrecondition( !Teuchos::GlobalMPISession::mpiIsFinalized() );
+
+  Teuchos::RCP<const Teuchos::MpiComm<unsigned long long> > mpi_comm = 
+    Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<unsigned long long> >( 
+								      d_comm );
+
+  if( mpi_comm->getRank() == d_root_process )
+  {
+    for( int i = 0; i < mpi_comm->getSize(); ++i )
+    {
+      if( i != d_root_process )
+      {
+	ParticleBank worker_fission_sites;
+
+	this->receiveParticleBank( *mpi_comm, worker_fission_sites, i );
+
+	fission_sites.merge( worker_fission_sites,
+			     ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::compareHistoryNumbers );
+      }
+    }
+
+    return true;
+  }
+  else
+  {
+    this->sendParticleBank( *mpi_comm, fission_sites, d_root_process );
+
+    return false;
+  }
+#else
+  return true;
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Distribute the source sites from the root to every process
+/*! \details The source sites on the root process are divided between the
+ * processes according to their cycle history ranges. On exit, every process 
+ * will only hold the source sites of its own cycle histories.
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::distributeSourceSites(
+						  ParticleBank& source_sites )
+{
+#ifdef HAVE_FRENSIE_MPI
+  // Make sure the global MPI session has been initialized
+  testPrecondition( Teuchos::GlobalMPISession::mpiIsInitialized() );
+  testPrecondition( !Teuchos::GlobalMPISession::mpiIsFinalized() );
+
+  Teuchos::RCP<const Teuchos::MpiComm<unsigned long long> > mpi_comm = 
+    Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<unsigned long long> >( 
+								      d_comm );
+
+  if( mpi_comm->getRank() == d_root_process )
+  {
+    // Make sure there is a source site for every history
+    testPrecondition( source_sites.size() == this->getNumberOfHistories() );
+
+    const unsigned long long number_of_histories = 
+      this->getNumberOfHistories();
+    
+    const unsigned long long size = mpi_comm->getSize();
+    
+    // The source sites of the root process
+    ParticleBank root_source_sites;
+    
+    for( int i = 0; i < mpi_comm->getSize(); ++i )
+    {
+      ParticleBank process_source_sites;
+
+      const unsigned long long rank = i;
+      
+      const unsigned long long number_of_process_sites = 
+	(number_of_histories*(rank+1))/size - (number_of_histories*rank)/size;
+
+      for( unsigned long long j = 0; j < number_of_process_sites; ++j )
+      {
+	process_source_sites.push( source_sites.top() );
+
+	source_sites.pop();
+      }
+
+      if( i == d_root_process )
+	root_source_sites.splice( process_source_sites );
+      else
+	this->sendParticleBank( *mpi_comm, process_source_sites, i );
+    }
+
+    source_sites.splice( root_source_sites );
+  }
+  else
+    this->receiveParticleBank( *mpi_comm, source_sites, d_root_process );
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Check if any process has requested an end to the simulation
+/*! \details The end simulation flag of every process is reduced so that
+ * every process makes the same decision. This must be called by every 
+ * process (it is a collective operation).
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::isSimulationEndRequested()
+{
+  unsigned long long local_end_simulation = 
+    ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::isSimulationEndRequested() ? 1ull : 0ull;
+  
+#ifdef HAVE_FRENSIE_MPI
+  // Make sure the global MPI session has been initialized
+  testPrecondition( Teuchos::GlobalMPISession::mpiIsInitialized() );
+  testPrecondition( !Teuchos::GlobalMPISession::mpiIsFinalized() );
+
+  unsigned long long global_end_simulation;
+
+  Teuchos::reduceAll( *d_comm,
+		      Teuchos::REDUCE_MAX,
+		      local_end_simulation,
+		      Teuchos::outArg( global_end_simulation ) );
+
+  return global_end_simulation > 0ull;
+#else
+  return local_end_simulation > 0ull;
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Send a particle bank to another process
+/*! \details The bank is packed with a binary archive. The size of the 
+ * packed bank is sent before the packed bank.
+ */
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::sendParticleBank(
+			  const Teuchos::MpiComm<unsigned long long>& mpi_comm,
+			  const ParticleBank& bank,
+			  const int destination_process ) const
+{
+#ifdef HAVE_FRENSIE_MPI
+  // Pack the bank
+  std::ostringstream oss;
+
+  {
+    boost::archive::binary_oarchive ar( oss );
+    
+    ar << BOOST_SERIALIZATION_NVP( bank );
+  }
+
+  std::string packed_bank = oss.str();
+
+  unsigned long long packed_bank_size = packed_bank.size();
+
+  // Send the size of the packed bank
+  int return_value = ::MPI_Send( &packed_bank_size,
+				 1,
+				 MPI_UNSIGNED_LONG_LONG,
+				 destination_process,
+				 mpi_comm.getTag(),
+				 *mpi_comm.getRawMpiComm() );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+		      std::runtime_error,
+		      "Error: process " << mpi_comm.getRank() << 
+		      " unable to send the particle bank size to process "
+		      << destination_process << "! "
+		      "MPI_Send failed with the following error: "
+		      << Teuchos::mpiErrorCodeToString( return_value ) );
+
+  // Send the packed bank
+  return_value = ::MPI_Send( &packed_bank[0],
+			     packed_bank_size,
+			     MPI_CHAR,
+			     destination_process,
+			     mpi_comm.getTag(),
+			     *mpi_comm.getRawMpiComm() );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+		      std::runtime_error,
+		      "Error: process " << mpi_comm.getRank() << 
+		      " unable to send the particle bank to process "
+		      << destination_process << "! "
+		      "MPI_Send failed with the following error: "
+		      << Teuchos::mpiErrorCodeToString( return_value ) );
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Receive a particle bank from another process
+template<typename GeometryHandler, 
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void BatchedDistributedParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::receiveParticleBank(
+			  const Teuchos::MpiComm<unsigned long long>& mpi_comm,
+			  ParticleBank& bank,
+			  const int source_process ) const
+{
+#ifdef HAVE_FRENSIE_MPI
+  unsigned long long packed_bank_size;
+  
+  // Receive the size of the packed bank
+  int return_value = ::MPI_Recv( &packed_bank_size,
+				 1,
+				 MPI_UNSIGNED_LONG_LONG,
+				 source_process,
+				 mpi_comm.getTag(),
+				 *mpi_comm.getRawMpiComm(),
+				 MPI_STATUS_IGNORE );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+		      std::runtime_error,
+		      "Error: process " << mpi_comm.getRank() << 
+		      " unable to receive the particle bank size from process "
+		      << source_process << "! "
+		      "MPI_Recv failed with the following error: "
+		      << Teuchos::mpiErrorCodeToString( return_value ) );
+
+  std::string packed_bank( packed_bank_size, '\0' );
+
+  // Receive the packed bank
+  return_value = ::MPI_Recv( &packed_bank[0],
+			     packed_bank_size,
+			     MPI_CHAR,
+			     source_process,
+			     mpi_comm.getTag(),
+			     *mpi_comm.getRawMpiComm(),
+			     MPI_STATUS_IGNORE );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+		      std::runtime_error,
+		      "Error: process " << mpi_comm.getRank() << 
+		      " unable to receive the particle bank from process "
+		      << source_process << "! "
+		      "MPI_Recv failed with the following error: "
+		      << Teuchos::mpiErrorCodeToString( return_value ) );
+
+  // Unpack the bank
+  std::istringstream iss( packed_bank );
+
+  boost::archive::binary_iarchive ar( iss );
+
+  ar >> boost::serialization::make_nvp( "bank", bank );
+#endif // end HAVE_FRENSIE_MPI
+}
+
 // Print the data in all estimators to the desired stream
 template<typename GeometryHandler, 
 	 typename SourceHandler,
@@ -14,6 +14,8 @@
 
 // Trilinos Includes
 #include <Teuchos_ParameterList.hpp>
+#include <Teuchos_Array.hpp>
+#include <Teuchos_RCP.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_SourceModuleInterface.hpp"
@@ -21,7 +23,11 @@
 #include "MonteCarlo_CollisionModuleInterface.hpp"
 #include "MonteCarlo_ParticleState.hpp"
 #include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_ParticleEventBank.hpp"
 #include "MonteCarlo_SimulationManager.hpp"
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_SimulationCheckpoint.hpp"
+#include "MonteCarlo_PerformanceCounters.hpp"
 #include "Geometry_ModuleInterface.hpp"
 
 namespace MonteCarlo{
@@ -73,12 +79,68 @@ public:
   // Signal handler
   virtual void signalHandler(int signal);
 
+  //! Set the weight windows (a null pointer turns weight windows off)
+  void setWeightWindows( 
+		const Teuchos::RCP<const WeightWindowMesh>& weight_windows );
+
+  //! Simulate an individual particle (the particle cell must be set)
+  template<typename ParticleStateType>
+  void simulateParticle( ParticleStateType& particle,
+                         ParticleBank& particle_bank ) const;
+
 protected:
 
   //! Run the simulation batch
   void runSimulationBatch( const unsigned long long start_history, 
 			   const unsigned long long end_history );
 
+  //! Run the simulation batch using event-based transport
+  void runEventBasedSimulationBatch( const unsigned long long start_history,
+                                     const unsigned long long end_history );
+
+  //! Run the simulation batch in sub-batches (checkpoints and termination)
+  void runSimulationSubBatches( const unsigned long long start_history,
+                                const unsigned long long end_history );
+
+  //! Check if a termination criterion has been met (at a batch boundary)
+  bool isTerminationCriterionMet( const double current_time,
+                                  const double batch_time ) const;
+
+  //! Restart the simulation from the restart file
+  unsigned long long restartSimulation();
+
+  //! Run the criticality (k-eigenvalue) simulation
+  void runCriticalitySimulation();
+
+  //! Run a criticality cycle
+  void runCriticalityCycle( const unsigned cycle,
+                            const unsigned long long cycle_start_history,
+                            const unsigned long long cycle_end_history,
+                            ParticleBank& source_sites,
+                            ParticleBank& fission_sites );
+
+  //! Return the range of cycle histories simulated by this process
+  virtual void getCycleHistoryRange( 
+                           unsigned long long& cycle_start_history,
+                           unsigned long long& cycle_end_history ) const;
+
+  //! Return the number of fission sites produced by every process
+  virtual unsigned long long getTotalNumberOfFissionSites( 
+                                      const ParticleBank& fission_sites );
+
+  //! Collect the fission sites produced by every process
+  virtual bool collectFissionSites( ParticleBank& fission_sites );
+
+  //! Distribute the source sites to every process
+  virtual void distributeSourceSites( ParticleBank& source_sites );
+
+  //! Check if an end to the simulation has been requested
+  virtual bool isSimulationEndRequested();
+
+  //! Compare the history numbers of two particle states
+  static bool compareHistoryNumbers( const ParticleState& state_a,
+                                     const ParticleState& state_b );
+
   //! Return the number of histories
   unsigned long long getNumberOfHistories() const;
 
@@ -92,6 +154,9 @@ protected:
 
   //! Set the start time
   void setStartTime( const double start_time );
+
+  //! Return the start time
+  double getStartTime() const;
   
   //! Set the end time
   void setEndTime( const double end_time );
@@ -101,16 +166,83 @@ protected:
 
 private:
 
-  // Simulate an individual particle
+  // Simulate the source particles in the bank (and all of their progeny)
+  void simulateHistory( ParticleBank& bank );
+
+  // Simulate a batch of histories together (one event at a time)
+  void simulateEventBatch( ParticleEventBank& event_bank,
+                           ParticleBank& bank,
+                           const unsigned long long start_history,
+                           const unsigned long long end_history );
+
+  // Transport the particles in the event bank until it is empty
   template<typename ParticleStateType>
-  void simulateParticle( ParticleStateType& particle,
-                         ParticleBank& particle_bank ) const;
+  void transportEventBank( ParticleEventBank& event_bank,
+                           ParticleBank& bank );
+
+  // Sample the optical path and look up the cross section of every particle
+  template<typename ParticleStateType>
+  void processCrossSectionLookupEvents( ParticleEventBank& event_bank ) const;
+
+  // Advance every particle to its next collision site
+  template<typename ParticleStateType>
+  void processAdvanceEvents( ParticleEventBank& event_bank,
+                             ParticleBank& bank ) const;
+
+  // Collide every particle that has reached its collision site
+  template<typename ParticleStateType>
+  void processCollisionEvents( ParticleEventBank& event_bank,
+                               ParticleBank& bank ) const;
+
+  // Move the particles in the bank to the event bank
+  void flushParticleBank( ParticleBank& bank,
+                          ParticleEventBank& event_bank,
+                          const unsigned history ) const;
+
+  // Replay the recorded estimator events of every completed history
+  template<typename ParticleStateType>
+  void commitCompletedHistories( ParticleEventBank& event_bank );
+
+  // Calculate the multiplication factor of a cycle
+  double calculateCycleMultiplicationFactor( 
+                                      const double total_fission_weight ) const;
+
+  // Sample the next cycle source sites from the fission sites
+  void sampleSourceSites( ParticleBank& fission_sites,
+                          ParticleBank& source_sites,
+                          double& total_fission_weight ) const;
+
+  // Print the multiplication factor of a cycle
+  void printCycleSummary( const unsigned cycle,
+                          const double cycle_multiplication_factor ) const;
+
+  // Simulate an individual electron using the condensed history method
+  void simulateElectronCondensedHistory( ElectronState& electron,
+                                         ParticleBank& particle_bank ) const;
+
+  // Simulate an individual electron using thick-target bremsstrahlung
+  void simulateElectronThickTargetBremsstrahlung( 
+                                          ElectronState& electron,
+                                          ParticleBank& particle_bank ) const;
+
+  // Sample a multiple scattering angle cosine with the desired mean
+  static double sampleMultipleScatteringAngleCosine( 
+                                              const double mean_angle_cosine );
+
+  // Play Russian roulette with a particle that is below the weight cutoff
+  static void playWeightRoulette( ParticleState& particle );
 
   // Dummy function for ignoring a particle
   template<typename ParticleStateType>
   void ignoreParticle( ParticleStateType& particle,
 		       ParticleBank& particle_bank ) const;
 
+  // The weight windows (null if weight windows are off)
+  Teuchos::RCP<const WeightWindowMesh> d_weight_windows;
+
+  // The simulation checkpoint (completed history ranges)
+  SimulationCheckpoint d_checkpoint;
+
   // Starting history
   unsigned long long d_start_history;
   
@@ -123,6 +255,12 @@ private:
   // Flag for ending simulation early
   bool d_end_simulation;
 
+  // Flag for using event-based transport
+  bool d_event_based_transport;
+
+  // The particle type simulated with event-based transport
+  ParticleType d_event_particle_type;
+
   // The previous run time
   double d_previous_run_time;
 
@@ -132,6 +270,9 @@ private:
   // The simulation end time
   double d_end_time;
 
+  // The multiplication factor of every active criticality cycle
+  Teuchos::Array<double> d_cycle_multiplication_factors;
+
   // The neutron simulation function
   boost::function<void (NeutronState&, ParticleBank&)> d_simulate_neutron;
 
@@ -156,6 +297,7 @@ private:
     std::cout << " Direction: " << particle.getXDirection() << " ";	\
     std::cout << particle.getYDirection() << " ";			\
     std::cout << particle.getZDirection() << std::endl;			\
+    INCREMENT_PERFORMANCE_COUNTER( LOST_PARTICLES, 1ull );		\
     particle.setAsLost();						\
     break;								\
     }
@@ -174,6 +316,7 @@ private:
     std::cout << " Direction: " << bank.top().getXDirection() << " ";	\
     std::cout << bank.top().getYDirection() << " ";			\
     std::cout << bank.top().getZDirection() << std::endl;		\
+    INCREMENT_PERFORMANCE_COUNTER( LOST_PARTICLES, 1ull );		\
     bank.pop();								\
     continue;								\
   }
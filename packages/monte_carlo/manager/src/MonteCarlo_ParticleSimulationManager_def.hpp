@@ -9,11 +9,19 @@
 #ifndef FACEMC_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 #define FACEMC_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
+// Std Lib Includes
+#include <limits>
+#include <cmath>
+#include <memory>
+#include <algorithm>
+
 // Boost Includes
 #include <boost/bind.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_FissionBank.hpp"
+#include "MonteCarlo_ParticleStateFactory.hpp"
 #include "MonteCarlo_SourceModuleInterface.hpp"
 #include "MonteCarlo_EstimatorModuleInterface.hpp"
 #include "MonteCarlo_CollisionModuleInterface.hpp"
@@ -21,11 +29,14 @@
 #include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "MonteCarlo_SimulationElectronProperties.hpp"
 #include "MonteCarlo_SimulationPhotonProperties.hpp"
+#include "MonteCarlo_AsynchronousCheckpointWriter.hpp"
 #include "Geometry_ModuleInterface.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_ContractException.hpp"
 #include "Utility_GlobalOpenMPSession.hpp"
 #include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_ElectronCondensedHistoryHelpers.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_NeutronState.hpp"
 
@@ -49,13 +60,18 @@ ParticleSimulationManager<GeometryHandler,
 		       const unsigned long long start_history,
 		       const unsigned long long previously_completed_histories,
 		       const double previous_run_time )
-  : d_start_history( start_history ),
+  : d_weight_windows(),
+    d_checkpoint(),
+    d_start_history( start_history ),
     d_history_number_wall( start_history + number_of_histories ),
     d_histories_completed( previously_completed_histories ),
     d_end_simulation( false ),
+    d_event_based_transport( false ),
+    d_event_particle_type( NEUTRON ),
     d_previous_run_time( previous_run_time ),
     d_start_time( 0.0 ),
-    d_end_time( 0.0 )
+    d_end_time( 0.0 ),
+    d_cycle_multiplication_factors()
 {
   // At least one history must be simulated
   testPrecondition( number_of_histories > 0 );
@@ -91,18 +107,38 @@ ParticleSimulationManager<GeometryHandler,
 					    boost::cref( *this ),
 					    _1,
 					    _2 );
-    d_simulate_electron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::ignoreParticle<ElectronState>,
-					    boost::cref( *this ),
-					    _1,
-					    _2 );
+    if( SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() )
+    {
+      d_simulate_electron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::simulateElectronThickTargetBremsstrahlung,
+					       boost::cref( *this ),
+					       _1,
+					       _2 );
+    }
+    else
+    {
+      d_simulate_electron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::ignoreParticle<ElectronState>,
+					       boost::cref( *this ),
+					       _1,
+					       _2 );
+    }
     break;
   }
   case ELECTRON_MODE:
   {
-    d_simulate_electron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::simulateParticle<ElectronState>,
-					     boost::cref( *this ),
-					     _1,
-					     _2 );
+    if( SimulationElectronProperties::isCondensedHistoryModeOn() )
+    {
+      d_simulate_electron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::simulateElectronCondensedHistory,
+					       boost::cref( *this ),
+					       _1,
+					       _2 );
+    }
+    else
+    {
+      d_simulate_electron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::simulateParticle<ElectronState>,
+					       boost::cref( *this ),
+					       _1,
+					       _2 );
+    }
     d_simulate_neutron = boost::bind<void>( &ParticleSimulationManager<GeometryHandler,SourceHandler,EstimatorHandler,CollisionHandler>::ignoreParticle<NeutronState>,
 					    boost::cref( *this ),
 					    _1,
@@ -118,6 +154,51 @@ ParticleSimulationManager<GeometryHandler,
 		     "Error: particle mode " << mode << " is not currently "
 		     << "supported by the particle simulation manager." );
   }
+
+  // Event-based transport only supports a single particle type
+  if( SimulationGeneralProperties::isEventBasedTransportModeOn() )
+  {
+    if( mode == NEUTRON_MODE &&
+        !SimulationNeutronProperties::isCriticalityModeOn() )
+    {
+      d_event_based_transport = true;
+      d_event_particle_type = NEUTRON;
+    }
+    else if( mode == PHOTON_MODE &&
+             !SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() )
+    {
+      d_event_based_transport = true;
+      d_event_particle_type = PHOTON;
+    }
+    else if( SimulationGeneralProperties::displayWarnings() )
+    {
+      std::cerr << "Warning: event-based transport is only supported in "
+                << "neutron mode (fixed source) and photon mode (without "
+                << "thick-target bremsstrahlung). History-based transport "
+                << "will be used." << std::endl;
+    }
+  }
+
+  // Load the weight windows
+  if( SimulationGeneralProperties::isWeightWindowModeOn() )
+  {
+    d_weight_windows = WeightWindowMesh::createFromHDF5File( 
+			  SimulationGeneralProperties::getWeightWindowFile() );
+  }
+}
+
+// Set the weight windows (a null pointer turns weight windows off)
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::setWeightWindows( 
+		  const Teuchos::RCP<const WeightWindowMesh>& weight_windows )
+{
+  d_weight_windows = weight_windows;
 }
 
 // Run the simulation set up by the user
@@ -143,12 +224,33 @@ void ParticleSimulationManager<GeometryHandler,
   // Enable estimator thread support
   EMI::enableThreadSupport( 
 		 Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() );
+
+  // Set up the performance counters for the number of threads requested
+  PerformanceCounters::initialize(
+		 Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() );
   
   // Set the start time
   this->setStartTime( Utility::GlobalOpenMPSession::getTime() );
 
-  // Simulate the batch
-  this->runSimulationBatch( d_start_history, d_history_number_wall );
+  // Simulate the batch (or the criticality cycles)
+  if( SimulationNeutronProperties::isCriticalityModeOn() )
+    this->runCriticalitySimulation();
+  else
+  {
+    unsigned long long start_history = d_start_history;
+    
+    if( SimulationGeneralProperties::isRestartModeOn() )
+      start_history = this->restartSimulation();
+    
+    if( SimulationGeneralProperties::isCheckpointModeOn() ||
+        SimulationGeneralProperties::isWallTimeLimitOn() ||
+        SimulationGeneralProperties::isConvergenceTerminationOn() )
+    {
+      this->runSimulationSubBatches( start_history, d_history_number_wall );
+    }
+    else
+      this->runSimulationBatch( start_history, d_history_number_wall );
+  }
     
   // Set the end time
   this->setEndTime( Utility::GlobalOpenMPSession::getTime() );
@@ -172,6 +274,14 @@ void ParticleSimulationManager<GeometryHandler,
   testPrecondition( batch_start_history <= batch_end_history );
   testPrecondition( batch_start_history >= d_start_history );
   testPrecondition( batch_end_history <= d_history_number_wall );
+
+  if( d_event_based_transport )
+  {
+    this->runEventBasedSimulationBatch( batch_start_history, 
+                                        batch_end_history );
+
+    return;
+  }
   
   #pragma omp parallel num_threads( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
   { 
@@ -189,62 +299,1407 @@ void ParticleSimulationManager<GeometryHandler,
 	Utility::RandomNumberGenerator::initialize( history );
 	
 	// Sample a particle state from the source
-	SMI::sampleParticleState( bank, history );
-	
-	// Determine the starting cell of the particle
-	for( unsigned i = 0; i < bank.size(); ++i )
 	{
-	  typename GMI::InternalCellHandle start_cell;
+	  START_PERFORMANCE_TIMER( SOURCE_TIME );
 	  
-	  try{
-	    start_cell = GMI::findCellContainingPoint( bank.top().ray() );
-	  }
-	  CATCH_LOST_SOURCE_PARTICLE_AND_CONTINUE( bank );
-	  
-	  bank.top().setCell( start_cell );
-	  
-	  EMI::updateEstimatorsFromParticleGenerationEvent( bank.top() );
+	  SMI::sampleParticleState( bank, history );
+
+	  STOP_PERFORMANCE_TIMER( SOURCE_TIME );
 	}
+
+	// Simulate the source particle and all of its progeny
+	this->simulateHistory( bank );
 	
-	// This history only ends when the particle bank is empty
-	while( bank.size() > 0 )
+	// Commit all estimator history contributions
 	{
-	  switch( bank.top().getParticleType() )
-	  {
-	  case NEUTRON: 
-	    d_simulate_neutron( dynamic_cast<NeutronState&>( bank.top() ),
-				bank );
-	    break;
-	  case PHOTON:
-	    d_simulate_photon( dynamic_cast<PhotonState&>( bank.top() ),
-			       bank );
-	    break;
-	  case ELECTRON:
-	    d_simulate_electron( dynamic_cast<ElectronState&>( bank.top() ),
-	    			 bank );
-	    break;
-	  default:
-	    THROW_EXCEPTION( std::logic_error,
-			     "Error: particle type "
-			     << bank.top().getParticleType() <<
-			     " is not currently supported!" );
-	  }
+	  START_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	  
+	  EMI::commitEstimatorHistoryContributions();
+
+	  STOP_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	}
+        
+	// Increment the number of histories completed
+        #pragma omp atomic
+	++d_histories_completed;
+      }
+    }
+  }
+}
+
+// Simulate the source particles in the bank (and all of their progeny)
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::simulateHistory( 
+                                                          ParticleBank& bank )
+{
+  // Determine the starting cell of the particle
+  for( unsigned i = 0; i < bank.size(); ++i )
+  {
+    typename GMI::InternalCellHandle start_cell;
+    
+    try{
+      start_cell = GMI::findCellContainingPoint( bank.top().ray() );
+    }
+    CATCH_LOST_SOURCE_PARTICLE_AND_CONTINUE( bank );
+    
+    bank.top().setCell( start_cell );
+    
+    EMI::updateEstimatorsFromParticleGenerationEvent( bank.top() );
+  }
+  
+  // This history only ends when the particle bank is empty
+  while( bank.size() > 0 )
+  {
+    switch( bank.top().getParticleType() )
+    {
+    case NEUTRON: 
+      d_simulate_neutron( dynamic_cast<NeutronState&>( bank.top() ),
+                          bank );
+      break;
+    case PHOTON:
+      d_simulate_photon( dynamic_cast<PhotonState&>( bank.top() ),
+                         bank );
+      break;
+    case ELECTRON:
+      d_simulate_electron( dynamic_cast<ElectronState&>( bank.top() ),
+                           bank );
+      break;
+    default:
+      THROW_EXCEPTION( std::logic_error,
+                       "Error: particle type "
+                       << bank.top().getParticleType() <<
+                       " is not currently supported!" );
+    }
+
+    bank.pop();
+  }
+}
+
+// Run the simulation batch using event-based transport
+/*! \details The batch is divided into event batches (see 
+ * MonteCarlo::SimulationGeneralProperties::setEventBatchSize). Every thread
+ * transports the histories of an event batch together, one event at a time.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::runEventBasedSimulationBatch( 
+                            const unsigned long long batch_start_history, 
+			    const unsigned long long batch_end_history )
+{
+  // Make sure the history range is valid
+  testPrecondition( batch_start_history <= batch_end_history );
+  // Make sure event-based transport has been requested
+  testPrecondition( SimulationGeneralProperties::isEventBasedTransportModeOn() );
+
+  const unsigned long long event_batch_size = 
+    SimulationGeneralProperties::getEventBatchSize();
+
+  const unsigned long long number_of_event_batches = 
+    (batch_end_history - batch_start_history + event_batch_size - 1ull)/
+    event_batch_size;
+  
+  #pragma omp parallel num_threads( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
+  { 
+    // Create the banks for each thread
+    ParticleEventBank event_bank;
+    ParticleBank bank;
+
+    #pragma omp for
+    for( unsigned long long i = 0; i < number_of_event_batches; ++i )
+    {
+      // Do useful work unless the user requests an end to the simulation
+      #pragma omp flush( d_end_simulation )
+      if( !d_end_simulation )
+      {
+	const unsigned long long event_batch_start_history = 
+	  batch_start_history + i*event_batch_size;
+
+	const unsigned long long event_batch_end_history = 
+	  std::min( event_batch_start_history + event_batch_size,
+		    batch_end_history );
+
+	this->simulateEventBatch( event_bank,
+				  bank,
+				  event_batch_start_history,
+				  event_batch_end_history );
+      }
+    }
+  }
+}
+
+// Simulate a batch of histories together (one event at a time)
+/*! \details The source particles of every history are sampled first. The
+ * random number generator state of every history is stored in the event 
+ * bank so that every history still uses its own random number stream. 
+ * Source particles of a type that is not being simulated are ignored (after 
+ * the generation event has been recorded).
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::simulateEventBatch( 
+                                    ParticleEventBank& event_bank,
+                                    ParticleBank& bank,
+                                    const unsigned long long start_history,
+                                    const unsigned long long end_history )
+{
+  // Make sure the banks are empty
+  testPrecondition( event_bank.getNumberOfHistories() == 0 );
+  testPrecondition( bank.isEmpty() );
+  
+  for( unsigned long long history = start_history; history < end_history; ++history )
+  {
+    const unsigned history_index = event_bank.addHistory( history );
+    
+    // Initialize the random number generator for this history
+    Utility::RandomNumberGenerator::initialize( history );
+
+    // Sample a particle state from the source
+    {
+      START_PERFORMANCE_TIMER( SOURCE_TIME );
+      
+      SMI::sampleParticleState( bank, history );
+
+      STOP_PERFORMANCE_TIMER( SOURCE_TIME );
+    }
+
+    // Determine the starting cell of the source particles
+    while( !bank.isEmpty() )
+    {
+      typename GMI::InternalCellHandle start_cell;
+      
+      try{
+	start_cell = GMI::findCellContainingPoint( bank.top().ray() );
+      }
+      CATCH_LOST_SOURCE_PARTICLE_AND_CONTINUE( bank );
+
+      bank.top().setCell( start_cell );
+
+      std::shared_ptr<ParticleState> particle;
+
+      bank.pop( particle );
+
+      const unsigned long long index = 
+	event_bank.push( particle, history_index );
+
+      if( EMI::isParticleTypeObserved( particle->getParticleType() ) )
+	event_bank.recordGenerationEvent( index );
+
+      if( particle->getParticleType() != d_event_particle_type )
+	particle->setAsGone();
+    }
+
+    event_bank.setRandomNumberGeneratorState( 
+		       history_index,
+		       Utility::RandomNumberGenerator::getGeneratorState() );
+  }
+
+  switch( d_event_particle_type )
+  {
+  case NEUTRON:
+    this->template transportEventBank<NeutronState>( event_bank, bank );
+    break;
+  case PHOTON:
+    this->template transportEventBank<PhotonState>( event_bank, bank );
+    break;
+  default:
+    THROW_EXCEPTION( std::logic_error,
+		     "Error: particle type " << d_event_particle_type << 
+		     " is not currently supported by event-based "
+		     "transport!" );
+  }
+
+  event_bank.clear();
+}
+
+// Transport the particles in the event bank until it is empty
+/*! \details Every pass transports every particle to its next collision site
+ * and collides it. The particles are sorted by cell and energy before every
+ * pass so that the cross section lookups of particles in the same material
+ * are done together. A history is committed as soon as all of its particles
+ * have been removed from the event bank.
+ */
+template<typename GeometryHandler,
+         typename SourceHandler,
+         typename EstimatorHandler,
+         typename CollisionHandler>
+template<typename ParticleStateType>
+void ParticleSimulationManager<GeometryHandler,
+                               SourceHandler,
+                               EstimatorHandler,
+                               CollisionHandler>::transportEventBank( 
+                                                ParticleEventBank& event_bank,
+                                                ParticleBank& bank )
+{
+  while( !event_bank.isEmpty() )
+  {
+    event_bank.sortParticles();
+    
+    this->template processCrossSectionLookupEvents<ParticleStateType>( 
+                                                                 event_bank );
+
+    this->template processAdvanceEvents<ParticleStateType>( event_bank, bank );
+
+    this->template processCollisionEvents<ParticleStateType>( event_bank, 
+                                                              bank );
+
+    // Update the global estimators with the particles that are finished
+    for( unsigned long long i = 0; i < event_bank.size(); ++i )
+    {
+      const ParticleState& particle = event_bank.getParticle( i );
+      
+      if( (particle.isGone() || particle.isLost()) &&
+	  particle.getParticleType() == d_event_particle_type &&
+	  EMI::isParticleTypeObserved( particle.getParticleType() ) )
+	event_bank.recordGlobalEvent( i );
+    }
+
+    event_bank.removeInactiveParticles();
+
+    this->template commitCompletedHistories<ParticleStateType>( event_bank );
+  }
+
+  // Commit the histories that did not have any source particles
+  this->template commitCompletedHistories<ParticleStateType>( event_bank );
+}
+
+// Sample the optical path and look up the cross section of every particle
+template<typename GeometryHandler,
+         typename SourceHandler,
+         typename EstimatorHandler,
+         typename CollisionHandler>
+template<typename ParticleStateType>
+void ParticleSimulationManager<GeometryHandler,
+                               SourceHandler,
+                               EstimatorHandler,
+                               CollisionHandler>::processCrossSectionLookupEvents( 
+                                         ParticleEventBank& event_bank ) const
+{
+  for( unsigned long long i = 0; i < event_bank.size(); ++i )
+  {
+    if( event_bank.getParticle( i ).isGone() || 
+	event_bank.getParticle( i ).isLost() )
+      continue;
+    
+    ParticleStateType& particle = 
+      event_bank.getParticle<ParticleStateType>( i );
+
+    // The particles are processed in an interleaved order - the particle 
+    // dependent collision data must not be shared between them
+    CMI::startNewParticle();
+
+    // Check if the particle energy is below the cutoff
+    if( particle.getEnergy() < SimulationGeneralProperties::getMinParticleEnergy<ParticleStateType>() )
+    {
+      particle.setAsGone();
+
+      continue;
+    }
+
+    const unsigned history = event_bank.getHistory( i );
+    
+    // Sample the mfp traveled by the particle on this subtrack
+    Utility::RandomNumberGenerator::setGeneratorState( 
+		      event_bank.getRandomNumberGeneratorState( history ) );
+    
+    event_bank.setOpticalPath( i, CMI::sampleOpticalPathLength() );
+
+    event_bank.setRandomNumberGeneratorState( 
+		       history,
+		       Utility::RandomNumberGenerator::getGeneratorState() );
+
+    // Get the total cross section for the cell
+    if( !CMI::isCellVoid( particle.getCell(), particle.getParticleType() ) )
+    {
+      event_bank.setCrossSection( 
+		      i, CMI::getMacroscopicTotalCrossSection( particle ) );
+
+      INCREMENT_PERFORMANCE_COUNTER( CROSS_SECTION_LOOKUPS, 1ull );
+    }
+    else
+      event_bank.setCrossSection( i, 0.0 );
+  }
+}
+
+// Advance every particle to its next collision site
+/*! \details The geometry module keeps a single ray history per thread so
+ * every particle is ray traced through all of the cells on its subtrack 
+ * before the next particle is processed. The surface crossing events are
+ * recorded in the event bank.
+ */
+template<typename GeometryHandler,
+         typename SourceHandler,
+         typename EstimatorHandler,
+         typename CollisionHandler>
+template<typename ParticleStateType>
+void ParticleSimulationManager<GeometryHandler,
+                               SourceHandler,
+                               EstimatorHandler,
+                               CollisionHandler>::processAdvanceEvents( 
+                                                ParticleEventBank& event_bank,
+                                                ParticleBank& bank ) const
+{
+  // Particle tracking information
+  double distance_to_surface_hit, op_to_surface_hit, remaining_subtrack_op;
+  double subtrack_start_time;
+
+  // Surface information
+  typename GMI::InternalSurfaceHandle surface_hit;
+  Teuchos::Array<double> surface_normal( 3 );
+
+  // Cell information
+  typename GMI::InternalCellHandle cell_entering, cell_leaving;
+  double cell_total_macro_cross_section;
+
+  // Particles split at a surface will be advanced in the next pass
+  const unsigned long long number_of_particles = event_bank.size();
+  
+  for( unsigned long long i = 0; i < number_of_particles; ++i )
+  {
+    if( event_bank.getParticle( i ).isGone() || 
+	event_bank.getParticle( i ).isLost() )
+      continue;
+    
+    ParticleStateType& particle = 
+      event_bank.getParticle<ParticleStateType>( i );
+
+    // The particles are processed in an interleaved order - the particle 
+    // dependent collision data must not be shared between them
+    CMI::startNewParticle();
+    
+    const unsigned history = event_bank.getHistory( i );
+
+    Utility::RandomNumberGenerator::setGeneratorState( 
+		      event_bank.getRandomNumberGeneratorState( history ) );
+
+    remaining_subtrack_op = event_bank.getOpticalPath( i );
+    cell_total_macro_cross_section = event_bank.getCrossSection( i );
+
+    // Clear the ray history of the previous particle
+    GMI::newRay();
+
+    // Ray trace until the necessary number of optical paths have be traveled
+    while( true )
+    {
+      // Fire a ray at the cell currently containing the particle
+      {
+	SCOPED_PERFORMANCE_TIMER( GEOMETRY_TIME );
+      
+	try{
+	  distance_to_surface_hit = 0.0;
+	  
+	  GMI::fireRay( particle.ray(),
+			particle.getCell(),
+			surface_hit,
+			distance_to_surface_hit );
+	}
+	CATCH_LOST_PARTICLE_AND_BREAK( particle );
+      }
+
+      INCREMENT_PERFORMANCE_COUNTER( RAY_FIRES, 1ull );
+
+      // Convert the distance to the surface to optical path
+      op_to_surface_hit = 
+  	distance_to_surface_hit*cell_total_macro_cross_section;
+
+      // Get the start time of this subtrack
+      subtrack_start_time = particle.getTime();
+
+      if( op_to_surface_hit < remaining_subtrack_op )
+      {
+  	// Advance the particle to the cell boundary
+  	particle.advance( distance_to_surface_hit );
+
+  	// Get the surface normal at the intersection point
+  	GMI::getSurfaceNormal( surface_hit,
+  			       particle.getPosition(),
+  			       surface_normal.getRawPtr() );		       
+
+  	cell_leaving = particle.getCell();
+	
+  	// Find the cell on the other side of the surface hit
+	{
+	  SCOPED_PERFORMANCE_TIMER( GEOMETRY_TIME );
+	
+	  try{
+	    cell_entering = GMI::findCellContainingPoint( particle.ray(),
+							  cell_leaving,
+							  surface_hit );
+	  }
+	  CATCH_LOST_PARTICLE_AND_BREAK( particle );
+	}
+
+	INCREMENT_PERFORMANCE_COUNTER( SURFACE_CROSSINGS, 1ull );
+
+  	particle.setCell( cell_entering );
+
+  	// Record the estimator event
+	if( EMI::isParticleTypeObserved( particle.getParticleType() ) )
+	{
+	  event_bank.recordCrossingSurfaceEvent( i,
+						 cell_entering,
+						 cell_leaving,
+						 surface_hit,
+						 distance_to_surface_hit,
+						 subtrack_start_time,
+						 surface_normal.getRawPtr() );
+	}
+
+  	// Check if a termination cell was encountered
+  	if( GMI::isTerminationCell( particle.getCell() ) )
+  	{
+  	  particle.setAsGone();
+
+  	  break;
+  	}
+
+	// Split or roulette the particle entering the new cell
+	if( !d_weight_windows.is_null() )
+	{
+	  d_weight_windows->applyWeightWindow( particle, bank );
+
+	  if( particle.isGone() )
+	    break;
+	}
+
+  	// Update the remaining subtrack mfp
+  	remaining_subtrack_op -= op_to_surface_hit;
+
+	// Get the total cross section for the new cell
+	if( !CMI::isCellVoid( particle.getCell(), particle.getParticleType() ) )
+	{
+	  cell_total_macro_cross_section = 
+	    CMI::getMacroscopicTotalCrossSection( particle );
+	  
+	  INCREMENT_PERFORMANCE_COUNTER( CROSS_SECTION_LOOKUPS, 1ull );
+	}
+	else
+	  cell_total_macro_cross_section = 0.0;
+      } 
+      
+      // A collision occurs in this cell
+      else
+      {
+  	// Advance the particle to the collision site
+  	double distance = remaining_subtrack_op/cell_total_macro_cross_section;
+	
+  	particle.advance( distance );
+
+	event_bank.setCollisionPending( i, distance, subtrack_start_time );
+	
+	break;
+      }
+    }
+
+    event_bank.setCrossSection( i, cell_total_macro_cross_section );
+    
+    event_bank.setRandomNumberGeneratorState( 
+		       history,
+		       Utility::RandomNumberGenerator::getGeneratorState() );
+
+    this->flushParticleBank( bank, event_bank, history );
+  }
+}
+
+// Collide every particle that has reached its collision site
+template<typename GeometryHandler,
+         typename SourceHandler,
+         typename EstimatorHandler,
+         typename CollisionHandler>
+template<typename ParticleStateType>
+void ParticleSimulationManager<GeometryHandler,
+                               SourceHandler,
+                               EstimatorHandler,
+                               CollisionHandler>::processCollisionEvents( 
+                                                ParticleEventBank& event_bank,
+                                                ParticleBank& bank ) const
+{
+  // Secondary particles will be transported in the next pass
+  const unsigned long long number_of_particles = event_bank.size();
+  
+  for( unsigned long long i = 0; i < number_of_particles; ++i )
+  {
+    if( !event_bank.isCollisionPending( i ) )
+      continue;
+
+    ParticleStateType& particle = 
+      event_bank.getParticle<ParticleStateType>( i );
+
+    // The particles are processed in an interleaved order - the particle 
+    // dependent collision data must not be shared between them
+    CMI::startNewParticle();
+    
+    const unsigned history = event_bank.getHistory( i );
+
+    // Record the estimator events
+    if( EMI::isParticleTypeObserved( particle.getParticleType() ) )
+      event_bank.recordCollisionEvents( i );
+
+    Utility::RandomNumberGenerator::setGeneratorState( 
+		      event_bank.getRandomNumberGeneratorState( history ) );
+
+    // Undergo a collision with the material in the cell
+    {
+      START_PERFORMANCE_TIMER( COLLISION_TIME );
+      START_SECONDARIES_BANKED_COUNTER( bank );
+      
+      CMI::collideWithCellMaterial( 
+		    particle, 
+		    bank, 
+		    !SimulationGeneralProperties::isImplicitCaptureModeOn() );
+
+      STOP_PERFORMANCE_TIMER( COLLISION_TIME );
+      STOP_SECONDARIES_BANKED_COUNTER( bank );
+      INCREMENT_COLLISION_COUNTER( particle.getParticleType() );
+    }
+
+    // Cache the current position of the new ray
+    event_bank.resetRayStartPoint( i );
+
+    // Make sure the energy is above the cutoff
+    if( particle.getEnergy() < SimulationGeneralProperties::getMinParticleEnergy<ParticleStateType>() )
+      particle.setAsGone();
+
+    // Split or roulette the particle leaving the collision site
+    if( !d_weight_windows.is_null() )
+      d_weight_windows->applyWeightWindow( particle, bank );
+
+    // Play Russian roulette with low weight particles
+    if( SimulationGeneralProperties::isWeightRouletteOn() )
+      this->playWeightRoulette( particle );
+
+    event_bank.clearCollisionPending( i );
+
+    event_bank.setRandomNumberGeneratorState( 
+		       history,
+		       Utility::RandomNumberGenerator::getGeneratorState() );
+
+    this->flushParticleBank( bank, event_bank, history );
+  }
+}
+
+// Move the particles in the bank to the event bank
+/*! \details Particles of a type that is not being simulated are ignored.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::flushParticleBank( 
+                                           ParticleBank& bank,
+                                           ParticleEventBank& event_bank,
+                                           const unsigned history ) const
+{
+  while( !bank.isEmpty() )
+  {
+    if( bank.top().getParticleType() == d_event_particle_type )
+    {
+      std::shared_ptr<ParticleState> particle;
+
+      bank.pop( particle );
+
+      event_bank.push( particle, history );
+    }
+    else
+      bank.pop();
+  }
+}
+
+// Replay the recorded estimator events of every completed history
+/*! \details The estimator events of a history are replayed one event type
+ * at a time and then committed so that the estimators see exactly one 
+ * history at a time. The estimators only accumulate the history 
+ * contributions until the commit so the order of the event types does not 
+ * matter. The recorded particle states are restored into a single particle
+ * of the transported type. Source particles of a type that is not being
+ * transported only have generation events.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+template<typename ParticleStateType>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::commitCompletedHistories( 
+                                               ParticleEventBank& event_bank )
+{
+  for( unsigned history = 0; history < event_bank.getNumberOfHistories(); ++history )
+  {
+    if( event_bank.isHistoryCommitted( history ) ||
+	!event_bank.isHistoryComplete( history ) )
+      continue;
+
+    START_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+
+    ParticleStateType particle( event_bank.getHistoryNumber( history ) );
+    
+    const Teuchos::Array<ParticleEventBank::ParticleStateData>& 
+      generation_events = event_bank.getGenerationEvents( history );
+
+    for( unsigned i = 0; i < generation_events.size(); ++i )
+    {
+      if( generation_events[i].particle_type == ParticleStateType::type )
+      {
+	ParticleEventBank::restoreParticleState( generation_events[i], 
+						 particle );
+	
+	EMI::updateEstimatorsFromParticleGenerationEvent( particle );
+      }
+      else
+      {
+	std::shared_ptr<ParticleState> source_particle;
+
+	ParticleStateFactory::createState( 
+					 source_particle,
+					 generation_events[i].particle_type,
+					 event_bank.getHistoryNumber( history ) );
+
+	ParticleEventBank::restoreParticleState( generation_events[i], 
+						 *source_particle );
+
+	EMI::updateEstimatorsFromParticleGenerationEvent( *source_particle );
+      }
+    }
+
+    const Teuchos::Array<ParticleEventBank::CrossingSurfaceEvent>& 
+      crossing_surface_events = event_bank.getCrossingSurfaceEvents( history );
+
+    for( unsigned i = 0; i < crossing_surface_events.size(); ++i )
+    {
+      const ParticleEventBank::CrossingSurfaceEvent& event = 
+	crossing_surface_events[i];
+
+      ParticleEventBank::restoreParticleState( event.particle, particle );
+      
+      EMI::updateEstimatorsFromParticleCrossingSurfaceEvent(
+						      particle,
+						      event.cell_entering,
+						      event.cell_leaving,
+						      event.surface_crossing,
+						      event.track_length,
+						      event.start_time,
+						      event.surface_normal );
+    }
+
+    const Teuchos::Array<ParticleEventBank::CollidingInCellEvent>& 
+      colliding_in_cell_events = event_bank.getCollidingInCellEvents( history );
+
+    for( unsigned i = 0; i < colliding_in_cell_events.size(); ++i )
+    {
+      const ParticleEventBank::CollidingInCellEvent& event = 
+	colliding_in_cell_events[i];
+
+      ParticleEventBank::restoreParticleState( event.particle, particle );
+      
+      EMI::updateEstimatorsFromParticleCollidingInCellEvent(
+					   particle,
+					   event.track_length,
+					   event.start_time,
+					   event.inverse_total_cross_section );
+    }
+
+    const Teuchos::Array<ParticleEventBank::CollidingGlobalEvent>& 
+      colliding_global_events = event_bank.getCollidingGlobalEvents( history );
+
+    for( unsigned i = 0; i < colliding_global_events.size(); ++i )
+    {
+      const ParticleEventBank::CollidingGlobalEvent& event = 
+	colliding_global_events[i];
+
+      ParticleEventBank::restoreParticleState( event.particle, particle );
+      
+      EMI::updateEstimatorsFromParticleCollidingGlobalEvent( particle,
+							     event.start_point,
+							     event.end_point );
+    }
+    
+    // Commit all estimator history contributions
+    EMI::commitEstimatorHistoryContributions();
+
+    STOP_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+
+    event_bank.setHistoryCommitted( history );
+
+    // Increment the number of histories completed
+    #pragma omp atomic
+    ++d_histories_completed;
+  }
+}
+
+// Run the simulation batch in sub-batches (checkpoints and termination)
+/*! \details The batch is divided into sub-batches. The sub-batch size is the
+ * checkpoint history interval (if one has been set) or the number of 
+ * histories divided by the ideal number of batches per processor. Once a 
+ * sub-batch has been completed the estimator moments are copied into the
+ * checkpoint on the master thread and the checkpoint is written to the
+ * checkpoint file on a background thread while the next sub-batch is 
+ * simulated. A checkpoint is written after every sub-batch if the history
+ * interval has been set and once the wall time interval has elapsed 
+ * otherwise. The termination criteria are checked after every sub-batch.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::runSimulationSubBatches( 
+                                    const unsigned long long start_history,
+                                    const unsigned long long end_history )
+{
+  // Make sure the history range is valid
+  testPrecondition( start_history <= end_history );
+
+  const unsigned long long history_interval = 
+    SimulationGeneralProperties::getCheckpointHistoryInterval();
+
+  const double wall_time_interval = 
+    SimulationGeneralProperties::getCheckpointWallTimeInterval();
+  
+  unsigned long long sub_batch_size;
+
+  if( history_interval > 0ull )
+    sub_batch_size = history_interval;
+  else
+  {
+    const unsigned long long batches = std::max( 
+         1ull,
+         (unsigned long long)SimulationGeneralProperties::getNumberOfBatchesPerProcessor() );
+    
+    sub_batch_size = (end_history - start_history + batches - 1ull)/batches;
+
+    if( sub_batch_size == 0ull )
+      sub_batch_size = 1ull;
+  }
+
+  AsynchronousCheckpointWriter checkpoint_writer;
+
+  double last_checkpoint_time = Utility::GlobalOpenMPSession::getTime();
+
+  unsigned long long sub_batch_start_history = start_history;
+  
+  while( sub_batch_start_history < end_history )
+  {
+    const unsigned long long sub_batch_end_history = 
+      std::min( sub_batch_start_history + sub_batch_size, end_history );
+
+    const double sub_batch_start_time = 
+      Utility::GlobalOpenMPSession::getTime();
+
+    this->runSimulationBatch( sub_batch_start_history, 
+                              sub_batch_end_history );
+
+    // A partially completed sub-batch cannot be checkpointed
+    #pragma omp flush( d_end_simulation )
+    if( d_end_simulation )
+      break;
+
+    d_checkpoint.addCompletedHistoryRange( sub_batch_start_history, 
+                                           sub_batch_end_history );
+
+    const double current_time = Utility::GlobalOpenMPSession::getTime();
+
+    if( SimulationGeneralProperties::isCheckpointModeOn() &&
+        (history_interval > 0ull || 
+         (wall_time_interval > 0.0 && 
+          current_time - last_checkpoint_time >= wall_time_interval)) )
+    {
+      d_checkpoint.setNumberOfHistoriesCompleted( d_histories_completed );
+      d_checkpoint.setRunTime( d_previous_run_time + 
+                               current_time - d_start_time );
+
+      EMI::getEstimatorRawMoments( d_checkpoint.getEstimatorIds(),
+                                   d_checkpoint.getEstimatorRawMoments() );
+
+      checkpoint_writer.write( 
+                           d_checkpoint,
+                           SimulationGeneralProperties::getCheckpointFile() );
+
+      last_checkpoint_time = current_time;
+    }
+
+    sub_batch_start_history = sub_batch_end_history;
+
+    if( sub_batch_start_history < end_history &&
+        this->isTerminationCriterionMet( current_time, 
+                                         current_time - sub_batch_start_time ) )
+      break;
+  }
+
+  // The final checkpoint must be written before the simulation data
+  checkpoint_writer.wait();
+}
+
+// Check if a termination criterion has been met (at a batch boundary)
+/*! \details The wall time limit has been met if the next batch (assumed to
+ * take as long as the last batch) would not finish before the limit. The
+ * convergence criterion has been met once every bin of the convergence
+ * estimators has reached the target relative error.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool ParticleSimulationManager<GeometryHandler,
+                               SourceHandler,
+                               EstimatorHandler,
+                               CollisionHandler>::isTerminationCriterionMet( 
+                                              const double current_time,
+                                              const double batch_time ) const
+{
+  if( SimulationGeneralProperties::isWallTimeLimitOn() )
+  {
+    if( current_time - d_start_time + batch_time > 
+        SimulationGeneralProperties::getWallTimeLimit() )
+    {
+      std::cout << "wall time limit reached ... ";
+      std::cout.flush();
+      
+      return true;
+    }
+  }
+
+  if( SimulationGeneralProperties::isConvergenceTerminationOn() &&
+      d_histories_completed > 0ull )
+  {
+    const double max_relative_error = EMI::getMaxEstimatorRelativeError(
+                      SimulationGeneralProperties::getConvergenceEstimators(),
+                      d_histories_completed );
+
+    if( max_relative_error <= 
+        SimulationGeneralProperties::getTargetRelativeError() )
+    {
+      std::cout << "target relative error reached ... ";
+      std::cout.flush();
+      
+      return true;
+    }
+  }
+  
+  return false;
+}
+
+// Restart the simulation from the restart file
+/*! \details The estimator moments, the number of histories completed and
+ * the run time are restored from the restart file. The first history that 
+ * has not been completed is returned. Because the random number generator
+ * is initialized from the history number the restarted simulation will 
+ * produce the same results as an uninterrupted simulation.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+unsigned long long ParticleSimulationManager<GeometryHandler,
+                                             SourceHandler,
+                                             EstimatorHandler,
+                                             CollisionHandler>::restartSimulation()
+{
+  // Make sure restart mode has been turned on
+  testPrecondition( SimulationGeneralProperties::isRestartModeOn() );
+  
+  d_checkpoint.importFromHDF5File( 
+                               SimulationGeneralProperties::getRestartFile() );
+
+  const unsigned long long start_history = 
+    d_checkpoint.getNextHistory( d_start_history );
+
+  TEST_FOR_EXCEPTION( start_history < d_start_history ||
+                      start_history > d_history_number_wall,
+                      std::runtime_error,
+                      "Error: the restart file " 
+                      << SimulationGeneralProperties::getRestartFile() <<
+                      " does not correspond to the histories requested!" );
+
+  EMI::setEstimatorRawMoments( d_checkpoint.getEstimatorIds(),
+                               d_checkpoint.getEstimatorRawMoments() );
+
+  this->setHistoriesCompleted( d_checkpoint.getNumberOfHistoriesCompleted() );
+
+  d_previous_run_time = d_checkpoint.getRunTime();
+
+  return start_history;
+}
+
+// Run the criticality (k-eigenvalue) simulation
+/*! \details The criticality simulation is a sequence of power iteration
+ * cycles. The first cycle is started from the user defined source. Every 
+ * other cycle is started from the fission sites that were banked in the
+ * previous cycle (renormalized to the number of histories per cycle). The 
+ * estimator data is reset after the last inactive cycle so that only the 
+ * active cycles contribute to it.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::runCriticalitySimulation()
+{
+  // Make sure that neutrons are being simulated
+  ParticleModeType mode = SimulationGeneralProperties::getParticleMode();
+  
+  TEST_FOR_EXCEPTION( mode != NEUTRON_MODE &&
+		      mode != NEUTRON_PHOTON_MODE &&
+		      mode != NEUTRON_PHOTON_ELECTRON_MODE,
+		      std::runtime_error,
+		      "Error: particle mode " << mode << " cannot be used "
+		      "in a criticality simulation!" );
+
+  // Fission sites are only banked by analogue collisions
+  TEST_FOR_EXCEPTION( SimulationGeneralProperties::isImplicitCaptureModeOn(),
+		      std::runtime_error,
+		      "Error: implicit capture cannot be used in a "
+		      "criticality simulation!" );
+  
+  const unsigned inactive_cycles = 
+    SimulationNeutronProperties::getNumberOfInactiveCycles();
+
+  const unsigned total_cycles = inactive_cycles + 
+    SimulationNeutronProperties::getNumberOfActiveCycles();
+
+  // The range of cycle histories simulated by this process
+  unsigned long long cycle_start_history, cycle_end_history;
+
+  this->getCycleHistoryRange( cycle_start_history, cycle_end_history );
+
+  // The source sites of the current cycle (empty for the first cycle)
+  ParticleBank source_sites;
+
+  d_cycle_multiplication_factors.clear();
+
+  for( unsigned cycle = 0; cycle < total_cycles; ++cycle )
+  {
+    // Discard the data collected during the inactive cycles
+    if( cycle == inactive_cycles )
+    {
+      EMI::resetEstimatorData();
+
+      this->setHistoriesCompleted( 0ull );
+    }
+
+    ParticleBank fission_sites;
+
+    this->runCriticalityCycle( cycle, 
+			       cycle_start_history, 
+			       cycle_end_history, 
+			       source_sites,
+			       fission_sites );
+
+    // Every process must agree to end the simulation before the fission
+    // sites are collected (collective communication may be required)
+    if( this->isSimulationEndRequested() )
+      break;
+
+    // Every process must agree that the cycle produced fission sites before
+    // any process waits on the fission site collection
+    TEST_FOR_EXCEPTION( this->getTotalNumberOfFissionSites( fission_sites ) 
+			== 0ull,
+			std::runtime_error,
+			"Error: no fission sites were produced - the next "
+			"criticality cycle cannot be started!" );
+    
+    // The process that holds all of the fission sites samples the new source
+    if( this->collectFissionSites( fission_sites ) )
+    {
+      double total_fission_weight;
+      
+      this->sampleSourceSites( fission_sites, 
+			       source_sites, 
+			       total_fission_weight );
+
+      const double cycle_multiplication_factor = 
+	this->calculateCycleMultiplicationFactor( total_fission_weight );
+
+      if( cycle >= inactive_cycles )
+      {
+	d_cycle_multiplication_factors.push_back( 
+					       cycle_multiplication_factor );
+      }
+
+      this->printCycleSummary( cycle, cycle_multiplication_factor );
+    }
+
+    this->distributeSourceSites( source_sites );
+  }
+}
+
+// Run a criticality cycle
+/*! \details The source particles of the first cycle are sampled from the 
+ * user defined source. The source particles of every other cycle are started
+ * from the source sites (the source site bank will be emptied). Every thread
+ * stores the fission sites that it produces in its own bank. The thread 
+ * banks are sorted by history number and merged after the cycle so that the 
+ * order of the fission sites does not depend on the number of threads or on 
+ * the order that the histories were completed in.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::runCriticalityCycle(
+                            const unsigned cycle,
+                            const unsigned long long cycle_start_history,
+                            const unsigned long long cycle_end_history,
+                            ParticleBank& source_sites,
+                            ParticleBank& fission_sites )
+{
+  // Make sure the history range is valid
+  testPrecondition( cycle_start_history <= cycle_end_history );
+  testPrecondition( cycle_end_history <= this->getNumberOfHistories() );
+  // Make sure the source sites are valid
+  testPrecondition( cycle == 0 || 
+		    source_sites.size() == 
+		    cycle_end_history - cycle_start_history );
+
+  // The history number of the first history in this cycle
+  const unsigned long long cycle_history_offset = 
+    d_start_history + cycle*this->getNumberOfHistories();
+
+  // Cache the source sites so that every thread can access them
+  Teuchos::Array<std::shared_ptr<ParticleState> > cycle_source_sites;
+  cycle_source_sites.reserve( source_sites.size() );
+
+  while( !source_sites.isEmpty() )
+  {
+    cycle_source_sites.push_back( std::shared_ptr<ParticleState>() );
+
+    source_sites.pop( cycle_source_sites.back() );
+  }
+
+  // The fission sites produced by each thread
+  Teuchos::Array<ParticleBank> thread_fission_sites( 
+		 Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() );
+
+  // The probability that a fission neutron is transported immediately
+  double immediate_fission_fraction = 0.0;
+
+  if( SimulationNeutronProperties::isWielandtAccelerationOn() )
+  {
+    immediate_fission_fraction = 
+      1.0/SimulationNeutronProperties::getWielandtShift();
+  }
+  
+  #pragma omp parallel num_threads( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
+  { 
+    // Create a bank for each thread
+    FissionBank bank( immediate_fission_fraction );
+
+    #pragma omp for
+    for( unsigned long long i = cycle_start_history; i < cycle_end_history; ++i )
+    {
+      // Do useful work unless the user requests an end to the simulation
+      #pragma omp flush( d_end_simulation )
+      if( !d_end_simulation )
+      {
+	const unsigned long long history = cycle_history_offset + i;
+	
+	// Initialize the random number generator for this history
+	Utility::RandomNumberGenerator::initialize( history );
+
+	// Sample a particle state from the source
+	if( cycle == 0 )
+	{
+	  START_PERFORMANCE_TIMER( SOURCE_TIME );
+	  
+	  SMI::sampleParticleState( bank, history );
+
+	  STOP_PERFORMANCE_TIMER( SOURCE_TIME );
+	}
+	
+	// Start a neutron at the source site
+	else
+	{
+	  const ParticleState& source_site = 
+	    *cycle_source_sites[i-cycle_start_history];
+	  
+	  NeutronState neutron( history );
+	  
+	  neutron.setPosition( source_site.getPosition() );
+	  neutron.setDirection( source_site.getDirection() );
+	  neutron.setEnergy( source_site.getEnergy() );
+
+	  bank.push( neutron );
+	}
+	
+	// Simulate the source particle and all of its progeny
+	this->simulateHistory( bank );
+
+	// Commit all estimator history contributions
+	{
+	  START_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	  
+	  EMI::commitEstimatorHistoryContributions();
+
+	  STOP_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	}
+        
+	// Increment the number of histories completed
+        #pragma omp atomic
+	++d_histories_completed;
+      }
+    }
+
+    // Store the fission sites produced by this thread
+    thread_fission_sites[Utility::GlobalOpenMPSession::getThreadId()].splice(
+					           bank.getFissionSiteBank() );
+  }
+
+  // Merge the fission sites produced by each thread
+  for( unsigned i = 0; i < thread_fission_sites.size(); ++i )
+  {
+    thread_fission_sites[i].sort( 
+			     ParticleSimulationManager::compareHistoryNumbers );
+
+    fission_sites.merge( thread_fission_sites[i],
+			 ParticleSimulationManager::compareHistoryNumbers );
+  }
+}
+
+// Return the range of cycle histories simulated by this process
+/*! \details All of the histories in a cycle are simulated by this process.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::getCycleHistoryRange( 
+                           unsigned long long& cycle_start_history,
+                           unsigned long long& cycle_end_history ) const
+{
+  cycle_start_history = 0ull;
+  cycle_end_history = this->getNumberOfHistories();
+}
+
+// Return the number of fission sites produced by every process
+/*! \details The fission sites produced by this process are all of the 
+ * fission sites produced in the cycle.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+unsigned long long ParticleSimulationManager<GeometryHandler,
+					     SourceHandler,
+					     EstimatorHandler,
+					     CollisionHandler>::getTotalNumberOfFissionSites( 
+                                           const ParticleBank& fission_sites )
+{
+  return fission_sites.size();
+}
+
+// Collect the fission sites produced by every process
+/*! \details The fission sites produced by this process are all of the 
+ * fission sites produced in the cycle. True will be returned if this
+ * process holds all of the fission sites after the call.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::collectFissionSites( 
+                                                 ParticleBank& fission_sites )
+{
+  return true;
+}
+
+// Distribute the source sites to every process
+/*! \details All of the source sites will be kept by this process.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::distributeSourceSites(
+                                                  ParticleBank& source_sites )
+{ /* ... */ }
+
+// Check if an end to the simulation has been requested
+/*! \details This process is the only process that needs to be consulted.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::isSimulationEndRequested()
+{
+  #pragma omp flush( d_end_simulation )
+  return d_end_simulation;
+}
+
+// Compare the history numbers of two particle states
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+bool ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::compareHistoryNumbers( 
+                                            const ParticleState& state_a,
+                                            const ParticleState& state_b )
+{
+  return state_a.getHistoryNumber() < state_b.getHistoryNumber();
+}
+
+// Calculate the multiplication factor of a cycle
+/*! \details When Wielandt acceleration is used only a fraction of the
+ * fission neutrons are banked. If f is the probability that a fission 
+ * neutron is transported immediately (the inverse of the shift eigenvalue)
+ * and k' is the banked fission weight per source particle, the 
+ * multiplication factor is k'/(1 - f + f*k').
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+double ParticleSimulationManager<GeometryHandler,
+				 SourceHandler,
+				 EstimatorHandler,
+				 CollisionHandler>::calculateCycleMultiplicationFactor(
+                                      const double total_fission_weight ) const
+{
+  const double banked_multiplication_factor = 
+    total_fission_weight/this->getNumberOfHistories();
+
+  if( SimulationNeutronProperties::isWielandtAccelerationOn() )
+  {
+    const double immediate_fission_fraction = 
+      1.0/SimulationNeutronProperties::getWielandtShift();
+    
+    return banked_multiplication_factor/
+      (1.0 - immediate_fission_fraction + 
+       immediate_fission_fraction*banked_multiplication_factor);
+  }
+  else
+    return banked_multiplication_factor;
+}
+
+// Sample the next cycle source sites from the fission sites
+/*! \details The number of source sites is renormalized to the number of
+ * histories per cycle using systematic (midpoint) sampling of the fission 
+ * site weights. No random numbers are used and the source sites keep the 
+ * order of the fission sites. The fission site bank will be emptied.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::sampleSourceSites( 
+                                        ParticleBank& fission_sites,
+                                        ParticleBank& source_sites,
+                                        double& total_fission_weight ) const
+{
+  // Make sure there are fission sites to sample from
+  testPrecondition( !fission_sites.isEmpty() );
+
+  // Cache the fission sites
+  Teuchos::Array<std::shared_ptr<ParticleState> > sites;
+  sites.reserve( fission_sites.size() );
+
+  total_fission_weight = 0.0;
+
+  while( !fission_sites.isEmpty() )
+  {
+    sites.push_back( std::shared_ptr<ParticleState>() );
+
+    fission_sites.pop( sites.back() );
+
+    total_fission_weight += sites.back()->getWeight();
+  }
+
+  const unsigned long long number_of_source_sites = 
+    this->getNumberOfHistories();
+  
+  const double source_site_weight = 
+    total_fission_weight/number_of_source_sites;
+
+  unsigned site_index = 0u;
   
-	bank.pop();
-	}
-	
-	// Commit all estimator history contributions
-	EMI::commitEstimatorHistoryContributions();
-        
-	// Increment the number of histories completed
-        #pragma omp atomic
-	++d_histories_completed;
-      }
+  double cumulative_weight = sites.front()->getWeight();
+
+  for( unsigned long long i = 0ull; i < number_of_source_sites; ++i )
+  {
+    const double sample_weight = (i + 0.5)*source_site_weight;
+
+    while( cumulative_weight < sample_weight && 
+	   site_index < sites.size() - 1 )
+    {
+      ++site_index;
+
+      cumulative_weight += sites[site_index]->getWeight();
     }
+
+    source_sites.push( *sites[site_index] );
   }
 }
 
-// Set the number of particle histories to simulate
+// Print the multiplication factor of a cycle
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::printCycleSummary( 
+                          const unsigned cycle,
+                          const double cycle_multiplication_factor ) const
+{
+  std::cout << std::endl << " Cycle: " << cycle+1;
+
+  if( cycle < SimulationNeutronProperties::getNumberOfInactiveCycles() )
+    std::cout << " (inactive)";
+
+  std::cout << " k: " << cycle_multiplication_factor;
+  std::cout.flush();
+}
+
+// Simulate an individual particle
+/*! \details The particle is tracked until it is lost or gone. Any secondary
+ * particles that are created are added to the bank but are not simulated.
+ */
 template<typename GeometryHandler,
          typename SourceHandler,
          typename EstimatorHandler,
@@ -261,11 +1716,19 @@ void ParticleSimulationManager<GeometryHandler,
   double distance_to_surface_hit, op_to_surface_hit, remaining_subtrack_op;
   double subtrack_start_time;
   double ray_start_point[3];
+
+  // The estimator updates (and the data that they require) can be skipped
+  // if no estimator can score this particle type
+  const bool particle_type_observed = 
+    EMI::isParticleTypeObserved( particle.getParticleType() );
   
   // Cache the start point of the ray
-  ray_start_point[0] = particle.getXPosition();
-  ray_start_point[1] = particle.getYPosition();
-  ray_start_point[2] = particle.getZPosition();
+  if( particle_type_observed )
+  {
+    ray_start_point[0] = particle.getXPosition();
+    ray_start_point[1] = particle.getYPosition();
+    ray_start_point[2] = particle.getZPosition();
+  }
 
   // Surface information
   typename GMI::InternalSurfaceHandle surface_hit;
@@ -275,6 +1738,10 @@ void ParticleSimulationManager<GeometryHandler,
   typename GMI::InternalCellHandle cell_entering, cell_leaving;
   double cell_total_macro_cross_section;
 
+  // The particle dependent collision data of the previous particle (e.g. the
+  // unresolved resonance band selections) must not be reused
+  CMI::startNewParticle();
+
   // Check if the particle energy is below the cutoff
   if( particle.getEnergy() < SimulationGeneralProperties::getMinParticleEnergy<ParticleStateType>() )
     particle.setAsGone();
@@ -288,21 +1755,29 @@ void ParticleSimulationManager<GeometryHandler,
     while( true )
     {
       // Fire a ray at the cell currently containing the particle
-      try{
-  	distance_to_surface_hit = 0.0;
-	
-  	GMI::fireRay( particle.ray(),
-  		      particle.getCell(),
-  		      surface_hit,
-  		      distance_to_surface_hit );
+      {
+	SCOPED_PERFORMANCE_TIMER( GEOMETRY_TIME );
+      
+	try{
+	  distance_to_surface_hit = 0.0;
+	  
+	  GMI::fireRay( particle.ray(),
+			particle.getCell(),
+			surface_hit,
+			distance_to_surface_hit );
+	}
+	CATCH_LOST_PARTICLE_AND_BREAK( particle );
       }
-      CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+      INCREMENT_PERFORMANCE_COUNTER( RAY_FIRES, 1ull );
 
       // Get the total cross section for the cell
       if( !CMI::isCellVoid( particle.getCell(), particle.getParticleType() ) )
       {
       	cell_total_macro_cross_section = 
       	  CMI::getMacroscopicTotalCrossSection( particle );
+
+	INCREMENT_PERFORMANCE_COUNTER( CROSS_SECTION_LOOKUPS, 1ull );
       }
       else
   	cell_total_macro_cross_section = 0.0;
@@ -320,31 +1795,47 @@ void ParticleSimulationManager<GeometryHandler,
   	particle.advance( distance_to_surface_hit );
 
   	// Get the surface normal at the intersection point
-  	GMI::getSurfaceNormal( surface_hit,
-  			       particle.getPosition(),
-  			       surface_normal.getRawPtr() );		       
+	if( particle_type_observed )
+	{
+	  GMI::getSurfaceNormal( surface_hit,
+				 particle.getPosition(),
+				 surface_normal.getRawPtr() );
+	}
 
   	cell_leaving = particle.getCell();
 	
   	// Find the cell on the other side of the surface hit
-  	try{
-  	  cell_entering = GMI::findCellContainingPoint( particle.ray(),
-  							cell_leaving,
-  							surface_hit );
-  	}
-  	CATCH_LOST_PARTICLE_AND_BREAK( particle );
+	{
+	  SCOPED_PERFORMANCE_TIMER( GEOMETRY_TIME );
+	
+	  try{
+	    cell_entering = GMI::findCellContainingPoint( particle.ray(),
+							  cell_leaving,
+							  surface_hit );
+	  }
+	  CATCH_LOST_PARTICLE_AND_BREAK( particle );
+	}
+
+	INCREMENT_PERFORMANCE_COUNTER( SURFACE_CROSSINGS, 1ull );
 
   	particle.setCell( cell_entering );
 
   	// Update estimators
-  	EMI::updateEstimatorsFromParticleCrossingSurfaceEvent(
-  						  particle,
-  						  cell_entering,
-  						  cell_leaving,
-  						  surface_hit,
-  						  distance_to_surface_hit,
-  						  subtrack_start_time,
-  						  surface_normal.getRawPtr() );
+	if( particle_type_observed )
+	{
+	  START_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	
+	  EMI::updateEstimatorsFromParticleCrossingSurfaceEvent(
+						  particle,
+						  cell_entering,
+						  cell_leaving,
+						  surface_hit,
+						  distance_to_surface_hit,
+						  subtrack_start_time,
+						  surface_normal.getRawPtr() );
+
+	  STOP_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	}
 
   	// Check if a termination cell was encountered
   	if( GMI::isTerminationCell( particle.getCell() ) )
@@ -354,6 +1845,15 @@ void ParticleSimulationManager<GeometryHandler,
   	  break;
   	}
 
+	// Split or roulette the particle entering the new cell
+	if( !d_weight_windows.is_null() )
+	{
+	  d_weight_windows->applyWeightWindow( particle, bank );
+
+	  if( particle.isGone() )
+	    break;
+	}
+
   	// Update the remaining subtrack mfp
   	remaining_subtrack_op -= op_to_surface_hit;
       } 
@@ -367,34 +1867,60 @@ void ParticleSimulationManager<GeometryHandler,
   	particle.advance( distance );
 	
   	// Update estimators
-  	EMI::updateEstimatorsFromParticleCollidingInCellEvent(
-  					  particle,
-  					  distance,
-  					  subtrack_start_time,
-  					  1.0/cell_total_macro_cross_section );
-
+	if( particle_type_observed )
+	{
+	  START_PERFORMANCE_TIMER( ESTIMATOR_TIME );
 	
+	  EMI::updateEstimatorsFromParticleCollidingInCellEvent(
+					  particle,
+					  distance,
+					  subtrack_start_time,
+					  1.0/cell_total_macro_cross_section );
 
-  	EMI::updateEstimatorsFromParticleCollidingGlobalEvent(
-  						      particle,
-  						      ray_start_point,
-  						      particle.getPosition() );
+	  EMI::updateEstimatorsFromParticleCollidingGlobalEvent(
+						      particle,
+						      ray_start_point,
+						      particle.getPosition() );
+
+	  STOP_PERFORMANCE_TIMER( ESTIMATOR_TIME );
+	}
 
   	// Undergo a collision with the material in the cell
-  	CMI::collideWithCellMaterial( particle, bank, true );
+	START_PERFORMANCE_TIMER( COLLISION_TIME );
+	START_SECONDARIES_BANKED_COUNTER( bank );
+	
+  	CMI::collideWithCellMaterial( 
+		    particle, 
+		    bank, 
+		    !SimulationGeneralProperties::isImplicitCaptureModeOn() );
+
+	STOP_PERFORMANCE_TIMER( COLLISION_TIME );
+	STOP_SECONDARIES_BANKED_COUNTER( bank );
+	INCREMENT_COLLISION_COUNTER( particle.getParticleType() );
 
   	// Indicate that a collision has occurred
   	GMI::newRay();
 
   	// Cache the current position of the new ray
-  	ray_start_point[0] = particle.getXPosition();
-  	ray_start_point[1] = particle.getYPosition();
-  	ray_start_point[2] = particle.getZPosition();
+	if( particle_type_observed )
+	{
+	  ray_start_point[0] = particle.getXPosition();
+	  ray_start_point[1] = particle.getYPosition();
+	  ray_start_point[2] = particle.getZPosition();
+	}
 
   	// Make sure the energy is above the cutoff
   	if( particle.getEnergy() < SimulationGeneralProperties::getMinParticleEnergy<ParticleStateType>() )
   	  particle.setAsGone();
 
+	// Split or roulette the particle leaving the collision site
+	if( !d_weight_windows.is_null() )
+	  d_weight_windows->applyWeightWindow( particle, bank );
+
+	// Play Russian roulette with low weight particles
+	if( SimulationGeneralProperties::isWeightRouletteOn() )
+	  this->playWeightRoulette( particle );
+
   	// This subtrack is finished
   	break;
       }
@@ -402,15 +1928,48 @@ void ParticleSimulationManager<GeometryHandler,
   }
 
   // Update the global estimators
-  EMI::updateEstimatorsFromParticleCollidingGlobalEvent(
-  						      particle,
-  						      ray_start_point,
-  						      particle.getPosition() );
+  if( particle_type_observed )
+  {
+    EMI::updateEstimatorsFromParticleCollidingGlobalEvent(
+						      particle,
+						      ray_start_point,
+						      particle.getPosition() );
+  }
 
   // Indicate that this particle history is complete
   GMI::newRay();
 }
 
+// Play Russian roulette with a particle that is below the weight cutoff
+/*! \details A particle with a weight below the weight cutoff survives with
+ * a probability equal to its weight divided by the survival weight. A
+ * surviving particle is given the survival weight so that the expected 
+ * weight is preserved.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::playWeightRoulette( 
+						      ParticleState& particle )
+{
+  if( particle.isGone() || 
+      particle.getWeight() >= SimulationGeneralProperties::getWeightCutoff() )
+    return;
+
+  const double survival_weight = 
+    SimulationGeneralProperties::getWeightRouletteSurvivalWeight();
+
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      survival_weight < particle.getWeight() )
+    particle.setWeight( survival_weight );
+  else
+    particle.setAsGone();
+}
+
 // Return the number of histories
 template<typename GeometryHandler,
 	 typename SourceHandler,
@@ -477,6 +2036,19 @@ void ParticleSimulationManager<GeometryHandler,
 {
   d_start_time = start_time;
 }
+
+// Return the start time
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+double ParticleSimulationManager<GeometryHandler,
+                                 SourceHandler,
+                                 EstimatorHandler,
+                                 CollisionHandler>::getStartTime() const
+{
+  return d_start_time;
+}
   
 // Set the end time
 template<typename GeometryHandler,
@@ -494,6 +2066,376 @@ void ParticleSimulationManager<GeometryHandler,
   d_end_time = end_time;
 }
 
+// Simulate an individual electron using the condensed history method
+/*! \details This is a class II condensed history algorithm with a random
+ * hinge. The soft reactions (see MonteCarlo::Electroatom::getSoftReactionTypes)
+ * are grouped into steps while the hard reactions are sampled explicitly. 
+ * A step ends at the next hard collision site or when the max fractional
+ * energy loss per step is reached (whichever is shorter). The soft energy 
+ * loss is deposited continuously along the step using the soft stopping 
+ * power at the start of the step. The multiple scattering deflection of the 
+ * entire step is applied at a hinge point that is sampled uniformly along the 
+ * step. The deflection is sampled from a Henyey-Greenstein distribution with
+ * a mean angle cosine of exp(-s*T), where s is the step length and T is the
+ * soft macroscopic transport cross section (first Goudsmit-Saunderson 
+ * moment). If a surface is crossed the step is truncated at the surface
+ * and a new step is started in the cell that is entered. Track length 
+ * contributions are scored with the energy at the end of each segment. If a
+ * segment would take the electron below the cutoff energy the estimators are
+ * scored with the cutoff energy and the electron is killed. Collision 
+ * estimators are scored with the inverse of the hard macroscopic cross 
+ * section.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+			       SourceHandler,
+			       EstimatorHandler,
+			       CollisionHandler>::simulateElectronCondensedHistory( 
+						       ElectronState& electron,
+						       ParticleBank& bank ) const
+{
+  // Particle tracking information
+  double distance_to_surface_hit, remaining_hard_op;
+  double subtrack_start_time;
+  double ray_start_point[3];
+  double segment_lengths[2];
+
+  // Cache the start point of the ray
+  ray_start_point[0] = electron.getXPosition();
+  ray_start_point[1] = electron.getYPosition();
+  ray_start_point[2] = electron.getZPosition();
+
+  // Surface information
+  typename GMI::InternalSurfaceHandle surface_hit;
+  Teuchos::Array<double> surface_normal( 3 );
+
+  // Cell information
+  typename GMI::InternalCellHandle cell_entering, cell_leaving;
+  double cell_hard_macro_cross_section, cell_soft_stopping_power;
+  double cell_soft_transport_cross_section;
+
+  const double min_energy = 
+    SimulationGeneralProperties::getMinParticleEnergy<ElectronState>();
+  
+  const double max_fractional_energy_loss = 
+    SimulationElectronProperties::getCondensedHistoryMaxFractionalEnergyLoss();
+  
+  // Check if the electron energy is below the cutoff
+  if( electron.getEnergy() < min_energy )
+    electron.setAsGone();
+
+  // Sample the mfp traveled by the electron before a hard collision
+  remaining_hard_op = CMI::sampleOpticalPathLength();
+  
+  while( !electron.isLost() && !electron.isGone() )
+  {
+    // Get the condensed history data for the cell
+    if( !CMI::isCellVoid( electron.getCell(), electron.getParticleType() ) )
+    {
+      cell_hard_macro_cross_section = 
+	CMI::getMacroscopicHardCrossSection( electron );
+
+      cell_soft_stopping_power = CMI::getSoftStoppingPower( electron );
+
+      cell_soft_transport_cross_section = 
+	CMI::getMacroscopicSoftTransportCrossSection( electron );
+    }
+    else
+    {
+      cell_hard_macro_cross_section = 0.0;
+      cell_soft_stopping_power = 0.0;
+      cell_soft_transport_cross_section = 0.0;
+    }
+
+    // Determine the step length
+    double step_length = std::numeric_limits<double>::infinity();
+    bool hard_collision = false;
+
+    if( cell_hard_macro_cross_section > 0.0 )
+    {
+      step_length = remaining_hard_op/cell_hard_macro_cross_section;
+
+      hard_collision = true;
+    }
+
+    if( cell_soft_stopping_power > 0.0 )
+    {
+      double energy_loss_step_length = 
+	max_fractional_energy_loss*electron.getEnergy()/
+	cell_soft_stopping_power;
+
+      if( energy_loss_step_length < step_length )
+      {
+	step_length = energy_loss_step_length;
+
+	hard_collision = false;
+      }
+    }
+
+    // Sample the hinge point
+    if( step_length < std::numeric_limits<double>::infinity() )
+    {
+      segment_lengths[0] = step_length*
+	Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+      segment_lengths[1] = step_length - segment_lengths[0];
+    }
+    else
+    {
+      segment_lengths[0] = step_length;
+      segment_lengths[1] = 0.0;
+    }
+
+    bool step_complete = false;
+    
+    // Transport the electron to the hinge and then to the end of the step
+    for( unsigned segment = 0u; segment < 2u; ++segment )
+    {
+      // Fire a ray at the cell currently containing the electron
+      try{
+	distance_to_surface_hit = 0.0;
+	
+	GMI::fireRay( electron.ray(),
+		      electron.getCell(),
+		      surface_hit,
+		      distance_to_surface_hit );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+      // Get the start time of this subtrack
+      subtrack_start_time = electron.getTime();
+
+      // The step is truncated at the cell boundary
+      if( distance_to_surface_hit < segment_lengths[segment] )
+      {
+	// Advance the electron to the cell boundary
+	electron.advance( distance_to_surface_hit );
+
+	remaining_hard_op -= 
+	  distance_to_surface_hit*cell_hard_macro_cross_section;
+
+	// Deposit the soft energy loss (clamped to the cutoff energy)
+	if( applySoftEnergyLoss( electron,
+				 distance_to_surface_hit,
+				 cell_soft_stopping_power,
+				 min_energy ) )
+	{
+	  EMI::updateEstimatorsFromParticleSubtrackEndingInCellEvent(
+						      electron,
+						      distance_to_surface_hit,
+						      subtrack_start_time );
+	  electron.setAsGone();
+
+	  break;
+	}
+	
+	// Get the surface normal at the intersection point
+	GMI::getSurfaceNormal( surface_hit,
+			       electron.getPosition(),
+			       surface_normal.getRawPtr() );
+
+	cell_leaving = electron.getCell();
+	
+	// Find the cell on the other side of the surface hit
+	try{
+	  cell_entering = GMI::findCellContainingPoint( electron.ray(),
+							cell_leaving,
+							surface_hit );
+	}
+	CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+	electron.setCell( cell_entering );
+
+	// Update estimators
+	EMI::updateEstimatorsFromParticleCrossingSurfaceEvent(
+						  electron,
+						  cell_entering,
+						  cell_leaving,
+						  surface_hit,
+						  distance_to_surface_hit,
+						  subtrack_start_time,
+						  surface_normal.getRawPtr() );
+
+	// Check if a termination cell was encountered
+	if( GMI::isTerminationCell( electron.getCell() ) )
+	  electron.setAsGone();
+	
+	// Start a new step in the cell that was entered
+	break;
+      }
+
+      // The segment ends in this cell
+      else
+      {
+	electron.advance( segment_lengths[segment] );
+
+	remaining_hard_op -= 
+	  segment_lengths[segment]*cell_hard_macro_cross_section;
+
+	// Deposit the soft energy loss (clamped to the cutoff energy)
+	const bool cutoff_reached = 
+	  applySoftEnergyLoss( electron,
+			       segment_lengths[segment],
+			       cell_soft_stopping_power,
+			       min_energy );
+
+	// Update estimators - collision estimators are scored with the 
+	// inverse of the hard (not the total) macroscopic cross section 
+	// since only hard collisions are sampled explicitly
+	if( segment == 1u && hard_collision )
+	{
+	  EMI::updateEstimatorsFromParticleCollidingInCellEvent(
+				      electron,
+				      segment_lengths[segment],
+				      subtrack_start_time,
+				      1.0/cell_hard_macro_cross_section );
+	}
+	else
+	{
+	  EMI::updateEstimatorsFromParticleSubtrackEndingInCellEvent(
+						      electron,
+						      segment_lengths[segment],
+						      subtrack_start_time );
+	}
+
+	if( cutoff_reached )
+	{
+	  electron.setAsGone();
+
+	  break;
+	}
+
+	EMI::updateEstimatorsFromParticleCollidingGlobalEvent(
+						      electron,
+						      ray_start_point,
+						      electron.getPosition() );
+	
+	// Apply the multiple scattering deflection at the hinge
+	if( segment == 0u )
+	{
+	  double mean_angle_cosine = 
+	    exp( -step_length*cell_soft_transport_cross_section );
+	  
+	  electron.rotateDirection( 
+		this->sampleMultipleScatteringAngleCosine( mean_angle_cosine ),
+		2.0*Utility::PhysicalConstants::pi*
+		Utility::RandomNumberGenerator::getRandomNumber<double>() );
+	}
+	else
+	  step_complete = true;
+
+	// Indicate that the direction may have changed
+	GMI::newRay();
+
+	// Cache the current position of the new ray
+	ray_start_point[0] = electron.getXPosition();
+	ray_start_point[1] = electron.getYPosition();
+	ray_start_point[2] = electron.getZPosition();
+      }
+    }
+
+    // Undergo a hard collision with the material in the cell
+    if( step_complete && hard_collision )
+    {
+      CMI::collideHardWithCellMaterial( electron, bank );
+
+      GMI::newRay();
+
+      // Make sure the energy is above the cutoff
+      if( electron.getEnergy() < min_energy )
+	electron.setAsGone();
+
+      // Sample the mfp traveled by the electron before the next hard collision
+      remaining_hard_op = CMI::sampleOpticalPathLength();
+    }
+  }
+
+  // Update the global estimators
+  EMI::updateEstimatorsFromParticleCollidingGlobalEvent(
+						      electron,
+						      ray_start_point,
+						      electron.getPosition() );
+
+  // Indicate that this particle history is complete
+  GMI::newRay();
+}
+
+// Simulate an individual electron using thick-target bremsstrahlung
+/*! \details The electron is not transported. Its energy is deposited 
+ * locally and the bremsstrahlung photons that it would have emitted while
+ * slowing down in the cell material are banked immediately (see
+ * MonteCarlo::ElectronMaterial::emitThickTargetBremsstrahlung). Electrons 
+ * in void cells are simply killed.
+ */
+template<typename GeometryHandler,
+         typename SourceHandler,
+         typename EstimatorHandler,
+         typename CollisionHandler>
+void ParticleSimulationManager<GeometryHandler,
+                               SourceHandler,
+                               EstimatorHandler,
+                               CollisionHandler>::simulateElectronThickTargetBremsstrahlung( 
+                                                       ElectronState& electron,
+						       ParticleBank& bank ) const
+{
+  if( electron.getEnergy() >= 
+      SimulationGeneralProperties::getMinParticleEnergy<ElectronState>() &&
+      !CMI::isCellVoid( electron.getCell(), electron.getParticleType() ) )
+  {
+    CMI::emitThickTargetBremsstrahlungInCellMaterial( electron, bank );
+  }
+
+  electron.setAsGone();
+}
+
+// Sample a multiple scattering angle cosine with the desired mean
+/*! \details The angle cosine is sampled from the Henyey-Greenstein 
+ * distribution, which has a mean angle cosine of g and can be sampled 
+ * directly.
+ */
+template<typename GeometryHandler,
+	 typename SourceHandler,
+	 typename EstimatorHandler,
+	 typename CollisionHandler>
+double ParticleSimulationManager<GeometryHandler,
+				 SourceHandler,
+				 EstimatorHandler,
+				 CollisionHandler>::sampleMultipleScatteringAngleCosine( 
+					       const double mean_angle_cosine )
+{
+  // Make sure the mean angle cosine is valid
+  testPrecondition( mean_angle_cosine >= 0.0 );
+  testPrecondition( mean_angle_cosine <= 1.0 );
+
+  const double random_number = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  double angle_cosine;
+
+  // The distribution is isotropic when the mean is zero
+  if( mean_angle_cosine < 1e-6 )
+    angle_cosine = 2.0*random_number - 1.0;
+  else
+  {
+    const double g = mean_angle_cosine;
+
+    const double arg = ( 1.0 - g*g )/( 1.0 - g + 2.0*g*random_number );
+
+    angle_cosine = ( 1.0 + g*g - arg*arg )/( 2.0*g );
+
+    // Roundoff can push the angle cosine out of [-1,1]
+    if( angle_cosine > 1.0 )
+      angle_cosine = 1.0;
+    else if( angle_cosine < -1.0 )
+      angle_cosine = -1.0;
+  }
+
+  return angle_cosine;
+}
+
 // Set the number of particle histories to simulate
 template<typename GeometryHandler,
          typename SourceHandler,
@@ -525,7 +2467,40 @@ void ParticleSimulationManager<GeometryHandler,
   os << "Number of histories completed: " << d_histories_completed <<std::endl;
   os << "Simulation Time (s): " << d_end_time - d_start_time << std::endl;
   os << "Previous Simulation Time (s): " << d_previous_run_time << std::endl;
+
+  // Print the multiplication factor statistics of the active cycles
+  if( d_cycle_multiplication_factors.size() > 0 )
+  {
+    double first_moment = 0.0, second_moment = 0.0;
+
+    for( unsigned i = 0; i < d_cycle_multiplication_factors.size(); ++i )
+    {
+      first_moment += d_cycle_multiplication_factors[i];
+      second_moment += d_cycle_multiplication_factors[i]*
+	d_cycle_multiplication_factors[i];
+    }
+
+    const double n = d_cycle_multiplication_factors.size();
+
+    const double mean = first_moment/n;
+
+    double std_dev = 0.0;
+
+    if( n > 1.0 )
+    {
+      std_dev = std::sqrt( std::max( second_moment/n - mean*mean, 0.0 )/
+			   (n - 1.0) );
+    }
+
+    os << "Active Cycles: " << d_cycle_multiplication_factors.size() 
+       << std::endl;
+    os << "k-effective: " << mean << " +/- " << std_dev << std::endl;
+  }
+  
   os << std::endl;
+
+  // Print the performance counters (if they have been compiled in)
+  PerformanceCounters::printSummary( os );
   
   EMI::printEstimators( os,
 			d_histories_completed,
@@ -554,6 +2529,8 @@ void ParticleSimulationManager<GeometryHandler,
   			    d_end_time+d_previous_run_time,
 			    true );
 
+  PerformanceCounters::exportData( data_file_name );
+
   std::cout << "done." << std::endl;
 }
 
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <iostream>
+
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSourceFactory.hpp"
 #include "MonteCarlo_StateSource.hpp"
@@ -68,8 +71,8 @@ void ParticleSourceFactory::validateSourceRep(
   {
     TEST_FOR_EXCEPTION( !source_rep.isParameter( "Particle State File" ),
 			InvalidParticleSourceRepresentation,
-			"Error: A state source needs to have a the particle "
-			"state hdf5 file specified!" );
+			"Error: A state source needs to have the particle "
+			"state (phase space) file specified!" );
    
     valid_source = true;
   }
@@ -129,7 +132,35 @@ double ParticleSourceFactory::createStateSource(
 				      Teuchos::RCP<ParticleSource>& source,
 				      const unsigned num_sources )
 {
-  return 0.0;
+  // Extract the phase space file name
+  std::string phase_space_file_name = 
+    source_rep.get<std::string>( "Particle State File" );
+
+  Teuchos::RCP<StateSource> source_tmp;
+  
+  try{
+    source_tmp.reset( new StateSource( phase_space_file_name ) );
+  }
+  EXCEPTION_CATCH_RETHROW_AS( std::runtime_error,
+			      InvalidParticleSourceRepresentation,
+			      "Error: The state source particle state file "
+			      << phase_space_file_name << " could not be "
+			      "loaded!" );
+
+  // Set the return source
+  source = Teuchos::rcp_dynamic_cast<ParticleSource>( source_tmp );
+
+  double weight;
+  // Return the weight of the source
+  if( num_sources == 1u )
+    weight = 1.0;
+  else
+    weight = source_rep.get<double>( "Weight" );
+
+  // Print out unused parameters
+  source_rep.unused( std::cout );
+
+  return weight;
 }
 
 } // end MonteCarlo namespace
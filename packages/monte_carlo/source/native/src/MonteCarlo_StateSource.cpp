@@ -29,6 +29,8 @@ StateSource::StateSource(
 		    const std::string& state_source_bank_archive_name,
 		    const std::string& bank_name_in_archive,
 		    const Utility::ArchivableObject::ArchiveType archive_type )
+  : d_particle_states(),
+    d_phase_space_file()
 { 
   // Make sure that the source bank archive name is valid
   testPrecondition( state_source_bank_archive_name.size() > 0 );
@@ -94,10 +96,45 @@ StateSource::StateSource(
   }
 }
 
+// Constructor (phase space file)
+/*! \details The history i in the source corresponds to the ith history
+ * that was recorded in the phase space file.
+ */
+StateSource::StateSource( const std::string& phase_space_file_name )
+  : d_particle_states(),
+    d_phase_space_file( new PhaseSpaceFileReader( phase_space_file_name ) )
+{ /* ... */ }
+
 // Sample a particle state from the source
 void StateSource::sampleParticleState( ParticleBank& bank,
 				       const unsigned long long history )
 {
+  if( d_phase_space_file )
+  {
+    TEST_FOR_EXCEPTION( history >= d_phase_space_file->getNumberOfHistories(),
+			std::runtime_error,
+			"Error: No particle states in the state source were "
+			"found for history number " << history << "!" );
+
+    const PhaseSpaceRecord* records =
+      d_phase_space_file->getHistoryRecords( history );
+
+    unsigned long long number_of_records =
+      d_phase_space_file->getNumberOfHistoryRecords( history );
+
+    boost::shared_ptr<ParticleState> particle;
+
+    // The bank takes the particle (the smart pointer will be reset)
+    for( unsigned long long i = 0ull; i < number_of_records; ++i )
+    {
+      createParticleState( particle, records[i], history );
+
+      bank.push( particle );
+    }
+
+    return;
+  }
+
   TEST_FOR_EXCEPTION( d_particle_states.find( history ) ==
 		      d_particle_states.end(),
 		      std::runtime_error,
@@ -114,6 +151,15 @@ double StateSource::getSamplingEfficiency() const
   return 1.0;
 }
 
+// Return the number of histories in the source
+unsigned long long StateSource::getNumberOfHistories() const
+{
+  if( d_phase_space_file )
+    return d_phase_space_file->getNumberOfHistories();
+  else
+    return d_particle_states.size();
+}
+
 // Compare two particle state cores
 bool StateSource::compareHistoryNumbers( const ParticleState& state_a,
 					 const ParticleState& state_b )
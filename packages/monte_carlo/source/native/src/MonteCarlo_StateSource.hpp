@@ -21,11 +21,19 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSource.hpp"
+#include "MonteCarlo_PhaseSpaceFileReader.hpp"
 #include "Utility_ArchivableObject.hpp"
 
 namespace MonteCarlo{
 
-//! The state source class
+/*! The state source class
+ * \details The particle states can be loaded from an archived particle bank
+ * or from a phase space file (see MonteCarlo::PhaseSpaceSurfaceObserver).
+ * The archived bank is loaded into memory all at once. The phase space file
+ * is memory mapped and the particle states of a history are only created
+ * when the history is sampled. In both cases the histories are renumbered
+ * so that the first history in the source is history 0.
+ */
 class StateSource : public ParticleSource
 {
   
@@ -36,6 +44,9 @@ public:
 	       const std::string& bank_name_in_archive,
 	       const Utility::ArchivableObject::ArchiveType archive_type );
 
+  //! Constructor (phase space file)
+  StateSource( const std::string& phase_space_file_name );
+
   //! Destructor
   ~StateSource()
   { /* ... */ }
@@ -47,6 +58,9 @@ public:
   //! Return the sampling efficiency from the source 
   double getSamplingEfficiency() const;
 
+  //! Return the number of histories in the source
+  unsigned long long getNumberOfHistories() const;
+
 private:
 
   // Compare two particle state cores
@@ -56,6 +70,9 @@ private:
   // The possible states
   boost::unordered_map<unsigned long long,Teuchos::Array<boost::shared_ptr<ParticleState> > >
   d_particle_states;
+
+  // The phase space file reader (only used with a phase space file)
+  boost::shared_ptr<const PhaseSpaceFileReader> d_phase_space_file;
 };
 
 } // end MonteCarlo namespace
@@ -24,6 +24,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_NeutronState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_PhaseSpaceFileWriter.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 
 //---------------------------------------------------------------------------//
@@ -32,6 +33,8 @@
 
 Teuchos::RCP<MonteCarlo::ParticleSource> source;
 
+Teuchos::RCP<MonteCarlo::StateSource> phase_space_source;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -84,6 +87,46 @@ TEUCHOS_UNIT_TEST( StateSource, getSamplingEfficiency )
   TEST_EQUALITY_CONST( source->getSamplingEfficiency(), 1.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that particle states can be "sampled" from a phase space file
+TEUCHOS_UNIT_TEST( StateSource, sampleParticleState_phase_space )
+{
+  TEST_EQUALITY_CONST( phase_space_source->getNumberOfHistories(), 2ull );
+  
+  MonteCarlo::ParticleBank bank;
+  phase_space_source->sampleParticleState( bank, 0 );
+
+  TEST_EQUALITY_CONST( bank.size(), 2 );
+
+  TEST_EQUALITY_CONST( bank.top().getHistoryNumber(), 0ull );
+  TEST_EQUALITY_CONST( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  TEST_EQUALITY_CONST( bank.top().getEnergy(), 1.0 );
+  TEST_EQUALITY_CONST( bank.top().getWeight(), 0.5 );
+  
+  bank.pop();
+    
+  TEST_EQUALITY_CONST( bank.top().getHistoryNumber(), 0ull );
+  TEST_EQUALITY_CONST( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  TEST_EQUALITY_CONST( bank.top().getEnergy(), 2.0 );
+  
+  bank.pop();
+
+  // Sample from the source again
+  phase_space_source->sampleParticleState( bank, 1 );
+
+  TEST_EQUALITY_CONST( bank.size(), 1 );
+
+  TEST_EQUALITY_CONST( bank.top().getHistoryNumber(), 1ull );
+  TEST_EQUALITY_CONST( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+  TEST_EQUALITY_CONST( bank.top().getZPosition(), 3.0 );
+  
+  bank.pop();
+
+  // Attempting to get another particle state should cause an exception
+  TEST_THROW( phase_space_source->sampleParticleState( bank, 2 ), 
+	      std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
@@ -140,6 +183,38 @@ int main( int argc, char** argv )
 				    bank_name_in_archive,
 				    Utility::ArchivableObject::XML_ARCHIVE ) );
   }
+
+  // Initialize the phase space source
+  {
+    std::string phase_space_file_name( "test_state_source.psf" );
+    
+    {
+      MonteCarlo::PhaseSpaceFileWriter writer( phase_space_file_name );
+
+      MonteCarlo::PhaseSpaceRecord record;
+
+      MonteCarlo::PhotonState photon( 4ull );
+      photon.setEnergy( 1.0 );
+      photon.setWeight( 0.5 );
+
+      MonteCarlo::fillPhaseSpaceRecord( record, photon, 1 );
+      writer.write( &record, 1 );
+
+      photon.setEnergy( 2.0 );
+
+      MonteCarlo::fillPhaseSpaceRecord( record, photon, 2 );
+      writer.write( &record, 1 );
+
+      MonteCarlo::NeutronState neutron( 7ull );
+      neutron.setPosition( 1.0, 2.0, 3.0 );
+
+      MonteCarlo::fillPhaseSpaceRecord( record, neutron, 1 );
+      writer.write( &record, 1 );
+    }
+
+    phase_space_source.reset( 
+		       new MonteCarlo::StateSource( phase_space_file_name ) );
+  }
   
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
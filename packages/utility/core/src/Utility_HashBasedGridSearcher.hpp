@@ -9,6 +9,9 @@
 #ifndef UTILITY_HASH_BASED_GRID_SEARCHER_HPP
 #define UTILITY_HASH_BASED_GRID_SEARCHER_HPP
 
+// Trilinos Includes
+#include <Teuchos_ArrayView.hpp>
+
 namespace Utility{
 
 //! The hash-based grid searcher
@@ -22,8 +25,24 @@ public:
 
   //! Return the index of the lower bin boundary that a value falls in
   virtual unsigned findLowerBinIndex( const double value ) const = 0;
+
+  //! Return the indices of the lower bin boundaries that the values fall in
+  virtual void findLowerBinIndices( 
+		       const Teuchos::ArrayView<const double>& values,
+		       const Teuchos::ArrayView<unsigned>& bin_indices ) const;
 };
 
+// Return the indices of the lower bin boundaries that the values fall in
+/*! \details By default the values will be searched for one at a time.
+ */
+inline void HashBasedGridSearcher::findLowerBinIndices( 
+		        const Teuchos::ArrayView<const double>& values,
+		        const Teuchos::ArrayView<unsigned>& bin_indices ) const
+{
+  for( unsigned i = 0; i < values.size(); ++i )
+    bin_indices[i] = this->findLowerBinIndex( values[i] );
+}
+
 } // end Utility namespace
 
 #endif // end UTILITY_HASH_BASED_GRID_SEARCHER_HPP
@@ -50,8 +50,18 @@ public:
   //! Return the index of the lower bin boundary that a value falls in
   unsigned findLowerBinIndex( const double value ) const;
 
+  //! Return the indices of the lower bin boundaries that the values fall in
+  void findLowerBinIndices( 
+		       const Teuchos::ArrayView<const double>& values,
+		       const Teuchos::ArrayView<unsigned>& bin_indices ) const;
+
   private:
 
+  // Search the hash grid bins for the lower bin boundaries of the values
+  void searchHashGridBins( 
+		       const Teuchos::ArrayView<const double>& values,
+		       const Teuchos::ArrayView<unsigned>& bin_indices ) const;
+
   // Initialize the hash grid
   void initializeHashGrid();
 
@@ -107,8 +117,18 @@ public:
   //! Return the index of the lower bin boundary that a value falls in
   unsigned findLowerBinIndex( const double value ) const;
 
+  //! Return the indices of the lower bin boundaries that the values fall in
+  void findLowerBinIndices( 
+		       const Teuchos::ArrayView<const double>& values,
+		       const Teuchos::ArrayView<unsigned>& bin_indices ) const;
+
   private:
 
+  // Search the hash grid bins for the lower bin boundaries of the values
+  void searchHashGridBins( 
+		       const Teuchos::ArrayView<const double>& values,
+		       const Teuchos::ArrayView<unsigned>& bin_indices ) const;
+
   // Test if a value is less than or equal to zero
   static bool lessThanOrEqualToZero( const double value );
 
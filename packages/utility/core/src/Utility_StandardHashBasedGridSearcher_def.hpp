@@ -13,6 +13,9 @@
 #include <cmath>
 #include <algorithm>
 
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
 // FRENSIE Includes
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_SearchAlgorithms.hpp"
@@ -232,6 +235,126 @@ StandardHashBasedGridSearcher<STLCompliantArray,false>::findLowerBinIndex(
     return --index;
 }
 
+// Return the indices of the lower bin boundaries that the values fall in
+/*! \details The values are processed together before any searches are
+ * done so that the log evaluations can be vectorized. Sorting the values
+ * before calling this method will improve the cache performance of the 
+ * searches.
+ */
+template<typename STLCompliantArray,bool processed_grid>
+void StandardHashBasedGridSearcher<STLCompliantArray,processed_grid>::findLowerBinIndices( 
+		        const Teuchos::ArrayView<const double>& values,
+		        const Teuchos::ArrayView<unsigned>& bin_indices ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( values.size() == bin_indices.size() );
+
+  Teuchos::Array<double> processed_values( values.size() );
+
+  for( unsigned i = 0; i < values.size(); ++i )
+  {
+    // Make sure the value is valid
+    testPrecondition( this->isValueWithinGridBounds( values[i] ) );
+    
+    processed_values[i] = log( values[i] );
+  }
+
+  this->searchHashGridBins( processed_values(), bin_indices );
+}
+
+// Return the indices of the lower bin boundaries that the values fall in
+/*! \details Sorting the values before calling this method will improve the
+ * cache performance of the searches.
+ */
+template<typename STLCompliantArray>
+void StandardHashBasedGridSearcher<STLCompliantArray,false>::findLowerBinIndices( 
+		        const Teuchos::ArrayView<const double>& values,
+		        const Teuchos::ArrayView<unsigned>& bin_indices ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( values.size() == bin_indices.size() );
+  
+  for( unsigned i = 0; i < values.size(); ++i )
+  {
+    // Make sure the value is valid
+    testPrecondition( this->isValueWithinGridBounds( values[i] ) );
+  }
+
+  this->searchHashGridBins( values, bin_indices );
+}
+
+// Search the hash grid bins for the lower bin boundaries of the values
+/*! \details The hash grid indices of all values are calculated first 
+ * (without branching) so that the loop can be vectorized. The last hash
+ * grid bin is used for values that fall on the max hash grid value.
+ */
+template<typename STLCompliantArray,bool processed_grid>
+void StandardHashBasedGridSearcher<STLCompliantArray,processed_grid>::searchHashGridBins( 
+		        const Teuchos::ArrayView<const double>& processed_values,
+		        const Teuchos::ArrayView<unsigned>& bin_indices ) const
+{
+  const unsigned max_hash_grid_index = d_hash_grid_size-2;
+  
+  for( unsigned i = 0; i < processed_values.size(); ++i )
+  {
+    unsigned hash_grid_index = 
+      std::floor( (d_hash_grid_size-1)*(processed_values[i] - d_hash_grid_min)/
+		  d_hash_grid_length );
+
+    bin_indices[i] = std::min( hash_grid_index, max_hash_grid_index );
+  }
+
+  const unsigned max_bin_index = d_grid.size()-2;
+
+  for( unsigned i = 0; i < processed_values.size(); ++i )
+  {
+    typename STLCompliantArray::const_iterator lower_bin_boundary = 
+      Search::binaryLowerBound( d_hash_grid[bin_indices[i]],
+				d_hash_grid[bin_indices[i]+1]+2,
+				processed_values[i] );
+
+    unsigned index = lower_bin_boundary - d_grid.begin();
+    
+    bin_indices[i] = std::min( index, max_bin_index );
+  }
+}
+
+// Search the hash grid bins for the lower bin boundaries of the values
+/*! \details The hash grid indices of all values are calculated first 
+ * (without branching) so that the loop can be vectorized. The last hash
+ * grid bin is used for values that fall on the max hash grid value.
+ */
+template<typename STLCompliantArray>
+void StandardHashBasedGridSearcher<STLCompliantArray,false>::searchHashGridBins( 
+		        const Teuchos::ArrayView<const double>& values,
+		        const Teuchos::ArrayView<unsigned>& bin_indices ) const
+{
+  const unsigned max_hash_grid_index = d_hash_grid_size-2;
+  
+  for( unsigned i = 0; i < values.size(); ++i )
+  {
+    unsigned hash_grid_index = 
+      std::floor( (d_hash_grid_size-1)*(values[i] - d_hash_grid_min)/
+		  d_hash_grid_length );
+
+    bin_indices[i] = std::min( hash_grid_index, max_hash_grid_index );
+  }
+
+  const unsigned max_bin_index = d_grid.size()-2;
+
+  for( unsigned i = 0; i < values.size(); ++i )
+  {
+    typename STLCompliantArray::const_iterator lower_bin_boundary = 
+      Search::binaryLowerBound( d_hash_grid[bin_indices[i]],
+				d_hash_grid[bin_indices[i]+1]+2,
+				values[i] );
+
+    unsigned index = lower_bin_boundary - d_grid.begin();
+    
+    bin_indices[i] = std::min( index, max_bin_index );
+  }
+}
+
 // Test if a value is less than or equal to zero
 template<typename STLCompliantArray>
 bool StandardHashBasedGridSearcher<STLCompliantArray,false>::lessThanOrEqualToZero( const double value )
@@ -15,6 +15,7 @@
 #include <Teuchos_VerboseObject.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_Array.hpp>
 
 // FRENSIE Includes
 #include "Utility_StandardHashBasedGridSearcher.hpp"
@@ -112,6 +113,57 @@ TEUCHOS_UNIT_TEST( HashBasedGridGenerator, findLowerBinIndex_processed )
   TEST_EQUALITY_CONST( grid_index, 998u );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the indices of the lower bin boundaries of values can be found
+TEUCHOS_UNIT_TEST( HashBasedGridGenerator, findLowerBinIndices )
+{
+  Teuchos::Array<double> values( 7 );
+  values[0] = 1.0;
+  values[1] = 1.5;
+  values[2] = 10.0;
+  values[3] = 10.5;
+  values[4] = 100.0;
+  values[5] = 100.5;
+  values[6] = 1000.0;
+
+  Teuchos::Array<unsigned> grid_indices( values.size() );
+
+  grid_searcher->findLowerBinIndices( values(), grid_indices() );
+
+  TEST_EQUALITY_CONST( grid_indices[0], 0u );
+  TEST_EQUALITY_CONST( grid_indices[1], 0u );
+  TEST_EQUALITY_CONST( grid_indices[2], 9u );
+  TEST_EQUALITY_CONST( grid_indices[3], 9u );
+  TEST_EQUALITY_CONST( grid_indices[4], 99u );
+  TEST_EQUALITY_CONST( grid_indices[5], 99u );
+  TEST_EQUALITY_CONST( grid_indices[6], 998u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the indices of the lower bin boundaries of values can be found
+TEUCHOS_UNIT_TEST( HashBasedGridGenerator, findLowerBinIndices_processed )
+{
+  Teuchos::Array<double> values( 7 );
+  values[0] = 1.0;
+  values[1] = 1.5;
+  values[2] = 10.0;
+  values[3] = 10.5;
+  values[4] = 100.0;
+  values[5] = 100.5;
+  values[6] = 1000.0;
+
+  Teuchos::Array<unsigned> grid_indices( values.size() );
+
+  processed_grid_searcher->findLowerBinIndices( values(), grid_indices() );
+
+  for( unsigned i = 0; i < values.size(); ++i )
+  {
+    TEST_EQUALITY( grid_indices[i], 
+		   processed_grid_searcher->findLowerBinIndex( values[i] ) );
+  }
+
+  TEST_EQUALITY_CONST( grid_indices[6], 998u );
+}
 
 //---------------------------------------------------------------------------//
 // Custom main function
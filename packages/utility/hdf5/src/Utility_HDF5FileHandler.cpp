@@ -15,6 +15,7 @@
 // FRENSIE Includes
 #include "Utility_HDF5FileHandler.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_ContractException.hpp"
 
 namespace Utility{
 
@@ -195,6 +196,35 @@ bool HDF5FileHandler::doesDataSetAttributeExist(
   return dataset_attribute_exists;
 }
 
+// Return the dimensions of an HDF5 file data set
+/*! \param[in,out] dimensions The array that will be used to store the
+ * dimensions of the dataset.
+ * \param[in] location_in_file The location of the dataset in the HDF5 file.
+ */
+void HDF5FileHandler::getDataSetDimensions(
+				    Teuchos::Array<hsize_t> &dimensions,
+				    const std::string &location_in_file ) const
+{
+  // The dataset_location must be absolute (start with /)
+  testPrecondition( location_in_file.compare( 0, 1, "/" ) == 0 );
+
+  // HDF5 exceptions can be thrown when opening a dataset
+  try
+  {
+    H5::DataSet dataset( d_hdf5_file->openDataSet( location_in_file ) );
+
+    H5::DataSpace dataspace = dataset.getSpace();
+
+    dimensions.resize( dataspace.getSimpleExtentNdims() );
+
+    dataspace.getSimpleExtentDims( dimensions.getRawPtr(), NULL );
+  }
+
+  HDF5_EXCEPTION_CATCH( std::runtime_error,
+			HDF5FileHandler::print_and_exit,
+			"Get Data Set Dimensions Error" );
+}
+
 /*! \details This function can be used to create a group heirarchy or to
  * create a directory at the desired location of the HDF5 file.
  * \param[in] path_name The name of the path containing parent groups that
@@ -80,6 +80,17 @@ public:
   void writeArrayToDataSet( const Array &data,
 			    const std::string &location_in_file );
 
+  //! Write data in array to a chunked and compressed HDF5 file data set
+  template<typename Array>
+  void writeArrayToChunkedDataSet( const Array &data,
+				   const Teuchos::Array<hsize_t> &dimensions,
+				   const std::string &location_in_file,
+				   const unsigned compression_level = 6u );
+
+  //! Return the dimensions of an HDF5 file data set
+  void getDataSetDimensions( Teuchos::Array<hsize_t> &dimensions,
+			     const std::string &location_in_file ) const;
+
   //! Read in HDF5 file dataset and save the data to an array
   template<typename Array>
   void readArrayFromDataSet( Array &data,
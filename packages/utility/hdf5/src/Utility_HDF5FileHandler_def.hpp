@@ -11,6 +11,9 @@
 
 //Std Lib Includes
 #include <string>
+#include <algorithm>
+#include <numeric>
+#include <functional>
 
 // Trilinos Includes
 #include <Teuchos_Array.hpp>
@@ -89,6 +92,114 @@ void HDF5FileHandler::writeArrayToDataSet(const Array &data,
 			"Write Array to Data Set Error" );
 }
 
+// Write data in array to a chunked and compressed HDF5 file data set
+/*! \tparam Array An array class. Any array class that has a 
+ *          Utility::ArrayTraits specialization can be used. 
+ * \param[in] data The data array to write to the HDF5 file dataset (stored
+ *            in row-major order).
+ * \param[in] dimensions The dimensions of the dataset.
+ * \param[in] location_in_file The location in the HDF5 file where the data will
+ *            be written.
+ * \param[in] compression_level The deflate (gzip) compression level (0-9). A
+ *            level of 0 disables compression.
+ * \details The dataset is chunked along its first dimension only so that
+ * every chunk contains complete rows (e.g. all of the bins of a group of
+ * entities). The number of rows in a chunk is chosen so that a chunk is
+ * roughly 1 MB. The shuffle and deflate filters are only applied if they are
+ * available in the HDF5 library. Chunked datasets can be read with 
+ * Utility::HDF5FileHandler::readArrayFromDataSet.
+ * \pre 
+ * <ul>
+ *  <li> A valid location string, which is any string that does not start with
+ *       a "/", must be given to this function.
+ *  <li> The dimensions must be non-zero and consistent with the array size.
+ *  <li> The compression level must be between 0 and 9.
+ * </ul>
+ */
+template<typename Array>
+void HDF5FileHandler::writeArrayToChunkedDataSet( 
+				    const Array &data,
+				    const Teuchos::Array<hsize_t> &dimensions,
+				    const std::string &location_in_file,
+				    const unsigned compression_level )
+{
+  // The dataset_location must be absolute (start with /)
+  testPrecondition( location_in_file.compare( 0, 1, "/" ) == 0 );
+  // The dimensions must be valid
+  testPrecondition( dimensions.size() > 0 );
+  testPrecondition( std::find( dimensions.begin(), dimensions.end(), 0 ) ==
+		    dimensions.end() );
+  testPrecondition( std::accumulate( dimensions.begin(), 
+				     dimensions.end(),
+				     (hsize_t)1,
+				     std::multiplies<hsize_t>() ) ==
+		    getArraySize( data ) );
+  // The compression level must be valid
+  testPrecondition( compression_level <= 9u );
+  
+  // Type contained in the array
+  typedef typename ArrayTraits<Array>::value_type value_type;
+
+  // The target size of a chunk (bytes)
+  const hsize_t target_chunk_size = 1048576;
+  
+  // HDF5 exceptions can be thrown when creating a dataset or writing to a 
+  // dataset
+  try
+  {
+    if( this->doesDataSetExist( location_in_file ) )
+    {
+      H5::DataSet dataset( d_hdf5_file->openDataSet( location_in_file ) );
+      
+      dataset.write( getHeadPtr( data ),
+		     HDF5TypeTraits<value_type>::dataType() );
+    }
+    else
+    {
+      // Create any parent groups that do not exist yet in the location path
+      createParentGroups( location_in_file );
+
+      // Chunk along the first dimension only
+      Teuchos::Array<hsize_t> chunk_dimensions( dimensions );
+
+      hsize_t row_size = sizeof( value_type );
+
+      for( unsigned i = 1; i < dimensions.size(); ++i )
+	row_size *= dimensions[i];
+
+      chunk_dimensions[0] = 
+	std::max( target_chunk_size/row_size, (hsize_t)1 );
+      chunk_dimensions[0] = std::min( chunk_dimensions[0], dimensions[0] );
+
+      H5::DSetCreatPropList property_list;
+      property_list.setChunk( chunk_dimensions.size(),
+			      chunk_dimensions.getRawPtr() );
+
+      if( compression_level > 0u )
+      {
+	if( H5Zfilter_avail( H5Z_FILTER_SHUFFLE ) )
+	  property_list.setShuffle();
+	
+	if( H5Zfilter_avail( H5Z_FILTER_DEFLATE ) )
+	  property_list.setDeflate( compression_level );
+      }
+      
+      H5::DataSpace space( dimensions.size(), dimensions.getRawPtr() );
+      H5::DataSet dataset( d_hdf5_file->createDataSet( 
+					location_in_file,
+					HDF5TypeTraits<value_type>::dataType(),
+					space,
+					property_list ) );
+      dataset.write( getHeadPtr( data ),
+		     HDF5TypeTraits<value_type>::dataType() );
+    }
+  }
+  
+  HDF5_EXCEPTION_CATCH( std::runtime_error,
+			HDF5FileHandler::print_and_exit,
+			"Write Array to Chunked Data Set Error" );
+}
+
 // Read in HDF5 file dataset and save the data to an array
 /*! \tparam Array An array class. Any array class that has a 
  *          Utility::ArrayTraits specialization can be used. 
@@ -409,6 +409,52 @@ UNIT_TEST_INSTANTIATION_TEUCHOS_ARRAY( HDF5FileHandler,
 				       TwoDArray );
 UNIT_TEST_INSTANTIATION_STD_VECTOR( HDF5FileHandler, readArrayFromDataSet );
 
+//---------------------------------------------------------------------------//
+// Check that the HDF5FileHandler can write an Array of Type to a chunked
+// and compressed dataset in an HDF5 file
+TEUCHOS_UNIT_TEST( HDF5FileHandler, writeArrayToChunkedDataSet )
+{
+  Utility::HDF5FileHandler hdf5_file_handler;
+
+  hdf5_file_handler.openHDF5FileAndOverwrite( HDF5_TEST_FILE_NAME );
+
+  Teuchos::Array<Utility::Pair<double,double> > data_original( 50 );
+
+  for( unsigned i = 0; i < data_original.size(); ++i )
+  {
+    data_original[i].first = i;
+    data_original[i].second = i*i;
+  }
+
+  Teuchos::Array<hsize_t> dimensions( 2 );
+  dimensions[0] = 10;
+  dimensions[1] = 5;
+
+  TEST_NOTHROW( hdf5_file_handler.writeArrayToChunkedDataSet( data_original,
+							       dimensions,
+							       DATASET_NAME ) );
+  
+  Teuchos::Array<hsize_t> dataset_dimensions;
+  
+  hdf5_file_handler.getDataSetDimensions( dataset_dimensions, DATASET_NAME );
+
+  TEST_COMPARE_ARRAYS( dataset_dimensions, dimensions );
+
+  Teuchos::Array<Utility::Pair<double,double> > data;
+
+  hdf5_file_handler.readArrayFromDataSet( data, DATASET_NAME );
+
+  UTILITY_TEST_COMPARE_ARRAYS( data_original, data );
+
+  // Write data to an existing data set
+  TEST_NOTHROW( hdf5_file_handler.writeArrayToChunkedDataSet( data_original,
+							       dimensions,
+							       DATASET_NAME,
+							       0u ) );
+
+  hdf5_file_handler.closeHDF5File();
+}
+
 //---------------------------------------------------------------------------//
 // Check that the HDF5FileHandler can write an Array of Type to a dataset
 // attribute in an HDF5 file
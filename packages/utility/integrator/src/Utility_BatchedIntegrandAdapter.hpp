@@ -0,0 +1,65 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_BatchedIntegrandAdapter.hpp
+//! \author Luke Kersting
+//! \brief  Batched integrand adapter for scalar integrand functors
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_BATCHED_INTEGRAND_ADAPTER_HPP
+#define UTILITY_BATCHED_INTEGRAND_ADAPTER_HPP
+
+namespace Utility{
+
+//! The batched integrand adapter
+/*! \details The batched Gauss-Kronrod integration methods require a functor
+ * with operator()( const double*, double*, const unsigned ) defined, which
+ * evaluates the integrand at every abscissa in a batch with a single call.
+ * This adapter allows any functor with operator()( double ) defined to be
+ * used with the batched integration methods.
+ */
+template<typename Functor>
+class BatchedIntegrandAdapter
+{
+
+public:
+
+  //! Constructor
+  BatchedIntegrandAdapter( Functor& integrand )
+    : d_integrand( integrand )
+  { /* ... */ }
+
+  //! Destructor
+  ~BatchedIntegrandAdapter()
+  { /* ... */ }
+
+  //! Evaluate the integrand at every abscissa in the batch
+  void operator()( const double* abscissae,
+                   double* integrand_values,
+                   const unsigned number_of_abscissae ) const
+  {
+    for( unsigned i = 0; i < number_of_abscissae; ++i )
+      integrand_values[i] = d_integrand( abscissae[i] );
+  }
+
+private:
+
+  // The scalar integrand
+  Functor& d_integrand;
+};
+
+//! Create a batched integrand adapter for a scalar integrand
+template<typename Functor>
+inline BatchedIntegrandAdapter<Functor>
+createBatchedIntegrandAdapter( Functor& integrand )
+{
+  return BatchedIntegrandAdapter<Functor>( integrand );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_BATCHED_INTEGRAND_ADAPTER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_BatchedIntegrandAdapter.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_GaussKronrodBatchedQuadratureSet.hpp
+//! \author Luke Kersting
+//! \brief  Gauss-Kronrod quadrature set expanded over every rule node
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_GAUSS_KRONROD_BATCHED_QUADRATURE_SET_HPP
+#define UTILITY_GAUSS_KRONROD_BATCHED_QUADRATURE_SET_HPP
+
+// FRENSIE Includes
+#include "Utility_GaussKronrodQuadratureSetTraits.hpp"
+#include "Utility_ContractException.hpp"
+
+namespace Utility{
+
+//! Gauss-Kronrod quadrature set with one abscissa and weight per rule node
+/*! \details The quadrature set traits only store the abscissae and weights
+ * for one half of the symmetric rule. This set expands them over all Points
+ * nodes of the rule so that the nodes can be evaluated in a single batch and
+ * the weights can be applied with contiguous (vectorizable) loops. The first
+ * (Points-1)/2 nodes are the lower nodes, the next (Points-1)/2 nodes are the
+ * upper nodes and the last node is the midpoint. The Gauss weight of every
+ * node that is not a Gauss node is zero.
+ */
+template<int Points>
+struct GaussKronrodBatchedQuadratureSet
+{
+  //! The number of nodes in the rule
+  static const int number_of_nodes = Points;
+
+  //! The unit abscissae (in [-1,1]) of every node
+  double unit_abscissae[Points];
+
+  //! The Kronrod weight of every node
+  double kronrod_weights[Points];
+
+  //! The Gauss weight of every node
+  double gauss_weights[Points];
+
+  //! Return the quadrature set (constructed on first use)
+  static const GaussKronrodBatchedQuadratureSet& getSet()
+  {
+    static const GaussKronrodBatchedQuadratureSet set;
+
+    return set;
+  }
+
+private:
+
+  // Constructor
+  GaussKronrodBatchedQuadratureSet()
+  {
+    // Make sure the point rule is valid
+    testStaticPrecondition( GaussKronrodQuadratureSetTraits<Points>::valid_rule );
+
+    typedef GaussKronrodQuadratureSetTraits<Points> RuleTraits;
+
+    const int number_of_weights = RuleTraits::kronrod_weights.size();
+    const int half_nodes = number_of_weights - 1;
+
+    for( int j = 0; j < half_nodes; ++j )
+    {
+      unit_abscissae[j] = -RuleTraits::kronrod_abscissae[j];
+      unit_abscissae[half_nodes+j] = RuleTraits::kronrod_abscissae[j];
+
+      kronrod_weights[j] = RuleTraits::kronrod_weights[j];
+      kronrod_weights[half_nodes+j] = RuleTraits::kronrod_weights[j];
+
+      // Only the odd Kronrod nodes are Gauss nodes
+      if( j % 2 == 1 )
+      {
+        gauss_weights[j] = RuleTraits::gauss_weights[j/2];
+        gauss_weights[half_nodes+j] = RuleTraits::gauss_weights[j/2];
+      }
+      else
+      {
+        gauss_weights[j] = 0.0;
+        gauss_weights[half_nodes+j] = 0.0;
+      }
+    }
+
+    // The midpoint node
+    unit_abscissae[Points-1] = 0.0;
+    kronrod_weights[Points-1] = RuleTraits::kronrod_weights[half_nodes];
+
+    if( number_of_weights % 2 == 0 )
+      gauss_weights[Points-1] = RuleTraits::gauss_weights[number_of_weights/2-1];
+    else
+      gauss_weights[Points-1] = 0.0;
+  }
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_GAUSS_KRONROD_BATCHED_QUADRATURE_SET_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_GaussKronrodBatchedQuadratureSet.hpp
+//---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 
 // std Includes
 #include <queue>
+#include <algorithm>
 
 // Trilinos Includes
 #include <Teuchos_Array.hpp>
@@ -43,6 +44,68 @@ struct ExtrpolatedBinTraits : BinTraits
 typedef std::priority_queue<BinTraits> BinQueue;
 typedef Teuchos::Array<ExtrpolatedBinTraits> BinArray;
 
+//! Max-heap of bins (largest error on top) with preallocated storage
+class BinHeap
+{
+
+public:
+
+  //! Constructor
+  BinHeap( const size_t capacity )
+    : d_bins( capacity ),
+      d_size( 0 )
+  { /* ... */ }
+
+  //! Destructor
+  ~BinHeap()
+  { /* ... */ }
+
+  //! Add a bin to the heap
+  void push( const BinTraits& bin )
+  {
+    d_bins[d_size] = bin;
+    ++d_size;
+
+    std::push_heap( d_bins.begin(), d_bins.begin()+d_size );
+  }
+
+  //! Return the bin with the largest error
+  const BinTraits& top() const
+  { return d_bins[0]; }
+
+  //! Remove the bin with the largest error
+  void pop()
+  {
+    std::pop_heap( d_bins.begin(), d_bins.begin()+d_size );
+
+    --d_size;
+  }
+
+  //! Return the number of bins in the heap
+  size_t size() const
+  { return d_size; }
+
+  //! Return the maximum number of bins that the heap can store
+  size_t capacity() const
+  { return d_bins.size(); }
+
+  //! Check if the heap is empty
+  bool empty() const
+  { return d_size == 0; }
+
+  //! Remove all bins from the heap (the storage is kept)
+  void clear()
+  { d_size = 0; }
+
+private:
+
+  // The preallocated bin storage
+  Teuchos::Array<BinTraits> d_bins;
+
+  // The number of bins in the heap
+  size_t d_size;
+};
+
 //! The Gauss-Kronrod integrator
 class GaussKronrodIntegrator
 {
@@ -84,6 +147,24 @@ public:
 			    double& absolute_error,
                 double& result_abs, 
                 double& result_asc ) const;
+
+  //! Integrate the batched function adaptively with a preallocated BinHeap
+  template<int Points, typename BatchedFunctor>
+  void integrateAdaptivelyBatched( BatchedFunctor& integrand,
+                                   double lower_limit,
+                                   double upper_limit,
+                                   double& result,
+                                   double& absolute_error ) const;
+
+  //! Integrate the batched function with point rule
+  template<int Points, typename BatchedFunctor>
+  void integrateWithBatchedPointRule( BatchedFunctor& integrand,
+                                      double lower_limit,
+                                      double upper_limit,
+                                      long double& result,
+                                      double& absolute_error,
+                                      double& result_abs,
+                                      double& result_asc ) const;
 /*
   //! Integrate the function over a semi-infinite interval (+infinity)
   template<typename Functor>
@@ -146,6 +227,32 @@ protected:
     double& bin_1_asc,
     double& bin_2_asc ) const;
 
+  // Bisect and integrate the given bin interval with one batched evaluation
+  template<int Points, typename BatchedFunctor>
+  void bisectAndIntegrateBinIntervalBatched( 
+    BatchedFunctor& integrand, 
+    const BinTraits& bin,
+    BinTraits& bin_1,
+    BinTraits& bin_2,
+    double& bin_1_asc,
+    double& bin_2_asc ) const;
+
+  // Calculate the batched point rule abscissae on an interval
+  template<int Points>
+  static void calculateBatchedPointRuleAbscissae( double lower_limit,
+                                                  double upper_limit,
+                                                  double* abscissae );
+
+  // Apply the point rule weights to the batched integrand values
+  template<int Points>
+  void applyBatchedPointRuleWeights( const double* integrand_values,
+                                     double lower_limit,
+                                     double upper_limit,
+                                     long double& result,
+                                     double& absolute_error,
+                                     double& result_abs,
+                                     double& result_asc ) const;
+
   // Rescale absolute error from integration
   void rescaleAbsoluteError( 
     double& absolute_error, 
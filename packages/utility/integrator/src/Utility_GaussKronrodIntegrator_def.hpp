@@ -25,6 +25,7 @@
 #include "Utility_IntegratorException.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_GaussKronrodQuadratureSetTraits.hpp"
+#include "Utility_GaussKronrodBatchedQuadratureSet.hpp"
 
 namespace Utility{
 
@@ -757,6 +758,317 @@ void GaussKronrodIntegrator::bisectAndIntegrateBinInterval(
       bin_2_asc );
 };
 
+// Integrate the batched function adaptively with a preallocated BinHeap
+/*! \details BatchedFunctor must have 
+ * operator()( const double*, double*, const unsigned ) defined, which 
+ * evaluates the integrand at every abscissa in the batch (scalar functors
+ * can be wrapped with the Utility::BatchedIntegrandAdapter). This function
+ * uses the same adaptive strategy as integrateAdaptively (see the qag
+ * function details in the quadpack documentation) but every node of the
+ * rule is evaluated with a single integrand call (both halves of a bisected
+ * bin are evaluated with one call) and the bins are stored in a heap that
+ * is allocated once for the entire integration.
+ */
+template<int Points, typename BatchedFunctor>
+void GaussKronrodIntegrator::integrateAdaptivelyBatched(
+                                                 BatchedFunctor& integrand,
+                                                 double lower_limit,
+                                                 double upper_limit,
+                                                 double& result,
+                                                 double& absolute_error ) const
+{
+  BinTraits bin;
+  BinHeap bin_heap( d_subinterval_limit + 1 );
+
+  result = 0.0;
+  bin.lower_limit = lower_limit;
+  bin.upper_limit = upper_limit;
+
+  /* perform the first integration */
+
+  double result_abs = 0.0;
+  double result_asc = 0.0;
+
+  integrateWithBatchedPointRule<Points>(
+    integrand,
+    bin.lower_limit,
+    bin.upper_limit,
+    bin.result,
+    bin.error,
+    result_abs,
+    result_asc );
+
+  bin_heap.push( bin );
+
+  /* Test on accuracy */
+
+  double tolerance =
+    std::max(d_absolute_error_tol, d_relative_error_tol * fabs (bin.result));
+
+  /* need IEEE rounding here to match original quadpack behavior */
+  volatile double volatile_round_off;
+  volatile_round_off = 50.0*std::numeric_limits<double>::epsilon()*result_abs;
+  double round_off = volatile_round_off;
+
+  TEST_FOR_EXCEPTION( bin.error <= round_off && bin.error > tolerance,
+                      Utility::IntegratorException,
+                      "cannot reach tolerance because of roundoff error "
+                      "on first attempt" );
+
+  if ( ( bin.error <= tolerance && bin.error != result_asc ) ||
+            bin.error == 0.0)
+    {
+      result = bin.result;
+      absolute_error = bin.error;
+
+      return;
+    }
+
+  TEST_FOR_EXCEPTION( d_subinterval_limit == 1,
+                      Utility::IntegratorException,
+                      "a maximum of one iteration was insufficient" );
+
+  long double area = bin.result;
+  absolute_error = bin.error;
+  int round_off_1 = 0;
+  int round_off_2 = 0;
+
+  for ( int last = 1; last < d_subinterval_limit; last++ )
+  {
+    double result_asc_1 = 0.0, result_asc_2 = 0.0;
+    BinTraits bin_1, bin_2;
+
+    // Pop bin with highest error from heap
+    bin = bin_heap.top();
+    bin_heap.pop();
+
+    bisectAndIntegrateBinIntervalBatched<Points>(
+      integrand,
+      bin,
+      bin_1,
+      bin_2,
+      result_asc_1,
+      result_asc_2 );
+
+    bin_heap.push( bin_1 );
+    bin_heap.push( bin_2 );
+
+    // Improve previous approximations to integral and error and test for accuracy
+    absolute_error += bin_1.error + bin_2.error - bin.error;
+    area += bin_1.result + bin_2.result - bin.result;
+
+    // Check that the roundoff error is not too high
+    checkRoundoffError( bin,
+                        bin_1,
+                        bin_2,
+                        result_asc_1,
+                        result_asc_2,
+                        round_off_1,
+                        round_off_2,
+                        last+1 );
+
+    tolerance =
+      std::max( d_absolute_error_tol, d_relative_error_tol * fabs (area));
+
+    if ( absolute_error <= tolerance )
+      break;
+
+    TEST_FOR_EXCEPTION( last+1 == d_subinterval_limit,
+                        Utility::IntegratorException,
+                        "Maximum number of subdivisions reached" );
+
+    TEST_FOR_EXCEPTION( subintervalTooSmall<Points>( bin_1.lower_limit,
+                                                     bin_2.lower_limit,
+                                                     bin_2.upper_limit ),
+                        Utility::IntegratorException,
+                        "Maximum number of subdivisions reached" );
+  }
+
+  result = area;
+}
+
+// Integrate the batched function with given Gauss-Kronrod point rule
+/*! \details BatchedFunctor must have
+ * operator()( const double*, double*, const unsigned ) defined. All Points
+ * nodes of the rule are evaluated with a single integrand call. The result
+ * is identical (up to round-off) to the one from integrateWithPointRule.
+ */
+template<int Points, typename BatchedFunctor>
+void GaussKronrodIntegrator::integrateWithBatchedPointRule(
+                                               BatchedFunctor& integrand,
+                                               double lower_limit,
+                                               double upper_limit,
+                                               long double& result,
+                                               double& absolute_error,
+                                               double& result_abs,
+                                               double& result_asc ) const
+{
+  // Make sure the point rule is valid_rule
+  testStaticPrecondition( GaussKronrodQuadratureSetTraits<Points>::valid_rule );
+  // Make sure the integration limits are bounded
+  testPrecondition( !Teuchos::ScalarTraits<double>::isnaninf( lower_limit ) );
+  testPrecondition( !Teuchos::ScalarTraits<double>::isnaninf( upper_limit ) );
+
+  if( lower_limit < upper_limit )
+  {
+    double abscissae[Points];
+    double integrand_values[Points];
+
+    calculateBatchedPointRuleAbscissae<Points>( lower_limit,
+                                                upper_limit,
+                                                abscissae );
+
+    integrand( abscissae, integrand_values, Points );
+
+    this->applyBatchedPointRuleWeights<Points>( integrand_values,
+                                                lower_limit,
+                                                upper_limit,
+                                                result,
+                                                absolute_error,
+                                                result_abs,
+                                                result_asc );
+  }
+  else if( lower_limit == upper_limit )
+  {
+    result = 0.0;
+    absolute_error = 0.0;
+    result_abs = 0.0;
+    result_asc = 0.0;
+  }
+  else // invalid limits
+  {
+    THROW_EXCEPTION( Utility::IntegratorException,
+		     "Invalid integration limits: " << lower_limit << " !< "
+		     << upper_limit << "." );
+  }
+}
+
+// Bisect and integrate the given bin interval with one batched evaluation
+/*! \details The nodes of both halves of the bin are evaluated with a single
+ * integrand call of 2*Points abscissae.
+ */
+template<int Points, typename BatchedFunctor>
+void GaussKronrodIntegrator::bisectAndIntegrateBinIntervalBatched( 
+    BatchedFunctor& integrand, 
+    const BinTraits& bin,
+    BinTraits& bin_1,
+    BinTraits& bin_2,
+    double& bin_1_asc,
+    double& bin_2_asc ) const
+{
+  // Bisect the bin with the largest error estimate into bin 1 and bin 2
+  bin_1.lower_limit = bin.lower_limit;
+  bin_1.upper_limit = 0.5 * ( bin.lower_limit + bin.upper_limit );
+
+  bin_2.lower_limit = bin_1.upper_limit;
+  bin_2.upper_limit = bin.upper_limit;
+
+  double abscissae[2*Points];
+  double integrand_values[2*Points];
+
+  calculateBatchedPointRuleAbscissae<Points>( bin_1.lower_limit,
+                                              bin_1.upper_limit,
+                                              abscissae );
+
+  calculateBatchedPointRuleAbscissae<Points>( bin_2.lower_limit,
+                                              bin_2.upper_limit,
+                                              abscissae+Points );
+
+  integrand( abscissae, integrand_values, 2*Points );
+
+  double bin_1_abs, bin_2_abs;
+
+  // Integrate over bin 1
+  this->applyBatchedPointRuleWeights<Points>( integrand_values,
+                                              bin_1.lower_limit,
+                                              bin_1.upper_limit,
+                                              bin_1.result,
+                                              bin_1.error,
+                                              bin_1_abs,
+                                              bin_1_asc );
+
+  // Integrate over bin 2
+  this->applyBatchedPointRuleWeights<Points>( integrand_values+Points,
+                                              bin_2.lower_limit,
+                                              bin_2.upper_limit,
+                                              bin_2.result,
+                                              bin_2.error,
+                                              bin_2_abs,
+                                              bin_2_asc );
+}
+
+// Calculate the batched point rule abscissae on an interval
+template<int Points>
+inline void GaussKronrodIntegrator::calculateBatchedPointRuleAbscissae(
+                                                      double lower_limit,
+                                                      double upper_limit,
+                                                      double* abscissae )
+{
+  const GaussKronrodBatchedQuadratureSet<Points>& quadrature_set =
+    GaussKronrodBatchedQuadratureSet<Points>::getSet();
+
+  double midpoint = 0.5*( upper_limit + lower_limit );
+  double half_length = 0.5*( upper_limit - lower_limit );
+
+  for( int i = 0; i < Points; ++i )
+    abscissae[i] = midpoint + half_length*quadrature_set.unit_abscissae[i];
+}
+
+// Apply the point rule weights to the batched integrand values
+/*! \details The integrand values must be ordered as described in the
+ * GaussKronrodBatchedQuadratureSet. Every weighted sum is a contiguous loop
+ * over all nodes of the rule, which allows the compiler to vectorize it.
+ */
+template<int Points>
+void GaussKronrodIntegrator::applyBatchedPointRuleWeights(
+                                               const double* integrand_values,
+                                               double lower_limit,
+                                               double upper_limit,
+                                               long double& result,
+                                               double& absolute_error,
+                                               double& result_abs,
+                                               double& result_asc ) const
+{
+  const GaussKronrodBatchedQuadratureSet<Points>& quadrature_set =
+    GaussKronrodBatchedQuadratureSet<Points>::getSet();
+
+  double half_length = 0.5*( upper_limit - lower_limit );
+  double abs_half_length = fabs( half_length );
+
+  // Estimate the Kronrod, Gauss and absolute value integrals
+  double kronrod_result = 0.0;
+  double gauss_result = 0.0;
+  double kronrod_abs_result = 0.0;
+
+  for( int i = 0; i < Points; ++i )
+  {
+    kronrod_result += quadrature_set.kronrod_weights[i]*integrand_values[i];
+    gauss_result += quadrature_set.gauss_weights[i]*integrand_values[i];
+    kronrod_abs_result +=
+      quadrature_set.kronrod_weights[i]*fabs( integrand_values[i] );
+  }
+
+  // Calculate the mean kronrod result
+  double mean_kronrod_result = 0.5*kronrod_result;
+
+  // Estimate the result asc
+  double kronrod_asc_result = 0.0;
+
+  for( int i = 0; i < Points; ++i )
+  {
+    kronrod_asc_result += quadrature_set.kronrod_weights[i]*
+      fabs( integrand_values[i] - mean_kronrod_result );
+  }
+
+  result = kronrod_result*half_length;
+  result_abs = kronrod_abs_result*abs_half_length;
+  result_asc = kronrod_asc_result*abs_half_length;
+
+  // Estimate error in integral
+  absolute_error = fabs( ( kronrod_result - gauss_result )*half_length );
+  rescaleAbsoluteError( absolute_error, result_abs, result_asc );
+}
+
 } // end Utility namespace
 
 #endif // end UTILITY_GAUSS_KRONROD_INTEGRATOR_DEF_HPP
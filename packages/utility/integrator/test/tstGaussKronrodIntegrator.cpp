@@ -19,6 +19,7 @@
 
 // FRENSIE Includes
 #include "Utility_GaussKronrodIntegrator.hpp"
+#include "Utility_BatchedIntegrandAdapter.hpp"
 
 //---------------------------------------------------------------------------//
 // Testing Functors
@@ -106,6 +107,7 @@ public:
   // Allow public access to the GaussKronrodIntegrator protected member functions
   using Utility::GaussKronrodIntegrator::calculateQuadratureIntegrandValuesAtAbscissa;
   using Utility::GaussKronrodIntegrator::bisectAndIntegrateBinInterval;
+  using Utility::GaussKronrodIntegrator::bisectAndIntegrateBinIntervalBatched;
   using Utility::GaussKronrodIntegrator::rescaleAbsoluteError;
   using Utility::GaussKronrodIntegrator::subintervalTooSmall;
   using Utility::GaussKronrodIntegrator::checkRoundoffError;
@@ -1178,6 +1180,231 @@ TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( GaussKronrodIntegrator,
 
 UNIT_TEST_INSTANTIATION( GaussKronrodIntegrator, integrateAdaptivelyWynnEpsilon_no_singularities );
 
+//---------------------------------------------------------------------------//
+// Check that the bin heap returns the bin with the largest error
+TEUCHOS_UNIT_TEST( BinHeap, push_pop )
+{
+  Utility::BinHeap bin_heap( 4 );
+
+  TEST_EQUALITY_CONST( bin_heap.capacity(), 4 );
+  TEST_ASSERT( bin_heap.empty() );
+
+  Utility::BinTraits bin;
+  bin.error = 1.0;
+  bin_heap.push( bin );
+
+  bin.error = 3.0;
+  bin_heap.push( bin );
+
+  bin.error = 2.0;
+  bin_heap.push( bin );
+
+  TEST_EQUALITY_CONST( bin_heap.size(), 3 );
+  TEST_EQUALITY_CONST( bin_heap.top().error, 3.0 );
+
+  bin_heap.pop();
+
+  TEST_EQUALITY_CONST( bin_heap.top().error, 2.0 );
+
+  bin_heap.pop();
+
+  TEST_EQUALITY_CONST( bin_heap.top().error, 1.0 );
+
+  bin_heap.clear();
+
+  TEST_ASSERT( bin_heap.empty() );
+  TEST_EQUALITY_CONST( bin_heap.capacity(), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated over [0,1] with a batched point rule
+TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( GaussKronrodIntegrator,
+                                   integrateWithBatchedPointRule,
+                                   Functor )
+{
+  Utility::GaussKronrodIntegrator gk_integrator( 1e-12 );
+
+  double absolute_error, result_abs, result_asc;
+  double batched_absolute_error, batched_result_abs, batched_result_asc;
+  long double result, batched_result;
+
+  Functor functor_instance;
+
+  Utility::BatchedIntegrandAdapter<Functor> batched_functor_instance =
+    Utility::createBatchedIntegrandAdapter( functor_instance );
+
+  gk_integrator.integrateWithPointRule<15>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithBatchedPointRule<15>( batched_functor_instance,
+                                                   0.0,
+                                                   1.0,
+                                                   batched_result,
+                                                   batched_absolute_error,
+                                                   batched_result_abs,
+                                                   batched_result_asc );
+
+  TEST_FLOATING_EQUALITY( static_cast<double>( result ),
+                          static_cast<double>( batched_result ),
+                          1e-15 );
+  TEST_FLOATING_EQUALITY( absolute_error, batched_absolute_error, 1e-6 );
+  TEST_FLOATING_EQUALITY( result_abs, batched_result_abs, 1e-15 );
+  TEST_FLOATING_EQUALITY( result_asc, batched_result_asc, 1e-15 );
+
+  gk_integrator.integrateWithPointRule<61>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithBatchedPointRule<61>( batched_functor_instance,
+                                                   0.0,
+                                                   1.0,
+                                                   batched_result,
+                                                   batched_absolute_error,
+                                                   batched_result_abs,
+                                                   batched_result_asc );
+
+  TEST_FLOATING_EQUALITY( static_cast<double>( result ),
+                          static_cast<double>( batched_result ),
+                          1e-15 );
+  TEST_FLOATING_EQUALITY( absolute_error, batched_absolute_error, 1e-6 );
+  TEST_FLOATING_EQUALITY( result_abs, batched_result_abs, 1e-15 );
+  TEST_FLOATING_EQUALITY( result_asc, batched_result_asc, 1e-15 );
+}
+
+UNIT_TEST_INSTANTIATION( GaussKronrodIntegrator, integrateWithBatchedPointRule );
+
+//---------------------------------------------------------------------------//
+// Check that a bin can be bisected and integrated with one batched evaluation
+TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( GaussKronrodIntegrator,
+                                   bisectAndIntegrateBinIntervalBatched,
+                                   Functor )
+{
+  TestGaussKronrodIntegrator test_integrator( 1e-12 );
+
+  Utility::BinTraits bin, bin_1, bin_2;
+
+  double bin_1_asc, bin_2_asc, tol_1, tol_2;
+
+  bin.lower_limit = 0.0;
+  bin.upper_limit = 1.0;
+
+  Functor functor_instance;
+
+  Utility::BatchedIntegrandAdapter<Functor> batched_functor_instance =
+    Utility::createBatchedIntegrandAdapter( functor_instance );
+
+  test_integrator.bisectAndIntegrateBinIntervalBatched<21>( 
+                batched_functor_instance, 
+                bin,
+                bin_1,
+                bin_2,
+                bin_1_asc,
+                bin_2_asc );  
+
+  tol_1 = bin_1.error/bin_1.result;
+  tol_2 = bin_2.error/bin_2.result;
+
+  TEST_FLOATING_EQUALITY( Functor::getLowerIntegratedValue(), 
+                          static_cast<double>( bin_1.result ), 
+                          tol_1 );
+  TEST_FLOATING_EQUALITY( Functor::getUpperIntegratedValue(),
+                          static_cast<double>( bin_2.result ), 
+                          tol_2 );
+
+  TEST_EQUALITY( bin_1.lower_limit, bin.lower_limit );
+  TEST_FLOATING_EQUALITY( bin_1.upper_limit, 0.5, 1e-15);
+  TEST_FLOATING_EQUALITY( bin_2.lower_limit, 0.5, 1e-15 );
+  TEST_EQUALITY( bin_2.upper_limit, bin.upper_limit );
+}
+
+UNIT_TEST_INSTANTIATION( GaussKronrodIntegrator, bisectAndIntegrateBinIntervalBatched );
+
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated over [0,1] adaptively in batches
+TEUCHOS_UNIT_TEST_TEMPLATE_1_DECL( GaussKronrodIntegrator,
+                                   integrateAdaptivelyBatched,
+                                   Functor )
+{
+  Utility::GaussKronrodIntegrator gk_integrator( 1e-12 );
+
+  double result, absolute_error, tol;
+
+  Functor functor_instance;
+
+  Utility::BatchedIntegrandAdapter<Functor> batched_functor_instance =
+    Utility::createBatchedIntegrandAdapter( functor_instance );
+
+  // Test the 15-point rule
+  gk_integrator.integrateAdaptivelyBatched<15>( batched_functor_instance,
+                                                0.0,
+                                                1.0,
+                                                result,
+                                                absolute_error );
+
+  tol = absolute_error/result;
+
+  TEST_FLOATING_EQUALITY( Functor::getIntegratedValue(), result, tol );
+
+  // Test the 31-point rule
+  gk_integrator.integrateAdaptivelyBatched<31>( batched_functor_instance,
+                                                0.0,
+                                                1.0,
+                                                result,
+                                                absolute_error );
+
+  tol = absolute_error/result;
+
+  TEST_FLOATING_EQUALITY( Functor::getIntegratedValue(), result, tol );
+
+  // Test the 61-point rule
+  gk_integrator.integrateAdaptivelyBatched<61>( batched_functor_instance,
+                                                0.0,
+                                                1.0,
+                                                result,
+                                                absolute_error );
+
+  tol = absolute_error/result;
+
+  TEST_FLOATING_EQUALITY( Functor::getIntegratedValue(), result, tol );
+}
+
+UNIT_TEST_INSTANTIATION( GaussKronrodIntegrator, integrateAdaptivelyBatched );
+
+//---------------------------------------------------------------------------//
+// Check that a boost::function can be integrated adaptively in batches
+TEUCHOS_UNIT_TEST( GaussKronrodIntegrator,
+                   integrateAdaptivelyBatched_exp )
+{
+  boost::function<double (double x)> function_wrapper = exp_neg_x;
+
+  Utility::BatchedIntegrandAdapter<boost::function<double (double x)> >
+    batched_function_wrapper =
+    Utility::createBatchedIntegrandAdapter( function_wrapper );
+
+  Utility::GaussKronrodIntegrator gk_integrator( 1e-12 );
+
+  double result, absolute_error;
+
+  gk_integrator.integrateAdaptivelyBatched<21>( batched_function_wrapper,
+                                                0.0,
+                                                10.0,
+                                                result,
+                                                absolute_error );
+
+  double tol = absolute_error/result;
+
+  TEST_FLOATING_EQUALITY( result, 1.0 - exp( -10.0 ), tol );
+}
+
 //---------------------------------------------------------------------------//
 // end tstGaussKronrodIntegrator.cpp
 //---------------------------------------------------------------------------//
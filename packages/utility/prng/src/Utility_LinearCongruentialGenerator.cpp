@@ -101,6 +101,17 @@ unsigned long long LinearCongruentialGenerator::getGeneratorState() const
   return d_state;
 }
 
+// Set the state of the random number (continue a saved stream)
+/*! \details The history seed is not changed. This method should only be
+ * used to continue a stream that was interrupted (the state must have been
+ * retrieved with getGeneratorState).
+ */
+void LinearCongruentialGenerator::setGeneratorState( 
+					      const unsigned long long state )
+{
+  d_state = state;
+}
+
 } // end Utility namespace
 
 //---------------------------------------------------------------------------//
@@ -34,6 +34,9 @@ public:
   //! Return the state of the random number
   virtual unsigned long long getGeneratorState() const;
 
+  //! Set the state of the random number (continue a saved stream)
+  void setGeneratorState( const unsigned long long state );
+
   //! Initialize the generator for the desired history
   void changeHistory( const unsigned long long history_number );
 
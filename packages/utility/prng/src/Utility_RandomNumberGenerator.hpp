@@ -40,6 +40,12 @@ public:
 
   //! Initialize the generator for the next history
   static void initializeNextHistory();
+
+  //! Return the state of the generator (used to interrupt a stream)
+  static unsigned long long getGeneratorState();
+
+  //! Set the state of the generator (used to continue a stream)
+  static void setGeneratorState( const unsigned long long state );
   
   //! Set a fake stream for the generator
   static void setFakeStream( std::vector<double>& fake_stream,
@@ -90,6 +96,33 @@ inline double RandomNumberGenerator::getRandomNumber<double>()
   return generator[GlobalOpenMPSession::getThreadId()].getRandomNumber();
 }
 
+// Return the state of the generator (used to interrupt a stream)
+inline unsigned long long RandomNumberGenerator::getGeneratorState()
+{
+  // Make sure the generator has been set up correctly
+  testPrecondition( GlobalOpenMPSession::getThreadId() < generator.size() );
+  // Make sure that the generator has been initialized
+  testPrecondition( !generator.is_null( GlobalOpenMPSession::getThreadId() ) );
+
+  return generator[GlobalOpenMPSession::getThreadId()].getGeneratorState();
+}
+
+// Set the state of the generator (used to continue a stream)
+/*! \details The state must have been retrieved with getGeneratorState. This
+ * allows several interleaved histories to be simulated on the same thread 
+ * without changing the random numbers used by each history.
+ */
+inline void RandomNumberGenerator::setGeneratorState( 
+					      const unsigned long long state )
+{
+  // Make sure the generator has been set up correctly
+  testPrecondition( GlobalOpenMPSession::getThreadId() < generator.size() );
+  // Make sure that the generator has been initialized
+  testPrecondition( !generator.is_null( GlobalOpenMPSession::getThreadId() ) );
+
+  generator[GlobalOpenMPSession::getThreadId()].setGeneratorState( state );
+}
+
 // Return a random long long unsigned integer in [0,2^64)
 template<>
 inline unsigned long long 
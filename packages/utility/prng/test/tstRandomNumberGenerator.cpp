@@ -135,6 +135,36 @@ TEUCHOS_UNIT_TEST( RandomNumberGenerator, initialize_history )
   TEST_EQUALITY( all_random_numbers.size(), random_set.size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that an interrupted stream can be continued
+TEUCHOS_UNIT_TEST( RandomNumberGenerator, setGeneratorState )
+{
+  Utility::RandomNumberGenerator::initialize( 10ull );
+
+  Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  unsigned long long state = 
+    Utility::RandomNumberGenerator::getGeneratorState();
+
+  double random_number_a = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+  double random_number_b = 
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  // Interrupt the stream with another history
+  Utility::RandomNumberGenerator::initialize( 20ull );
+
+  Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  // Continue the stream
+  Utility::RandomNumberGenerator::setGeneratorState( state );
+
+  TEST_EQUALITY( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+		 random_number_a );
+  TEST_EQUALITY( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+		 random_number_b );
+}
+
 //---------------------------------------------------------------------------//
 // Custom main function
 //---------------------------------------------------------------------------//
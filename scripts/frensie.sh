@@ -49,6 +49,7 @@ cmake \
     -D FRENSIE_ENABLE_DAGMC:BOOL=ON \
     -D FRENSIE_ENABLE_ROOT:BOOL=ON \
     -D FRENSIE_ENABLE_PROFILING:BOOL=OFF \
+    -D FRENSIE_ENABLE_PERFORMANCE_COUNTERS:BOOL=OFF \
     -D FRENSIE_ENABLE_COVERAGE:BOOL=OFF \
     -D TRILINOS_PREFIX:PATH=$TRILINOS_PREFIX_PATH \
     -D TRILINOS_SOURCE:PATH=$TRILINOS_SOURCE_PATH \
@@ -8,8 +8,13 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <iomanip>
 #include <sstream>
 #include <fstream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 // Trilinos Includes
 #include <Teuchos_ParameterList.hpp>
@@ -20,51 +25,38 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_CrossSectionsXMLProperties.hpp"
+#include "MonteCarlo_NuclideACEFactory.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
-#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
 
-int main( int argc, char** argv )
+//! The batch mode table report
+struct TableReport
 {
-  Teuchos::RCP<Teuchos::FancyOStream> out = 
-    Teuchos::VerboseObjectBase::getDefaultOStream();
-
-  // Set up the command line options
-  Teuchos::CommandLineProcessor acequery_clp;
-  
-  std::string cs_directory;
-  std::string cs_alias;
-  
-  acequery_clp.setDocString( "Query information in the requested continuous energy neutron ACE table.\n");
-  acequery_clp.setOption( "cs_dir",
-			  &cs_directory,
-			  "The name (and location) of the cross_sections.xml "
-			  "file" );
-  acequery_clp.setOption( "cs_alias",
-			  &cs_alias,
-			  "Neutron cross section table alias",
-			  true );
-
-  acequery_clp.throwExceptions( false );
+  std::string alias;
+  std::string table_name;
+  int xss_length;
+  int energy_grid_length;
+  int number_of_reactions;
+  double load_time;
+  double construction_time;
+  double lookup_rate;
+  std::string error_message;
+};
 
-  // Parse the command line
-  Teuchos::CommandLineProcessor::EParseCommandLineReturn
-    parse_return = acequery_clp.parse( argc, argv );
-
-  if( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL )
-  {
-    acequery_clp.printHelpMessage( argv[0], *out );
-
-    return parse_return;
-  }
+//! Compare table reports using the total (load + construction) time
+bool compareTableReportTimes( const TableReport& report_a,
+			      const TableReport& report_b )
+{
+  return report_a.load_time + report_a.construction_time >
+    report_b.load_time + report_b.construction_time;
+}
 
-  // Open the cross_sections.xml file
-  std::string cross_sections_xml_file = cs_directory;
-  cross_sections_xml_file += "/cross_sections.xml";
-  
-  Teuchos::RCP<Teuchos::ParameterList> cs_table_info = 
-    Teuchos::getParametersFromXmlFile( cross_sections_xml_file );
-  
+//! Query a single ACE table
+int queryTable( const std::string& cs_directory,
+		const std::string& cs_alias,
+		const Teuchos::ParameterList& cs_table_info )
+{
   std::string data_file_path, data_file_type, data_table_name;
   int data_file_start_line, atomic_number, atomic_mass_number, isomer_number;
   double atomic_weight_ratio, temperature;
@@ -72,7 +64,7 @@ int main( int argc, char** argv )
   MonteCarlo::CrossSectionsXMLProperties::extractInfoFromNuclideTableInfoParameterList(
 							 cs_directory,
 							 cs_alias,
-							 *cs_table_info,
+							 cs_table_info,
 							 data_file_path,
 							 data_file_type,
 							 data_table_name,
@@ -163,6 +155,337 @@ int main( int argc, char** argv )
   return 0;
 }
 
+//! Load, construct and benchmark a single ACE table (batch mode)
+/*! \details The ACE tables are read with the Fortran reader, which always 
+ * uses the same file unit. The reads are therefore serialized with a named
+ * critical section. The nuclide construction and the lookup benchmark are
+ * done concurrently.
+ */
+void processTable( const std::string& cs_directory,
+		   const Teuchos::ParameterList& cs_table_info,
+		   const int number_of_lookups,
+		   TableReport& report )
+{
+  std::string data_file_path, data_file_type;
+  int data_file_start_line, atomic_number, atomic_mass_number, isomer_number;
+  double atomic_weight_ratio, temperature;
+
+  MonteCarlo::CrossSectionsXMLProperties::extractInfoFromNuclideTableInfoParameterList(
+							 cs_directory,
+							 report.alias,
+							 cs_table_info,
+							 data_file_path,
+							 data_file_type,
+							 report.table_name,
+							 data_file_start_line,
+							 atomic_number,
+							 atomic_mass_number,
+							 isomer_number,
+							 atomic_weight_ratio,
+							 temperature );
+
+  // Load the table
+  Teuchos::RCP<const Data::XSSNeutronDataExtractor> data_extractor;
+
+  // Exceptions cannot leave the critical region - store the message and
+  // report the failure once the region has been exited
+  std::string load_error_message;
+
+  #pragma omp critical( ace_file_read )
+  {
+    try{
+      double start_time = Utility::GlobalOpenMPSession::getTime();
+    
+      Data::ACEFileHandler ace_file_handler( data_file_path,
+					     report.table_name,
+					     data_file_start_line,
+					     true );
+
+      data_extractor.reset( new Data::XSSNeutronDataExtractor( 
+				       ace_file_handler.getTableNXSArray(),
+				       ace_file_handler.getTableJXSArray(),
+				       ace_file_handler.getTableXSSArray() ) );
+
+      report.load_time = Utility::GlobalOpenMPSession::getTime() - start_time;
+
+      report.xss_length = ace_file_handler.getTableXSSArray().size();
+    }
+    catch( std::exception& exception )
+    {
+      load_error_message = exception.what();
+    }
+  }
+
+  if( !load_error_message.empty() )
+  {
+    report.error_message = load_error_message;
+
+    return;
+  }
+
+  Teuchos::ArrayView<const double> energy_grid = 
+    data_extractor->extractEnergyGrid();
+
+  report.energy_grid_length = energy_grid.size();
+  report.number_of_reactions = data_extractor->extractMTRBlock().size();
+
+  // Construct the nuclide
+  double start_time = Utility::GlobalOpenMPSession::getTime();
+  
+  Teuchos::RCP<MonteCarlo::Nuclide> nuclide;
+
+  MonteCarlo::NuclideACEFactory::createNuclide( *data_extractor,
+						report.table_name,
+						atomic_number,
+						atomic_mass_number,
+						isomer_number,
+						atomic_weight_ratio,
+						temperature,
+						nuclide,
+						false,
+						false );
+
+  report.construction_time = 
+    Utility::GlobalOpenMPSession::getTime() - start_time;
+
+  // Benchmark the total cross section lookups
+  if( number_of_lookups > 0 )
+  {
+    // Log spaced quasi-random energies (golden ratio sequence)
+    const double golden_ratio_fraction = 0.5*(std::sqrt( 5.0 ) - 1.0);
+    const double log_min_energy = std::log( energy_grid.front() );
+    const double log_energy_range = 
+      std::log( energy_grid.back() ) - log_min_energy;
+    
+    std::vector<double> energies( number_of_lookups );
+
+    double fraction = 0.5;
+    
+    for( int i = 0; i < number_of_lookups; ++i )
+    {
+      fraction += golden_ratio_fraction;
+      fraction -= std::floor( fraction );
+      
+      energies[i] = std::exp( log_min_energy + fraction*log_energy_range );
+    }
+
+    start_time = Utility::GlobalOpenMPSession::getTime();
+
+    double cross_section_sum = 0.0;
+    
+    for( int i = 0; i < number_of_lookups; ++i )
+      cross_section_sum += nuclide->getTotalCrossSection( energies[i] );
+
+    double lookup_time = Utility::GlobalOpenMPSession::getTime() - start_time;
+
+    // Make sure the lookups cannot be optimized away
+    if( cross_section_sum < 0.0 )
+      report.error_message = "negative total cross section";
+
+    if( lookup_time > 0.0 )
+      report.lookup_rate = number_of_lookups/lookup_time;
+  }
+}
+
+//! Load and benchmark every ACE table in the cross_sections.xml file
+int queryAllTables( const std::string& cs_directory,
+		    const Teuchos::ParameterList& cs_table_info,
+		    const int number_of_lookups )
+{
+  // Find all of the continuous energy neutron ACE tables
+  std::vector<TableReport> reports;
+  
+  Teuchos::ParameterList::ConstIterator entry_it = cs_table_info.begin();
+  
+  while( entry_it != cs_table_info.end() )
+  {
+    const Teuchos::ParameterEntry& entry = cs_table_info.entry( entry_it );
+
+    if( entry.isList() )
+    {
+      const Teuchos::ParameterList& sublist =
+	Teuchos::any_cast<Teuchos::ParameterList>( entry.getAny() );
+
+      if( sublist.isParameter( MonteCarlo::CrossSectionsXMLProperties::nuclear_file_path_prop ) &&
+	  sublist.isParameter( MonteCarlo::CrossSectionsXMLProperties::nuclear_file_type_prop ) &&
+	  sublist.get<std::string>( MonteCarlo::CrossSectionsXMLProperties::nuclear_file_type_prop ) == "ACE" )
+      {
+	TableReport report;
+	report.alias = cs_table_info.name( entry_it );
+	report.xss_length = 0;
+	report.energy_grid_length = 0;
+	report.number_of_reactions = 0;
+	report.load_time = 0.0;
+	report.construction_time = 0.0;
+	report.lookup_rate = 0.0;
+	
+	reports.push_back( report );
+      }
+    }
+
+    ++entry_it;
+  }
+
+  std::cout << "Processing " << reports.size() << " ACE tables using " 
+	    << Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() 
+	    << " thread(s) ... " << std::flush;
+
+  double start_time = Utility::GlobalOpenMPSession::getTime();
+  
+  #pragma omp parallel for schedule( dynamic ) num_threads( Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() )
+  for( int i = 0; i < (int)reports.size(); ++i )
+  {
+    try{
+      processTable( cs_directory, cs_table_info, number_of_lookups, reports[i] );
+    }
+    catch( std::exception& exception )
+    {
+      reports[i].error_message = exception.what();
+    }
+  }
+
+  double wall_time = Utility::GlobalOpenMPSession::getTime() - start_time;
+
+  std::cout << "done (" << wall_time << " s).\n" << std::endl;
+
+  // Report the most expensive tables first
+  std::sort( reports.begin(), reports.end(), compareTableReportTimes );
+
+  std::cout << std::left
+	    << std::setw( 20 ) << "alias" << " "
+	    << std::setw( 12 ) << "table" << " "
+	    << std::right
+	    << std::setw( 10 ) << "XSS" << " "
+	    << std::setw( 8 ) << "grid" << " "
+	    << std::setw( 5 ) << "rxns" << " "
+	    << std::setw( 10 ) << "load (s)" << " "
+	    << std::setw( 10 ) << "build (s)" << " "
+	    << std::setw( 12 ) << "lookups/s" << std::endl;
+
+  double total_load_time = 0.0, total_construction_time = 0.0;
+  long long total_xss_length = 0;
+  int failed_tables = 0;
+  
+  for( unsigned i = 0; i < reports.size(); ++i )
+  {
+    const TableReport& report = reports[i];
+
+    std::cout << std::left
+	      << std::setw( 20 ) << report.alias << " "
+	      << std::setw( 12 ) << report.table_name << " ";
+
+    if( report.error_message.empty() )
+    {
+      std::cout << std::right
+		<< std::setw( 10 ) << report.xss_length << " "
+		<< std::setw( 8 ) << report.energy_grid_length << " "
+		<< std::setw( 5 ) << report.number_of_reactions << " "
+		<< std::setw( 10 ) << std::setprecision( 4 ) 
+		<< report.load_time << " "
+		<< std::setw( 10 ) << report.construction_time << " "
+		<< std::setw( 12 ) << std::setprecision( 6 )
+		<< report.lookup_rate << std::endl;
+
+      total_load_time += report.load_time;
+      total_construction_time += report.construction_time;
+      total_xss_length += report.xss_length;
+    }
+    else
+    {
+      std::cout << "Error: " << report.error_message << std::endl;
+
+      ++failed_tables;
+    }
+  }
+
+  std::cout << "\nTotal XSS length: " << total_xss_length 
+	    << " (" << total_xss_length*sizeof(double)/1048576.0 << " MB)\n"
+	    << "Total load time: " << total_load_time << " s\n"
+	    << "Total construction time: " << total_construction_time 
+	    << " s\n"
+	    << "Failed tables: " << failed_tables << std::endl;
+
+  return (failed_tables == 0 ? 0 : 1);
+}
+
+int main( int argc, char** argv )
+{
+  Teuchos::RCP<Teuchos::FancyOStream> out = 
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  // Set up the command line options
+  Teuchos::CommandLineProcessor acequery_clp;
+  
+  std::string cs_directory;
+  std::string cs_alias;
+  bool batch_mode = false;
+  int number_of_lookups = 1000000;
+  int threads = 1;
+  
+  acequery_clp.setDocString( "Query information in the requested continuous energy neutron ACE table.\n"
+			     "In batch mode every ACE table in the cross_sections.xml file will be loaded\n"
+			     "and the table sizes, load times and lookup throughputs will be reported.\n");
+  acequery_clp.setOption( "cs_dir",
+			  &cs_directory,
+			  "The name (and location) of the cross_sections.xml "
+			  "file" );
+  acequery_clp.setOption( "cs_alias",
+			  &cs_alias,
+			  "Neutron cross section table alias" );
+  acequery_clp.setOption( "batch",
+			  "no-batch",
+			  &batch_mode,
+			  "Load and benchmark every neutron ACE table" );
+  acequery_clp.setOption( "lookups",
+			  &number_of_lookups,
+			  "Number of total cross section lookups per table "
+			  "in batch mode (0 disables the benchmark)" );
+  acequery_clp.setOption( "threads",
+			  &threads,
+			  "Number of threads to use in batch mode" );
+
+  acequery_clp.throwExceptions( false );
+
+  // Parse the command line
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn
+    parse_return = acequery_clp.parse( argc, argv );
+
+  if( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL )
+  {
+    acequery_clp.printHelpMessage( argv[0], *out );
+
+    return parse_return;
+  }
+
+  if( !batch_mode && cs_alias.empty() )
+  {
+    std::cerr << "Error: a cross section table alias must be specified "
+	      << "(or use --batch)!" << std::endl;
+    
+    acequery_clp.printHelpMessage( argv[0], *out );
+
+    return 1;
+  }
+
+  // Open the cross_sections.xml file
+  std::string cross_sections_xml_file = cs_directory;
+  cross_sections_xml_file += "/cross_sections.xml";
+  
+  Teuchos::RCP<Teuchos::ParameterList> cs_table_info = 
+    Teuchos::getParametersFromXmlFile( cross_sections_xml_file );
+
+  if( batch_mode )
+  {
+    // Set up the global OpenMP session
+    if( Utility::GlobalOpenMPSession::isOpenMPUsed() )
+      Utility::GlobalOpenMPSession::setNumberOfThreads( threads );
+    
+    return queryAllTables( cs_directory, *cs_table_info, number_of_lookups );
+  }
+  else
+    return queryTable( cs_directory, cs_alias, *cs_table_info );
+}
+
 //---------------------------------------------------------------------------//
 // end acequery.cpp
 //---------------------------------------------------------------------------//
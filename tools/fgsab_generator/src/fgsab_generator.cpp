@@ -0,0 +1,185 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   fgsab_generator.cpp
+//! \author Luke Kersting
+//! \brief  Free gas elastic scattering S(alpha,beta) native table generator
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <cmath>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_FancyOStream.hpp>
+#include <Teuchos_VerboseObject.hpp>
+
+// FRENSIE Includes
+#include "DataGen_FreeGasSAlphaBetaDataGenerator.hpp"
+#include "Data_FreeGasSAlphaBetaVolatileDataContainer.hpp"
+#include "MonteCarlo_NuclearScatteringAngularDistribution.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+
+int main( int argc, char** argv )
+{
+  Teuchos::RCP<Teuchos::FancyOStream> out = 
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  double atomic_weight_ratio = 0.999167;
+  double temperature = 2.5301e-8; // MeV
+  double min_energy = 1e-11; // MeV
+  double max_energy = 1e-5; // MeV
+  int number_of_energies = 10;
+  double beta_max = 20.0;
+  double convergence_tol = 0.001;
+  double absolute_diff_tol = 1e-12;
+  double distance_tol = 1e-14;
+  int threads = 1;
+  std::string output_file_name;
+  
+  // Set up the command line options
+  Teuchos::CommandLineProcessor sab_clp;
+
+  sab_clp.setDocString( "Free gas elastic scattering S(alpha,beta) native "
+                        "table generator\n" );
+  sab_clp.setOption( "atomic_weight_ratio",
+		     &atomic_weight_ratio,
+		     "Atomic weight ratio of scatterer",
+		     true );
+  sab_clp.setOption( "temperature",
+		     &temperature,
+		     "Temperature at which the table will be generated (MeV)",
+		     true );
+  sab_clp.setOption( "min_energy",
+		     &min_energy,
+		     "Min incoming energy for table (MeV)" );
+  sab_clp.setOption( "max_energy",
+		     &max_energy,
+		     "Max incoming energy for table (MeV)" );
+  sab_clp.setOption( "energies",
+		     &number_of_energies,
+		     "Number of (log spaced) incoming energies in table" );
+  sab_clp.setOption( "beta_max",
+		     &beta_max,
+		     "Max beta value in table" );
+  sab_clp.setOption( "grid_convergence_tol",
+		     &convergence_tol,
+		     "Grid convergence tolerance" );
+  sab_clp.setOption( "grid_absolute_diff_tol",
+		     &absolute_diff_tol,
+		     "Grid absolute difference tolerance" );
+  sab_clp.setOption( "grid_absolute_dist_tol",
+		     &distance_tol,
+		     "Grid absolute distance tolerance" );
+  sab_clp.setOption( "threads",
+		     &threads,
+		     "Number of threads to use" );
+  sab_clp.setOption( "output_file",
+		     &output_file_name,
+		     "Name of the binary table file that will be written "
+                     "(default: fgsab_<awr>_<kT>_native.bin)" );
+
+  sab_clp.throwExceptions( false );
+
+  // Parse the command line
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn
+    parse_return = sab_clp.parse( argc, argv );
+
+  if( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL )
+  {
+    sab_clp.printHelpMessage( argv[0], *out );
+
+    return parse_return;
+  }
+
+  if( min_energy <= 0.0 || max_energy < min_energy || number_of_energies < 1 )
+  {
+    std::cerr << "Error: the incoming energy grid is invalid!" << std::endl;
+
+    return 1;
+  }
+
+  // Set up the global OpenMP session
+  if( Utility::GlobalOpenMPSession::isOpenMPUsed() )
+    Utility::GlobalOpenMPSession::setNumberOfThreads( threads );
+
+  // Initialize the zero temperature cross section
+  Teuchos::RCP<Utility::OneDDistribution> cross_section(
+			  new Utility::UniformDistribution( 0.0, 20.0, 1.0 ) );
+
+  // Initialize the scattering probability distribution
+  Teuchos::RCP<Utility::TabularOneDDistribution> isotropic_distribution(
+			  new Utility::UniformDistribution( -1.0, 1.0, 0.5 ) );
+
+  // Initialize the scattering distribution
+  MonteCarlo::NuclearScatteringAngularDistribution::AngularDistribution
+    distribution( 2 );
+
+  distribution[0].first = 0.0;
+  distribution[0].second = isotropic_distribution;
+  
+  distribution[1].first = 20.0;
+  distribution[1].second = isotropic_distribution;
+
+  Teuchos::RCP<MonteCarlo::NuclearScatteringAngularDistribution> 
+    scattering_distribution( 
+			 new MonteCarlo::NuclearScatteringAngularDistribution(
+							      distribution ) );
+
+  // Create the incoming energy grid
+  std::vector<double> energy_grid( number_of_energies, min_energy );
+
+  for( int i = 1; i < number_of_energies; ++i )
+  {
+    energy_grid[i] = min_energy*
+      pow( max_energy/min_energy, ((double)i)/(number_of_energies-1) );
+  }
+  
+  // Create the data generator
+  DataGen::FreeGasSAlphaBetaDataGenerator sab_generator( 
+                                                      cross_section,
+                                                      scattering_distribution,
+                                                      atomic_weight_ratio,
+                                                      temperature,
+                                                      beta_max,
+                                                      convergence_tol,
+                                                      absolute_diff_tol,
+                                                      distance_tol );
+
+  // Create the new data container
+  Data::FreeGasSAlphaBetaVolatileDataContainer data_container;
+
+  try{
+    sab_generator.populateDataContainer( energy_grid, data_container, true );
+  }
+  EXCEPTION_CATCH_AND_EXIT( std::exception,
+                            "Error: the S(alpha,beta) table could not be "
+                            "generated!" );
+
+  // Export the generated data to a binary file
+  if( output_file_name.size() == 0 )
+  {
+    std::ostringstream oss;
+    oss << "fgsab_" << atomic_weight_ratio << "_" << temperature 
+        << "_native.bin";
+
+    output_file_name = oss.str();
+  }
+
+  data_container.exportData( output_file_name,
+                             Utility::ArchivableObject::BINARY_ARCHIVE );
+
+  *out << "S(alpha,beta) table written to " << output_file_name << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end fgsab_generator.cpp
+//---------------------------------------------------------------------------//
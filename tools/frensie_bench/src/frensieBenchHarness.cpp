@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   frensieBenchHarness.cpp
+//! \author Luke Kersting
+//! \brief  Micro-benchmark harness definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <ctime>
+
+// FRENSIE Includes
+#include "frensieBenchHarness.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ContractException.hpp"
+
+// Constructor
+BenchmarkHarness::BenchmarkHarness( const double min_time,
+				    const std::string& filter )
+  : d_min_time( min_time ),
+    d_filter( filter ),
+    d_benchmarks()
+{
+  // Make sure the min time is valid
+  testPrecondition( min_time > 0.0 );
+}
+
+// Add a benchmark
+/*! \details The benchmark will be ignored if its name does not contain the
+ * filter.
+ */
+void BenchmarkHarness::addBenchmark( 
+				 const std::string& name,
+				 const BenchmarkFunction& function,
+				 const double items_per_iteration,
+				 const unsigned long long fixed_iterations )
+{
+  // Make sure the number of items is valid
+  testPrecondition( items_per_iteration > 0.0 );
+  
+  if( name.find( d_filter ) < name.size() )
+  {
+    Benchmark benchmark;
+    benchmark.name = name;
+    benchmark.function = function;
+    benchmark.items_per_iteration = items_per_iteration;
+    benchmark.fixed_iterations = fixed_iterations;
+    benchmark.iterations = 0ull;
+    benchmark.time = 0.0;
+
+    d_benchmarks.push_back( benchmark );
+  }
+}
+
+// Run the benchmarks
+void BenchmarkHarness::runBenchmarks( std::ostream& os )
+{
+  os << std::left << std::setw( 50 ) << "Benchmark"
+     << std::right << std::setw( 15 ) << "Time (ns)"
+     << std::setw( 15 ) << "Iterations"
+     << std::setw( 18 ) << "Items/s" << std::endl
+     << std::string( 98, '-' ) << std::endl;
+  
+  for( unsigned i = 0; i < d_benchmarks.size(); ++i )
+  {
+    this->runBenchmark( d_benchmarks[i] );
+
+    const Benchmark& benchmark = d_benchmarks[i];
+
+    os << std::left << std::setw( 50 ) << benchmark.name
+       << std::right << std::setw( 15 ) 
+       << benchmark.time/benchmark.iterations*1e9
+       << std::setw( 15 ) << benchmark.iterations
+       << std::setw( 18 ) 
+       << benchmark.iterations*benchmark.items_per_iteration/benchmark.time
+       << std::endl;
+  }
+}
+
+// Run a benchmark
+/*! \details The number of iterations is increased geometrically (based on 
+ * the time of the previous run) until the minimum time has been reached.
+ */
+void BenchmarkHarness::runBenchmark( Benchmark& benchmark ) const
+{
+  unsigned long long iterations = 
+    (benchmark.fixed_iterations > 0ull ? benchmark.fixed_iterations : 1ull);
+  
+  while( true )
+  {
+    double start_time = Utility::GlobalOpenMPSession::getTime();
+
+    benchmark.function( iterations );
+
+    double time = Utility::GlobalOpenMPSession::getTime() - start_time;
+
+    if( benchmark.fixed_iterations > 0ull || time >= d_min_time )
+    {
+      benchmark.iterations = iterations;
+      benchmark.time = time;
+
+      break;
+    }
+
+    // Estimate the number of iterations needed (with 40% extra)
+    double multiplier = (time > 0.0 ? 1.4*d_min_time/time : 10.0);
+
+    if( multiplier > 10.0 )
+      multiplier = 10.0;
+    else if( multiplier < 2.0 )
+      multiplier = 2.0;
+
+    iterations = (unsigned long long)(iterations*multiplier);
+  }
+}
+
+// Export the benchmark results to a JSON file
+void BenchmarkHarness::exportResults( const std::string& json_file_name ) const
+{
+  std::ofstream json_file( json_file_name.c_str() );
+
+  TEST_FOR_EXCEPTION( !json_file.good(),
+		      std::runtime_error,
+		      "Error: the benchmark results file " << json_file_name <<
+		      " could not be opened!" );
+
+  std::time_t current_time = std::time( NULL );
+  char date[64];
+  std::strftime( date, 64, "%Y-%m-%d %H:%M:%S", 
+		 std::localtime( &current_time ) );
+  
+  json_file << std::setprecision( 12 )
+	    << "{\n"
+	    << "  \"context\": {\n"
+	    << "    \"date\": \"" << date << "\",\n"
+	    << "    \"executable\": \"frensie_bench\",\n"
+	    << "    \"num_threads\": " 
+	    << Utility::GlobalOpenMPSession::getRequestedNumberOfThreads() 
+	    << ",\n"
+	    << "    \"min_time\": " << d_min_time << "\n"
+	    << "  },\n"
+	    << "  \"benchmarks\": [";
+
+  for( unsigned i = 0; i < d_benchmarks.size(); ++i )
+  {
+    const Benchmark& benchmark = d_benchmarks[i];
+
+    double time_per_iteration = benchmark.time/benchmark.iterations*1e9;
+    
+    double items_per_second = 
+      benchmark.iterations*benchmark.items_per_iteration/benchmark.time;
+
+    json_file << (i == 0 ? "\n" : ",\n")
+	      << "    {\n"
+	      << "      \"name\": \"" << benchmark.name << "\",\n"
+	      << "      \"iterations\": " << benchmark.iterations << ",\n"
+	      << "      \"real_time\": " << time_per_iteration << ",\n"
+	      << "      \"time_unit\": \"ns\",\n"
+	      << "      \"items_per_second\": " << items_per_second << "\n"
+	      << "    }";
+  }
+
+  json_file << "\n  ]\n}" << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+// end frensieBenchHarness.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   frensieBenchHarness.hpp
+//! \author Luke Kersting
+//! \brief  Micro-benchmark harness declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef FRENSIE_BENCH_HARNESS_HPP
+#define FRENSIE_BENCH_HARNESS_HPP
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+#include <functional>
+
+// Trilinos Includes
+#include <Teuchos_Array.hpp>
+
+/*! The micro-benchmark harness
+ * \details Every benchmark function must execute the code being timed the
+ * requested number of times (iterations). Unless the number of iterations
+ * is fixed, the number of iterations is increased until the benchmark
+ * runs for at least the minimum time. The results can be exported to a JSON
+ * file (using the same layout as Google Benchmark) so that the results from
+ * different releases can be compared.
+ */
+class BenchmarkHarness
+{
+
+public:
+
+  //! The benchmark function type
+  typedef std::function<void (const unsigned long long)> BenchmarkFunction;
+
+  //! Constructor
+  BenchmarkHarness( const double min_time, const std::string& filter );
+
+  //! Destructor
+  ~BenchmarkHarness()
+  { /* ... */ }
+
+  //! Add a benchmark
+  void addBenchmark( const std::string& name,
+		     const BenchmarkFunction& function,
+		     const double items_per_iteration = 1.0,
+		     const unsigned long long fixed_iterations = 0ull );
+
+  //! Run the benchmarks
+  void runBenchmarks( std::ostream& os );
+
+  //! Export the benchmark results to a JSON file
+  void exportResults( const std::string& json_file_name ) const;
+
+private:
+
+  // The benchmark data
+  struct Benchmark
+  {
+    // The benchmark name
+    std::string name;
+    
+    // The benchmark function
+    BenchmarkFunction function;
+
+    // The number of items processed in every iteration
+    double items_per_iteration;
+
+    // The fixed number of iterations (0 if not fixed)
+    unsigned long long fixed_iterations;
+
+    // The number of iterations that were run
+    unsigned long long iterations;
+
+    // The time of the run (s)
+    double time;
+  };
+
+  // Run a benchmark
+  void runBenchmark( Benchmark& benchmark ) const;
+
+  // The minimum benchmark time (s)
+  double d_min_time;
+
+  // The benchmark name filter (only names containing the filter will run)
+  std::string d_filter;
+
+  // The benchmarks
+  Teuchos::Array<Benchmark> d_benchmarks;
+};
+
+#endif // end FRENSIE_BENCH_HARNESS_HPP
+
+//---------------------------------------------------------------------------//
+// end frensieBenchHarness.hpp
+//---------------------------------------------------------------------------//
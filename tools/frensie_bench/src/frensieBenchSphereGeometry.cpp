@@ -0,0 +1,272 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   frensieBenchSphereGeometry.cpp
+//! \author Luke Kersting
+//! \brief  Concentric sphere geometry (and module interface) definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+// FRENSIE Includes
+#include "frensieBenchSphereGeometry.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+// Constructor
+ConcentricSphereGeometry::ConcentricSphereGeometry(
+				        const Teuchos::Array<double>& radii )
+  : d_radii( radii )
+{
+  // Make sure there is at least one sphere
+  testPrecondition( radii.size() > 0 );
+
+  std::sort( d_radii.begin(), d_radii.end() );
+
+  // Make sure the radii are valid
+  testPrecondition( d_radii.front() > 0.0 );
+}
+
+// Return the number of spheres
+unsigned ConcentricSphereGeometry::getNumberOfSpheres() const
+{
+  return d_radii.size();
+}
+
+// Return the radius of a sphere
+double ConcentricSphereGeometry::getRadius( const unsigned surface ) const
+{
+  // Make sure the surface is valid
+  testPrecondition( surface > 0u );
+  testPrecondition( surface <= d_radii.size() );
+
+  return d_radii[surface-1];
+}
+
+// Return the cell that contains a point
+/*! \details A point on a sphere is assigned to the cell inside of it.
+ */
+unsigned ConcentricSphereGeometry::getCellContainingPoint(
+					       const double position[3] ) const
+{
+  const double radius_squared = position[0]*position[0] +
+    position[1]*position[1] + position[2]*position[2];
+
+  for( unsigned i = 0; i < d_radii.size(); ++i )
+  {
+    if( radius_squared <= d_radii[i]*d_radii[i] )
+      return i+1u;
+  }
+
+  return d_radii.size()+1u;
+}
+
+// Return the distance to the surface hit by a ray starting in a cell
+/*! \details The ray can only hit the inner bounding sphere when it is
+ * traveling towards the origin. A ray that starts on a bounding sphere
+ * (e.g. after a surface crossing) will hit the opposite side of the outer
+ * bounding sphere when it does not hit the inner bounding sphere.
+ */
+double ConcentricSphereGeometry::getDistanceToSurfaceHit(
+					      const double position[3],
+					      const double direction[3],
+					      const unsigned cell,
+					      unsigned& surface_hit ) const
+{
+  // Make sure the cell is valid
+  testPrecondition( cell > 0u );
+  testPrecondition( cell <= d_radii.size() );
+
+  const double position_dot_direction = position[0]*direction[0] +
+    position[1]*direction[1] + position[2]*direction[2];
+
+  const double radius_squared = position[0]*position[0] +
+    position[1]*position[1] + position[2]*position[2];
+
+  // Check if the inner bounding sphere is hit
+  if( cell > 1u && position_dot_direction < 0.0 )
+  {
+    const double inner_radius = d_radii[cell-2];
+
+    const double discriminant = position_dot_direction*position_dot_direction
+      - radius_squared + inner_radius*inner_radius;
+
+    if( discriminant > 0.0 )
+    {
+      surface_hit = cell-1u;
+
+      return std::max( -position_dot_direction - sqrt( discriminant ), 0.0 );
+    }
+  }
+
+  // The outer bounding sphere must be hit
+  const double outer_radius = d_radii[cell-1];
+
+  const double discriminant = position_dot_direction*position_dot_direction
+    - radius_squared + outer_radius*outer_radius;
+
+  surface_hit = cell;
+
+  return -position_dot_direction + sqrt( std::max( discriminant, 0.0 ) );
+}
+
+namespace Geometry{
+
+// Initialize the concentric sphere geometry module interface static data
+const ModuleInterface<ConcentricSphereGeometry>::ExternalSurfaceHandle
+ModuleInterface<ConcentricSphereGeometry>::invalid_external_surface_handle = 0;
+
+const ModuleInterface<ConcentricSphereGeometry>::ExternalCellHandle
+ModuleInterface<ConcentricSphereGeometry>::invalid_external_cell_handle = 0;
+
+Teuchos::RCP<const ConcentricSphereGeometry>
+ModuleInterface<ConcentricSphereGeometry>::s_geometry;
+
+// Find the cell that contains a given point (start of history)
+ModuleInterface<ConcentricSphereGeometry>::InternalCellHandle
+ModuleInterface<ConcentricSphereGeometry>::findCellContainingPoint(
+							       const Ray& ray )
+{
+  return s_geometry->getCellContainingPoint( ray.getPosition() );
+}
+
+// Find the cell that contains a given point (surface crossing)
+/*! \details The cell on the other side of a sphere is always known, so the
+ * ray position does not need to be tested.
+ */
+ModuleInterface<ConcentricSphereGeometry>::InternalCellHandle
+ModuleInterface<ConcentricSphereGeometry>::findCellContainingPoint(
+					 const Ray& ray,
+					 const InternalCellHandle current_cell,
+					 const InternalSurfaceHandle surface )
+{
+  // Make sure the surface bounds the cell
+  testPrecondition( current_cell == surface || current_cell == surface+1 );
+
+  if( current_cell == surface )
+    return surface+1;
+  else
+    return surface;
+}
+
+// Fire a ray through the geometry
+void ModuleInterface<ConcentricSphereGeometry>::fireRay(
+				       const Ray& ray,
+				       const InternalCellHandle& current_cell,
+				       InternalSurfaceHandle& surface_hit,
+				       double& distance_to_surface_hit )
+{
+  TEST_FOR_EXCEPTION( isTerminationCell( current_cell ),
+		      std::runtime_error,
+		      "Warning: lost particle detected!" );
+
+  unsigned surface;
+
+  distance_to_surface_hit =
+    s_geometry->getDistanceToSurfaceHit( ray.getPosition(),
+					 ray.getDirection(),
+					 current_cell,
+					 surface );
+
+  surface_hit = surface;
+}
+
+// Get the point location w.r.t. a given cell
+PointLocation ModuleInterface<ConcentricSphereGeometry>::getPointLocation(
+					      const Ray& ray,
+					      const InternalCellHandle cell )
+{
+  // Make sure the cell exists
+  testPrecondition( doesCellExist( cell ) );
+
+  const double* position = ray.getPosition();
+
+  const double radius = sqrt( position[0]*position[0] +
+			      position[1]*position[1] +
+			      position[2]*position[2] );
+
+  const double tolerance = 1e-12;
+
+  // Check the inner bounding sphere
+  if( cell > 1 )
+  {
+    const double inner_radius = s_geometry->getRadius( cell-1 );
+
+    if( fabs( radius - inner_radius ) <= tolerance*inner_radius )
+      return POINT_ON_CELL;
+    else if( radius < inner_radius )
+      return POINT_OUTSIDE_CELL;
+  }
+
+  // Check the outer bounding sphere
+  if( !isTerminationCell( cell ) )
+  {
+    const double outer_radius = s_geometry->getRadius( cell );
+
+    if( fabs( radius - outer_radius ) <= tolerance*outer_radius )
+      return POINT_ON_CELL;
+    else if( radius > outer_radius )
+      return POINT_OUTSIDE_CELL;
+  }
+
+  return POINT_INSIDE_CELL;
+}
+
+// Calculate the surface normal at a point on the surface
+void ModuleInterface<ConcentricSphereGeometry>::getSurfaceNormal(
+					   const InternalSurfaceHandle surface,
+					   const double position[3],
+					   double normal[3] )
+{
+  const double radius = sqrt( position[0]*position[0] +
+			      position[1]*position[1] +
+			      position[2]*position[2] );
+
+  normal[0] = position[0]/radius;
+  normal[1] = position[1]/radius;
+  normal[2] = position[2]/radius;
+}
+
+// Get the volume of a cell
+double ModuleInterface<ConcentricSphereGeometry>::getCellVolume(
+						const InternalCellHandle cell )
+{
+  // Make sure the cell has a finite volume
+  testPrecondition( doesCellExist( cell ) );
+  testPrecondition( !isTerminationCell( cell ) );
+
+  const double outer_radius = s_geometry->getRadius( cell );
+
+  double volume = 4.0/3.0*M_PI*outer_radius*outer_radius*outer_radius;
+
+  if( cell > 1 )
+  {
+    const double inner_radius = s_geometry->getRadius( cell-1 );
+
+    volume -= 4.0/3.0*M_PI*inner_radius*inner_radius*inner_radius;
+  }
+
+  return volume;
+}
+
+// Get the surface area of a surface bounding a cell
+double ModuleInterface<ConcentricSphereGeometry>::getCellSurfaceArea(
+					   const InternalSurfaceHandle surface,
+					   const InternalCellHandle cell )
+{
+  // Make sure the surface bounds the cell
+  testPrecondition( doesSurfaceExist( surface ) );
+  testPrecondition( cell == surface || cell == surface+1 );
+
+  const double radius = s_geometry->getRadius( surface );
+
+  return 4.0*M_PI*radius*radius;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end frensieBenchSphereGeometry.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,252 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   frensieBenchSphereGeometry.hpp
+//! \author Luke Kersting
+//! \brief  Concentric sphere geometry (and module interface) declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef FRENSIE_BENCH_SPHERE_GEOMETRY_HPP
+#define FRENSIE_BENCH_SPHERE_GEOMETRY_HPP
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+
+// FRENSIE Includes
+#include "Geometry_ModuleInterfaceDecl.hpp"
+#include "Utility_ContractException.hpp"
+
+/*! The concentric sphere geometry
+ * \details The spheres are centered on the origin. Surface i (starting at 1)
+ * is the sphere with the ith smallest radius. Cell i is bounded by surface i
+ * and surface i-1 (if it exists). The cell outside of the largest sphere
+ * is the termination cell. This analytic geometry allows the transport
+ * kernel to be benchmarked without any external geometry files.
+ */
+class ConcentricSphereGeometry
+{
+
+public:
+
+  //! Constructor
+  ConcentricSphereGeometry( const Teuchos::Array<double>& radii );
+
+  //! Destructor
+  ~ConcentricSphereGeometry()
+  { /* ... */ }
+
+  //! Return the number of spheres
+  unsigned getNumberOfSpheres() const;
+
+  //! Return the radius of a sphere
+  double getRadius( const unsigned surface ) const;
+
+  //! Return the cell that contains a point
+  unsigned getCellContainingPoint( const double position[3] ) const;
+
+  //! Return the distance to the surface hit by a ray starting in a cell
+  double getDistanceToSurfaceHit( const double position[3],
+				  const double direction[3],
+				  const unsigned cell,
+				  unsigned& surface_hit ) const;
+
+private:
+
+  // The sphere radii (sorted)
+  Teuchos::Array<double> d_radii;
+};
+
+namespace Geometry{
+
+/*! The specialization of the GeometryModuleInterface class for the
+ * concentric sphere geometry handler.
+ * \ingroup geometry_module
+ */
+template<>
+class ModuleInterface<ConcentricSphereGeometry>
+{
+
+public:
+
+  //! The external surface id class (used within the geometry handler)
+  typedef unsigned ExternalSurfaceId;
+  //! The external cell id class (used within the geometry handler)
+  typedef unsigned ExternalCellId;
+
+  //! The external surface handle class (used within the geometry handler)
+  typedef unsigned ExternalSurfaceHandle;
+  //! The external cell handle class (used within the geometry handler)
+  typedef unsigned ExternalCellHandle;
+
+  //! The internal surface handle class (used within FRENSIE)
+  typedef ModuleTraits::InternalSurfaceHandle InternalSurfaceHandle;
+  //! The internal cell handle class (used within FRENSIE)
+  typedef ModuleTraits::InternalCellHandle InternalCellHandle;
+
+  //! The value of an invalid surface handle
+  static const ExternalSurfaceHandle invalid_external_surface_handle;
+
+  //! The value of an invalid cell handle
+  static const ExternalCellHandle invalid_external_cell_handle;
+
+  //! Set the geometry handler instance
+  static void setHandlerInstance(
+	       const Teuchos::RCP<const ConcentricSphereGeometry>& geometry );
+
+  //! Do just in time initialization of interface members
+  static void initialize();
+
+  //! Enable support for multiple threads
+  static void enableThreadSupport( const unsigned num_threads );
+
+  //! Find the cell that contains a given point (start of history)
+  static InternalCellHandle findCellContainingPoint( const Ray& ray );
+
+  //! Find the cell that contains a given point (surface crossing)
+  static InternalCellHandle findCellContainingPoint(
+					 const Ray& ray,
+					 const InternalCellHandle current_cell,
+					 const InternalSurfaceHandle surface );
+
+  //! Fire a ray through the geometry
+  static void fireRay( const Ray& ray,
+		       const InternalCellHandle& current_cell,
+		       InternalSurfaceHandle& surface_hit,
+		       double& distance_to_surface_hit );
+
+  //! Initialize a new ray (after a collision)
+  static void newRay();
+
+  //! Check if the cell is a termination cell
+  static bool isTerminationCell( const InternalCellHandle cell );
+
+  //! Get the point location w.r.t. a given cell
+  static PointLocation getPointLocation( const Ray& ray,
+					 const InternalCellHandle cell );
+
+  //! Calculate the surface normal at a point on the surface
+  static void getSurfaceNormal( const InternalSurfaceHandle surface,
+				const double position[3],
+				double normal[3] );
+
+  //! Get the volume of a cell
+  static double getCellVolume( const InternalCellHandle cell );
+
+  //! Get the surface area of a surface bounding a cell
+  static double getCellSurfaceArea( const InternalSurfaceHandle surface,
+				    const InternalCellHandle cell );
+
+  //! Check that an external surface handle exists
+  static bool doesSurfaceExist( const ExternalSurfaceId surface );
+
+  //! Check that an external cell handle exists
+  static bool doesCellExist( const ExternalCellId cell );
+
+  //! Get the internal surf. handle corresponding to the external surf. handle
+  static InternalSurfaceHandle getInternalSurfaceHandle(
+				const ExternalSurfaceHandle surface_external );
+
+  //! Get the internal cell handle corresponding to the external cell handle
+  static InternalCellHandle getInternalCellHandle(
+				      const ExternalCellHandle cell_external );
+
+  //! Get the external surf. handle corresponding to the internal surf. handle
+  static ExternalSurfaceHandle getExternalSurfaceHandle(
+					 const InternalSurfaceHandle surface );
+
+  //! Get the external cell handle corresponding to the internal cell handle
+  static ExternalCellHandle getExternalCellHandle(
+					       const InternalCellHandle cell );
+
+private:
+
+  // The geometry instance
+  static Teuchos::RCP<const ConcentricSphereGeometry> s_geometry;
+};
+
+// Set the geometry handler instance
+inline void ModuleInterface<ConcentricSphereGeometry>::setHandlerInstance(
+		const Teuchos::RCP<const ConcentricSphereGeometry>& geometry )
+{
+  // Make sure the geometry is valid
+  testPrecondition( !geometry.is_null() );
+
+  s_geometry = geometry;
+}
+
+// Do just in time initialization of interface members
+inline void ModuleInterface<ConcentricSphereGeometry>::initialize()
+{ /* ... */ }
+
+// Enable support for multiple threads
+/*! \details The geometry has no ray state so every thread can share it.
+ */
+inline void ModuleInterface<ConcentricSphereGeometry>::enableThreadSupport(
+						   const unsigned num_threads )
+{ /* ... */ }
+
+// Initialize a new ray (after a collision)
+inline void ModuleInterface<ConcentricSphereGeometry>::newRay()
+{ /* ... */ }
+
+// Check if the cell is a termination cell
+inline bool ModuleInterface<ConcentricSphereGeometry>::isTerminationCell(
+						const InternalCellHandle cell )
+{
+  return cell == s_geometry->getNumberOfSpheres() + 1u;
+}
+
+// Check that an external surface handle exists
+inline bool ModuleInterface<ConcentricSphereGeometry>::doesSurfaceExist(
+					       const ExternalSurfaceId surface )
+{
+  return surface > 0u && surface <= s_geometry->getNumberOfSpheres();
+}
+
+// Check that an external cell handle exists
+inline bool ModuleInterface<ConcentricSphereGeometry>::doesCellExist(
+						     const ExternalCellId cell )
+{
+  return cell > 0u && cell <= s_geometry->getNumberOfSpheres() + 1u;
+}
+
+// Get the internal surf. handle corresponding to the external surf. handle
+inline ModuleInterface<ConcentricSphereGeometry>::InternalSurfaceHandle
+ModuleInterface<ConcentricSphereGeometry>::getInternalSurfaceHandle(
+				 const ExternalSurfaceHandle surface_external )
+{
+  return surface_external;
+}
+
+// Get the internal cell handle corresponding to the external cell handle
+inline ModuleInterface<ConcentricSphereGeometry>::InternalCellHandle
+ModuleInterface<ConcentricSphereGeometry>::getInternalCellHandle(
+				       const ExternalCellHandle cell_external )
+{
+  return cell_external;
+}
+
+// Get the external surf. handle corresponding to the internal surf. handle
+inline ModuleInterface<ConcentricSphereGeometry>::ExternalSurfaceHandle
+ModuleInterface<ConcentricSphereGeometry>::getExternalSurfaceHandle(
+					  const InternalSurfaceHandle surface )
+{
+  return surface;
+}
+
+// Get the external cell handle corresponding to the internal cell handle
+inline ModuleInterface<ConcentricSphereGeometry>::ExternalCellHandle
+ModuleInterface<ConcentricSphereGeometry>::getExternalCellHandle(
+						const InternalCellHandle cell )
+{
+  return cell;
+}
+
+} // end Geometry namespace
+
+#endif // end FRENSIE_BENCH_SPHERE_GEOMETRY_HPP
+
+//---------------------------------------------------------------------------//
+// end frensieBenchSphereGeometry.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,519 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   frensie_bench.cpp
+//! \author Luke Kersting
+//! \brief  Main function for the transport micro-benchmark suite
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_FancyOStream.hpp>
+#include <Teuchos_VerboseObject.hpp>
+
+// FRENSIE Includes
+#include "frensieBenchHarness.hpp"
+#include "frensieBenchSphereGeometry.hpp"
+#include "MonteCarlo_ParticleSimulationManager.hpp"
+#include "MonteCarlo_SimulationGeneralProperties.hpp"
+#include "MonteCarlo_PhotonMaterial.hpp"
+#include "MonteCarlo_IncoherentPhotoatomicReaction.hpp"
+#include "MonteCarlo_VoidAtomicRelaxationModel.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_KleinNishinaPhotonScatteringDistribution.hpp"
+#include "MonteCarlo_CoupledCompleteDopplerBroadenedPhotonEnergyDistribution.hpp"
+#include "MonteCarlo_ComptonProfileSubshellConverterFactory.hpp"
+#include "MonteCarlo_ComptonProfileHelpers.hpp"
+#include "MonteCarlo_SubshellType.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_DiscreteDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_GlobalOpenMPSession.hpp"
+
+// The sink used to keep the benchmarked results from being optimized away
+volatile double bench_sink = 0.0;
+
+// The number of precomputed random values
+const unsigned random_values = 4096u;
+
+// Create a log spaced grid
+Teuchos::Array<double> createLogGrid( const double min_value,
+				      const double max_value,
+				      const unsigned size )
+{
+  Teuchos::Array<double> grid( size );
+
+  for( unsigned i = 0; i < size; ++i )
+    grid[i] = min_value*pow( max_value/min_value, i/(double)(size-1) );
+
+  grid.back() = max_value;
+
+  return grid;
+}
+
+// Sample log spaced random values
+Teuchos::Array<double> sampleLogValues( const double min_value,
+					const double max_value )
+{
+  Teuchos::Array<double> values( random_values );
+
+  for( unsigned i = 0; i < random_values; ++i )
+  {
+    values[i] = min_value*pow( max_value/min_value,
+	      Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+
+  return values;
+}
+
+// Add the grid search benchmarks
+void addGridSearchBenchmarks( BenchmarkHarness& harness )
+{
+  Teuchos::RCP<Teuchos::Array<double> > grid( new Teuchos::Array<double>(
+				        createLogGrid( 1e-11, 20.0, 100000 ) ) );
+
+  Teuchos::RCP<Utility::HashBasedGridSearcher> grid_searcher(
+	   new Utility::StandardHashBasedGridSearcher<Teuchos::Array<double> >(
+								    *grid,
+								    1000 ) );
+
+  Teuchos::RCP<Teuchos::Array<double> > values( new Teuchos::Array<double>(
+					    sampleLogValues( 1e-11, 20.0 ) ) );
+
+  harness.addBenchmark(
+		   "grid_search/binary_lower_bound",
+		   [=]( const unsigned long long iterations ){
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       bench_sink = *Utility::Search::binaryLowerBound(
+				   grid->begin(),
+				   grid->end(),
+				   (*values)[i%random_values] );
+		     }
+		   } );
+
+  harness.addBenchmark(
+		   "grid_search/standard_hash_based_grid_searcher",
+		   [=]( const unsigned long long iterations ){
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       bench_sink = grid_searcher->findLowerBinIndex(
+					        (*values)[i%random_values] );
+		     }
+		   } );
+}
+
+// Add the distribution sampling benchmarks
+void addDistributionBenchmarks( BenchmarkHarness& harness )
+{
+  Teuchos::Array<double> independent_values =
+    createLogGrid( 1e-3, 20.0, 1000 );
+
+  Teuchos::Array<double> dependent_values( independent_values.size() );
+
+  for( unsigned i = 0; i < independent_values.size(); ++i )
+    dependent_values[i] = exp( -independent_values[i] );
+
+  Teuchos::RCP<Utility::OneDDistribution> tabular_distribution(
+	    new Utility::TabularDistribution<Utility::LinLin>(
+							 independent_values,
+							 dependent_values ) );
+
+  Teuchos::RCP<Utility::OneDDistribution> discrete_distribution(
+	    new Utility::DiscreteDistribution( independent_values,
+					       dependent_values ) );
+
+  harness.addBenchmark(
+		   "distribution/tabular_lin_lin_sample",
+		   [=]( const unsigned long long iterations ){
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		       bench_sink = tabular_distribution->sample();
+		   } );
+
+  harness.addBenchmark(
+		   "distribution/discrete_sample",
+		   [=]( const unsigned long long iterations ){
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		       bench_sink = discrete_distribution->sample();
+		   } );
+}
+
+// Add the photon scattering benchmarks
+/*! \details A hydrogen-like Compton profile is used for the Doppler
+ * broadening benchmark.
+ */
+void addPhotonScatteringBenchmarks( BenchmarkHarness& harness )
+{
+  Teuchos::RCP<MonteCarlo::KleinNishinaPhotonScatteringDistribution>
+    klein_nishina_distribution(
+		  new MonteCarlo::KleinNishinaPhotonScatteringDistribution );
+
+  // Create the hydrogen-like Compton profile (atomic units)
+  Teuchos::Array<double> half_momentum_grid( 301 ), half_profile( 301 );
+
+  for( unsigned i = 0; i < half_momentum_grid.size(); ++i )
+  {
+    half_momentum_grid[i] = i*0.1;
+
+    half_profile[i] = 8.0/(3.0*M_PI)/
+      pow( 1.0 + half_momentum_grid[i]*half_momentum_grid[i], 3 );
+  }
+
+  Teuchos::Array<double> full_momentum_grid, full_profile;
+
+  MonteCarlo::createFullProfileFromHalfProfile( half_momentum_grid.begin(),
+						half_momentum_grid.end(),
+						half_profile.begin(),
+						half_profile.end(),
+						full_momentum_grid,
+						full_profile );
+
+  MonteCarlo::convertMomentumGridToMeCUnits( full_momentum_grid.begin(),
+					     full_momentum_grid.end() );
+
+  MonteCarlo::convertProfileToInverseMeCUnits( full_profile.begin(),
+					       full_profile.end() );
+
+  MonteCarlo::DopplerBroadenedPhotonEnergyDistribution::ElectronMomentumDistArray
+    compton_profiles( 1 );
+
+  compton_profiles[0].reset(
+	 new Utility::TabularDistribution<Utility::LinLin>( full_momentum_grid,
+							    full_profile ) );
+
+  Teuchos::RCP<MonteCarlo::ComptonProfileSubshellConverter> converter;
+
+  MonteCarlo::ComptonProfileSubshellConverterFactory::createConverter(
+								 converter, 1 );
+
+  Teuchos::Array<double> binding_energies( 1, 1.361e-5 );
+  Teuchos::Array<double> occupancies( 1, 1.0 );
+  Teuchos::Array<MonteCarlo::SubshellType>
+    subshell_order( 1, MonteCarlo::K_SUBSHELL );
+
+  Teuchos::RCP<MonteCarlo::DopplerBroadenedPhotonEnergyDistribution>
+    doppler_distribution(
+	   new MonteCarlo::CoupledCompleteDopplerBroadenedPhotonEnergyDistribution(
+							    binding_energies,
+							    occupancies,
+							    subshell_order,
+							    converter,
+							    compton_profiles ) );
+
+  harness.addBenchmark(
+		   "photon/klein_nishina_sample",
+		   [=]( const unsigned long long iterations ){
+		     double outgoing_energy, scattering_angle_cosine;
+
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       klein_nishina_distribution->sample(
+						     1.0,
+						     outgoing_energy,
+						     scattering_angle_cosine );
+
+		       bench_sink = outgoing_energy;
+		     }
+		   } );
+
+  harness.addBenchmark(
+		   "photon/doppler_broadened_energy_sample",
+		   [=]( const unsigned long long iterations ){
+		     double outgoing_energy;
+		     MonteCarlo::SubshellType shell_of_interaction;
+
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       doppler_distribution->sample( 0.1,
+						     0.5,
+						     outgoing_energy,
+						     shell_of_interaction );
+
+		       bench_sink = outgoing_energy;
+		     }
+		   } );
+}
+
+// Add the particle bank benchmarks
+void addParticleBankBenchmarks( BenchmarkHarness& harness )
+{
+  harness.addBenchmark(
+		   "particle_bank/push_pop",
+		   [=]( const unsigned long long iterations ){
+		     MonteCarlo::ParticleBank bank;
+
+		     MonteCarlo::PhotonState photon( 0ull );
+		     photon.setEnergy( 1.0 );
+
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       bank.push( photon );
+
+		       bench_sink = bank.top().getEnergy();
+
+		       bank.pop();
+		     }
+		   } );
+}
+
+// Add the estimator benchmarks
+void addEstimatorBenchmarks( BenchmarkHarness& harness )
+{
+  Teuchos::Array<MonteCarlo::StandardCellEstimator::cellIdType>
+    cell_ids( 1, 0 );
+  Teuchos::Array<double> cell_norm_consts( 1, 1.0 );
+
+  Teuchos::RCP<MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> > estimator(
+    new MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>(
+							      0u,
+							      1.0,
+							      cell_ids,
+							      cell_norm_consts ) );
+
+  Teuchos::Array<double> energy_bin_boundaries =
+    createLogGrid( 1e-3, 20.0, 101 );
+
+  estimator->setBinBoundaries<MonteCarlo::ENERGY_DIMENSION>(
+						       energy_bin_boundaries );
+
+  Teuchos::Array<MonteCarlo::ParticleType> particle_types( 1 );
+  particle_types[0] = MonteCarlo::PHOTON;
+
+  estimator->setParticleTypes( particle_types );
+
+  Teuchos::RCP<Teuchos::Array<double> > energies( new Teuchos::Array<double>(
+					      sampleLogValues( 1e-3, 20.0 ) ) );
+
+  harness.addBenchmark(
+		   "estimator/commit_history_contribution",
+		   [=]( const unsigned long long iterations ){
+		     MonteCarlo::PhotonState photon( 0ull );
+		     photon.setWeight( 1.0 );
+
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       photon.setEnergy( (*energies)[i%random_values] );
+
+		       estimator->updateFromParticleSubtrackEndingInCellEvent(
+								photon, 0, 1.0 );
+
+		       estimator->commitHistoryContribution();
+		     }
+		   } );
+}
+
+// Add the simulation benchmark
+/*! \details The photons are born at the origin of a bundled concentric
+ * sphere geometry with an isotropic direction and an energy of 1 MeV. The
+ * spheres are filled with an analytic hydrogen material (Klein-Nishina
+ * scattering only) so that no external geometry or data files are required.
+ * There are no estimators. Every iteration simulates one history.
+ */
+void addSimulationBenchmark( BenchmarkHarness& harness )
+{
+  typedef MonteCarlo::ParticleSimulationManager<ConcentricSphereGeometry,
+						MonteCarlo::ParticleSource,
+						MonteCarlo::EstimatorHandler,
+						MonteCarlo::CollisionHandler>
+    BenchmarkSimulationManager;
+
+  // Create the geometry (the inner sphere and shell contain the material)
+  Teuchos::Array<double> radii( 2 );
+  radii[0] = 5.0;
+  radii[1] = 10.0;
+
+  Geometry::ModuleInterface<ConcentricSphereGeometry>::setHandlerInstance(
+		      Teuchos::rcp( new ConcentricSphereGeometry( radii ) ) );
+
+  // Create the analytic incoherent cross section
+  Teuchos::Array<double> energy_grid_values = createLogGrid( 1e-4, 20.0, 1000 );
+
+  Teuchos::RCP<MonteCarlo::KleinNishinaPhotonScatteringDistribution>
+    klein_nishina_distribution(
+		  new MonteCarlo::KleinNishinaPhotonScatteringDistribution );
+
+  Teuchos::ArrayRCP<double> energy_grid, incoherent_cross_section;
+  energy_grid.assign( energy_grid_values.begin(), energy_grid_values.end() );
+  incoherent_cross_section.resize( energy_grid.size() );
+
+  for( unsigned i = 0; i < energy_grid.size(); ++i )
+  {
+    incoherent_cross_section[i] =
+      klein_nishina_distribution->evaluateIntegratedCrossSection(
+							  energy_grid[i],
+							  1e-6 );
+  }
+
+  Teuchos::RCP<Utility::HashBasedGridSearcher> grid_searcher(
+	new Utility::StandardHashBasedGridSearcher<Teuchos::ArrayRCP<const double>,false>(
+					     energy_grid,
+					     energy_grid[0],
+					     energy_grid[energy_grid.size()-1],
+					     1000 ) );
+
+  Teuchos::RCP<MonteCarlo::PhotoatomicReaction> incoherent_reaction(
+	new MonteCarlo::IncoherentPhotoatomicReaction<Utility::LogLog,false>(
+					       energy_grid,
+					       incoherent_cross_section,
+					       0u,
+					       klein_nishina_distribution ) );
+
+  MonteCarlo::Photoatom::ReactionMap scattering_reactions,
+    absorption_reactions;
+
+  scattering_reactions[incoherent_reaction->getReactionType()] =
+    incoherent_reaction;
+
+  Teuchos::RCP<MonteCarlo::AtomicRelaxationModel> relaxation_model(
+				   new MonteCarlo::VoidAtomicRelaxationModel );
+
+  // Create the analytic material (1 g/cm^3)
+  MonteCarlo::PhotonMaterial::PhotoatomNameMap photoatom_name_map;
+
+  photoatom_name_map["H-KleinNishina"].reset(
+	   new MonteCarlo::Photoatom( "H-KleinNishina",
+				      1u,
+				      1.00794,
+				      energy_grid,
+				      grid_searcher,
+				      scattering_reactions,
+				      absorption_reactions,
+				      relaxation_model,
+				      false,
+				      Utility::LogLog() ) );
+
+  Teuchos::RCP<MonteCarlo::PhotonMaterial> material(
+	     new MonteCarlo::PhotonMaterial(
+			      1u,
+			      -1.0,
+			      photoatom_name_map,
+			      Teuchos::Array<double>( 1, 1.0 ),
+			      Teuchos::Array<std::string>( 1, "H-KleinNishina" ) ) );
+
+  Teuchos::Array<Geometry::ModuleTraits::InternalCellHandle> cells( 2 );
+  cells[0] = 1;
+  cells[1] = 2;
+
+  MonteCarlo::CollisionHandler::addMaterial( material, cells );
+
+  // Create the simulation manager
+  MonteCarlo::SimulationGeneralProperties::setParticleMode(
+						     MonteCarlo::PHOTON_MODE );
+
+  Teuchos::RCP<const BenchmarkSimulationManager> manager(
+				      new BenchmarkSimulationManager( 1ull ) );
+
+  harness.addBenchmark(
+		   "simulation/simulate_particle",
+		   [=]( const unsigned long long iterations ){
+		     MonteCarlo::ParticleBank bank;
+
+		     for( unsigned long long i = 0; i < iterations; ++i )
+		     {
+		       // Sample the source photon
+		       MonteCarlo::PhotonState photon( i );
+
+		       const double mu = 2.0*
+			 Utility::RandomNumberGenerator::getRandomNumber<double>() - 1.0;
+		       const double phi = 2.0*M_PI*
+			 Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+		       photon.setPosition( 0.0, 0.0, 0.0 );
+		       photon.setDirection( sqrt( 1.0 - mu*mu )*cos( phi ),
+					    sqrt( 1.0 - mu*mu )*sin( phi ),
+					    mu );
+		       photon.setEnergy( 1.0 );
+		       photon.setWeight( 1.0 );
+		       photon.setCell(
+			   Geometry::ModuleInterface<ConcentricSphereGeometry>::findCellContainingPoint( photon.ray() ) );
+
+		       manager->simulateParticle( photon, bank );
+
+		       // Simulate the secondary photons
+		       while( bank.size() > 0 )
+		       {
+			 manager->simulateParticle(
+			      dynamic_cast<MonteCarlo::PhotonState&>( bank.top() ),
+			      bank );
+
+			 bank.pop();
+		       }
+
+		       bench_sink = photon.getEnergy();
+		     }
+		   } );
+}
+
+// Main benchmark function
+int main( int argc, char** argv )
+{
+  Teuchos::RCP<Teuchos::FancyOStream> out =
+    Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  std::string json_output_file = "frensie_bench.json";
+  std::string filter;
+  double min_time = 0.5;
+
+  // Set up the command line options
+  Teuchos::CommandLineProcessor bench_clp;
+
+  bench_clp.setDocString( "Transport micro-benchmark suite\n" );
+  bench_clp.setOption( "json_output",
+		       &json_output_file,
+		       "Name of JSON file where the results will be written" );
+  bench_clp.setOption( "filter",
+		       &filter,
+		       "Only run the benchmarks that contain this string" );
+  bench_clp.setOption( "min_time",
+		       &min_time,
+		       "Minimum run time of every benchmark (s)" );
+
+  bench_clp.throwExceptions( false );
+
+  // Parse the command line
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn
+    parse_return = bench_clp.parse( argc, argv );
+
+  if( parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL )
+  {
+    bench_clp.printHelpMessage( argv[0], *out );
+
+    return parse_return;
+  }
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  Utility::RandomNumberGenerator::initialize();
+
+  // Set up the benchmarks
+  BenchmarkHarness harness( min_time, filter );
+
+  addGridSearchBenchmarks( harness );
+  addDistributionBenchmarks( harness );
+  addPhotonScatteringBenchmarks( harness );
+  addParticleBankBenchmarks( harness );
+  addEstimatorBenchmarks( harness );
+  addSimulationBenchmark( harness );
+
+  // Run the benchmarks
+  harness.runBenchmarks( *out );
+
+  harness.exportResults( json_output_file );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end frensie_bench.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   xs_lookup_timer.cpp
+//! \author Luke Kersting
+//! \brief  Main function for timing the scalar and batched cross section
+//!         lookups
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <time.h>
+
+// Trilinos Includes
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayRCP.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhotoelectricPhotoatomicReaction.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+
+// Time macro
+#define TIME() (clock()/((double)CLOCKS_PER_SEC))
+
+// Lookup timing function
+void timeLookups( const MonteCarlo::PhotoatomicReaction& reaction,
+		  const Teuchos::Array<double>& energies,
+		  const int trials )
+{
+  Teuchos::Array<double> scalar_cross_sections( energies.size() );
+  Teuchos::Array<double> batch_cross_sections( energies.size() );
+  
+  double time1 = TIME();
+
+  // Scalar lookup timing
+  for( int i = 0; i < trials; ++i )
+  {
+    for( unsigned j = 0; j < energies.size(); ++j )
+      scalar_cross_sections[j] = reaction.getCrossSection( energies[j] );
+  }
+
+  double time2 = TIME();
+
+  // Batched lookup timing
+  for( int i = 0; i < trials; ++i )
+    reaction.getCrossSections( energies(), batch_cross_sections() );
+
+  double time3 = TIME();
+
+  // Compare the cross sections
+  double max_relative_diff = 0.0;
+
+  for( unsigned j = 0; j < energies.size(); ++j )
+  {
+    double relative_diff = 
+      fabs( scalar_cross_sections[j] - batch_cross_sections[j] );
+
+    if( scalar_cross_sections[j] > 0.0 )
+      relative_diff /= scalar_cross_sections[j];
+
+    max_relative_diff = std::max( max_relative_diff, relative_diff );
+  }
+  
+  // Check for valid time intervals
+  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 )
+  {
+    std::cerr << "Timing information not accurate enough for this batch size."
+	      << std::endl;
+  }
+  else
+  {
+    // Calculate the lookup speed (Millions/sec)
+    double mlps_scalar = trials*energies.size()/(time2-time1)/1e6;
+    double mlps_batch = trials*energies.size()/(time3-time2)/1e6;
+
+    std::cout << "Batch size: " << energies.size() << std::endl
+	      << "Max relative difference: " << max_relative_diff 
+	      << std::endl
+	      << "User + System time information (NOTE: MLPS = Million "
+	      << "Lookups Per Second)\n" << std::endl
+	      << "  Scalar lookup:\tTime = " << time2-time1 
+	      << " seconds " << "=> " << mlps_scalar << " MLPS"
+	      << std::endl
+	      << "  Batched lookup:\tTime = " << time3-time2
+	      << " seconds " << "=> " << mlps_batch << " MLPS"
+	      << std::endl
+	      << "  Speedup:\t\t" << mlps_batch/mlps_scalar 
+	      << std::endl << std::endl;
+  }
+}
+
+// Main timing function
+int main()
+{
+  Utility::RandomNumberGenerator::createStreams();
+  
+  Utility::RandomNumberGenerator::initialize();
+
+  // Create a log spaced energy grid with a 1/E^3 cross section
+  const unsigned grid_size = 20000;
+  const double min_energy = 1e-3;
+  const double max_energy = 20.0;
+  
+  Teuchos::ArrayRCP<double> energy_grid( grid_size );
+  Teuchos::ArrayRCP<double> cross_section( grid_size );
+
+  for( unsigned i = 0; i < grid_size; ++i )
+  {
+    energy_grid[i] = min_energy*
+      pow( max_energy/min_energy, i/(double)(grid_size-1) );
+
+    cross_section[i] = 1.0/(energy_grid[i]*energy_grid[i]*energy_grid[i]);
+  }
+
+  energy_grid[grid_size-1] = max_energy;
+
+  MonteCarlo::PhotoelectricPhotoatomicReaction<Utility::LogLog,false>
+    reaction( energy_grid, cross_section, 0u );
+
+  const int total_lookups = 10000000;
+
+  for( unsigned batch_size = 10; batch_size <= 100000; batch_size *= 10 )
+  {
+    // Sample the energies (sorted, as they are in an event bank)
+    Teuchos::Array<double> energies( batch_size );
+
+    for( unsigned i = 0; i < batch_size; ++i )
+    {
+      energies[i] = min_energy*pow( max_energy/min_energy, 
+	  Utility::RandomNumberGenerator::getRandomNumber<double>() );
+    }
+
+    std::sort( energies.begin(), energies.end() );
+
+    std::cout << "Timing lookups for batch size " << batch_size << std::endl;
+    timeLookups( reaction, energies, total_lookups/batch_size );
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end xs_lookup_timer.cpp
+//---------------------------------------------------------------------------//